@@ -0,0 +1,341 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Corpus Options                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief the shape of a generated corpus
+ */
+struct CorpusOptions {
+    //Functions are generated until the corpus reaches this many bytes
+    size_t targetBytes = 1 << 20;
+
+    //How deep `if`, `while` and `for` blocks nest inside a function body
+    uint32_t maxDepth = 4;
+
+    //The most operands in one expression, parenthesized groups and call arguments included
+    uint32_t expressionTerms = 6;
+
+    //Out of 1000, how many names, string literals and comments are spelled with non ASCII characters, which
+    //never changes the shape of the corpus, only its spelling
+    uint32_t unicodePerMille = 100;
+
+    uint64_t seed = 1;
+};
+
+/*======================================================================================================*/
+/*                                         Corpus Random                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief a splitmix64 stream, which is tiny, fast and identical everywhere unlike the standard distributions
+ * @note decisions are drawn with integer math only, so the same seed makes the same corpus byte for byte
+ * on every platform, compiler and commit
+ */
+class CorpusRandom {
+public:
+    explicit CorpusRandom(uint64_t seed) noexcept : state(seed) {}
+
+    uint64_t next() noexcept {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief draws a number in `[0, bound)`, where the tiny bias of a plain modulo doesn't matter here
+     */
+    uint32_t below(uint32_t bound) noexcept {
+        return (bound == 0) ? 0 : static_cast<uint32_t>(next() % bound);
+    }
+
+    /**
+     * @brief draws true `perMille` times out of 1000
+     */
+    bool chance(uint32_t perMille) noexcept {
+        return below(1000) < perMille;
+    }
+
+    template <typename T, size_t N>
+    const T& pick(const T (&from)[N]) noexcept {
+        return from[below(N)];
+    }
+
+private:
+    uint64_t state;
+};
+
+/*======================================================================================================*/
+/*                                        Corpus Generator                                              */
+/*======================================================================================================*/
+
+/**
+ * @brief writes a synthetic script of functions, for benchmarking the front end on inputs of any size and shape
+ * @details functions only call functions declared before them, with the right number of arguments, and
+ * statements only name variables still in scope, so every name resolves. Types are drawn at random, so
+ * the corpus is meant for the tokenizer and parser, and mostly fails type checking past them
+ */
+class CorpusGenerator {
+public:
+    explicit CorpusGenerator(const CorpusOptions& options) : options(options), random(options.seed) {}
+
+    std::string generate() {
+        out.clear();
+        out.reserve(options.targetBytes + 4096);
+        functions.clear();
+        while (out.size() < options.targetBytes) {
+            function();
+        }
+        return std::move(out);
+    }
+
+private:
+    struct Declared {
+        std::string name;
+        uint32_t arity;
+    };
+
+    static constexpr const char* asciiSyllables[] = {
+        "ka", "lo", "mi", "ra", "sen", "tor", "vi", "pex", "qu", "zan", "dor", "fel", "gri", "hum", "jo", "bel"
+    };
+
+    //Precomposed and outside of ASCII, spread over 2 and 3 byte utf8, and all valid identifier characters
+    static constexpr const char* unicodeSyllables[] = {
+        "α", "βη", "γλ", "δέ", "λύ", "πρ", "ση", "ωμ", "дом", "ки", "лё", "жу", "数", "据", "変", "値", "é", "ñu", "øl", "ßa"
+    };
+
+    //String literals and comments can hold anything, including 4 byte utf8
+    static constexpr const char* unicodeWords[] = {
+        "héllo", "wörld", "日本語", "данные", "λόγος", "🚀", "✓", "naïve", "😀", "𝔘𝔫𝔦"
+    };
+
+    static constexpr const char* asciiWords[] = {
+        "alpha", "beta", "gamma", "delta", "value", "result", "total", "count", "index", "buffer"
+    };
+
+    static constexpr const char* typeNames[] = {"int", "float", "str", "bool", "val"};
+    static constexpr const char* binaryOps[] = {"+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==", "!="};
+    static constexpr const char* assignOps[] = {"=", "+=", "-=", "*="};
+
+    const CorpusOptions options;
+    CorpusRandom random;
+    std::string out;
+    std::vector<Declared> functions;
+    std::vector<std::string> locals;
+    uint32_t nameCount = 0;
+
+    void indent(uint32_t depth) {
+        out.append((depth + 1) * 4, ' ');
+    }
+
+    /**
+     * @brief makes a fresh name, suffixed with a counter so every name is unique
+     */
+    std::string name() {
+        const bool unicode = random.chance(options.unicodePerMille);
+        std::string made;
+        const uint32_t syllables = 1 + random.below(3);
+        for (uint32_t i = 0; i < syllables; i++) {
+            made += unicode ? random.pick(unicodeSyllables) : random.pick(asciiSyllables);
+        }
+        return made + std::to_string(nameCount++);
+    }
+
+    void words(uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            out += (i == 0) ? "" : " ";
+            out += random.chance(options.unicodePerMille) ? random.pick(unicodeWords) : random.pick(asciiWords);
+        }
+    }
+
+    void literal() {
+        switch (random.below(4)) {
+            case 0: {
+                out += std::to_string(random.below(100000));
+                break;
+            }
+            case 1: {
+                out += std::to_string(random.below(1000)) + "." + std::to_string(random.below(100));
+                break;
+            }
+            case 2: {
+                out += '"';
+                words(1 + random.below(4));
+                out += '"';
+                break;
+            }
+            default: {
+                out += std::to_string(random.below(10));
+                break;
+            }
+        }
+    }
+
+    void operand(uint32_t& budget) {
+        budget--;
+        const uint32_t roll = random.below(10);
+        if ((roll < 2) && (budget >= 2)) {
+            out += '(';
+            expression(budget);
+            out += ')';
+        } else if ((roll < 3) && !functions.empty()) {
+            const Declared& callee = functions[random.below(static_cast<uint32_t>(functions.size()))];
+            out += callee.name + "(";
+            for (uint32_t i = 0; i < callee.arity; i++) {
+                out += (i == 0) ? "" : ", ";
+                if (budget > 1) {
+                    expression(budget);
+                } else {
+                    literal();
+                }
+            }
+            out += ')';
+        } else if ((roll < 7) && !locals.empty()) {
+            if (random.chance(100)) {
+                out += '-';
+            }
+            out += locals[random.below(static_cast<uint32_t>(locals.size()))];
+        } else {
+            literal();
+        }
+    }
+
+    /**
+     * @brief writes operands joined by binary operators, spending `budget` terms across it and anything nested
+     */
+    void expression(uint32_t& budget) {
+        const uint32_t terms = 1 + random.below(std::max<uint32_t>(budget, 1));
+        for (uint32_t i = 0; (i < terms) && (budget > 0); i++) {
+            if (i != 0) {
+                out += ' ';
+                out += random.pick(binaryOps);
+                out += ' ';
+            }
+            operand(budget);
+        }
+    }
+
+    void expression() {
+        uint32_t budget = std::max<uint32_t>(options.expressionTerms, 1);
+        expression(budget);
+    }
+
+    void statement(uint32_t depth) {
+        const uint32_t roll = random.below(20);
+        const bool canNest = depth < options.maxDepth;
+        indent(depth);
+        if (roll < 5) {
+            const std::string declared = name();
+            out += "let " + std::string(random.pick(typeNames)) + " " + declared + " = ";
+            expression();
+            out += ";\n";
+            locals.push_back(declared);
+        } else if ((roll < 9) && !locals.empty()) {
+            out += locals[random.below(static_cast<uint32_t>(locals.size()))] + " " + random.pick(assignOps) + " ";
+            expression();
+            out += ";\n";
+        } else if ((roll < 12) && canNest) {
+            out += "if ";
+            expression();
+            out += " then\n";
+            block(depth + 1);
+            while (random.chance(300)) {
+                indent(depth);
+                out += "elif ";
+                expression();
+                out += " then\n";
+                block(depth + 1);
+            }
+            if (random.chance(400)) {
+                indent(depth);
+                out += "else\n";
+                block(depth + 1);
+            }
+            indent(depth);
+            out += "end\n";
+        } else if ((roll < 14) && canNest) {
+            out += "while ";
+            expression();
+            out += " do\n";
+            block(depth + 1);
+            indent(depth);
+            out += "end\n";
+        } else if ((roll < 16) && canNest) {
+            const std::string counter = name();
+            out += "for let int " + counter + " = 0; " + counter + " < " + std::to_string(1 + random.below(100)) + "; " + counter + "++; do\n";
+            locals.push_back(counter);
+            block(depth + 1);
+            locals.pop_back();
+            indent(depth);
+            out += "end\n";
+        } else if (roll < 18) {
+            out += "# ";
+            words(2 + random.below(8));
+            out += " #\n";
+        } else {
+            expression();
+            out += ";\n";
+        }
+    }
+
+    void block(uint32_t depth) {
+        //Names declared inside a block go out of scope with it
+        const size_t outer = locals.size();
+        const uint32_t count = 1 + random.below(4);
+        for (uint32_t i = 0; i < count; i++) {
+            statement(depth);
+        }
+        locals.resize(outer);
+    }
+
+    void function() {
+        const Declared declared{.name = name(), .arity = random.below(4)};
+        locals.clear();
+        out += "func " + declared.name + "(";
+        for (uint32_t i = 0; i < declared.arity; i++) {
+            const std::string param = name();
+            out += (i == 0) ? "" : ", ";
+            out += std::string(random.pick(typeNames)) + " " + param;
+            locals.push_back(param);
+        }
+        out += ") returns val\n";
+
+        const uint32_t statements = 2 + random.below(8);
+        for (uint32_t i = 0; i < statements; i++) {
+            statement(0);
+        }
+        indent(0);
+        out += "return ";
+        expression();
+        out += ";\nend\n\n";
+        functions.push_back(declared);
+    }
+};
+
+/**
+ * @brief generates the corpus for a set of options
+ */
+inline std::string generateCorpus(const CorpusOptions& options) {
+    return CorpusGenerator(options).generate();
+}
+
+} //end namespace fl
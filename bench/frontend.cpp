@@ -0,0 +1,245 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "corpus.hpp"
+#include "instrument.hpp"
+#include "parser.hpp"
+#include "tokenizer.hpp"
+#include "utf8string.hpp"
+
+/**
+ * @brief measures each stage of the front end on its own, over a generated corpus
+ * @details usage: `frontend [--bytes N] [--depth N] [--terms N] [--unicode N] [--seed N] [--iterations N]
+ * [--json PATH] [--emit PATH]`, where `--unicode` is out of 1000, `--emit` writes the corpus out and exits,
+ * and `--json` writes the results somewhere they can be compared against another commit. Every stage
+ * reports its median time, throughput, and the allocations made by its first run, along with the
+ * peak resident set size of the process once it has finished
+ * @note allocations are read back from the hook in instrument.cpp, so they are only counted in builds
+ * with `FL_INSTRUMENTATION`, and read as zero in every other build
+ */
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Phases                                                    */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief what one stage of the front end cost
+ */
+struct PhaseResult {
+    const char* name = "";
+    std::vector<double> seconds = {};
+    uint64_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+
+    //Only the stages that see tokens report a token rate
+    bool countsTokens = false;
+
+    double median() const {
+        std::vector<double> sorted = seconds;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+};
+
+/**
+ * @brief the largest the resident set has ever been, in kilobytes
+ */
+long peakRssKb() {
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * @brief runs `body` once, timing it and counting the allocations it made on the first iteration
+ */
+template <typename Body>
+void measure(PhaseResult& phase, size_t iteration, Body&& body) {
+    const AllocationTotals before = allocationTotals();
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    phase.seconds.push_back(elapsed.count());
+    if (iteration == 0) {
+        const AllocationTotals after = allocationTotals();
+        phase.allocations = after.allocations - before.allocations;
+        phase.allocatedBytes = after.allocatedBytes - before.allocatedBytes;
+    }
+}
+
+/**
+ * @brief a 64 bit FNV-1a over the corpus, so results are only ever compared over the same input
+ */
+uint64_t fingerprint(const std::string& text) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (unsigned char c : text) {
+        hash = (hash ^ c) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+bool readArg(int argc, char** argv, int& i, const char* flag, uint64_t& out) {
+    if ((std::string(argv[i]) != flag) || ((i + 1) >= argc)) {
+        return false;
+    }
+    out = std::strtoull(argv[++i], nullptr, 10);
+    return true;
+}
+
+} //end anonymous namespace
+
+int main(int argc, char** argv) {
+    setInstrumentationEnabled(true);
+    CorpusOptions options;
+    uint64_t iterations = 10;
+    std::string jsonPath;
+    std::string emitPath;
+    for (int i = 1; i < argc; i++) {
+        uint64_t value = 0;
+        if (readArg(argc, argv, i, "--bytes", value)) {
+            options.targetBytes = value;
+        } else if (readArg(argc, argv, i, "--depth", value)) {
+            options.maxDepth = static_cast<uint32_t>(value);
+        } else if (readArg(argc, argv, i, "--terms", value)) {
+            options.expressionTerms = static_cast<uint32_t>(value);
+        } else if (readArg(argc, argv, i, "--unicode", value)) {
+            options.unicodePerMille = static_cast<uint32_t>(std::min<uint64_t>(value, 1000));
+        } else if (readArg(argc, argv, i, "--seed", value)) {
+            options.seed = value;
+        } else if (readArg(argc, argv, i, "--iterations", value)) {
+            iterations = std::max<uint64_t>(value, 1);
+        } else if ((std::string(argv[i]) == "--json") && ((i + 1) < argc)) {
+            jsonPath = argv[++i];
+        } else if ((std::string(argv[i]) == "--emit") && ((i + 1) < argc)) {
+            emitPath = argv[++i];
+        } else {
+            std::cout << "Unknown argument `" << argv[i] << "`" << std::endl;
+            return 1;
+        }
+    }
+
+    const std::string corpus = generateCorpus(options);
+    if (!emitPath.empty()) {
+        std::ofstream(emitPath, std::ios::binary) << corpus;
+        return 0;
+    }
+
+    //`fromFile` reads from disk, so the corpus is written somewhere it can be read back from
+    const std::filesystem::path corpusPath = std::filesystem::temp_directory_path() / "flow_frontend_corpus.fl";
+    std::ofstream(corpusPath, std::ios::binary) << corpus;
+    const std::string corpusPathText = corpusPath.string();
+
+    PhaseResult read{.name = "fromFile"};
+    PhaseResult decode{.name = "expandUtf8"};
+    PhaseResult lex{.name = "tokenize", .countsTokens = true};
+    PhaseResult parse{.name = "parse", .countsTokens = true};
+    size_t charCount = 0;
+    size_t tokenCount = 0;
+    size_t lineCount = 0;
+
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        Utf8String fromDisk;
+        measure(read, iteration, [&]() { fromDisk = Utf8String::fromFile(corpusPathText.c_str()); });
+
+        //Decoding on its own, without the file read in front of it
+        Utf8String text;
+        measure(decode, iteration, [&]() { text = Utf8String(corpus.data(), corpus.size()); });
+
+        SymbolTable symbols;
+        DiagnosticBuffer diagnostics;
+        std::vector<Token> tokens;
+        measure(lex, iteration, [&]() { tokens = tokenize(text, symbols, diagnostics); });
+        if (!diagnostics.isEmpty()) {
+            std::cout << "The corpus failed to tokenize: " << WithSymbols{*diagnostics.begin(), symbols} << std::endl;
+            return 1;
+        }
+
+        FlowParser parser;
+        bool parsed = false;
+        measure(parse, iteration, [&]() { parsed = parser.parse(tokens).isOk(); });
+        if (!parsed) {
+            std::cout << "The corpus failed to parse: " << WithSymbols{parser.getDiagnostics()[0], symbols} << std::endl;
+            return 1;
+        }
+
+        charCount = text.getCharCount();
+        tokenCount = tokens.size();
+        lineCount = tokens.empty() ? 0 : tokens.back().lineCount;
+    }
+    std::filesystem::remove(corpusPath);
+
+    const double megabytes = static_cast<double>(corpus.size()) / 1e6;
+    const std::vector<const PhaseResult*> phases = {&read, &decode, &lex, &parse};
+    std::cout << "corpus: " << corpus.size() << " bytes, " << charCount << " chars, " << lineCount << " lines, " << tokenCount << " tokens" << std::endl;
+    std::cout << "phase       median ms   MB/s      Mtokens/s  allocations  allocated bytes" << std::endl;
+    for (const PhaseResult* phase : phases) {
+        const double seconds = phase->median();
+        std::cout << std::left << std::fixed << std::setw(12) << phase->name << std::setw(12) << std::setprecision(3) << (seconds * 1e3)
+                  << std::setw(10) << std::setprecision(1) << (megabytes / seconds) << std::setw(11) << std::setprecision(2)
+                  << (phase->countsTokens ? (static_cast<double>(tokenCount) / seconds / 1e6) : 0.0)
+                  << std::setw(13) << phase->allocations << phase->allocatedBytes << std::endl;
+    }
+    std::cout << "peak rss: " << peakRssKb() << " KB" << std::endl;
+    if (instrumentationBuilt) {
+        std::cout << "\nevery stage, over every iteration:\n" << collectInstrumentation();
+    } else {
+        std::cout << "allocations are only counted in builds with FL_INSTRUMENTATION" << std::endl;
+    }
+
+    if (jsonPath.empty()) {
+        return 0;
+    }
+    //Keys never change order, so two result files diff line by line
+    std::ofstream json(jsonPath);
+    json << std::setprecision(9);
+    json << "{\n";
+    json << "  \"benchmark\": \"frontend\",\n";
+    json << "  \"corpus\": {\n";
+    json << "    \"target_bytes\": " << options.targetBytes << ",\n";
+    json << "    \"max_depth\": " << options.maxDepth << ",\n";
+    json << "    \"expression_terms\": " << options.expressionTerms << ",\n";
+    json << "    \"unicode_per_mille\": " << options.unicodePerMille << ",\n";
+    json << "    \"seed\": " << options.seed << ",\n";
+    json << "    \"fingerprint\": \"" << std::hex << fingerprint(corpus) << std::dec << "\",\n";
+    json << "    \"bytes\": " << corpus.size() << ",\n";
+    json << "    \"chars\": " << charCount << ",\n";
+    json << "    \"lines\": " << lineCount << ",\n";
+    json << "    \"tokens\": " << tokenCount << "\n";
+    json << "  },\n";
+    json << "  \"iterations\": " << iterations << ",\n";
+    json << "  \"phases\": [\n";
+    for (size_t i = 0; i < phases.size(); i++) {
+        const PhaseResult& phase = *phases[i];
+        const double seconds = phase.median();
+        json << "    {\"name\": \"" << phase.name << "\", \"median_seconds\": " << seconds
+             << ", \"mb_per_second\": " << (megabytes / seconds)
+             << ", \"tokens_per_second\": " << (phase.countsTokens ? (static_cast<double>(tokenCount) / seconds) : 0.0)
+             << ", \"allocations\": " << phase.allocations << ", \"allocated_bytes\": " << phase.allocatedBytes << "}"
+             << (((i + 1) < phases.size()) ? ",\n" : "\n");
+    }
+    json << "  ],\n";
+    json << "  \"peak_rss_kb\": " << peakRssKb() << "\n";
+    json << "}\n";
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "embed.hpp"
+
+/**
+ * @brief runs N isolates on N threads over one shared module, and reports how throughput scales with N
+ * @details usage: `isolate_scaling [max isolates] [calls per isolate]`, where the isolate count doubles
+ * from 1 up to the maximum, which defaults to the number of hardware threads
+ */
+
+using namespace fl;
+
+namespace {
+
+const Utf8String benchSource =
+    "func fib(int n) returns int\n"
+    "    if n < 2 then\n"
+    "        return n;\n"
+    "    end\n"
+    "    return fib(n - 1) + fib(n - 2);\n"
+    "end\n"
+    "func work(int n) returns int\n"
+    "    let int total = 0;\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        total = total + fib(15);\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n"_utf8;
+
+constexpr int64_t workPerCall = 4;
+
+/**
+ * @brief runs one isolate, making `calls` calls into the shared module
+ * @returns false if any call failed or gave the wrong answer
+ */
+bool runIsolate(const std::shared_ptr<const Module>& shared, size_t calls) {
+    Engine engine;
+    engine.load(shared);
+    auto work = engine.find<int64_t(int64_t)>("work"_utf8);
+    if (!work.has_value()) {
+        return false;
+    }
+    for (size_t i = 0; i < calls; i++) {
+        auto result = engine.call(*work, workPerCall);
+        if (!result.isOk() || (result.okValue() != workPerCall * 610)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} //end anonymous namespace
+
+int main(int argc, char** argv) {
+    const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const size_t maxIsolates = (argc > 1) ? std::max(1l, std::atol(argv[1])) : hardware;
+    const size_t calls = (argc > 2) ? std::max(1l, std::atol(argv[2])) : 2000;
+
+    //Compiled once, every isolate after this only reads the module
+    Engine compiler;
+    auto loadError = compiler.loadSource(benchSource);
+    if (loadError) {
+        std::cout << "Failed to load the benchmark script:\n" << *loadError << std::endl;
+        return 1;
+    }
+    const std::shared_ptr<const Module>& shared = compiler.getModule();
+
+    std::cout << "isolates  calls/sec        speedup  efficiency" << std::endl;
+    double baseline = 0.0;
+    std::vector<size_t> counts;
+    for (size_t isolates = 1; isolates < maxIsolates; isolates *= 2) {
+        counts.push_back(isolates);
+    }
+    counts.push_back(maxIsolates);
+
+    for (size_t isolates : counts) {
+        std::vector<char> passed(isolates, 0);
+        std::vector<std::thread> threads;
+        threads.reserve(isolates);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < isolates; i++) {
+            threads.emplace_back([&shared, &passed, calls, i]() { passed[i] = runIsolate(shared, calls); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (std::find(passed.begin(), passed.end(), 0) != passed.end()) {
+            std::cout << "An isolate failed while running " << isolates << " at once!" << std::endl;
+            return 1;
+        }
+        const double throughput = static_cast<double>(isolates * calls) / elapsed.count();
+        if (isolates == 1) {
+            baseline = throughput;
+        }
+        const double speedup = throughput / baseline;
+        std::cout << std::left << std::setw(10) << isolates << std::setw(17) << std::fixed << std::setprecision(0) << throughput
+                  << std::setw(9) << std::setprecision(2) << speedup << std::setprecision(0) << (100.0 * speedup / isolates) << "%" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include <algorithm>
+#include <ctime>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "embed.hpp"
+#include "profiler.hpp"
+#include "vm.hpp"
+
+/**
+ * @brief measures what sampling costs a call and loop heavy script, against the same script with no profiler
+ * @details usage: `profiler_overhead [--runs N] [--work N] [--interval US] [--limit PERCENT]`. Each run calls
+ * `work(N)` on a fresh VM, timed in thread cpu time, with profiled and unprofiled runs interleaved, and the order flipped every round,
+ * so drift in clock speed or cache state lands on both sides evenly. Each round compares its two runs, which
+ * ran back to back under the same conditions, and the overhead is the median of those per round deltas,
+ * reported with its interquartile range so the noise is visible next to it. The benchmark exits with 1
+ * when the overhead is over `--limit`, which is 2% by default
+ */
+
+using namespace fl;
+
+namespace {
+
+//Recursion keeps calls hot, while the inner loop runs a backward jump for every few instructions
+const Utf8String benchSource =
+    "func fib(int n) returns int\n"
+    "    if n < 2 then\n"
+    "        return n;\n"
+    "    end\n"
+    "    return fib(n - 1) + fib(n - 2);\n"
+    "end\n"
+    "func spin(int n) returns int\n"
+    "    let int total = 0;\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        total = total + i * 3 % 7;\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n"
+    "func work(int n) returns int\n"
+    "    let int total = 0;\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        total = total + fib(18) + spin(4000);\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n"_utf8;
+
+/**
+ * @brief the cpu time this thread has used, which leaves out time other processes had the core for, while
+ * still counting the profiler's signal handler, since it runs on the thread it interrupts
+ */
+double threadSeconds() {
+    timespec now = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<double>(now.tv_sec) + (static_cast<double>(now.tv_nsec) * 1e-9);
+}
+
+/**
+ * @brief gets the value a given fraction of the way through the sorted values, so 0.5 is the median
+ */
+double quantile(std::vector<double> values, double fraction) {
+    std::sort(values.begin(), values.end());
+    return values[static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5)];
+}
+
+bool readArg(int argc, char** argv, int& i, const char* flag, uint64_t& out) {
+    if ((std::string(argv[i]) != flag) || ((i + 1) >= argc)) {
+        return false;
+    }
+    out = std::strtoull(argv[++i], nullptr, 10);
+    return true;
+}
+
+} //end anonymous namespace
+
+int main(int argc, char** argv) {
+    uint64_t runs = 101;
+    uint64_t work = 100;
+    uint64_t intervalUs = 1000;
+    uint64_t limitPercent = 2;
+    for (int i = 1; i < argc; i++) {
+        uint64_t value = 0;
+        if (readArg(argc, argv, i, "--runs", value)) {
+            runs = std::max<uint64_t>(value, 1);
+        } else if (readArg(argc, argv, i, "--work", value)) {
+            work = std::max<uint64_t>(value, 1);
+        } else if (readArg(argc, argv, i, "--interval", value)) {
+            intervalUs = std::max<uint64_t>(value, 1);
+        } else if (readArg(argc, argv, i, "--limit", value)) {
+            limitPercent = value;
+        } else {
+            std::cout << "Unknown argument `" << argv[i] << "`" << std::endl;
+            return 1;
+        }
+    }
+
+    Engine compiler;
+    auto loadError = compiler.loadSource(benchSource);
+    if (loadError) {
+        std::cout << "Failed to load the benchmark script:\n" << *loadError << std::endl;
+        return 1;
+    }
+    const std::shared_ptr<const Module>& shared = compiler.getModule();
+    const uint32_t entry = shared->findFunction("work"_utf8).value();
+    const std::vector<Value> args = {Value::fromInt(static_cast<int64_t>(work))};
+
+    Profiler profiler;
+    profiler.retain(shared->symbols);
+
+    //Returns the seconds one call of `work` took, or a negative number if it failed
+    const auto timeRun = [&](bool profiled) {
+        VM vm(shared);
+        if (profiled) {
+            vm.setProfiler(&profiler);
+            if (profiler.start(static_cast<uint32_t>(intervalUs))) {
+                return -1.0;
+            }
+        }
+        const double start = threadSeconds();
+        const bool ok = vm.call(entry, args).isOk();
+        const double elapsed = threadSeconds() - start;
+        if (profiled) {
+            profiler.stop();
+            vm.setProfiler(nullptr);
+            profiler.drain();
+        }
+        return ok ? elapsed : -1.0;
+    };
+
+    //One untimed round of each first, so neither side pays for warming up the caches or the allocator
+    timeRun(false);
+    timeRun(true);
+    profiler.clear();
+
+    std::vector<double> off;
+    std::vector<double> on;
+    std::vector<double> deltas;
+    for (uint64_t round = 0; round < runs; round++) {
+        const bool profiledFirst = (round % 2) == 1;
+        const double first = timeRun(profiledFirst);
+        const double second = timeRun(!profiledFirst);
+        if ((first < 0.0) || (second < 0.0)) {
+            std::cout << "The benchmark script failed, or the profiler could not be started!" << std::endl;
+            return 1;
+        }
+        (profiledFirst ? on : off).push_back(first);
+        (profiledFirst ? off : on).push_back(second);
+        deltas.push_back(100.0 * (on.back() - off.back()) / off.back());
+    }
+
+    const double overhead = quantile(deltas, 0.5);
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "runs:       " << runs << " of each, interleaved, work(" << work << ")" << std::endl;
+    std::cout << "off:        " << (quantile(off, 0.5) * 1e3) << " ms cpu median" << std::endl;
+    std::cout << "on:         " << (quantile(on, 0.5) * 1e3) << " ms cpu median, sampling every " << intervalUs << " us" << std::endl;
+    std::cout << "samples:    " << (static_cast<double>(profiler.getSampleCount()) / static_cast<double>(runs)) << " per run, "
+              << profiler.getDroppedCount() << " dropped" << std::endl;
+    std::cout << std::setprecision(2) << "overhead:   " << overhead << "% median per round, " << quantile(deltas, 0.25) << "% to "
+              << quantile(deltas, 0.75) << "% interquartile (limit " << limitPercent << "%)" << std::endl;
+    return (overhead > static_cast<double>(limitPercent)) ? 1 : 0;
+}
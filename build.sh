@@ -1,5 +1,6 @@
 #!/bin/bash
 
+mkdir -p build
 cd build
 if [ "$#" -eq 1 ]; then
     echo "Building release"
@@ -10,4 +11,4 @@ fi
 cmake --build .
 echo "Finished!"
 
-#../bin/FlowLang
\ No newline at end of file
+#./FlowLang
\ No newline at end of file
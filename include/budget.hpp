@@ -0,0 +1,158 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <ostream>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Memory Usage                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief what a tracked allocation was made for
+ */
+enum class MemoryKind : uint8_t {
+    Strings,        //Live string objects, including uChars spilled onto the heap
+    Registers,      //Register files of the VM and every coroutine
+    Frames,         //Call frame stacks of the VM and every coroutine
+    Compiled,       //Code, constants and functions compiled into the module by lazy stubs
+    Count
+};
+
+inline constexpr size_t memoryKindCount = static_cast<size_t>(MemoryKind::Count);
+
+/**
+ * @brief prints a memory kind by name
+ */
+std::ostream& operator<<(std::ostream& os, const MemoryKind kind);
+
+/**
+ * @brief the bytes one isolate is holding, broken down by what they are for
+ */
+struct MemoryUsage {
+    std::array<size_t, memoryKindCount> bytes = {};
+    size_t total = 0;
+    size_t peak = 0;
+
+    size_t of(MemoryKind kind) const noexcept {
+        return bytes[static_cast<size_t>(kind)];
+    }
+};
+
+/**
+ * @brief prints the bytes held of every kind, along with the total and peak
+ */
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage);
+
+/**
+ * @brief the limits an isolate runs under, where a limit of zero is no limit
+ * @details crossing the soft limit runs a full collection, and calls `onSoftLimit` if the isolate is still
+ * over it afterwards, once per crossing. Going over the hard limit also runs a full collection first,
+ * and is a runtime error if that doesn't bring the isolate back under it
+ */
+struct MemoryBudget {
+    size_t softLimit = 0;
+    size_t hardLimit = 0;
+
+    //Called at a safepoint, so it must not run scripts on the isolate that crossed the limit
+    std::function<void(const MemoryUsage&)> onSoftLimit;
+};
+
+/*======================================================================================================*/
+/*                                         Memory Account                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief counts the bytes one isolate holds against its budget
+ * @details charging is two adds into a fixed array and a single compare against the next limit that
+ * matters, which flags the account for its owner to enforce at the next safepoint
+ */
+class MemoryAccount {
+public:
+    void charge(MemoryKind kind, size_t bytes) noexcept {
+        usage.bytes[static_cast<size_t>(kind)] += bytes;
+        usage.total += bytes;
+        usage.peak = (usage.total > usage.peak) ? usage.total : usage.peak;
+        if (usage.total > nextCheck) {
+            flagged = true;
+        }
+    }
+
+    void refund(MemoryKind kind, size_t bytes) noexcept {
+        usage.bytes[static_cast<size_t>(kind)] -= bytes;
+        usage.total -= bytes;
+    }
+
+    /**
+     * @brief checks whether `bytes` more can be allocated without going over the hard limit
+     */
+    bool fits(size_t bytes) const noexcept {
+        return (budget.hardLimit == 0) || ((usage.total + bytes) <= budget.hardLimit);
+    }
+
+    /**
+     * @brief checks whether a limit has been crossed since the account was last settled
+     */
+    bool isFlagged() const noexcept {
+        return flagged;
+    }
+
+    bool isOverHardLimit() const noexcept {
+        return (budget.hardLimit != 0) && (usage.total > budget.hardLimit);
+    }
+
+    /**
+     * @brief replaces the budget, rearming its soft limit
+     */
+    void setBudget(MemoryBudget limits);
+
+    /**
+     * @brief rearms the soft limit once a collection has brought the usage back under it
+     */
+    void rearm() noexcept {
+        if (softFired && (usage.total <= budget.softLimit)) {
+            softFired = false;
+            pickNextCheck();
+        }
+    }
+
+    /**
+     * @brief checks the usage against the budget once garbage has been collected, calling the soft limit
+     * callback if it was just crossed, and picking the next limit to watch for
+     */
+    void settle();
+
+    const MemoryBudget& getBudget() const noexcept {
+        return budget;
+    }
+
+    const MemoryUsage& getUsage() const noexcept {
+        return usage;
+    }
+
+private:
+    MemoryUsage usage;
+    MemoryBudget budget;
+
+    //The usage past which the account is flagged, either limit depending on whether the soft one has fired
+    size_t nextCheck = SIZE_MAX;
+    bool flagged = false;
+    bool softFired = false;
+
+    void pickNextCheck() noexcept;
+};
+
+} //end namespace fl
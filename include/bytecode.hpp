@@ -0,0 +1,296 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "value.hpp"
+#include "fl_util.hpp"
+#include "intern.hpp"
+#include <vector>
+#include <optional>
+#include <functional>
+#include <memory>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          OpCode                                                      */
+/*======================================================================================================*/
+
+/**
+ * @brief every operation the bytecode can express. The bytecode is register based, where each
+ * function frame holds `frameSize` registers and parameters arrive in the lowest registers
+ * @note the comments describe each op in terms of the `a`, `b` and `c` operands of an `Instruction`
+ */
+enum class OpCode : uint8_t {
+    LoadK,          // R[a] = K[bx]
+    Move,           // R[a] = R[b]
+
+    //Arithmetic and logic, R[a] = R[b] op R[c]
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Mod,
+    Neg,            // R[a] = -R[b]
+    Not,            // R[a] = !R[b]
+
+    //Comparisons, R[a] = R[b] op R[c]
+    LessThan,
+    LessEqual,
+    GreaterThan,
+    GreaterEqual,
+    Equals,
+    NotEquals,
+
+    //Arithmetic specialized for operands statically known to be ints, R[a] = R[b] op R[c]
+    AddInt,
+    SubInt,
+    MulInt,
+    DivInt,
+    ModInt,
+    NegInt,         // R[a] = -R[b]
+
+    //Arithmetic specialized for operands statically known to be floats, R[a] = R[b] op R[c]
+    AddFloat,
+    SubFloat,
+    MulFloat,
+    DivFloat,
+    NegFloat,       // R[a] = -R[b]
+
+    //Comparisons specialized for int operands, R[a] = R[b] op R[c]
+    LessThanInt,
+    LessEqualInt,
+    GreaterThanInt,
+    GreaterEqualInt,
+    EqualsInt,
+    NotEqualsInt,
+
+    //Comparisons specialized for float operands, R[a] = R[b] op R[c]
+    LessThanFloat,
+    LessEqualFloat,
+    GreaterThanFloat,
+    GreaterEqualFloat,
+    EqualsFloat,
+    NotEqualsFloat,
+
+    Check,          // R[a] = R[b] if it holds the ValueType in c, converting ints to floats, else runtime error
+
+    //Control flow
+    Jump,           // pc = bx
+    JumpIfTrue,     // if R[a] then pc = bx
+    JumpIfFalse,    // if !R[a] then pc = bx
+    Call,           // R[a] = callee[b](R[c] ... R[c + argc - 1]), where b is a function index once linked
+    CallHost,       // R[a] = host[b](R[c] ... R[c + argc - 1]), only made by linking a call to a host function
+    ParallelFor,    // R[a] = the reduction of running body[b](R[c] ... R[c + argc - 1]) over chunks of R[c] up to R[c + 1]
+    Return,         // return R[a]
+    ReturnNil       // return nil
+};
+
+/**
+ * @brief an override on the output stream to make disassembly readable
+ */
+std::ostream& operator<<(std::ostream& os, const OpCode op);
+
+/*======================================================================================================*/
+/*                                        Instruction                                                   */
+/*======================================================================================================*/
+
+/**
+ * @brief a single fixed width bytecode instruction
+ */
+struct Instruction {
+    OpCode op;
+    uint8_t argc = 0;
+    uint16_t a = 0;
+    uint16_t b = 0;
+    uint16_t c = 0;
+
+    /**
+     * @brief gets the wide operand formed by `b` and `c`, used for jump targets and constant indices
+     */
+    constexpr uint32_t bx() const noexcept {
+        return (static_cast<uint32_t>(b) << 16) | static_cast<uint32_t>(c);
+    }
+
+    /**
+     * @brief sets the wide operand formed by `b` and `c`
+     */
+    constexpr void setBx(uint32_t bx) noexcept {
+        b = static_cast<uint16_t>(bx >> 16);
+        c = static_cast<uint16_t>(bx & 0xFFFF);
+    }
+};
+
+/*======================================================================================================*/
+/*                                        FunctionProto                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief marks the source line every instruction from `pc` up to the next mark was compiled from
+ */
+struct SourceLine {
+    uint32_t pc;
+    uint32_t line;
+};
+
+/**
+ * @brief a single compiled function before linking, where calls name their callee through `callees`
+ * @note a `ParallelFor` names its body by position in `bodies` until linking, which moves every body into
+ * the module as a function of its own and points the loop at its function index
+ */
+struct FunctionProto {
+    Symbol name = noSymbol;
+    uint16_t arity = 0;
+    uint16_t frameSize = 0;
+    std::vector<Instruction> code;
+    std::vector<Constant> constants;
+    std::vector<Symbol> callees;
+
+    //Sorted by pc, counted from the start of `code`, which stays valid once the code is laid out in a module
+    std::vector<SourceLine> lines;
+
+    //The outlined bodies of this function's parallel loops
+    std::vector<FunctionProto> bodies;
+
+    //Set on a parallel loop body, which is named after the function it came from and can't be called by name
+    bool outlined = false;
+
+    //How the results of chunks of a parallel loop body combine, `Move` when they are just dropped
+    OpCode reduction = OpCode::Move;
+};
+
+/**
+ * @brief disassembles a function into a readable listing, naming callees through the table their symbols came from
+ */
+std::ostream& operator<<(std::ostream& os, const WithSymbols<FunctionProto>& printed);
+
+/*======================================================================================================*/
+/*                                        Host Functions                                                */
+/*======================================================================================================*/
+
+class VM;
+
+/**
+ * @brief the signature every host function is called through, which unpacks `args` straight out of
+ * the callers registers and writes the result into `out`
+ * @returns nullptr on success, or a message describing why the call failed
+ * @note these are generated from the C++ signature of the bound function by `embed.hpp`
+ */
+using HostThunk = const char* (*)(VM& vm, void* target, const Value* args, Value& out);
+
+/**
+ * @brief a native function scripts can call like any other function
+ */
+struct HostFunction {
+    Symbol name = noSymbol;
+    uint16_t arity = 0;
+
+    //Only meaningful when `typedReturn` is set, letting the compiler specialize code using the result
+    ValueType returnType = ValueType::Nil;
+    bool typedReturn = false;
+
+    HostThunk thunk = nullptr;
+
+    //Whatever the thunk needs to reach the bound callable, owned by whoever bound it
+    void* target = nullptr;
+};
+
+/*======================================================================================================*/
+/*                                           Module                                                     */
+/*======================================================================================================*/
+
+/**
+ * @brief the entry pc of a function table stub, whose function is compiled on its first call
+ */
+inline constexpr uint32_t lazyEntryPc = UINT32_MAX;
+
+/**
+ * @brief an entry in the function table of a linked module, holding everything a call needs
+ */
+struct FunctionDesc {
+    uint16_t arity = 0;
+    uint16_t frameSize = 0;
+    uint32_t entryPc = 0;
+};
+
+/**
+ * @brief the compiled form of a whole script
+ * @details `functions` holds each function as it was emitted, in declaration order, so a functions
+ * position is its function index. Linking lays the code of every function out into one array, with
+ * a flat function table describing where each one starts, and every call bound to a function index.
+ * Functions without code are left as stubs in the table, and are compiled by `lazyCompiler` when first called.
+ * Calls to names that aren't script functions are bound to `hostFunctions` instead
+ * @note names are interned symbols, so a module holds nothing that points back into the source text
+ */
+struct Module {
+    std::vector<FunctionProto> functions;
+
+    //The table every symbol in the module came from, shared with anything else compiled against it
+    std::shared_ptr<const SymbolTable> symbols;
+
+    //Filled in by link
+    std::vector<FunctionDesc> functionTable;
+    std::vector<Instruction> code;
+    ConstantPool constants;
+    FlatMap<Symbol, uint32_t> functionIndices;
+
+    //Set before linking, and never changed after
+    std::vector<HostFunction> hostFunctions;
+    FlatMap<Symbol, uint32_t> hostIndices;
+
+    //Keeps the callables some host functions are bound to alive for as long as the module
+    std::vector<std::shared_ptr<void>> hostTargets;
+
+    //Produces the code for a stubbed function, only set when compiling lazily
+    std::function<Result<FunctionProto, Utf8String>(uint32_t)> lazyCompiler;
+
+    /**
+     * @brief finds the function index of a function by name, meant for entry points and not for calls
+     */
+    std::optional<uint32_t> findFunction(const Utf8StringView& name) const;
+
+    /**
+     * @brief checks if a function is still a stub waiting on its first call
+     */
+    bool isStub(uint32_t function) const noexcept;
+
+    /**
+     * @brief maps a pc inside a compiled function back to the source line it came from
+     * @returns the line, or zero when the function has no line marked for it
+     */
+    uint32_t lineAt(uint32_t function, uint32_t pc) const noexcept;
+
+    /**
+     * @brief compiles and links a stubbed function, so every later call goes straight to its code
+     * @note does nothing if the function is already compiled
+     */
+    std::optional<Utf8String> compileStub(uint32_t function);
+};
+
+/**
+ * @brief binds every call in the module to the index of the function it calls and builds the function table,
+ * leaving functions without any code as stubs. Calls to a host function are bound to its index in `hostFunctions`
+ * @returns an error listing any calls to functions that do not exist, or calls with the wrong number of arguments
+ */
+std::optional<Utf8String> link(Module& module);
+
+/**
+ * @brief links a single newly compiled function into an already linked module, replacing its stub
+ */
+std::optional<Utf8String> linkFunction(Module& module, uint32_t function, FunctionProto&& proto);
+
+/**
+ * @brief disassembles every function in a module
+ */
+std::ostream& operator<<(std::ostream& os, const Module& module);
+
+} //end namespace fl
@@ -0,0 +1,44 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "parser.hpp"
+#include "ir.hpp"
+#include "bytecode.hpp"
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Compiler                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief lowers an optimized SSA function into bytecode
+ * @details every SSA value gets its own register, and phis are resolved by moves placed at the
+ * end of each predecessor. Critical edges are split first so those moves never run on the wrong path
+ * @note this edits the CFG of `func` while splitting edges
+ */
+Result<FunctionProto, Utf8String> emitBytecode(IRFunction& func);
+
+/**
+ * @brief compiles every function found by the parser, running each through SSA construction, the
+ * IR optimization pipeline and bytecode emission, before linking them into one module
+ * @details functions whose bodies were skipped by a `ParseMode::Lazy` parse are linked as stubs, and
+ * are parsed, compiled and linked in on their first call, so unused functions never cost anything
+ * @note a fully compiled module only refers to names through interned symbols, so the source text and
+ * tokens can be released as soon as this returns
+ * @param symbols the table the parsed tokens were interned into, which the module keeps hold of
+ * @param hosts the host functions scripts may call, whose return types, when known, are used to type their calls
+ * @warning the parser, and the tokens it parsed, must outlive the module when parsing lazily
+ */
+Result<Module, Utf8String> compile(FlowParser& parser, std::shared_ptr<const SymbolTable> symbols, const std::vector<HostFunction>& hosts = {});
+
+} //end namespace fl
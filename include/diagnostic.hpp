@@ -0,0 +1,179 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "utf8string.hpp"
+#include "intern.hpp"
+#include <vector>
+#include <ostream>
+#include <type_traits>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                       Diagnostic Codes                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief every error the tokenizer and parser can report, each with a fixed message held in a static table
+ * @note new codes must be added to the end of the message table in `diagnostic.cpp` too, in the same order
+ */
+enum class DiagCode : uint16_t {
+    //Tokenizer
+    UnclosedComment,
+    UnclosedString,
+    IllegalOperator,
+    InvalidTokenStart,
+
+    //Top level and function structure
+    IllegalTopLevelToken,
+    UnclosedFunction,
+    MissingFunctionName,
+    MissingParamList,
+    UnclosedParamList,
+    MissingReturnType,
+    MissingParamType,
+    MissingParamName,
+    MissingParamComma,
+
+    //Blocks
+    UnclosedBlock,
+    MisplacedElse,
+    MissingThen,
+    MissingBranchCondition,
+    MissingWhileDo,
+    MissingWhileCondition,
+    MissingForDo,
+    MalformedForHeader,
+    EmptyForHeader,
+    UnknownDirective,
+    MisplacedParallel,
+
+    //Expressions
+    UnboundedExpression,
+    UnexpectedTokens,
+    ExpectedValue,
+    ExpectedSingleOperand,
+    UnexpectedOperator,
+    MissingLeftOperand,
+    MissingRightOperand,
+    TokensBeforePrefix,
+    MalformedDeclaration,
+    MissingPrefixOperand,
+    TokensAfterPostfix,
+    MissingPostfixOperand,
+    TokensBeforeCall,
+    UnclosedCallArgs,
+    TokensAfterCall,
+    EmptyCallArgument,
+
+    Count
+};
+
+/**
+ * @brief the fixed message for a code
+ */
+const char* diagnosticMessage(DiagCode code) noexcept;
+
+/*======================================================================================================*/
+/*                                          Diagnostic                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief a compact description of an error, holding just a code, where it happened, and optionally the
+ * name it happened in. Nothing is formatted until the diagnostic is displayed, so reporting one never
+ * allocates, and it is small and trivially copyable enough to be passed back through every level of the
+ * parser in registers
+ */
+struct Diagnostic {
+    uint32_t line = 0;
+    uint32_t column = 0;
+    DiagCode code = DiagCode::UnexpectedTokens;
+    Symbol arg = noSymbol;
+};
+static_assert(std::is_trivially_copyable_v<Diagnostic> && (sizeof(Diagnostic) <= 16));
+
+/**
+ * @brief formats a diagnostic as `[L: line C: column] message`, followed by its name if it has one
+ * @param symbols the table the name was interned into
+ */
+Utf8String renderDiagnostic(const Diagnostic& diagnostic, const SymbolTable& symbols);
+
+/**
+ * @brief formats a message that was never a `Diagnostic` as `[L: line C: column] message`, for errors found
+ * past the parser that still point at the source
+ */
+Utf8String renderLocated(size_t line, size_t column, const char* message);
+
+/**
+ * @brief writes a diagnostic in the same format as `renderDiagnostic`, without building a string first
+ */
+std::ostream& operator<<(std::ostream& os, const WithSymbols<Diagnostic>& printed);
+
+/*======================================================================================================*/
+/*                                      Diagnostic Buffer                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief collects diagnostics in the order they were reported, so a caller can decide later which,
+ * if any, are worth rendering
+ * @note every stage hands back its batch sorted by position, and batches are merged through `append`
+ * and `sortByPosition`, so errors always read top to bottom through the source
+ */
+class DiagnosticBuffer {
+public:
+    void report(const Diagnostic& diagnostic) {
+        diagnostics.push_back(diagnostic);
+    }
+
+    bool isEmpty() const noexcept {
+        return diagnostics.empty();
+    }
+
+    size_t size() const noexcept {
+        return diagnostics.size();
+    }
+
+    const Diagnostic& operator[](size_t index) const {
+        return diagnostics[index];
+    }
+
+    std::vector<Diagnostic>::const_iterator begin() const noexcept {
+        return diagnostics.begin();
+    }
+
+    std::vector<Diagnostic>::const_iterator end() const noexcept {
+        return diagnostics.end();
+    }
+
+    void clear() noexcept {
+        diagnostics.clear();
+    }
+
+    /**
+     * @brief adds every diagnostic of another buffer after these
+     */
+    void append(const DiagnosticBuffer& other) {
+        diagnostics.insert(diagnostics.end(), other.diagnostics.begin(), other.diagnostics.end());
+    }
+
+    /**
+     * @brief orders every diagnostic from `from` onward by line, then column
+     * @note diagnostics at the same position keep the order they were reported in
+     */
+    void sortByPosition(size_t from = 0);
+
+private:
+    std::vector<Diagnostic> diagnostics;
+};
+
+} //end namespace fl
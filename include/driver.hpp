@@ -0,0 +1,155 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "bytecode.hpp"
+#include "fl_util.hpp"
+#include "scheduler.hpp"
+#include "utf8string.hpp"
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                         Driver Options                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief what the driver writes out for every file that compiled cleanly
+ */
+enum class EmitKind : uint8_t {
+    None,
+
+    //The compiled module in the binary format of `writeModule`, as `.flbc` next to the source or under the
+    //output directory, which the driver loads and runs in place of a source file when given one
+    Bytecode,
+
+    //A readable disassembly of the compiled module, as `.fllist`
+    Listing,
+
+    //The flat parse tree in the binary format of `writeAstDump`, as `.flast`
+    AstDump
+};
+
+/**
+ * @brief everything the driver is asked to do in one run
+ */
+struct DriverOptions {
+    //Files and directories, where directories are searched recursively for `.fl` files
+    std::vector<std::string> inputs;
+
+    //How many files are worked on at once, where zero uses every hardware thread
+    size_t jobs = 0;
+
+    EmitKind emit = EmitKind::None;
+
+    //Where emitted files go, mirroring the layout of each input directory, or next to each source when empty
+    std::string outDir;
+
+    //Stops after parsing, so files are only checked for syntax errors
+    bool syntaxOnly = false;
+
+    //Calls `main` in every file that has one after everything has compiled, in input order
+    bool run = false;
+
+    bool stats = false;
+};
+
+/*======================================================================================================*/
+/*                                           File Result                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief the time spent in each part of one file's pipeline, summed over every file for the stats
+ */
+struct FileTimes {
+    double read = 0.0;
+    double decode = 0.0;
+    double tokenize = 0.0;
+    double parse = 0.0;
+    double compile = 0.0;
+    double emit = 0.0;
+
+    FileTimes& operator+=(const FileTimes& other) noexcept {
+        read += other.read;
+        decode += other.decode;
+        tokenize += other.tokenize;
+        parse += other.parse;
+        compile += other.compile;
+        emit += other.emit;
+        return *this;
+    }
+};
+
+/**
+ * @brief everything one file's pipeline produced, kept in the same order as the inputs so the report is
+ * identical no matter which thread finished first
+ */
+struct FileResult {
+    std::string path = {};
+
+    //Where the file sits under the directory it was found in, which emitted files mirror under the output directory
+    std::string relativePath = {};
+
+    //Every error already rendered, since the symbol table the diagnostics refer to belongs to the pipeline
+    std::vector<std::string> messages = {};
+    bool failed = false;
+
+    size_t bytes = 0;
+    size_t chars = 0;
+    size_t lines = 0;
+    size_t tokens = 0;
+    size_t astNodes = 0;
+    size_t functions = 0;
+    FileTimes times = {};
+
+    //Only kept when the module is going to be run
+    std::optional<Module> module = std::nullopt;
+};
+
+/*======================================================================================================*/
+/*                                             Driver                                                   */
+/*======================================================================================================*/
+
+/**
+ * @brief expands every input into the files the driver works on, in a fixed order
+ * @details files are kept in the order given, while each directory is replaced by the `.fl` files under
+ * it sorted by path, and a file named twice is only worked on once
+ * @returns a result for every file, or why the first input that could not be searched failed
+ */
+Result<std::vector<FileResult>, Utf8String> collectInputs(const std::vector<std::string>& inputs);
+
+/**
+ * @brief reads, decodes, tokenizes, parses and compiles every file, one pipeline per file spread over
+ * a pool of `jobs` threads, writing out whatever `options.emit` asks for
+ * @details each pipeline interns into a symbol table of its own, so pipelines share nothing and never
+ * wait on each other, and results land in their file's slot so the report never depends on scheduling
+ * @param scheduler the pool files are spread over, where the calling thread works on files too
+ */
+void compileFiles(std::vector<FileResult>& files, const DriverOptions& options, TaskScheduler& scheduler);
+
+/**
+ * @brief writes every message in input order, followed by a throughput summary when `options.stats` is set
+ * @param wallSeconds how long `compileFiles` took, which the summary measures throughput against
+ */
+void reportResults(std::ostream& os, const std::vector<FileResult>& files, const DriverOptions& options, double wallSeconds);
+
+/**
+ * @brief runs the driver end to end, as the command line does
+ * @returns the process exit code, which is nonzero when any file failed
+ */
+int runDriver(const DriverOptions& options, std::ostream& os);
+
+} //end namespace fl
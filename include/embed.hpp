@@ -0,0 +1,452 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "vm.hpp"
+#include "profiler.hpp"
+#include "utf8string.hpp"
+#include "fl_util.hpp"
+#include <array>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Host Types                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief describes how a C++ type crosses into and out of the VM, where `accepts` checks a value can be
+ * read as the type, `from` reads it out of a register and `to` builds a value from it
+ * @note only the types specialized below can be used in a host function or script function signature
+ */
+template <typename T>
+struct HostType;
+
+template <>
+struct HostType<int64_t> {
+    static constexpr bool typed = true;
+    static constexpr ValueType type = ValueType::Int;
+    static bool accepts(const Value& v) noexcept { return v.type == ValueType::Int; }
+    static int64_t from(const Value& v) noexcept { return v.intVal; }
+    static Value to(VM&, int64_t i) noexcept { return Value::fromInt(i); }
+};
+
+/**
+ * @brief floats also accept ints, converting them the same way a `float` typed variable would
+ */
+template <>
+struct HostType<double> {
+    static constexpr bool typed = true;
+    static constexpr ValueType type = ValueType::Float;
+    static bool accepts(const Value& v) noexcept { return (v.type == ValueType::Float) || (v.type == ValueType::Int); }
+    static double from(const Value& v) noexcept { return (v.type == ValueType::Int) ? static_cast<double>(v.intVal) : v.floatVal; }
+    static Value to(VM&, double f) noexcept { return Value::fromFloat(f); }
+};
+
+template <>
+struct HostType<bool> {
+    static constexpr bool typed = true;
+    static constexpr ValueType type = ValueType::Bool;
+    static bool accepts(const Value& v) noexcept { return v.type == ValueType::Bool; }
+    static bool from(const Value& v) noexcept { return v.boolVal; }
+    static Value to(VM&, bool b) noexcept { return Value::fromBool(b); }
+};
+
+/**
+ * @brief views read strings in place, straight out of the VM heap
+ * @warning a view taken from a script string is only valid until the VM that made it next runs, since
+ * its collections move and free strings
+ */
+template <>
+struct HostType<Utf8StringView> {
+    static constexpr bool typed = true;
+    static constexpr ValueType type = ValueType::String;
+    static bool accepts(const Value& v) noexcept { return v.type == ValueType::String; }
+    static Utf8StringView from(const Value& v) noexcept { return v.strVal->text.view(); }
+    static Value to(VM& vm, const Utf8StringView& str) { return vm.newString(str.toOwned()); }
+};
+
+/**
+ * @brief owned strings are moved onto the VM heap as they are, so returning one never copies its uChars
+ */
+template <>
+struct HostType<Utf8String> {
+    static constexpr bool typed = true;
+    static constexpr ValueType type = ValueType::String;
+    static bool accepts(const Value& v) noexcept { return v.type == ValueType::String; }
+    static Utf8String from(const Value& v) { return v.strVal->text; }
+    static Value to(VM& vm, Utf8String str) { return vm.newString(std::move(str)); }
+};
+
+/**
+ * @brief passes values through untouched, for host functions that take or give anything
+ */
+template <>
+struct HostType<Value> {
+    static constexpr bool typed = false;
+    static constexpr ValueType type = ValueType::Nil;
+    static bool accepts(const Value&) noexcept { return true; }
+    static Value from(const Value& v) noexcept { return v; }
+    static Value to(VM&, const Value& v) noexcept { return v; }
+};
+
+/**
+ * @brief returned by a host function to suspend the coroutine calling it, for a host that finishes the work
+ * asynchronously and resumes the coroutine with its result once it is ready
+ * @details the token is handed back from `resume`, to tell the host what the script is now waiting on,
+ * like the file descriptor it is reading from
+ */
+struct Suspend {
+    int64_t token = 0;
+};
+
+/**
+ * @brief host functions can fail by returning a `Result`, whose message becomes a runtime error in the script
+ */
+template <typename T>
+struct IsHostResult : std::false_type {};
+
+template <typename T>
+struct IsHostResult<Result<T, const char*>> : std::true_type {
+    using OkType = T;
+};
+
+/*======================================================================================================*/
+/*                                         Host Binding                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief generates the argument marshalling for a host function with the signature `R(Args...)`, so a
+ * call reads each argument directly out of the callers registers with a single type check, and never
+ * boxes them into a list or looks at the signature at runtime
+ */
+template <typename R, typename... Args>
+struct HostBinding {
+    static constexpr uint16_t arity = sizeof...(Args);
+
+    template <typename Callable, size_t... I>
+    static const char* invoke(VM& vm, Callable& callable, const Value* args, Value& out, std::index_sequence<I...>) {
+        if (!(HostType<std::remove_cvref_t<Args>>::accepts(args[I]) && ...)) {
+            return "Host function was called with an argument of the wrong type!";
+        }
+        if constexpr (std::is_void_v<R>) {
+            callable(HostType<std::remove_cvref_t<Args>>::from(args[I])...);
+            out = Value();
+        } else if constexpr (std::is_same_v<std::remove_cvref_t<R>, Suspend>) {
+            vm.suspend(Value::fromInt(callable(HostType<std::remove_cvref_t<Args>>::from(args[I])...).token));
+            out = Value();
+        } else if constexpr (IsHostResult<R>::value) {
+            R result = callable(HostType<std::remove_cvref_t<Args>>::from(args[I])...);
+            if (!result.isOk()) {
+                return result.errValue();
+            }
+            out = HostType<typename IsHostResult<R>::OkType>::to(vm, std::move(result).okValue());
+        } else {
+            out = HostType<std::remove_cvref_t<R>>::to(vm, callable(HostType<std::remove_cvref_t<Args>>::from(args[I])...));
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief fills in everything about a host function that comes from its signature, leaving its name to
+     * be interned into the table of whichever module it is linked into
+     */
+    static HostFunction describe(HostThunk thunk, void* target) {
+        HostFunction host{.arity = arity, .thunk = thunk, .target = target};
+        if constexpr (std::is_void_v<R>) {
+            host.typedReturn = true;
+        } else if constexpr (std::is_same_v<std::remove_cvref_t<R>, Suspend>) {
+            //Whatever the coroutine is resumed with becomes the result, so it is never typed
+            host.typedReturn = false;
+        } else if constexpr (IsHostResult<R>::value) {
+            host.typedReturn = HostType<typename IsHostResult<R>::OkType>::typed;
+            host.returnType = HostType<typename IsHostResult<R>::OkType>::type;
+        } else {
+            host.typedReturn = HostType<std::remove_cvref_t<R>>::typed;
+            host.returnType = HostType<std::remove_cvref_t<R>>::type;
+        }
+        return host;
+    }
+};
+
+/**
+ * @brief binds a free function known at compile time, so its thunk calls it directly and can inline it
+ */
+template <auto Fn>
+struct FunctionThunk;
+
+template <typename R, typename... Args, R (*Fn)(Args...)>
+struct FunctionThunk<Fn> {
+    using Binding = HostBinding<R, Args...>;
+
+    static const char* call(VM& vm, void*, const Value* args, Value& out) {
+        return Binding::invoke(vm, *Fn, args, out, std::index_sequence_for<Args...>{});
+    }
+};
+
+/**
+ * @brief binds a callable object, like a lambda with captures, reached through the thunk's target
+ */
+template <typename F, typename Signature = decltype(&F::operator())>
+struct CallableThunk;
+
+template <typename F, typename C, typename R, typename... Args>
+struct CallableThunk<F, R (C::*)(Args...) const> {
+    using Binding = HostBinding<R, Args...>;
+
+    static const char* call(VM& vm, void* target, const Value* args, Value& out) {
+        return Binding::invoke(vm, *static_cast<F*>(target), args, out, std::index_sequence_for<Args...>{});
+    }
+};
+
+template <typename F, typename C, typename R, typename... Args>
+struct CallableThunk<F, R (C::*)(Args...)> : CallableThunk<F, R (C::*)(Args...) const> {};
+
+/*======================================================================================================*/
+/*                                            Engine                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief a handle to a script function, found once by name so every call through it goes straight to
+ * the function table, with its arguments marshalled from the C++ signature at compile time
+ * @note the handle is only valid for the engine, and the load, it was found in
+ */
+template <typename Signature>
+struct ScriptFunction;
+
+template <typename R, typename... Args>
+struct ScriptFunction<R(Args...)> {
+    uint32_t index = 0;
+};
+
+/**
+ * @brief the embedding surface of Flow, holding a loaded module, the VM running it, and every host
+ * function scripts can call
+ * @details host functions are bound before loading, since calls to them are resolved while linking
+ * ```
+ * fl::Engine engine;
+ * engine.bind<&hostSqrt>("sqrt"_utf8);
+ * engine.loadSource(source);
+ * auto area = engine.find<double(double)>("area"_utf8);
+ * auto result = engine.call(*area, 2.0);
+ * ```
+ * Each engine is an isolate, so a module compiled once by one engine can be handed to engines on other
+ * threads through `getModule` and `load`, where they all share its code, constants and symbols read only
+ */
+class Engine {
+public:
+    Engine() = default;
+
+    //The VM holds onto the module by reference, so the engine stays where it is
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    ~Engine();
+
+    /**
+     * @brief binds a free function under `name`, replacing any host function already bound to it
+     * @note only affects modules loaded after this call
+     */
+    template <auto Fn>
+    void bind(const Utf8StringView& name) {
+        using Thunk = FunctionThunk<Fn>;
+        addHost(name, Thunk::Binding::describe(&Thunk::call, nullptr), nullptr);
+    }
+
+    /**
+     * @brief binds a callable object under `name`, which is kept alive by the engine and by every module
+     * linked against it
+     * @warning a module shared between isolates calls the same callable from every thread running it
+     * @note only affects modules loaded after this call
+     */
+    template <typename F>
+    void bind(const Utf8StringView& name, F&& callable) {
+        using Callable = std::remove_cvref_t<F>;
+        using Thunk = CallableThunk<Callable>;
+        std::shared_ptr<Callable> target = std::make_shared<Callable>(std::forward<F>(callable));
+        //Described before the target is moved, since arguments are evaluated in no particular order
+        const HostFunction host = Thunk::Binding::describe(&Thunk::call, target.get());
+        addHost(name, host, std::move(target));
+    }
+
+    /**
+     * @brief tokenizes, parses and compiles a script into a new module, replacing whatever was loaded before
+     * @returns every error found in the script, one per line, if it could not be loaded
+     * @note the module gets a symbol table of its own, which nothing changes once it is compiled
+     */
+    std::optional<Utf8String> loadSource(const Utf8String& source);
+
+    /**
+     * @brief loads an already compiled module, linking it against the bound host functions
+     * @warning the module must be fully compiled, as loaded modules are never changed
+     */
+    std::optional<Utf8String> loadModule(Module&& compiled);
+
+    /**
+     * @brief runs a module shared with other isolates, without copying or changing it
+     */
+    void load(std::shared_ptr<const Module> shared);
+
+    /**
+     * @brief splits `@parallel for` loops across `pool`, which engines running on separate threads can share
+     * @note takes effect on the loaded VM right away, and on every module loaded after it
+     */
+    void setScheduler(std::shared_ptr<TaskScheduler> pool);
+
+    /**
+     * @brief sets the memory limits the loaded isolate runs under, so a runaway script stops with an error
+     * @note takes effect on the loaded VM right away, and on every module loaded after it
+     */
+    void setMemoryBudget(const MemoryBudget& limits);
+
+    /**
+     * @brief samples the loaded isolate into `sampler`, which engines running on separate threads can share
+     * @note takes effect on the loaded VM right away, and on every module loaded after it
+     */
+    void setProfiler(std::shared_ptr<Profiler> sampler);
+
+    /**
+     * @brief finds a script function by name, checking that it takes as many arguments as `Signature`
+     * @returns the handle to call it through, or nothing if it doesn't exist
+     */
+    template <typename Signature>
+    std::optional<ScriptFunction<Signature>> find(const Utf8StringView& name) const {
+        return findHandle(name, static_cast<Signature*>(nullptr));
+    }
+
+    /**
+     * @brief calls a script function, building each argument directly from its C++ value
+     * @returns the result converted to `R`, or the error that stopped the script
+     * @note strings come back as views into the VM heap, use `Value` to take anything
+     */
+    template <typename R, typename... Args, typename... Given>
+    Result<R, Utf8String> call(ScriptFunction<R(Args...)> function, Given&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Given), "Script function called with the wrong number of arguments!");
+        static_assert(!std::is_same_v<R, Utf8String>, "Take script strings as a Utf8StringView!");
+        if (!machine) {
+            return Result<R, Utf8String>::Err("Nothing has been loaded to call!"_utf8);
+        }
+        const std::array<Value, sizeof...(Args)> values = {HostType<std::remove_cvref_t<Args>>::to(*machine, std::forward<Given>(args))...};
+        auto result = machine->call(function.index, values.data(), values.size());
+        if (!result.isOk()) {
+            return Result<R, Utf8String>::Err(std::move(result).errValue());
+        }
+        if (!HostType<R>::accepts(result.okValue())) {
+            return Result<R, Utf8String>::Err("Script function returned a value of the wrong type!"_utf8);
+        }
+        return Result<R, Utf8String>::Ok(HostType<R>::from(result.okValue()));
+    }
+
+    /**
+     * @brief spawns a script function as a coroutine, which only starts running once it is first resumed
+     * @returns the handle to resume it through, which is only valid for the load it was spawned in
+     */
+    template <typename R, typename... Args, typename... Given>
+    Result<Coroutine, Utf8String> spawn(ScriptFunction<R(Args...)> function, Given&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Given), "Script function called with the wrong number of arguments!");
+        if (!machine) {
+            return Result<Coroutine, Utf8String>::Err("Nothing has been loaded to call!"_utf8);
+        }
+        const std::array<Value, sizeof...(Args)> values = {HostType<std::remove_cvref_t<Args>>::to(*machine, std::forward<Given>(args))...};
+        return machine->spawn(function.index, values.data(), values.size());
+    }
+
+    /**
+     * @brief resumes a coroutine, handing it `sent` as the result of the host call it was suspended in
+     * @returns where it stopped, with the token it suspended on or the value it returned, or the error that
+     * stopped it
+     */
+    template <typename T>
+    Result<CoroutineStep, Utf8String> resume(Coroutine coroutine, T&& sent) {
+        if (!machine) {
+            return Result<CoroutineStep, Utf8String>::Err("Nothing has been loaded to resume!"_utf8);
+        }
+        return machine->resume(coroutine, HostType<std::remove_cvref_t<T>>::to(*machine, std::forward<T>(sent)));
+    }
+
+    Result<CoroutineStep, Utf8String> resume(Coroutine coroutine) {
+        return resume(coroutine, Value());
+    }
+
+    /**
+     * @brief frees a suspended coroutine without running the rest of it, like when the connection it was
+     * serving closes
+     */
+    void cancel(Coroutine coroutine) {
+        if (machine) {
+            machine->cancel(coroutine);
+        }
+    }
+
+    /**
+     * @brief gives access to the VM running the loaded module
+     * @warning only valid once something has been loaded
+     */
+    VM& getVM() noexcept {
+        return *machine;
+    }
+
+    /**
+     * @brief gives the loaded module, which can be handed to `load` on other engines to share it
+     */
+    const std::shared_ptr<const Module>& getModule() const noexcept {
+        return loaded;
+    }
+
+private:
+    /**
+     * @brief a bound host function, whose name is only interned once a module is linked against it
+     */
+    struct BoundHost {
+        Utf8String name;
+        HostFunction host;
+        std::shared_ptr<void> target;
+    };
+
+    std::vector<BoundHost> hosts;
+
+    //Destroyed in reverse, so the VM goes before the module it runs, the pool it splits loops across and the profiler it samples into
+    std::shared_ptr<TaskScheduler> scheduler;
+    std::shared_ptr<Profiler> profiler;
+    MemoryBudget budget;
+    std::shared_ptr<const Module> loaded;
+    std::unique_ptr<VM> machine;
+
+    void addHost(const Utf8StringView& name, const HostFunction& host, std::shared_ptr<void> target);
+
+    /**
+     * @brief gathers every bound host function for a module about to be linked, naming each through the
+     * module's symbols and skipping any it never refers to, along with the callables they need kept alive
+     */
+    std::vector<HostFunction> hostsFor(const SymbolTable& symbols, std::vector<std::shared_ptr<void>>& targets) const;
+
+    /**
+     * @brief looks up a function index, and checks its arity against the one a handle expects
+     */
+    std::optional<uint32_t> findIndex(const Utf8StringView& name, size_t arity) const;
+
+    template <typename R, typename... Args>
+    std::optional<ScriptFunction<R(Args...)>> findHandle(const Utf8StringView& name, R (*)(Args...)) const {
+        auto index = findIndex(name, sizeof...(Args));
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        return ScriptFunction<R(Args...)>{.index = index.value()};
+    }
+};
+
+} //end namespace fl
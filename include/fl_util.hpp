@@ -16,6 +16,22 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 #include <algorithm> //Gets us all sorts of goodies
 #include <iterator> //Access to custom iterators for the span type
 #include <type_traits>
+#include <functional> //Transparent equality for the flat map
+#include <initializer_list>
+#include <utility>
+#include <memory>
+#include <tuple>
+#include <bit>
+#include <cstring>
+#include <stdint.h>
+
+//SSE2 is part of every x86-64 target, everything else takes the portable paths
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FL_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define FL_HAS_SSE2 0
+#endif
 
 namespace fl {
 
@@ -93,6 +109,45 @@ private:
     Result(E&& errVal) : value(std::move(errVal)) {}
 };
 
+/**
+ * @brief a specialization of Result for when both sides are trivially copyable, like an index and a
+ * `Diagnostic`, which is a plain tagged union with no variant bookkeeping. The Result itself stays
+ * trivially copyable, so it can be returned through deep recursion in registers instead of memory
+ * @note the API is identical to the general Result
+ */
+template <typename R, typename E>
+    requires (std::is_trivially_copyable_v<R> && std::is_trivially_copyable_v<E>)
+class Result<R, E> {
+    static_assert(!std::is_same_v<R, E>, "Results cannot be initilzied with two of the same type!");
+public:
+    static constexpr Result Ok(const R& okVal) { return Result(okVal); }
+    static constexpr Result Err(const E& errVal) { return Result(errVal); }
+
+    constexpr bool isOk() const noexcept {
+        return ok;
+    }
+
+    constexpr const R& okValue() const& { return value.okVal; }
+    constexpr R& okValue() & { return value.okVal; }
+    constexpr R&& okValue() && { return std::move(value.okVal); }
+    constexpr const R&& okValue() const&& { return std::move(value.okVal); }
+
+    constexpr const E& errValue() const& { return value.errVal; }
+    constexpr E& errValue() & { return value.errVal; }
+    constexpr E&& errValue() && { return std::move(value.errVal); }
+    constexpr const E&& errValue() const&& { return std::move(value.errVal); }
+
+private:
+    union Storage {
+        R okVal;
+        E errVal;
+    } value;
+    bool ok;
+
+    constexpr Result(const R& okVal) : value{.okVal = okVal}, ok(true) {}
+    constexpr Result(const E& errVal) : value{.errVal = errVal}, ok(false) {}
+};
+
 /*======================================================================================================*/
 /*                                     Contiguse Iter                                                  */
 /*======================================================================================================*/
@@ -115,42 +170,42 @@ public:
     using reference = T&;
 
     //Constructor for begin and end
-    ContIter(pointer ptr) noexcept : iptr(ptr) {}
-    ContIter() noexcept : iptr(nullptr) {}
+    constexpr ContIter(pointer ptr) noexcept : iptr(ptr) {}
+    constexpr ContIter() noexcept : iptr(nullptr) {}
 
     //Dereference so we can actually access our elements
-    reference operator*() const noexcept { return *iptr; }
+    constexpr reference operator*() const noexcept { return *iptr; }
     //friend reference operator*(const ContIter& it) const { return *(it.iptr); }
 
     //Operator overloads for all of our math
-    ContIter& operator++() noexcept { iptr++; return *this; }
-    ContIter operator++(int) noexcept {ContIter temp = *this; (*this)++; return temp; }
-    ContIter& operator--() noexcept { iptr--; return *this; }
-    ContIter operator--(int) noexcept { ContIter tmp = *this; (*this)--; return tmp; }
-    ContIter& operator+=(difference_type diff) noexcept { iptr += diff; return *this; }
-    ContIter& operator-=(difference_type diff) noexcept { iptr -= diff; return *this; }
-    ContIter operator+(difference_type diff) const noexcept { return ContIter(iptr + diff); }
-    ContIter operator-(difference_type diff) const noexcept { return ContIter(iptr - diff); }
-    difference_type operator-(const ContIter& it) const noexcept { return iptr - it.iptr; }
-
-    friend ContIter operator+(difference_type diff, const ContIter& it) {
+    constexpr ContIter& operator++() noexcept { iptr++; return *this; }
+    constexpr ContIter operator++(int) noexcept {ContIter temp = *this; (*this)++; return temp; }
+    constexpr ContIter& operator--() noexcept { iptr--; return *this; }
+    constexpr ContIter operator--(int) noexcept { ContIter tmp = *this; (*this)--; return tmp; }
+    constexpr ContIter& operator+=(difference_type diff) noexcept { iptr += diff; return *this; }
+    constexpr ContIter& operator-=(difference_type diff) noexcept { iptr -= diff; return *this; }
+    constexpr ContIter operator+(difference_type diff) const noexcept { return ContIter(iptr + diff); }
+    constexpr ContIter operator-(difference_type diff) const noexcept { return ContIter(iptr - diff); }
+    constexpr difference_type operator-(const ContIter& it) const noexcept { return iptr - it.iptr; }
+
+    friend constexpr ContIter operator+(difference_type diff, const ContIter& it) {
         return it + diff;
     }
 
-    friend ContIter operator-(difference_type diff, const ContIter& it) {
+    friend constexpr ContIter operator-(difference_type diff, const ContIter& it) {
         return it - diff;
     }
 
     //Get all of our comparisson operators
-    bool operator==(const ContIter& it) const noexcept { return iptr == it.iptr; }
-    bool operator!=(const ContIter& it) const noexcept { return iptr != it.iptr; }
-    bool operator<(const ContIter& it) const noexcept { return iptr < it.iptr; }
-    bool operator>(const ContIter& it) const noexcept { return iptr > it.iptr; }
-    bool operator<=(const ContIter& it) const noexcept { return iptr <= it.iptr; }
-    bool operator>=(const ContIter& it) const noexcept { return iptr >= it.iptr; }
+    constexpr bool operator==(const ContIter& it) const noexcept { return iptr == it.iptr; }
+    constexpr bool operator!=(const ContIter& it) const noexcept { return iptr != it.iptr; }
+    constexpr bool operator<(const ContIter& it) const noexcept { return iptr < it.iptr; }
+    constexpr bool operator>(const ContIter& it) const noexcept { return iptr > it.iptr; }
+    constexpr bool operator<=(const ContIter& it) const noexcept { return iptr <= it.iptr; }
+    constexpr bool operator>=(const ContIter& it) const noexcept { return iptr >= it.iptr; }
 
     //And finally a direct subscripting operation
-    reference operator[](difference_type diff) const { return iptr[diff]; }
+    constexpr reference operator[](difference_type diff) const { return iptr[diff]; }
 
 private:
     //Our internal iter pointer
@@ -185,24 +240,24 @@ public:
     /**
      * @brief the empty, uninitilzed default span constructor
      */
-    Span() noexcept : ptr(nullptr), len(0) {}
+    constexpr Span() noexcept : ptr(nullptr), len(0) {}
 
     /**
      * @brief a basic constructor for a general span
      */
-    Span(T* first, size_t count) noexcept : ptr(first), len(count) {}
+    constexpr Span(T* first, size_t count) noexcept : ptr(first), len(count) {}
 
     /**
      * @brief index operator for non-const access
      */
-    T& operator[] (size_t index) {
+    constexpr T& operator[] (size_t index) {
         return ptr[index];
     }
 
     /**
      * @brief index operator for const access
      */
-    const T& operator[] (size_t index) const {
+    constexpr const T& operator[] (size_t index) const {
         return ptr[index];
     }
 
@@ -210,62 +265,62 @@ public:
      * @brief operator overload for equality, checks to see if the data inside the span
      * is the same, not if the internal pointers are the same
      */
-    bool operator==(const Span& other) const noexcept {
+    constexpr bool operator==(const Span& other) const noexcept {
         return (len != other.len) ? false : std::equal(ptr, (ptr + len), other.ptr); 
     }
 
     /**
      * @brief provides a begin() function for algorithm work, by attaching its iter
      */
-    iterator begin() const noexcept {
+    constexpr iterator begin() const noexcept {
         return iterator(ptr);
     }
 
     /**
      * @brief provides an end() function for the rest of the iterator attachment
      */
-    iterator end() const noexcept {
+    constexpr iterator end() const noexcept {
         return iterator(ptr + len);
     }
 
     /**
      * @brief provides a constant iterator beign for the span
      */
-    const_iterator cbegin() const noexcept {
+    constexpr const_iterator cbegin() const noexcept {
         return const_iterator(ptr);
     }
 
     /**
      * @brief provides a constant iterator end for the span
      */
-    const_iterator cend() const noexcept {
+    constexpr const_iterator cend() const noexcept {
         return const_iterator(ptr + len);
     }
 
     /**
      * @brief gets the number of elements in a span
      */
-    size_t size() const noexcept {
+    constexpr size_t size() const noexcept {
         return len;
     }
 
     /**
      * @brief creates a subspan from `ptr + startIndx`, with count elements
-     * @warning startIndx should be less than endIndx!
+     * @note both ends are clamped to this span, so a range running past the end is cut short instead of
+     * reading past it
      */
-    Span subspan(size_t startIndx, size_t count) const {
-        // //TODO maybe make this return a Result over an error?
-        // if ((endIndx < startIndx) || (startIndx > len) || (endIndx > len)) {
-        //     throw std::runtime_error("Subspan parameters out of range!");
-        // }
-        return Span((ptr + startIndx), count);
+    constexpr Span subspan(size_t startIndx, size_t count) const {
+        const size_t start = (startIndx < len) ? startIndx : len;
+        return Span((ptr + start), ((count < (len - start)) ? count : (len - start)));
     }
 
     /**
      * @brief an alternative for the default subspan that takes to the end
+     * @note a start past the end gives an empty span, rather than wrapping the length around
      */
-    Span subspan(size_t startIndx) const {
-        return Span((ptr + startIndx), len - startIndx);
+    constexpr Span subspan(size_t startIndx) const {
+        const size_t start = (startIndx < len) ? startIndx : len;
+        return Span((ptr + start), len - start);
     }
 
 private:
@@ -276,4 +331,586 @@ private:
     size_t len;
 };
 
-}; //End namespace fl
\ No newline at end of file
+/*======================================================================================================*/
+/*                                          Hashing                                                     */
+/*======================================================================================================*/
+
+namespace detail {
+
+inline constexpr uint64_t hashPrime1 = 0x9E3779B185EBCA87ull;
+inline constexpr uint64_t hashPrime2 = 0xC2B2AE3D27D4EB4Full;
+alignas(16) inline constexpr uint64_t hashSecret[4] = {
+    0xBE4BA423396CFEB8ull, 0x1CAD21F72C81017Cull, 0xDB979083E96DD4DEull, 0x1F67B3B7A4A44072ull
+};
+
+inline uint64_t load64(const unsigned char* p) noexcept {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t load32(const unsigned char* p) noexcept {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+constexpr uint64_t mix64(uint64_t a, uint64_t b) noexcept {
+    return (std::rotl(a * hashPrime1, 31) * hashPrime2) ^ b;
+}
+
+constexpr uint64_t avalanche(uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief folds a 32 byte stripe into four 64 bit lanes, multiplying the two halves of each keyed
+ * word together and adding in the neighbouring word, two lanes per SSE2 register
+ * @note both paths give identical results, so hashes never depend on the target
+ */
+inline void accumulateStripe(uint64_t acc[4], const unsigned char* p) noexcept {
+#if FL_HAS_SSE2
+    for (int half = 0; half < 2; half++) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + (16 * half)));
+        const __m128i keyed = _mm_xor_si128(data, _mm_load_si128(reinterpret_cast<const __m128i*>(hashSecret + (2 * half))));
+        const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+        const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128i* lanes = reinterpret_cast<__m128i*>(acc + (2 * half));
+        _mm_storeu_si128(lanes, _mm_add_epi64(_mm_loadu_si128(lanes), _mm_add_epi64(product, swapped)));
+    }
+#else
+    for (int lane = 0; lane < 4; lane++) {
+        const uint64_t keyed = load64(p + (8 * lane)) ^ hashSecret[lane];
+        acc[lane] += ((keyed & 0xFFFFFFFFull) * (keyed >> 32)) + load64(p + (8 * (lane ^ 1)));
+    }
+#endif
+}
+
+} //end namespace detail
+
+/**
+ * @brief a fast non cryptographic hash over raw bytes
+ * @details short inputs are hashed from at most two overlapping loads, while longer inputs are
+ * consumed 32 bytes at a time across four independent lanes, which SSE2 processes two at once
+ */
+inline uint64_t hashBytes(const void* data, size_t len, uint64_t seed = 0) noexcept {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    if (len <= 16) {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        if (len >= 8) {
+            lo = detail::load64(p);
+            hi = detail::load64(p + len - 8);
+        } else if (len >= 4) {
+            lo = detail::load32(p);
+            hi = detail::load32(p + len - 4);
+        } else if (len > 0) {
+            lo = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+        }
+        return detail::avalanche(detail::mix64(lo ^ seed ^ detail::hashSecret[0], hi ^ detail::hashSecret[1]) + len);
+    }
+
+    uint64_t acc[4] = {
+        seed ^ detail::hashPrime1, seed ^ detail::hashPrime2,
+        seed ^ detail::hashSecret[2], seed ^ detail::hashSecret[3]
+    };
+    size_t i = 0;
+    for (; (i + 32) <= len; i += 32) {
+        detail::accumulateStripe(acc, p + i);
+    }
+    if (i < len) {
+        //The tail overlaps the last full stripe when there is one, and is zero padded otherwise
+        if (len >= 32) {
+            detail::accumulateStripe(acc, p + len - 32);
+        } else {
+            unsigned char tail[32] = {};
+            std::memcpy(tail, p + i, len - i);
+            detail::accumulateStripe(acc, tail);
+        }
+    }
+
+    uint64_t hash = len * detail::hashPrime1;
+    for (int lane = 0; lane < 4; lane++) {
+        hash = detail::mix64(hash ^ acc[lane], detail::hashSecret[lane]);
+    }
+    return detail::avalanche(hash);
+}
+
+/**
+ * @brief hashes a run of uChars, shared by `Utf8String` and `Utf8StringView` so equal text always hashes equally
+ */
+inline uint64_t hashUChars(const uChar* data, size_t count) noexcept {
+    return hashBytes(data, count * sizeof(uChar));
+}
+
+/**
+ * @brief the default hasher for `FlatMap`, which scrambles integers fully since the map takes its
+ * probe position and tag straight from the hash bits
+ */
+template <typename K, typename = void>
+struct FlatHash;
+
+template <typename K>
+struct FlatHash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> {
+    size_t operator()(K key) const noexcept {
+        return static_cast<size_t>(detail::avalanche(static_cast<uint64_t>(key) * detail::hashPrime1));
+    }
+};
+
+template <>
+struct FlatHash<uChar> {
+    size_t operator()(uChar c) const noexcept {
+        return static_cast<size_t>(detail::avalanche(static_cast<uint64_t>(c.n) * detail::hashPrime1));
+    }
+};
+
+/**
+ * @brief hashes strings and views alike, which lets a view look up an owned key without copying it
+ */
+template <>
+struct FlatHash<Utf8StringView> {
+    using is_transparent = void;
+
+    size_t operator()(const Utf8StringView& str) const noexcept {
+        return static_cast<size_t>(hashUChars(str.getDataPointer(), str.getLen()));
+    }
+
+    size_t operator()(const Utf8String& str) const noexcept {
+        return static_cast<size_t>(hashUChars(str.getDataPointer(), str.getCharCount()));
+    }
+};
+
+template <>
+struct FlatHash<Utf8String> : FlatHash<Utf8StringView> {};
+
+/*======================================================================================================*/
+/*                                          FlatMap                                                     */
+/*======================================================================================================*/
+
+namespace detail {
+
+/**
+ * @brief the control bytes of a flat map, where a full slot holds the low 7 bits of its keys hash
+ */
+inline constexpr int8_t ctrlEmpty = -128;
+inline constexpr int8_t ctrlDeleted = -2;
+inline constexpr size_t flatGroupWidth = 16;
+
+/**
+ * @brief a group of 16 control bytes that can all be checked against a tag at once
+ */
+struct FlatGroup {
+#if FL_HAS_SSE2
+    __m128i ctrl;
+
+    explicit FlatGroup(const int8_t* p) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+    uint32_t match(int8_t tag) const noexcept {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrl)));
+    }
+
+    uint32_t matchEmptyOrDeleted() const noexcept {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+    }
+#else
+    const int8_t* ctrl;
+
+    explicit FlatGroup(const int8_t* p) noexcept : ctrl(p) {}
+
+    uint32_t match(int8_t tag) const noexcept {
+        uint32_t bits = 0;
+        for (size_t i = 0; i < flatGroupWidth; i++) {
+            bits |= static_cast<uint32_t>(ctrl[i] == tag) << i;
+        }
+        return bits;
+    }
+
+    uint32_t matchEmptyOrDeleted() const noexcept {
+        uint32_t bits = 0;
+        for (size_t i = 0; i < flatGroupWidth; i++) {
+            bits |= static_cast<uint32_t>(ctrl[i] < -1) << i;
+        }
+        return bits;
+    }
+#endif
+
+    uint32_t matchEmpty() const noexcept {
+        return match(ctrlEmpty);
+    }
+};
+
+} //end namespace detail
+
+/**
+ * @brief an open addressing hash map in the style of SwissTable, meant to replace `std::map` anywhere
+ * lookups matter
+ * @details entries live in one flat array, next to a parallel array of one byte control tags. A lookup
+ * checks 16 tags at a time against 7 bits of the hash, and only compares keys on a tag match, so most
+ * misses never touch the entries at all. Groups are probed triangularly, which visits every group once
+ * since the group count is a power of two. Erased entries leave a tombstone until the next rehash
+ * @note if `Hash` and `Eq` are transparent, `find`, `contains` and `erase` take anything comparable to
+ * a key, so a `Utf8StringView` can find a `Utf8String` key
+ * @warning inserting can move every entry, invalidating iterators and references, and keys must never
+ * be modified through an iterator
+ */
+template <typename K, typename V, typename Hash = FlatHash<K>, typename Eq = std::equal_to<>>
+class FlatMap {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = size_t;
+
+    /**
+     * @brief walks the full slots of the map
+     */
+    template <bool IsConst>
+    class Iter {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        Iter() noexcept = default;
+        Iter(const int8_t* ctrl, pointer slot, const int8_t* end) noexcept : ctrl(ctrl), slot(slot), end(end) {
+            skipEmpty();
+        }
+
+        //Mutable iterators convert to const ones
+        operator Iter<true>() const noexcept { return Iter<true>(ctrl, slot, end); }
+
+        reference operator*() const noexcept { return *slot; }
+        pointer operator->() const noexcept { return slot; }
+        Iter& operator++() noexcept { ctrl++; slot++; skipEmpty(); return *this; }
+        Iter operator++(int) noexcept { Iter temp = *this; ++(*this); return temp; }
+        bool operator==(const Iter& other) const noexcept { return slot == other.slot; }
+        bool operator!=(const Iter& other) const noexcept { return slot != other.slot; }
+
+    private:
+        void skipEmpty() noexcept {
+            while ((ctrl != end) && (*ctrl < 0)) {
+                ctrl++;
+                slot++;
+            }
+        }
+
+        const int8_t* ctrl = nullptr;
+        pointer slot = nullptr;
+        const int8_t* end = nullptr;
+    };
+
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    FlatMap() noexcept = default;
+
+    FlatMap(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const value_type& entry : init) {
+            insert(entry);
+        }
+    }
+
+    FlatMap(const FlatMap& other) : hasher(other.hasher), equals(other.equals) {
+        allocate(other.cap);
+        if (cap != 0) {
+            std::memcpy(ctrl, other.ctrl, cap);
+            for (size_t i = 0; i < cap; i++) {
+                if (ctrl[i] >= 0) {
+                    std::construct_at(slots + i, other.slots[i]);
+                }
+            }
+        }
+        count = other.count;
+        growthLeft = other.growthLeft;
+    }
+
+    FlatMap(FlatMap&& other) noexcept
+        : ctrl(std::exchange(other.ctrl, nullptr)), slots(std::exchange(other.slots, nullptr)),
+          cap(std::exchange(other.cap, 0)), count(std::exchange(other.count, 0)),
+          growthLeft(std::exchange(other.growthLeft, 0)), hasher(other.hasher), equals(other.equals) {}
+
+    FlatMap& operator=(const FlatMap& other) {
+        if (this != &other) {
+            FlatMap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    FlatMap& operator=(FlatMap&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~FlatMap() {
+        release();
+    }
+
+    void swap(FlatMap& other) noexcept {
+        std::swap(ctrl, other.ctrl);
+        std::swap(slots, other.slots);
+        std::swap(cap, other.cap);
+        std::swap(count, other.count);
+        std::swap(growthLeft, other.growthLeft);
+        std::swap(hasher, other.hasher);
+        std::swap(equals, other.equals);
+    }
+
+    size_t size() const noexcept { return count; }
+    bool empty() const noexcept { return count == 0; }
+    size_t capacity() const noexcept { return cap; }
+
+    iterator begin() noexcept { return iterator(ctrl, slots, ctrl + cap); }
+    iterator end() noexcept { return iterator(ctrl + cap, slots + cap, ctrl + cap); }
+    const_iterator begin() const noexcept { return const_iterator(ctrl, slots, ctrl + cap); }
+    const_iterator end() const noexcept { return const_iterator(ctrl + cap, slots + cap, ctrl + cap); }
+
+    /**
+     * @brief finds the entry for a key
+     * @returns an iterator to the entry, or `end()` if there is none
+     */
+    template <typename Q>
+    iterator find(const Q& key) noexcept {
+        const size_t indx = findIndex(key, hasher(key));
+        return (indx == npos) ? end() : iterator(ctrl + indx, slots + indx, ctrl + cap);
+    }
+
+    template <typename Q>
+    const_iterator find(const Q& key) const noexcept {
+        const size_t indx = findIndex(key, hasher(key));
+        return (indx == npos) ? end() : const_iterator(ctrl + indx, slots + indx, ctrl + cap);
+    }
+
+    template <typename Q>
+    bool contains(const Q& key) const noexcept {
+        return findIndex(key, hasher(key)) != npos;
+    }
+
+    /**
+     * @brief inserts a new entry built from `args` if the key is not already present
+     * @returns the entry for the key, and whether it was newly inserted
+     */
+    template <typename KeyArg, typename... Args>
+    std::pair<iterator, bool> try_emplace(KeyArg&& key, Args&&... args) {
+        const size_t hash = hasher(key);
+        size_t indx = findIndex(key, hash);
+        if (indx != npos) {
+            return {iterator(ctrl + indx, slots + indx, ctrl + cap), false};
+        }
+
+        indx = prepareInsert(hash);
+        std::construct_at(slots + indx, std::piecewise_construct,
+            std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(ctrl + indx, slots + indx, ctrl + cap), true};
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) {
+        return try_emplace(entry.first, entry.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& entry) {
+        return try_emplace(std::move(entry.first), std::move(entry.second));
+    }
+
+    /**
+     * @brief gets the value for a key, default constructing it first if the key is new
+     */
+    V& operator[](const K& key) {
+        return try_emplace(key).first->second;
+    }
+
+    V& operator[](K&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief removes the entry for a key, leaving a tombstone in its slot
+     * @returns the number of entries removed
+     */
+    template <typename Q>
+    size_t erase(const Q& key) {
+        const size_t indx = findIndex(key, hasher(key));
+        if (indx == npos) {
+            return 0;
+        }
+        std::destroy_at(slots + indx);
+        ctrl[indx] = detail::ctrlDeleted;
+        count--;
+        return 1;
+    }
+
+    /**
+     * @brief removes every entry while keeping the allocated slots
+     */
+    void clear() noexcept {
+        destroyAll();
+        if (cap != 0) {
+            std::memset(ctrl, static_cast<unsigned char>(detail::ctrlEmpty), cap);
+        }
+        count = 0;
+        growthLeft = maxLoad(cap);
+    }
+
+    /**
+     * @brief makes room for at least `n` entries without any further rehashing
+     */
+    void reserve(size_t n) {
+        size_t wanted = detail::flatGroupWidth;
+        while (maxLoad(wanted) < n) {
+            wanted *= 2;
+        }
+        if (wanted > cap) {
+            rehash(wanted);
+        }
+    }
+
+private:
+    static constexpr size_t npos = SIZE_MAX;
+
+    //Tables are kept at most 7/8 full, tombstones included
+    static constexpr size_t maxLoad(size_t capacity) noexcept {
+        return capacity - (capacity / 8);
+    }
+
+    static constexpr int8_t tagOf(size_t hash) noexcept {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    template <typename Q>
+    size_t findIndex(const Q& key, size_t hash) const noexcept {
+        if (cap == 0) {
+            return npos;
+        }
+        const size_t groupMask = (cap / detail::flatGroupWidth) - 1;
+        size_t group = (hash >> 7) & groupMask;
+        for (size_t step = 1; ; step++) {
+            const size_t base = group * detail::flatGroupWidth;
+            const detail::FlatGroup g(ctrl + base);
+            for (uint32_t bits = g.match(tagOf(hash)); bits != 0; bits &= (bits - 1)) {
+                const size_t indx = base + std::countr_zero(bits);
+                if (equals(slots[indx].first, key)) {
+                    return indx;
+                }
+            }
+            //An empty slot ends every probe sequence the key could have been placed along
+            if ((g.matchEmpty() != 0) || (step > groupMask)) {
+                return npos;
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    /**
+     * @brief claims a slot for a new key with the given hash, rehashing first if the table is full
+     */
+    size_t prepareInsert(size_t hash) {
+        if (cap == 0) {
+            rehash(detail::flatGroupWidth);
+        }
+        size_t indx = findFreeSlot(hash);
+        if ((growthLeft == 0) && (ctrl[indx] == detail::ctrlEmpty)) {
+            //Mostly tombstones means a same size rehash is enough to clean them out
+            rehash(((count + 1) > (maxLoad(cap) / 2)) ? (cap * 2) : cap);
+            indx = findFreeSlot(hash);
+        }
+        growthLeft -= (ctrl[indx] == detail::ctrlEmpty);
+        ctrl[indx] = tagOf(hash);
+        count++;
+        return indx;
+    }
+
+    size_t findFreeSlot(size_t hash) const noexcept {
+        const size_t groupMask = (cap / detail::flatGroupWidth) - 1;
+        size_t group = (hash >> 7) & groupMask;
+        for (size_t step = 1; ; step++) {
+            const size_t base = group * detail::flatGroupWidth;
+            const uint32_t bits = detail::FlatGroup(ctrl + base).matchEmptyOrDeleted();
+            if (bits != 0) {
+                return base + std::countr_zero(bits);
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    void rehash(size_t newCap) {
+        int8_t* oldCtrl = ctrl;
+        value_type* oldSlots = slots;
+        const size_t oldCap = cap;
+
+        allocate(newCap);
+        count = 0;
+        for (size_t i = 0; i < oldCap; i++) {
+            if (oldCtrl[i] < 0) {
+                continue;
+            }
+            const size_t hash = hasher(oldSlots[i].first);
+            const size_t indx = findFreeSlot(hash);
+            ctrl[indx] = tagOf(hash);
+            std::construct_at(slots + indx, std::move(oldSlots[i]));
+            std::destroy_at(oldSlots + i);
+            count++;
+        }
+        growthLeft = maxLoad(cap) - count;
+
+        if (oldCap != 0) {
+            std::allocator<value_type>().deallocate(oldSlots, oldCap);
+            delete[] oldCtrl;
+        }
+    }
+
+    void allocate(size_t newCap) {
+        cap = newCap;
+        if (cap == 0) {
+            ctrl = nullptr;
+            slots = nullptr;
+            growthLeft = 0;
+            return;
+        }
+        ctrl = new int8_t[cap];
+        std::memset(ctrl, static_cast<unsigned char>(detail::ctrlEmpty), cap);
+        slots = std::allocator<value_type>().allocate(cap);
+        growthLeft = maxLoad(cap);
+    }
+
+    void destroyAll() noexcept {
+        for (size_t i = 0; i < cap; i++) {
+            if (ctrl[i] >= 0) {
+                std::destroy_at(slots + i);
+            }
+        }
+    }
+
+    void release() noexcept {
+        if (cap != 0) {
+            destroyAll();
+            std::allocator<value_type>().deallocate(slots, cap);
+            delete[] ctrl;
+        }
+        ctrl = nullptr;
+        slots = nullptr;
+        cap = 0;
+        count = 0;
+        growthLeft = 0;
+    }
+
+    int8_t* ctrl = nullptr;
+    value_type* slots = nullptr;
+    size_t cap = 0;
+    size_t count = 0;
+    size_t growthLeft = 0;
+    [[no_unique_address]] Hash hasher;
+    [[no_unique_address]] Eq equals;
+};
+
+}; //End namespace fl
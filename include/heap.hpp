@@ -0,0 +1,190 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "budget.hpp"
+#include "value.hpp"
+#include <memory>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                           Heap Stats                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief a snapshot of what a heap holds, and of every collection it has run
+ * @note pauses are measured around each collection and each slice of sweeping, in nanoseconds
+ */
+struct HeapStats {
+    size_t nurseryObjects = 0;
+    size_t nurseryCapacity = 0;
+    size_t oldObjects = 0;
+    size_t oldBytes = 0;
+
+    uint64_t allocatedBytes = 0;
+    uint64_t minorCollections = 0;
+    uint64_t majorCollections = 0;
+    uint64_t promotedObjects = 0;
+    uint64_t freedObjects = 0;
+
+    uint64_t lastPauseNs = 0;
+    uint64_t maxPauseNs = 0;
+    uint64_t totalPauseNs = 0;
+};
+
+/**
+ * @brief prints every field of the heap stats on its own line
+ */
+std::ostream& operator<<(std::ostream& os, const HeapStats& stats);
+
+/*======================================================================================================*/
+/*                                              Heap                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief a generational heap for the objects of one VM
+ * @details new objects are bump allocated out of a fixed size nursery. A minor collection copies every
+ * nursery object a root still reaches into the old generation, leaving a forwarding pointer behind so
+ * every other root to it is patched to the copy, then empties the nursery in one go. Once the old
+ * generation has grown past its threshold, the next collection also marks every old object the roots
+ * reach, and the rest are swept a slice at a time on later safepoints, so no single pause has to walk
+ * the whole old generation
+ *
+ * Objects only ever point at their own data, never at other objects, so the roots are the only place
+ * a reference to a young object can live, and collections never need a write barrier or remembered set
+ *
+ * Collecting is driven by the owner, which calls `beginCollection`, then `visit` on every root, then
+ * `endCollection`, and only ever at a safepoint where every live value is in a root. Every live object is
+ * charged to the owner's `MemoryAccount` as strings, and refunded once it is freed
+ */
+class Heap {
+public:
+    /**
+     * @brief the number of objects the nursery holds when not told otherwise
+     */
+    static constexpr size_t defaultNurseryObjects = 4096;
+
+    /**
+     * @brief the old generation size that triggers the first major collection
+     */
+    static constexpr size_t initialMajorThreshold = 1 << 20;
+
+    /**
+     * @brief the number of old objects each slice of sweeping looks at
+     */
+    static constexpr size_t sweepSliceObjects = 1024;
+
+    explicit Heap(MemoryAccount& account, size_t nurseryObjects = defaultNurseryObjects);
+
+    //Roots point straight at objects, so the heap stays where it is
+    Heap(const Heap&) = delete;
+    Heap& operator=(const Heap&) = delete;
+
+    /**
+     * @brief frees every object still in either generation
+     */
+    ~Heap();
+
+    /**
+     * @brief creates a string object, bumping it out of the nursery, or straight into the old generation
+     * once the nursery is full
+     * @note never collects, so values held outside of roots stay valid until the next safepoint
+     */
+    StringObject* allocateString(Utf8String&& text);
+
+    /**
+     * @brief checks whether the nursery has filled up, or the old generation has grown past its threshold
+     */
+    bool needsCollection() const noexcept {
+        return collectionDue;
+    }
+
+    /**
+     * @brief checks whether a major collection still has old objects left to sweep
+     */
+    bool isSweeping() const noexcept {
+        return sweepLink != nullptr;
+    }
+
+    /**
+     * @brief starts a collection, which is major when forced or when the old generation is over its
+     * threshold, unless the last major collection is still being swept
+     */
+    void beginCollection(bool forceMajor);
+
+    /**
+     * @brief reports a root, patching it to point at the promoted copy of a nursery object
+     * @note objects made by another heap are skipped, since parallel loops hand strings across isolates
+     */
+    void visit(Value& root);
+
+    /**
+     * @brief frees every nursery object no root reached and empties the nursery
+     */
+    void endCollection();
+
+    /**
+     * @brief the bytes an object accounts for, including uChars spilled onto the heap
+     */
+    static size_t objectBytes(size_t charCount) noexcept {
+        return sizeof(StringObject) + ((charCount > Utf8String::inlineCapacity) ? (charCount * sizeof(uChar)) : 0);
+    }
+
+    /**
+     * @brief frees unreached old objects left by the last major collection, looking at no more than
+     * `sweepSliceObjects` of them
+     */
+    void sweepSlice();
+
+    /**
+     * @brief sweeps whatever the last major collection has left to sweep in one go
+     */
+    void finishSweep();
+
+    const HeapStats& getStats() const noexcept {
+        return stats;
+    }
+
+private:
+    //Uninitialized storage, where objects below `nurseryTop` are alive
+    std::allocator<StringObject> nurseryAllocator;
+    StringObject* nurseryBase = nullptr;
+    StringObject* nurseryTop = nullptr;
+    StringObject* nurseryEnd = nullptr;
+
+    //Every old object, newest first, linked through `StringObject::next`
+    StringObject* oldHead = nullptr;
+
+    //Old objects survive a major collection when their mark matches the epoch it ran in
+    uint32_t epoch = 1;
+    bool collectionDue = false;
+    bool majorRunning = false;
+    size_t majorThreshold = initialMajorThreshold;
+
+    //The link to the next old object to sweep, or null when there is nothing left to sweep
+    StringObject** sweepLink = nullptr;
+
+    uint64_t pauseStart = 0;
+    HeapStats stats;
+    MemoryAccount& account;
+
+    /**
+     * @brief links an object into the old generation, already marked for any sweep in progress
+     */
+    StringObject* tenure(Utf8String&& text);
+
+    void startPause();
+    void endPause();
+};
+
+} //end namespace fl
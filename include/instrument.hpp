@@ -0,0 +1,174 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include <array>
+#include <ostream>
+#include <stdint.h>
+
+//Set by the `FL_INSTRUMENTATION` CMake option, without which every stage scope compiles away to nothing
+#ifndef FL_INSTRUMENTATION
+#define FL_INSTRUMENTATION 0
+#endif
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                             Stages                                                   */
+/*======================================================================================================*/
+
+/**
+ * @brief every stage of the pipeline that time and allocations are counted against
+ */
+enum class Stage : uint8_t {
+    Decode,
+    Tokenize,
+
+    //Every parse function of `FlowParser`, where `Parse` is the whole token stream
+    Parse,
+    ParseFunc,
+    ParseFunctionBody,
+    ParseIf,
+    ParseWhile,
+    ParseFor,
+    ParseParallel,
+    ParseExprs,
+    ParseExpr,
+    ParseBinaryExpr,
+    ParseRightUnaryExpr,
+    ParseLeftUnaryExpr,
+    ParseCallExpr,
+
+    BuildIR,
+    InferTypes,
+    Optimize,
+    Emit,
+    Link,
+    Execute,
+    Count
+};
+
+inline constexpr size_t stageCount = static_cast<size_t>(Stage::Count);
+
+/**
+ * @brief prints a stage by name
+ */
+std::ostream& operator<<(std::ostream& os, const Stage stage);
+
+/*======================================================================================================*/
+/*                                         Instrument Report                                            */
+/*======================================================================================================*/
+
+/**
+ * @brief what one stage cost, where time and allocations are only counted against the innermost stage
+ * running, so nested stages never count twice and the stages of a pipeline add up to its total
+ */
+struct StageStats {
+    uint64_t calls = 0;
+    uint64_t nanoseconds = 0;
+    uint64_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+};
+
+/**
+ * @brief the counts of every thread merged together
+ */
+struct InstrumentReport {
+    std::array<StageStats, stageCount> stages = {};
+
+    const StageStats& of(Stage stage) const noexcept {
+        return stages[static_cast<size_t>(stage)];
+    }
+};
+
+/**
+ * @brief prints every stage that ran as one row of a table
+ */
+std::ostream& operator<<(std::ostream& os, const InstrumentReport& report);
+
+/**
+ * @brief writes every stage as a JSON object keyed by stage name, in a fixed order so dumps diff cleanly
+ */
+void writeJson(std::ostream& os, const InstrumentReport& report);
+
+/*======================================================================================================*/
+/*                                         Instrumentation                                              */
+/*======================================================================================================*/
+
+/**
+ * @brief whether this build counts anything at all
+ */
+inline constexpr bool instrumentationBuilt = (FL_INSTRUMENTATION != 0);
+
+/**
+ * @brief starts or stops counting, which is off until a host opts in
+ * @note does nothing unless `instrumentationBuilt`, and stages already running finish counting as they began
+ */
+void setInstrumentationEnabled(bool enabled) noexcept;
+bool isInstrumentationEnabled() noexcept;
+
+/**
+ * @brief merges the counts of every thread, including threads that have exited since the last reset
+ * @details each thread counts into its own counters, which only it ever writes, so counting never
+ * contends, and merging only has to read them
+ */
+InstrumentReport collectInstrumentation();
+
+/**
+ * @brief sets every count back to zero
+ * @warning stages running on other threads while resetting can be left with part of their counts
+ */
+void resetInstrumentation();
+
+/**
+ * @brief every allocation made by any thread so far, whether or not a stage was running
+ */
+struct AllocationTotals {
+    uint64_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+};
+
+/**
+ * @brief reads back the totals counted by the allocation hook, for hosts that count around code of their own
+ * @note always zero unless `instrumentationBuilt`, since only instrumented builds replace `operator new`,
+ * and only counts while instrumentation is enabled. Every thread adds to the same totals, so unlike stage
+ * counts they can contend
+ */
+AllocationTotals allocationTotals() noexcept;
+
+#if FL_INSTRUMENTATION
+
+/**
+ * @brief counts everything from its construction to its destruction against a stage, pausing whatever
+ * stage it is nested in
+ * @note allocations are counted by replacing the global `operator new`, which instrumented builds do
+ */
+class StageScope {
+public:
+    explicit StageScope(Stage stage) noexcept;
+    ~StageScope();
+
+    StageScope(const StageScope&) = delete;
+    StageScope& operator=(const StageScope&) = delete;
+
+private:
+    bool active;
+};
+
+#define FL_STAGE(stage) const ::fl::StageScope flStageScope(::fl::Stage::stage)
+
+#else
+
+#define FL_STAGE(stage) static_cast<void>(0)
+
+#endif
+
+} //end namespace fl
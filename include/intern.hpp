@@ -0,0 +1,148 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "utf8string.hpp"
+#include <vector>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                           Symbol                                                     */
+/*======================================================================================================*/
+
+/**
+ * @brief a 32 bit id standing in for an interned spelling, where two symbols from the same table
+ * are equal exactly when their text is canonically equivalent
+ */
+using Symbol = uint32_t;
+
+/**
+ * @brief marks a token or name that was never interned
+ */
+inline constexpr Symbol noSymbol = UINT32_MAX;
+
+/*======================================================================================================*/
+/*                                         SymbolTable                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief a thread safe interning table that hands out a dense symbol for every distinct spelling
+ * @note there is no process wide table, each one is filled by the tokenizer and then owned by the
+ * module compiled from those tokens
+ * @details spellings are copied into chunks owned by the table, so the text of a symbol never points
+ * back into the source it came from, and stays valid for as long as the table does. Lookups hash the
+ * uChars and probe an open addressing table of `(hash, symbol)` slots, only comparing text when the
+ * stored hashes match. Readers share a lock, and only interning a brand new spelling takes it exclusively
+ *
+ * Text is normalized to NFC before it is given a symbol, so a name typed with precomposed accents and
+ * the same name typed with combining marks are one symbol. Every spelling that needed normalizing is
+ * kept as an alias of its normalized symbol, so it is only ever normalized the first time it is seen,
+ * and the quick check that decides whether to normalize at all is nearly free for ascii
+ */
+class SymbolTable {
+public:
+    SymbolTable();
+
+    //Handing out views into its chunks means the table can never move
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * @brief gets the symbol for some text, adding its NFC form to the table the first time it is seen
+     */
+    Symbol intern(const Utf8StringView& text);
+
+    /**
+     * @brief gets the symbol for some text without adding it
+     * @returns the symbol, or nothing if the text has never been interned
+     */
+    std::optional<Symbol> find(const Utf8StringView& text) const;
+
+    /**
+     * @brief gets the interned text of a symbol, which is always in NFC
+     * @warning `symbol` must have come from this table
+     */
+    Utf8StringView text(Symbol symbol) const;
+
+    /**
+     * @brief gets the number of distinct symbols interned so far, not counting aliases
+     */
+    size_t size() const;
+
+private:
+    /**
+     * @brief one spelling in the table, where an alias names the symbol of its normalized form
+     */
+    struct Slot {
+        uint32_t hash;
+        uint32_t spelling;
+        Symbol symbol = noSymbol;
+    };
+
+    /**
+     * @brief finds the slot holding `text`, or the empty slot it would go in
+     * @warning the caller must hold the lock
+     */
+    size_t probe(const Utf8StringView& text, uint32_t hash) const;
+
+    /**
+     * @brief copies text into the chunks, so it outlives whatever it was copied from
+     * @warning the caller must hold the lock exclusively
+     */
+    Utf8StringView store(const Utf8StringView& text);
+
+    /**
+     * @brief fills the empty slot at `indx` with a spelling, growing the table if it gets too full
+     * @warning the caller must hold the lock exclusively
+     */
+    void insertSlot(size_t indx, uint32_t hash, const Utf8StringView& spelling, Symbol symbol);
+
+    /**
+     * @brief gets the symbol for text that is already in NFC
+     * @warning the caller must hold the lock exclusively
+     */
+    Symbol internNormalized(const Utf8StringView& text, uint32_t hash);
+
+    /**
+     * @brief doubles the slot table and reinserts every symbol
+     * @warning the caller must hold the lock exclusively
+     */
+    void grow();
+
+    mutable std::shared_mutex mutex;
+    std::vector<Slot> slots;
+
+    //The text of every symbol, and the text of every spelling including aliases
+    std::vector<Utf8StringView> texts;
+    std::vector<Utf8StringView> spellings;
+
+    //The owned copies of every spelling, which never move once written
+    std::vector<std::unique_ptr<uChar[]>> chunks;
+    size_t chunkUsed = 0;
+    size_t chunkCapacity = 0;
+};
+
+/**
+ * @brief pairs something holding symbols with the table they came from, so it can be printed with names,
+ * like `std::cout << WithSymbols{proto, symbols}`
+ */
+template <typename T>
+struct WithSymbols {
+    const T& item;
+    const SymbolTable& symbols;
+};
+
+} //end namespace fl
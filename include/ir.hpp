@@ -0,0 +1,270 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "ast_node.hpp"
+#include "value.hpp"
+#include "fl_util.hpp"
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          IR Types                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief every SSA value is named by the index of the instruction that defines it
+ */
+using ValueId = uint32_t;
+
+/**
+ * @brief every basic block is named by its index inside of its function
+ */
+using BlockId = uint32_t;
+
+/**
+ * @brief a sentinel for a missing value or block
+ */
+constexpr uint32_t irNone = UINT32_MAX;
+
+/**
+ * @brief the static type of an SSA value, as found by `inferTypes`
+ * @note `Unknown` is only seen while inference is still running, and `Dynamic` means the type can only
+ * be known at runtime, so the value has to go through the generic tag checked opcodes
+ */
+enum class IRType : uint8_t {
+    Unknown,
+    Nil,
+    Bool,
+    Int,
+    Float,
+    String,
+    Dynamic
+};
+
+/**
+ * @brief an override on the output stream to make IR dumps readable
+ */
+std::ostream& operator<<(std::ostream& os, const IRType type);
+
+/**
+ * @brief resolves the name of a declared type, like the `int` in `let int foo`
+ * @returns the matching type, with `val` being `IRType::Dynamic`, or an error for unknown names
+ */
+Result<IRType, Utf8String> typeFromName(const Utf8StringView& name);
+
+/**
+ * @brief this enum class covers every operation of the mid-level IR
+ */
+enum class IROp : uint8_t {
+    //Values
+    Const,  //imm is an index into the function constants
+    Param,  //imm is the parameter index
+    Phi,    //args line up one to one with the blocks predecessors
+    Copy,
+
+    //Arithmetic
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Mod,
+    Neg,
+    Not,
+
+    //Comparisons
+    LessThan,
+    LessEqual,
+    GreaterThan,
+    GreaterEqual,
+    Equals,
+    NotEquals,
+
+    //Side effects, imm is an index into the function callees
+    Call,
+
+    //Runs the outlined loop body in imm, see `IRFunction::bodies`, over args[0] up to args[1], with args[2]
+    //as the reduction's starting value and the captured values after it, giving the combined reduction
+    ParallelFor,
+
+    //Checks that args[0] holds the IRType in imm, converting ints when imm is a float, and raises a runtime error otherwise
+    Guard,
+
+    //Terminators
+    Jump,   //targets[0] is the destination
+    Branch, //jumps to targets[0] if args[0] is true, otherwise targets[1]
+    Return  //args may be empty, in which case nil is returned
+};
+
+/**
+ * @brief an override on the output stream to make IR dumps readable
+ */
+std::ostream& operator<<(std::ostream& os, const IROp op);
+
+/**
+ * @brief checks if an op ends a basic block
+ */
+constexpr bool isTerminator(IROp op) {
+    return (op == IROp::Jump) || (op == IROp::Branch) || (op == IROp::Return);
+}
+
+/**
+ * @brief checks if an op only depends on its operands, which means it can be removed when
+ * unused, and merged with an identical op that dominates it
+ */
+constexpr bool isPure(IROp op) {
+    return !isTerminator(op) && (op != IROp::Call) && (op != IROp::ParallelFor) && (op != IROp::Param);
+}
+
+/**
+ * @brief checks if an op only ever reads its operands as numbers
+ */
+constexpr bool isArithmetic(IROp op) {
+    return (op == IROp::Add) || (op == IROp::Sub) || (op == IROp::Mul) || (op == IROp::Div) || (op == IROp::Mod) || (op == IROp::Neg);
+}
+
+/**
+ * @brief checks if an op orders or compares its operands
+ */
+constexpr bool isComparison(IROp op) {
+    return (op >= IROp::LessThan) && (op <= IROp::NotEquals);
+}
+
+/**
+ * @brief checks if swapping the operands of an op leaves its result unchanged
+ */
+constexpr bool isCommutative(IROp op) {
+    return (op == IROp::Add) || (op == IROp::Mul) || (op == IROp::Equals) || (op == IROp::NotEquals);
+}
+
+/*======================================================================================================*/
+/*                                          IRInst                                                      */
+/*======================================================================================================*/
+
+/**
+ * @brief a single IR instruction, which is also the SSA value it defines
+ */
+struct IRInst {
+    IROp op;
+    BlockId block;
+    std::vector<ValueId> args = {};
+    uint32_t imm = 0;
+    BlockId targets[2] = {irNone, irNone};
+    IRType type = IRType::Unknown;
+
+    //The source position of the token this was lowered from, for diagnostics
+    size_t lineCount = 0;
+    size_t charCount = 0;
+
+    //Removed instructions stay in the function so that ValueIds remain stable
+    bool dead = false;
+};
+
+/*======================================================================================================*/
+/*                                          IRBlock                                                     */
+/*======================================================================================================*/
+
+/**
+ * @brief a basic block, which is a straight line of instructions ending in a single terminator
+ * @note phis are always kept at the front of `insts`
+ */
+struct IRBlock {
+    std::vector<ValueId> insts;
+    std::vector<BlockId> preds;
+    std::vector<BlockId> succs;
+
+    //Filled in by `IRFunction::computeDominators`
+    BlockId idom = irNone;
+    std::vector<BlockId> domChildren;
+    uint32_t domPre = 0;
+    uint32_t domPost = 0;
+    bool reachable = false;
+};
+
+/*======================================================================================================*/
+/*                                          IRFunction                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief a single function lowered into SSA form, built from one `func` subtree of the AST
+ * @note names are held as interned symbols, so the IR never points back into the source text
+ */
+class IRFunction {
+public:
+    Symbol name = noSymbol;
+    uint32_t arity = 0;
+    IRType returnType = IRType::Dynamic;
+    std::vector<IRInst> insts;
+    std::vector<IRBlock> blocks;
+    ConstantPool constants;
+    std::vector<Symbol> callees;
+
+    //The body of every `@parallel for` in this function, outlined into a function taking
+    //`(begin, end, reduction start, captured values...)` that runs one chunk of the loop and returns its reduction
+    std::vector<IRFunction> bodies;
+
+    //How the results of chunks of this body combine, `Copy` when the loop has no reduction
+    IROp reduction = IROp::Copy;
+
+    //Blocks in reverse post order from the entry, filled in by `computeDominators`
+    std::vector<BlockId> rpo;
+
+    /**
+     * @brief rebuilds the reverse post order, reachability and dominator tree of the function
+     * @note must be rerun after any change to the shape of the control flow graph
+     */
+    void computeDominators();
+
+    /**
+     * @brief checks if every path from the entry to `b` goes through `a`
+     * @warning `computeDominators` must be up to date
+     */
+    bool dominates(BlockId a, BlockId b) const noexcept {
+        return (blocks[a].domPre <= blocks[b].domPre) && (blocks[b].domPost <= blocks[a].domPost);
+    }
+
+    /**
+     * @brief gets the terminator of a block, or `nullptr` if the block is still open
+     */
+    const IRInst* terminator(BlockId block) const noexcept {
+        const auto& blockInsts = blocks[block].insts;
+        if (blockInsts.empty() || !isTerminator(insts[blockInsts.back()].op)) {
+            return nullptr;
+        }
+        return &insts[blockInsts.back()];
+    }
+};
+
+/**
+ * @brief dumps a function in a readable textual form, naming callees through the table their symbols came from
+ */
+std::ostream& operator<<(std::ostream& os, const WithSymbols<IRFunction>& printed);
+
+/*======================================================================================================*/
+/*                                          IR Builder                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief lowers a single `func` subtree into SSA form
+ * @param ast the flat AST produced by `FlowParser`
+ * @param funcNode the index of the `func` node inside of `ast`
+ * @note SSA construction happens directly while walking the AST, by tracking the latest definition
+ * of each variable per block and placing phis lazily once all predecessors of a block are known
+ * @details the body of a `@parallel for` is outlined into one of `IRFunction::bodies`, so its
+ * iterations can run on any thread. It must count an int up by one, and may only read the locals
+ * around it, except for a single reduction updated through `+=` and `-=`, or `*=`, which each chunk
+ * accumulates on its own before they are combined
+ */
+Result<IRFunction, Utf8String> buildIR(const std::vector<ASTNode>& ast, size_t funcNode);
+
+} //end namespace fl
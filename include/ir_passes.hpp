@@ -0,0 +1,71 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "ir.hpp"
+#include <optional>
+
+namespace fl {
+
+/**
+ * @brief the declared return type of every function in a module, keyed by the function's name
+ */
+using ReturnTypeMap = FlatMap<Symbol, IRType>;
+
+/*======================================================================================================*/
+/*                                          IR Passes                                                   */
+/*======================================================================================================*/
+
+/**
+ * @brief infers a static type for every value, starting from literals, declared parameter and variable types,
+ * and the declared return types of called functions, then removes the type guards it can prove always pass
+ * @param returnTypes the declared return type of every function in the module, by name
+ * @returns an error if some operation or declared type can never be satisfied
+ * @note values whose type can only be known at runtime are typed `IRType::Dynamic`, and are left to the
+ * generic opcodes. Unreachable code is removed first so it cannot cause false type errors
+ */
+std::optional<Utf8String> inferTypes(IRFunction& func, const ReturnTypeMap& returnTypes);
+
+/**
+ * @brief forwards every use of a copy to the original value, and turns phis whose operands all agree
+ * into copies, repeating until nothing changes
+ * @note this is what cleans up the trivial phis left behind by SSA construction
+ */
+void propagateCopies(IRFunction& func);
+
+/**
+ * @brief global value numbering over the dominator tree, replacing any pure instruction with an
+ * identical one that dominates it
+ * @warning `IRFunction::computeDominators` must be up to date
+ */
+void numberValues(IRFunction& func);
+
+/**
+ * @brief removes unreachable blocks and every instruction whose result is never used and has no
+ * side effects
+ * @note this updates the dominator tree itself once unreachable blocks are removed
+ */
+void eliminateDeadCode(IRFunction& func);
+
+/**
+ * @brief hoists loop invariant instructions into the block that enters the loop
+ * @note instructions that might raise a runtime error are only hoisted out of blocks that
+ * run on every trip into the loop, so no new errors can be introduced
+ * @warning `IRFunction::computeDominators` must be up to date
+ */
+void hoistLoopInvariants(IRFunction& func);
+
+/**
+ * @brief runs the full optimization pipeline over a freshly built function
+ */
+void optimizeIR(IRFunction& func);
+
+} //end namespace fl
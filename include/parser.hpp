@@ -8,9 +8,12 @@ Copyright (c) 2025 Moose Abou-Harb All rights reserved.
 This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
 */
 
+#pragma once
+
 #include "ast_node.hpp"
 #include "fl_util.hpp"
-#include <map>
+#include "diagnostic.hpp"
+#include <vector>
 #include <optional>
 
 /**
@@ -27,7 +30,17 @@ namespace fl {
 /**
  * @brief a type alias to make writing the parsers cleaner
  */
-using ParseResult = Result<size_t, Utf8String>;
+using ParseResult = Result<size_t, Diagnostic>;
+
+/**
+ * @brief controls how much of each function is parsed up front
+ * @note in lazy mode only function signatures are parsed, and the tokens of each body are held
+ * onto until `FlowParser::parseFunctionBody` is called for it
+ */
+enum class ParseMode : uint8_t {
+    Eager,
+    Lazy
+};
 
 /**
  * @brief an object to parse the entire contents of a token stream
@@ -39,23 +52,70 @@ public:
     FlowParser() noexcept {}
 
     /**
-     * @brief a saftey wrapper over the internal parseGlobal to ensure that any upwards propogated
-     * errors results in clearing the internal data of the parser
-     */
-    inline Result<ASTNode*, Utf8String> parse(std::vector<Token>& tokens) {
-        auto result = parseExpr(Span<Token>(tokens.data(), tokens.size()));
-        if (!result.isOk()) {
-            ast.clear();
-            return Result<ASTNode*, Utf8String>::Err(result.errValue());
-        } else {
-            std::cout << "AST has " << ast.size() << " Nodes" << std::endl;
-            for (const auto& t : ast) {
-                std::cout << t.body << std::endl;
-            }
-            return Result<ASTNode*, Utf8String>::Ok(&ast[0]);
+     * @brief parses a whole token stream, recovering from errors so that every one of them is reported in a
+     * single pass, syncing on the next `;` inside a function and on the next `end` past a broken block
+     * @returns the global head, or the earliest error in the source reported during this call
+     * @note every error is reported to `getDiagnostics()`, and functions that parsed cleanly are kept in
+     * `getFunctionDecs()` even when others failed
+     */
+    inline Result<ASTNode*, Diagnostic> parse(std::vector<Token>& tokens, ParseMode parseMode = ParseMode::Eager) {
+        mode = parseMode;
+        const size_t errorsBefore = diagnostics.size();
+        size_t globalHead = parseGlobal(Span<Token>(tokens.data(), tokens.size()));
+        if (diagnostics.size() != errorsBefore) {
+            //Recovery points report on the way back out, so the batch is put back into source order
+            diagnostics.sortByPosition(errorsBefore);
+            return Result<ASTNode*, Diagnostic>::Err(diagnostics[errorsBefore]);
         }
+        return Result<ASTNode*, Diagnostic>::Ok(&ast[globalHead]);
+    }
+
+    /**
+     * @brief gives read access to the flat AST, indexed by the values stored in `ASTNode::children`
+     */
+    const std::vector<ASTNode>& getAst() const noexcept {
+        return ast;
+    }
+
+    /**
+     * @brief gives read access to the registry of parsed functions, holding the index of each `func` node
+     * inside `getAst()` in declaration order
+     * @note a functions position in this registry is its function index in the compiled module
+     */
+    const std::vector<size_t>& getFunctionDecs() const noexcept {
+        return functionDecs;
     }
 
+    /**
+     * @brief checks if the body of a function has been parsed yet, which is always true in eager mode
+     * @param funcIndex the position of the function in `getFunctionDecs()`
+     */
+    bool isBodyParsed(size_t funcIndex) const noexcept {
+        return !pendingBodies[funcIndex].has_value();
+    }
+
+    /**
+     * @brief parses the body of a function that was skipped over in lazy mode, attaching it to the
+     * functions name node just as an eager parse would
+     * @note does nothing if the body was already parsed
+     * @warning the token vector given to `parse` must still be alive
+     */
+    std::optional<Diagnostic> parseFunctionBody(size_t funcIndex);
+
+    /**
+     * @brief gives read access to every diagnostic this parser has reported, in the order they happened
+     * @note diagnostics are kept across calls to `parse` and `parseFunctionBody`, until cleared by the caller
+     */
+    const DiagnosticBuffer& getDiagnostics() const noexcept {
+        return diagnostics;
+    }
+
+    /**
+     * @brief drops every diagnostic reported so far
+     */
+    void clearDiagnostics() noexcept {
+        diagnostics.clear();
+    }
 
     /**
      * @brief displays an AST
@@ -75,13 +135,23 @@ private:
     //This is built up as a flat tree for cache locality
     std::vector<ASTNode> ast;
 
-    //A map which takes in a given functions name and returns its parse tree
-    std::map<Utf8StringView, size_t> functionDecs;
+    //The parse tree of every function, densely packed in declaration order, with names only resolved when linking
+    std::vector<size_t> functionDecs;
+
+    //Lines up with functionDecs, holding the tokens of each function body that has not been parsed yet
+    std::vector<std::optional<Span<Token>>> pendingBodies;
+
+    ParseMode mode = ParseMode::Eager;
+
+    //Every error reported so far, only rendered if someone asks to see them
+    DiagnosticBuffer diagnostics;
 
     /**
-     * @brief performs all the heavy lifting over actually parsing anything
+     * @brief performs all the heavy lifting over actually parsing anything, reporting every error it
+     * recovers from
+     * @returns the index of the global head node
      */
-    ParseResult parseGlobal(const Span<Token>& tokens);
+    size_t parseGlobal(const Span<Token>& tokens);
 
     /**
      * @brief provides the initial structural parsing of a top level function block
@@ -89,9 +159,35 @@ private:
     ParseResult parseFunc(const Span<Token>& tokens);
 
     /**
-     * @brief parses lines of blocks / expressions into children of a given node
+     * @brief parses an `if` block and all of its `elif` and `else` branches
+     * @note `tokens` should start on the `if` token and stop just before its matching `end`
+     */
+    ParseResult parseIf(const Span<Token>& tokens);
+
+    /**
+     * @brief parses a `while` block
+     * @note `tokens` should start on the `while` token and stop just before its matching `end`
+     */
+    ParseResult parseWhile(const Span<Token>& tokens);
+
+    /**
+     * @brief parses a `for` block
+     * @note `tokens` should start on the `for` token and stop just before its matching `end`
      */
-    std::optional<Utf8String> parseExprs(size_t parent, const Span<Token>& tokens);
+    ParseResult parseFor(const Span<Token>& tokens);
+
+    /**
+     * @brief parses a `@parallel for` block, whose iterations are split across threads when it runs
+     * @note `tokens` should start on the `@` token and stop just before the for block's matching `end`
+     */
+    ParseResult parseParallel(const Span<Token>& tokens);
+
+    /**
+     * @brief parses lines of blocks / expressions into children of a given node, reporting and skipping
+     * past any line or block that fails to parse
+     * @returns the first error reported, if there were any
+     */
+    std::optional<Diagnostic> parseExprs(size_t parent, const Span<Token>& tokens);
 
     /**
      * @brief parses a normal expression line, like `let val foo = 4 + 5;`
@@ -104,11 +200,33 @@ private:
      */
     ParseResult parseBinaryExpr(size_t nextOp, const Span<Token>& tokens);
 
+    /**
+     * @brief parses a prefix expression like `!a`, `-a`, `return a` or `let val a`
+     */
+    ParseResult parseRightUnaryExpr(size_t nextOp, const Span<Token>& tokens);
+
+    /**
+     * @brief parses a postfix expression like `a++`
+     */
+    ParseResult parseLeftUnaryExpr(size_t nextOp, const Span<Token>& tokens);
+
+    /**
+     * @brief parses a function call like `foo(a, b + c)`, where each argument becomes a child
+     */
+    ParseResult parseCallExpr(size_t nextOp, const Span<Token>& tokens);
+
     /**
      * @brief inserts a new child into the parser AST
      * @note uses emplace so that hopefully each AST node is only constructed once
      */
     size_t addAstNode(const Token* newNodeBody = nullptr, int64_t newParent = -1);
+
+    /**
+     * @brief reports an error that has reached a point the parser can recover from, unless a deeper
+     * recovery point already reported it
+     * @param errorsBefore the number of diagnostics reported before the failed parse started
+     */
+    void recover(const Diagnostic& error, size_t errorsBefore);
     
 };
 
@@ -0,0 +1,174 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "bytecode.hpp"
+#include "intern.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+struct CallFrame;
+
+/*======================================================================================================*/
+/*                                            Profiler                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief one frame of a sampled stack, already mapped back to the line of source it was running
+ */
+struct ProfileFrame {
+    Symbol function = noSymbol;
+    uint32_t line = 0;
+};
+
+/**
+ * @brief a sampling profiler for scripts, which folds the stacks it samples into the collapsed format
+ * flamegraph tools read
+ * @details while started, a `SIGPROF` interval timer ticks over process cpu time, and the signal handler
+ * does nothing but bump a counter. Every VM the profiler is attached to compares that counter against the
+ * last tick it sampled on at calls and backward jumps, so a sample is only ever taken by the thread
+ * running the script, at a point where its frames are consistent, and a loop can never run for long
+ * without reaching one. A sample maps each frame's pc back to its source line straight away, and is
+ * pushed into a fixed size lock free ring, dropping the sample instead of ever waiting when it is full
+ *
+ * Folding the ring into stack counts is done by `drain`, which can run on any thread while scripts keep
+ * running, and should be called often enough to keep the ring from filling up
+ * @note the timer is process wide, so only one profiler can be started at a time, and with several
+ * isolates running at once the ticks come in faster, in proportion to the cpu time they all use
+ */
+class Profiler {
+public:
+    /**
+     * @brief the most frames kept per sample, where deeper stacks keep their innermost frames
+     */
+    static constexpr size_t maxSampleDepth = 32;
+
+    /**
+     * @brief the number of samples the ring holds when not told otherwise
+     */
+    static constexpr size_t defaultCapacity = 4096;
+
+    /**
+     * @brief creates a stopped profiler, whose ring holds `capacity` samples rounded up to a power of two
+     */
+    explicit Profiler(size_t capacity = defaultCapacity);
+
+    //VMs point at the profiler, so it stays where it is
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * @brief stops the timer if it is still running
+     * @warning every VM attached to the profiler must be detached or destroyed first
+     */
+    ~Profiler();
+
+    /**
+     * @brief starts ticking every `intervalUs` microseconds of process cpu time
+     * @returns an error if another profiler is already running, or the platform has no interval timers
+     */
+    std::optional<Utf8String> start(uint32_t intervalUs = 1000);
+
+    /**
+     * @brief stops the timer, leaving every sample taken so far to be drained
+     */
+    void stop();
+
+    bool isRunning() const noexcept {
+        return running;
+    }
+
+    /**
+     * @brief gets the number of ticks so far, which VMs compare against the last tick they sampled on
+     */
+    uint32_t getTick() const noexcept {
+        return tick.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief keeps the symbols of a module being profiled alive, so its samples can be named after it is gone
+     */
+    void retain(std::shared_ptr<const SymbolTable> symbols);
+
+    /**
+     * @brief samples a stack, where `pc` is the instruction the top frame is running and every frame
+     * below it is parked on the call it made
+     * @note lock free and never blocks, so it is safe to call from any number of threads at once
+     */
+    void record(const Module& module, const CallFrame* frames, size_t frameCount, uint32_t pc) noexcept;
+
+    /**
+     * @brief folds every sample in the ring into the stack counts, freeing its space for more samples
+     */
+    void drain();
+
+    /**
+     * @brief drains the ring, then writes every distinct stack as its frames from the root down, separated
+     * by `;` and named `function:line`, followed by the number of samples it was seen in
+     */
+    void writeCollapsed(std::ostream& os);
+
+    /**
+     * @brief gets the number of samples taken, including any that were dropped
+     */
+    uint64_t getSampleCount() const noexcept {
+        return samples.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief gets the number of samples dropped because the ring was full
+     */
+    uint64_t getDroppedCount() const noexcept {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief forgets every stack counted so far, along with the sample and drop counts
+     */
+    void clear();
+
+private:
+    /**
+     * @brief a slot of the ring, whose sequence says whether it is free to write or holds a sample to read
+     */
+    struct Slot {
+        std::atomic<size_t> sequence;
+        const SymbolTable* symbols;
+        uint32_t depth;
+        bool truncated;
+        ProfileFrame frames[maxSampleDepth];
+    };
+
+    std::unique_ptr<Slot[]> ring;
+    size_t mask;
+    //Producers race on the head while only the drain moves the tail, so they sit on separate cache lines
+    alignas(64) std::atomic<size_t> head = 0;
+    alignas(64) size_t tail = 0;
+
+    std::atomic<uint32_t> tick = 0;
+    std::atomic<uint64_t> samples = 0;
+    std::atomic<uint64_t> dropped = 0;
+    bool running = false;
+
+    //Guards everything only touched while draining
+    std::mutex drainLock;
+    std::vector<std::shared_ptr<const SymbolTable>> retained;
+    FlatMap<Utf8String, uint64_t> stacks;
+};
+
+} //end namespace fl
@@ -0,0 +1,170 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Task Scheduler                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief the signature every chunk of a parallel range is run through, where `slot` names the thread
+ * running it, and stays below `TaskScheduler::getSlotCount`
+ */
+using ChunkThunk = void (*)(void* target, size_t slot, int64_t begin, int64_t end);
+
+/**
+ * @brief a work stealing thread pool that splits integer ranges across its workers
+ * @details every worker owns a deque of ranges. A worker takes the newest range off the back of its own
+ * deque, and keeps splitting it in half, pushing the upper half back, until it is no bigger than the
+ * grain, which it then runs. Workers that run dry steal the oldest, and so largest, range off the front
+ * of another worker's deque, so a range spreads out over every idle worker in a logarithmic number of
+ * steals, and a worker that finishes early keeps taking work off the others instead of waiting on them
+ *
+ * The thread calling `parallelFor` takes part as one more worker, in a slot of its own past the pool's,
+ * but only ever runs chunks of its own range, so a slot is never used by two ranges at once. Once its own
+ * deque runs dry it steals its range's halves off the workers, and sleeps only until they split off another
+ */
+class TaskScheduler {
+public:
+    /**
+     * @brief starts a pool with one worker per hardware thread, less the thread that will be calling in
+     */
+    TaskScheduler();
+
+    /**
+     * @brief starts a pool with `workerCount` threads, where zero runs every range on the calling thread
+     */
+    explicit TaskScheduler(size_t workerCount);
+
+    //Workers point back at the scheduler, so it stays where it is
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief waits for every worker to run out of work, then joins them
+     */
+    ~TaskScheduler();
+
+    /**
+     * @brief gets the number of threads in the pool, not counting callers
+     */
+    size_t getWorkerCount() const noexcept {
+        return slotCount - 1;
+    }
+
+    /**
+     * @brief gets the number of distinct slots a chunk can be run in, one per worker plus one for callers
+     */
+    size_t getSlotCount() const noexcept {
+        return slotCount;
+    }
+
+    /**
+     * @brief runs `body(slot, chunkBegin, chunkEnd)` over every chunk of `[begin, end)`, returning once
+     * they have all finished
+     * @param grain the largest chunk that is not split any further
+     * @note called from inside a chunk, the nested range just runs inline on that chunk's thread
+     */
+    template <typename Body>
+    void parallelFor(int64_t begin, int64_t end, int64_t grain, Body& body) {
+        run(begin, end, grain, [](void* target, size_t slot, int64_t chunkBegin, int64_t chunkEnd) {
+            (*static_cast<Body*>(target))(slot, chunkBegin, chunkEnd);
+        }, &body);
+    }
+
+    /**
+     * @brief the type erased form of `parallelFor`
+     */
+    void run(int64_t begin, int64_t end, int64_t grain, ChunkThunk thunk, void* target);
+
+private:
+    /**
+     * @brief one call to `run`, living on the caller's stack until every chunk of it is done
+     */
+    struct Job {
+        ChunkThunk thunk;
+        void* target;
+        int64_t grain;
+
+        //Iterations not run yet, the caller returns once this reaches zero
+        std::atomic<int64_t> remaining;
+
+        //Tasks of this job sitting in any deque, and whether the caller is asleep until one turns up
+        std::atomic<size_t> queued = 0;
+        std::atomic<bool> callerWaiting = false;
+    };
+
+    struct Task {
+        Job* job;
+        int64_t begin;
+        int64_t end;
+    };
+
+    //Padded out to a cache line, so workers pushing to their own deques don't contend with each other
+    struct alignas(64) Slot {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    //Fixed before any worker starts, since workers read it while the rest are still being started
+    const size_t slotCount;
+    std::unique_ptr<Slot[]> slots;
+    std::vector<std::thread> workers;
+
+    //Tasks sitting in any deque, and workers asleep waiting for one
+    std::atomic<size_t> queued = 0;
+    std::atomic<size_t> sleeping = 0;
+
+    std::mutex sleepLock;
+    std::condition_variable wake;
+
+    //Wakes callers when a job finishes, or when a task of theirs is pushed while they wait
+    std::condition_variable finished;
+    bool stopping = false;
+
+    void workerLoop(size_t slot);
+
+    /**
+     * @brief pushes a task onto the back of a slot's deque, waking a sleeping worker to steal it, and the
+     * job's caller if it is waiting
+     */
+    void push(size_t slot, const Task& task);
+
+    /**
+     * @brief takes the newest task off a slot's own deque, or steals the oldest task off another's
+     * @param only when set, only tasks belonging to this job are taken
+     */
+    std::optional<Task> take(size_t slot, const Job* only);
+
+    /**
+     * @brief splits a task down to its grain, leaving the halves for others to steal, and runs what is left
+     */
+    void runTask(size_t slot, Task task);
+
+    /**
+     * @brief finds the slot of the calling thread, which is past every worker for threads outside the pool
+     */
+    size_t currentSlot() const noexcept;
+};
+
+} //end namespace fl
@@ -0,0 +1,89 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "ast_node.hpp"
+#include "bytecode.hpp"
+#include "fl_util.hpp"
+#include "utf8string.hpp"
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                         Bytecode Files                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief the version of the `.flbc` layout, bumped whenever it changes
+ */
+inline constexpr uint8_t bytecodeVersion = 1;
+
+/**
+ * @brief writes a fully compiled module, so it can be loaded and run later without its source
+ * @details the layout is little endian throughout:
+ *  - the magic `FLBC`, then `bytecodeVersion` as one byte
+ *  - the symbol count as a u32, followed by every symbol's text as a u32 length and that many bytes of utf8,
+ *    in symbol order, so interning them in order into a fresh table gives every symbol back its number
+ *  - the function count as a u32, followed by each function in function index order
+ *
+ * Each function is its name as a u32 symbol, its arity and frame size as u16s, one byte each for `outlined`
+ * and its reduction op, then its instructions, constants, callees and source lines, each as a u32 count
+ * followed by the entries. An instruction is its op and argc as bytes, then `a`, `b` and `c` as u16s. A
+ * constant is its type as a byte followed by a u64 for ints and bools, the bits of a double for floats,
+ * or a u32 length and utf8 for strings. A source line is its pc and line as u32s
+ * @note functions are written as linking leaves them, with every parallel loop body already moved out into
+ * a function of its own, while calls still name their callee through `callees` so hosts are bound on load
+ * @returns an error if any function is still a stub, or still holds bodies that were never linked
+ */
+std::optional<Utf8String> writeModule(std::ostream& os, const Module& module);
+
+/**
+ * @brief reads a module written by `writeModule`, ready to be bound to hosts and linked like a freshly compiled one
+ * @details every instruction is checked against the function it is in before anything is returned, so
+ * registers stay inside the frame, constants, callees, loop bodies and jump targets exist, and every function
+ * ends in a return or a jump. A file that passes can only fail at runtime in the ways compiled code can
+ * @returns the module, interning into a symbol table of its own, or why the file could not be loaded
+ */
+Result<Module, Utf8String> readModule(std::istream& is);
+
+/*======================================================================================================*/
+/*                                            AST Dumps                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief the version of the `.flast` layout, bumped whenever it changes
+ */
+inline constexpr uint8_t astDumpVersion = 1;
+
+/**
+ * @brief writes a parsed file's flat AST, for tools that want the parse tree without a parser of their own
+ * @details the layout is little endian throughout:
+ *  - the magic `FLAST`, then `astDumpVersion` as one byte
+ *  - a 64 bit FNV-1a hash of the source bytes, to tell when the dump has gone stale
+ *  - the node count and the index of the root node, as u32s
+ *  - each node as its token type in one byte, its line and column as u32s, the length of its text as a
+ *    u32 followed by that text in utf8, then its child count as a u32 followed by each child's index
+ *  - the function count as a u32, followed by the index of each `func` node in declaration order
+ * @note this is a dump and not a cache, nothing in the pipeline reads it back in
+ */
+void writeAstDump(std::ostream& os, uint64_t sourceHash, const std::vector<ASTNode>& ast, size_t root, const std::vector<size_t>& functions);
+
+/**
+ * @brief a 64 bit FNV-1a over raw bytes, which is plenty to notice a changed file
+ */
+uint64_t fingerprintBytes(const char* data, size_t len) noexcept;
+
+} //end namespace fl
@@ -11,6 +11,7 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 #pragma once
 
 #include "utf8string.hpp"
+#include "intern.hpp"
 
 namespace fl {
 
@@ -57,6 +58,7 @@ enum class TokenType {
     Func,
     End,
     Returns,
+    Return,
     Let,
     Import,
     If,
@@ -121,15 +123,16 @@ std::ostream& operator<<(std::ostream& os, const TokenType token);
  * @brief a Token is a simple collection of text and type that defines a single atomic
  * unit of lexical information. It should be noted that these tokens work over views,
  * not established strings, which means that if the underlying data changes there is
- * no garuntee to their validity
- * @todo see if a default empty constructor would improve anything, and see about going through
- * and making these owning strings after tokenization is complete 
+ * no garuntee to their validity. Identifiers and literals also carry the symbol their text interns
+ * to, so names can be compared as integers and outlive the source
+ * @todo see if a default empty constructor would improve anything
  */
 struct Token {
     TokenType type;
     Utf8StringView text;
     size_t lineCount;
     size_t charCount;
+    Symbol symbol = noSymbol;
 };
 
 /**
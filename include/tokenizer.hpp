@@ -13,6 +13,7 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 #include "utf8string.hpp"
 #include "token.hpp"
 #include "fl_util.hpp"
+#include "diagnostic.hpp"
 #include <vector>
 
 namespace fl {
@@ -22,8 +23,16 @@ namespace fl {
 /*======================================================================================================*/
 
 /**
- * @brief the tokenizer tokenizes using a state machine approach
+ * @brief the tokenizer tokenizes using a state machine approach, interning the spelling of every
+ * identifier and literal into `symbols`
+ * @note every error is reported to `diagnostics` and skipped over, so the tokens of everything that
+ * could be read are always returned
  */
-Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text);
+std::vector<Token> tokenize(const Utf8String& text, SymbolTable& symbols, DiagnosticBuffer& diagnostics);
+
+/**
+ * @brief tokenizes `text`, giving back the first error if there were any
+ */
+Result<std::vector<Token>, Diagnostic> tokenize(const Utf8String& text, SymbolTable& symbols);
 
 } //end namespace fl
\ No newline at end of file
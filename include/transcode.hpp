@@ -0,0 +1,88 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "utf8string.hpp"
+#include "fl_util.hpp"
+#include <string>
+#include <string_view>
+#include <stdint.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Transcoding                                                   */
+/*======================================================================================================*/
+
+/*
+ * Conversions between the expanded uChars of a `Utf8String` and the strings a host application holds.
+ * Each direction has a buffer form, which writes into memory the caller owns and never allocates, and
+ * an owning form built on it. Errors are static messages, so reporting one never allocates. Every kernel widens or narrows runs of ascii a whole SSE2 register at a
+ * time where it is available, and only falls back to per character work for everything else
+ */
+
+/**
+ * @brief expands utf16 into uChars, pairing up surrogates
+ * @returns the number of uChars written, or an error if there is an unpaired surrogate
+ * @warning `out` must hold at least `len` uChars
+ */
+Result<size_t, const char*> decodeUtf16(const char16_t* data, size_t len, uChar* out) noexcept;
+
+/**
+ * @brief expands utf32 into uChars
+ * @returns the number of uChars written, or an error if a code point is a surrogate or out of range
+ * @warning `out` must hold at least `len` uChars
+ */
+Result<size_t, const char*> decodeUtf32(const char32_t* data, size_t len, uChar* out) noexcept;
+
+/**
+ * @brief the most utf16 code units `count` uChars can take
+ */
+constexpr size_t maxUtf16Units(size_t count) noexcept {
+    return count * 2;
+}
+
+/**
+ * @brief packs uChars into utf16, splitting anything past the basic plane into a surrogate pair
+ * @returns the number of code units written
+ * @warning `out` must hold at least `maxUtf16Units(count)` code units
+ */
+size_t encodeUtf16(const uChar* data, size_t count, char16_t* out) noexcept;
+
+/**
+ * @brief packs uChars into utf32, writing exactly one code point per uChar
+ * @warning `out` must hold at least `count` code points
+ */
+void encodeUtf32(const uChar* data, size_t count, char32_t* out) noexcept;
+
+/**
+ * @brief builds a string from utf8 the host has not checked
+ */
+Result<Utf8String, const char*> fromUtf8(std::string_view text);
+
+/**
+ * @brief builds a string from utf8 the host has already validated, decoding straight into the
+ * string's own storage with no error path to unwrap
+ * @warning malformed input is not reported, the string just ends before the first bad sequence
+ */
+Utf8String fromValidatedUtf8(std::string_view text);
+
+Result<Utf8String, const char*> fromUtf16(std::u16string_view text);
+Result<Utf8String, const char*> fromUtf32(std::u32string_view text);
+
+/**
+ * @brief encodes a string or view for the host
+ * @note `Utf8String::toUtf8` and `encodeUtf8` cover utf8
+ */
+std::u16string toUtf16(const Utf8StringView& text);
+std::u32string toUtf32(const Utf8StringView& text);
+
+} //end namespace fl
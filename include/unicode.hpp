@@ -0,0 +1,178 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "utf8string.hpp"
+#include <stdint.h>
+#include <stddef.h>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Unicode Tables                                                */
+/*======================================================================================================*/
+
+namespace detail {
+
+//Generated into src/unicode_tables.cpp by tools/gen_unicode_tables.py
+extern const uint8_t asciiIdentifierFlags[128];
+extern const size_t identifierBlockCount;
+extern const uint16_t identifierBlockIndex[];
+extern const uint64_t xidStartBits[];
+extern const uint64_t xidContinueBits[];
+extern const size_t normalizationBlockCount;
+extern const uint8_t normalizationBlockIndex[];
+extern const uint16_t normalizationProps[];
+extern const size_t decompositionCount;
+extern const uint32_t decompositionKeys[];
+extern const uint32_t decompositionRanges[];
+extern const uint32_t decompositionData[];
+extern const size_t compositionCount;
+extern const uint64_t compositionKeys[];
+extern const uint32_t compositionValues[];
+
+inline constexpr uint8_t asciiStartFlag = 1;
+inline constexpr uint8_t asciiContinueFlag = 2;
+
+/**
+ * @brief splits a packed multi byte uChar into its 64 code point block and its offset inside that block
+ * @details every table is split into the same blocks, and the bit is always the low 6 bits of the last utf8 byte, and the block is the code point bits
+ * held by every byte before it, so both come straight out of the packed bytes with no decode step
+ */
+inline void unicodeBlockOf(uChar c, size_t& block, uint32_t& bit) noexcept {
+    switch (c.n >> 24) {
+        case 2: {
+            block = c.n & 0x1F;
+            bit = (c.n >> 8) & 0x3F;
+            break;
+        }
+        case 3: {
+            block = ((c.n & 0x0F) << 6) | ((c.n >> 8) & 0x3F);
+            bit = (c.n >> 16) & 0x3F;
+            break;
+        }
+        default: {
+            //Four byte uChars keep their last trailing byte in the size byte
+            block = ((c.n & 0x07) << 12) | (((c.n >> 8) & 0x3F) << 6) | ((c.n >> 16) & 0x3F);
+            bit = (c.n >> 24) & 0x3F;
+            break;
+        }
+    }
+}
+
+inline bool lookupIdentifierBits(uChar c, const uint64_t* bits) noexcept {
+    size_t block = 0;
+    uint32_t bit = 0;
+    unicodeBlockOf(c, block, bit);
+    return (block < identifierBlockCount) && (((bits[identifierBlockIndex[block]] >> bit) & 1) != 0);
+}
+
+} //end namespace detail
+
+/**
+ * @brief checks if a uChar is plain ascii
+ */
+constexpr bool isAscii(uChar c) noexcept {
+    return (c.n >> 24) == 1;
+}
+
+/**
+ * @brief checks if a uChar can start an identifier, which is any XID_Start code point or an underscore
+ */
+inline bool isIdentifierStart(uChar c) noexcept {
+    if (isAscii(c)) {
+        return (detail::asciiIdentifierFlags[c.n & 0x7F] & detail::asciiStartFlag) != 0;
+    }
+    return (c.n != 0) && detail::lookupIdentifierBits(c, detail::xidStartBits);
+}
+
+/**
+ * @brief checks if a uChar can continue an identifier, which is any XID_Continue code point
+ */
+inline bool isIdentifierContinue(uChar c) noexcept {
+    if (isAscii(c)) {
+        return (detail::asciiIdentifierFlags[c.n & 0x7F] & detail::asciiContinueFlag) != 0;
+    }
+    return (c.n != 0) && detail::lookupIdentifierBits(c, detail::xidContinueBits);
+}
+
+/**
+ * @brief gets the code point a uChar holds
+ */
+constexpr uint32_t codePointOf(uChar c) noexcept {
+    switch (c.n >> 24) {
+        case 1: { return c.n & 0x7F; }
+        case 2: { return ((c.n & 0x1F) << 6) | ((c.n >> 8) & 0x3F); }
+        case 3: { return ((c.n & 0x0F) << 12) | (((c.n >> 8) & 0x3F) << 6) | ((c.n >> 16) & 0x3F); }
+        case 0: { return 0; }
+        default: {
+            return ((c.n & 0x07) << 18) | (((c.n >> 8) & 0x3F) << 12) | (((c.n >> 16) & 0x3F) << 6) | ((c.n >> 24) & 0x3F);
+        }
+    }
+}
+
+/**
+ * @brief packs a code point into a uChar, the same way a `Utf8String` expands it
+ */
+constexpr uChar uCharFromCodePoint(uint32_t cp) noexcept {
+    if (cp < 0x80) {
+        return packUChar(1, 0, 0, static_cast<uint8_t>(cp));
+    } else if (cp < 0x800) {
+        return packUChar(2, 0, static_cast<uint8_t>(0x80 | (cp & 0x3F)), static_cast<uint8_t>(0xC0 | (cp >> 6)));
+    } else if (cp < 0x10000) {
+        return packUChar(3, static_cast<uint8_t>(0x80 | (cp & 0x3F)), static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)),
+            static_cast<uint8_t>(0xE0 | (cp >> 12)));
+    }
+    return packUChar(static_cast<uint8_t>(0x80 | (cp & 0x3F)), static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F)),
+        static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3F)), static_cast<uint8_t>(0xF0 | (cp >> 18)));
+}
+
+/**
+ * @brief counts how many uChars from the start of `data` are plain ascii
+ * @note this checks four uChars at a time with SSE2 where it is available
+ */
+size_t countLeadingAscii(const uChar* data, size_t count) noexcept;
+
+/**
+ * @brief finds the end of the identifier that continues at `pos`
+ * @returns the index of the first uChar at or after `pos` that can not continue an identifier
+ * @details the text is checked 16 uChars at a time for an ascii run, which is classified straight from a
+ * 128 entry table, so only non ascii uChars ever go to the XID tables
+ */
+size_t takeIdentifier(const Utf8StringView& text, size_t pos) noexcept;
+
+/*======================================================================================================*/
+/*                                        Normalization                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief the answer of the NFC quick check, where `Maybe` means only a full normalization can tell
+ */
+enum class NfcCheck : uint8_t {
+    Yes,
+    No,
+    Maybe
+};
+
+/**
+ * @brief checks if text is already in NFC without normalizing it
+ * @note all ascii text is checked four uChars at a time and is always `Yes`, and so is anything
+ * below the first combining mark at U+0300
+ */
+NfcCheck quickCheckNfc(const Utf8StringView& text) noexcept;
+
+/**
+ * @brief normalizes text into NFC, composing every canonically equivalent spelling into the same uChars
+ * @note text that passes the quick check is copied as is
+ */
+Utf8String normalizeNfc(const Utf8StringView& text);
+
+} //end namespace fl
@@ -13,9 +13,9 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 #include <iostream>     //General IO
 #include <string>       //Used to give a constructor
 #include <vector>       //Stores the internal string data
-#include <clocale>      //Allows us to set locale for proper printing
 #include <stdint.h>     //Fixed size numbers
 #include <iterator>     //To expose a custom iterator type
+#include <cstddef>      //size_t and SIZE_MAX
 
 //Temporary includes
 #include <stdexcept>    //Out of range exception
@@ -110,10 +110,44 @@ constexpr uint8_t countLeadingOnes(const uint8_t byte) noexcept {
 
 /**
  * @brief an operator override for ostream that allows the uchars to be unpacked from the wide expansion into a printable form
- * @note yes this is a bit cursed, im looking into alternatives, and hey it works just fine for now
  */
 std::ostream& operator<<(std::ostream& os, const uChar c);
 
+/*======================================================================================================*/
+/*                                        Utf8 Encoding                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief the most bytes `count` uChars can take once encoded back to utf8
+ */
+constexpr size_t maxUtf8Bytes(size_t count) noexcept {
+    return count * 4;
+}
+
+/**
+ * @brief packs expanded uChars back into contiguous utf8
+ * @returns the number of bytes written to `out`
+ * @note runs of ascii are narrowed 16 uChars at a time with SSE2 where it is available
+ * @warning `out` must hold at least `maxUtf8Bytes(count)` bytes, even when the result is shorter
+ */
+size_t encodeUtf8(const uChar* data, size_t count, char* out) noexcept;
+
+/**
+ * @brief encodes uChars as utf8 onto the end of `out`
+ */
+void appendUtf8(std::string& out, const uChar* data, size_t count);
+
+/**
+ * @brief expands packed utf8 into uChars, checking that every sequence is well formed
+ * @details overlong forms, encoded surrogates, and anything past U+10FFFF are rejected, so every uChar
+ * written holds the one encoding of a scalar value, and equal text always compares equal
+ * @param count set to the number of uChars written, including on failure
+ * @returns 0 on success, or the error code a `Utf8String` fails to construct with
+ * @note runs of ascii are widened 16 bytes at a time with SSE2 where it is available
+ * @warning `out` must hold at least `len` uChars
+ */
+uint32_t decodeUtf8(const char* bytes, size_t len, uChar* out, size_t& count) noexcept;
+
 /*======================================================================================================*/
 /*                                         Utf8String                                                   */
 /*======================================================================================================*/
@@ -128,14 +162,17 @@ std::ostream& operator<<(std::ostream& os, const uChar c);
  * each utf8string is an expanded byte array that stores each unicode charachter as its own
  * 4 byte container, which is what allows us to use direct indexing, and fast view creation
  * the internal storage mechanism also encodes the datas size to make it more efficient
- * when printing
+ * when printing. Strings of up to `inlineCapacity` uChars are stored inside the object itself,
+ * so most names and literals never allocate
+ * @warning moving or destroying a short string invalidates views into it, even though moving a
+ * long string keeps its uChars where they are
  */
 class Utf8String {
 public:
     /**
      * @brief default simple constructor
      */
-    Utf8String() {};
+    Utf8String() noexcept;
 
     /**
      * @brief a constructor designed to take in raw packed utf8 data
@@ -148,6 +185,29 @@ public:
      */
     Utf8String(const uChar* uCharPtr, size_t charCount);
 
+    Utf8String(const Utf8String& other);
+    Utf8String(Utf8String&& other) noexcept;
+    Utf8String& operator=(const Utf8String& other);
+    Utf8String& operator=(Utf8String&& other) noexcept;
+    ~Utf8String();
+
+    /**
+     * @brief the most uChars a string can hold without allocating
+     */
+    static constexpr size_t inlineCapacity = 6;
+
+    /**
+     * @brief builds a string by letting `fill` write straight into its storage, with no intermediate copy
+     * @param fill called once as `fill(uChar* out)`, writing at most `maxChars` uChars and returning how many it wrote
+     */
+    template <typename Fill>
+    static Utf8String build(size_t maxChars, Fill&& fill) {
+        Utf8String str;
+        str.reserve(maxChars);
+        str.setLength(fill(str.buffer()));
+        return str;
+    }
+
     /**
      * @brief a helper static constructor that builds a Utf8String straight from
      * a file
@@ -156,6 +216,11 @@ public:
      */
     static Utf8String fromFile(const char* filePath);
 
+    /**
+     * @brief encodes the string back into a contiguous utf8 `std::string`
+     */
+    std::string toUtf8() const;
+
     //Friend overrides to allow the stream operator, and this types view to access members
     friend std::ostream& operator<<(std::ostream& os, const Utf8String& str);
     friend Utf8StringView;
@@ -166,6 +231,16 @@ public:
      */
     bool operator<(const Utf8String& other) const;
 
+    /**
+     * @brief checks if this string holds the same charachters as `other`
+     */
+    bool operator==(const Utf8StringView& other) const;
+
+    /**
+     * @brief creates a new string holding this string followed by `other`
+     */
+    Utf8String operator+(const Utf8StringView& other) const;
+
     /**
      * @brief an overload to provide direct indexing into the string
      */
@@ -196,12 +271,6 @@ public:
      */
     Utf8StringView view(size_t startIndx, size_t endIndx) const;
 
-    /**
-     * @brief a method that is required to be run before printing utf8 strings
-     * @note untested for multiple platforms, and possibly redundant on some
-     */
-    static void setLocale();
-
 private:
     /**
      * @brief expands a packed utf8 byte array into the data member of this string
@@ -209,12 +278,55 @@ private:
      */
     uint32_t expandUtf8(const char* bytes, size_t len);
 
+    //Set in `lenAndFlag` once the uChars live on the heap
+    static constexpr size_t heapFlag = ~(SIZE_MAX >> 1);
+
+    bool isInline() const noexcept { return (lenAndFlag & heapFlag) == 0; }
+    size_t length() const noexcept { return lenAndFlag & ~heapFlag; }
+    size_t capacity() const noexcept { return isInline() ? inlineCapacity : heap.cap; }
+    uChar* buffer() noexcept { return isInline() ? local : heap.ptr; }
+    const uChar* buffer() const noexcept { return isInline() ? local : heap.ptr; }
+    void setLength(size_t count) noexcept { lenAndFlag = count | (lenAndFlag & heapFlag); }
+
     /**
-     * @brief the actual data container for the expanded uChars the string manages
+     * @brief makes room for at least `count` uChars, moving onto the heap if they no longer fit inline
      */
-    std::vector<uChar> data;
+    void reserve(size_t count);
+
+    /**
+     * @brief copies `count` uChars onto the end of the string
+     */
+    void append(const uChar* chars, size_t count);
+
+    /**
+     * @brief moves the uChars of `other` into this string, leaving `other` empty
+     * @warning any heap storage this string had must already be released
+     */
+    void takeStorage(Utf8String& other) noexcept;
+
+    /**
+     * @brief frees any heap storage and leaves the string empty and inline
+     */
+    void release() noexcept;
+
+    /**
+     * @brief the storage for the expanded uChars the string manages, which is either the uChars
+     * themselves or a pointer to them on the heap
+     */
+    union {
+        struct {
+            uChar* ptr;
+            size_t cap;
+        } heap;
+        uChar local[inlineCapacity];
+    };
+
+    //The number of uChars held, with `heapFlag` marking heap storage
+    size_t lenAndFlag;
 };
 
+static_assert(sizeof(Utf8String) == 32, "Utf8String is meant to fill exactly half a cache line");
+
 /**
  * @brief a constructor that implements the custom suffix operators of C++, allowing for utf8 string creation
  * for anything instantiated with "..."_utf8
@@ -270,12 +382,50 @@ public:
      * @note this will check if the data is the same, not the internal pointers
      */
     bool operator==(const Utf8String& other) const;
+    bool operator==(const Utf8StringView& other) const;
 
     /**
      * @brief provides a lexigraphical compare between two string views so they can be used as map keys
      */
     bool operator<(const Utf8StringView& other) const;
 
+    /**
+     * @brief a three way lexigraphical compare, in the same order as `operator<`
+     * @returns a negative number, zero, or a positive number as this view sorts before, equal to, or after `other`
+     */
+    int compare(const Utf8StringView& other) const noexcept;
+
+    /**
+     * @brief returned by every search when nothing was found
+     */
+    static constexpr size_t npos = SIZE_MAX;
+
+    /**
+     * @brief finds the first `c` at or after `from`
+     * @returns the index of the match, or `npos`
+     * @note this and every other search scans four uChars at a time with SSE2 where it is available
+     */
+    size_t find(uChar c, size_t from = 0) const noexcept;
+
+    /**
+     * @brief finds the first run of `needle` starting at or after `from`
+     * @returns the index the match starts at, or `npos`. An empty needle matches at `from`
+     */
+    size_t find(const Utf8StringView& needle, size_t from = 0) const noexcept;
+
+    /**
+     * @brief finds the first uChar at or after `from` that is any of the uChars in `set`
+     * @returns the index of the match, or `npos`
+     * @note meant for small sets, since every uChar of the set is checked against every position
+     */
+    size_t findAny(const Utf8StringView& set, size_t from = 0) const noexcept;
+
+    /**
+     * @brief checks if `c`, or a run of `needle`, is anywhere in the view
+     */
+    bool contains(uChar c) const noexcept;
+    bool contains(const Utf8StringView& needle) const noexcept;
+
     /**
      * @brief provides subscript access (non owning only) to a given view
      */
@@ -302,12 +452,22 @@ public:
      */
     Utf8String toOwned() const;
 
+    /**
+     * @brief encodes the view into a contiguous utf8 `std::string`
+     */
+    std::string toUtf8() const;
+
     /**
      * @brief checks to see if the view was created over an empty span
      * @returns true if the internal pointer is `nullptr`, false otherwise
      */
     bool isEmpty() const noexcept;
 
+    /**
+     * @brief gets a pointer to the first uChar the view covers
+     */
+    const uChar* getDataPointer() const noexcept;
+
 private:
     //The data pointer of the span
     const uChar* start;
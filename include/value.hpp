@@ -0,0 +1,226 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "utf8string.hpp"
+#include "fl_util.hpp"
+#include <stdint.h>
+#include <cstring>
+#include <vector>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Constant                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief covers every kind of value that can be written directly into a script as a literal
+ */
+enum class ConstantType : uint8_t {
+    Nil,
+    Bool,
+    Int,
+    Float,
+    String
+};
+
+/**
+ * @brief a compile time constant, produced from literal tokens and carried through the IR
+ * into the constant table of the emitted bytecode
+ * @note only the member matching `type` is meaningful, with bools stored in `intVal`
+ */
+struct Constant {
+    ConstantType type = ConstantType::Nil;
+    int64_t intVal = 0;
+    double floatVal = 0.0;
+    Utf8String strVal;
+
+    /**
+     * @brief checks if two constants hold the same value, floats are compared bitwise so that
+     * constants like `-0.0` and `0.0` stay distinct
+     */
+    bool operator==(const Constant& other) const {
+        if (type != other.type) {
+            return false;
+        }
+        switch (type) {
+            case ConstantType::Bool:
+            case ConstantType::Int: { return intVal == other.intVal; }
+            case ConstantType::Float: { return std::memcmp(&floatVal, &other.floatVal, sizeof(double)) == 0; }
+            case ConstantType::String: { return other.strVal.view() == strVal; }
+            default: { return true; }
+        }
+    }
+};
+
+/**
+ * @brief prints a constant in the form it would be written in a script
+ */
+std::ostream& operator<<(std::ostream& os, const Constant& constant);
+
+/**
+ * @brief converts the text of a `Number` token straight from its uChars, without any intermediate copies
+ * @details text with a `.` becomes a float and anything else an int. Floats whose digits fit exactly
+ * in a double, which covers nearly every literal written by hand, are built with a single exact
+ * multiply or divide, and only longer literals fall back to `std::from_chars`
+ * @returns the constant, or an error if the text is not a number or an int literal overflows
+ */
+Result<Constant, Utf8String> constantFromNumber(const Utf8StringView& text);
+
+/**
+ * @brief hashes a constant by its type and value, matching `Constant::operator==`
+ */
+struct ConstantHash {
+    size_t operator()(const Constant& constant) const noexcept;
+};
+
+/*======================================================================================================*/
+/*                                        ConstantPool                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief an append only table of constants where every distinct constant is stored exactly once
+ */
+class ConstantPool {
+public:
+    /**
+     * @brief gets the index of a constant, adding it to the pool if it has not been seen before
+     */
+    uint32_t intern(const Constant& constant);
+
+    const Constant& operator[](size_t index) const noexcept {
+        return constants[index];
+    }
+
+    size_t size() const noexcept {
+        return constants.size();
+    }
+
+    auto begin() const noexcept {
+        return constants.begin();
+    }
+
+    auto end() const noexcept {
+        return constants.end();
+    }
+
+    /**
+     * @brief gives the constants in the order they were added
+     */
+    const std::vector<Constant>& entries() const noexcept {
+        return constants;
+    }
+
+    void clear() noexcept {
+        constants.clear();
+        indices.clear();
+    }
+
+private:
+    std::vector<Constant> constants;
+    FlatMap<Constant, uint32_t, ConstantHash> indices;
+};
+
+/*======================================================================================================*/
+/*                                            Value                                                     */
+/*======================================================================================================*/
+
+/**
+ * @brief the runtime type held by a value
+ * @note the order matches `ConstantType`, so constants convert by value
+ */
+enum class ValueType : uint8_t {
+    Nil,
+    Bool,
+    Int,
+    Float,
+    String
+};
+
+/**
+ * @brief prints a value type using the name it is declared with in a script
+ */
+std::ostream& operator<<(std::ostream& os, const ValueType type);
+
+class Heap;
+
+/**
+ * @brief a string living on the heap of the VM that made it
+ */
+struct StringObject {
+    Utf8String text;
+
+    //Links the old generation, and points at the promoted copy once a nursery object survives a collection
+    StringObject* next = nullptr;
+
+    //Strings cross isolates as captures of parallel loops, so collections skip the ones they don't own
+    const Heap* owner = nullptr;
+
+    //The epoch of the last major collection that reached this object
+    uint32_t mark = 0;
+};
+
+/**
+ * @brief a single runtime value, small enough to copy around registers freely
+ * @note strings are held by pointer and owned by the VM that created them
+ */
+struct Value {
+    ValueType type = ValueType::Nil;
+    union {
+        bool boolVal;
+        int64_t intVal = 0;
+        double floatVal;
+        StringObject* strVal;
+    };
+
+    static constexpr Value fromBool(bool b) noexcept {
+        Value v;
+        v.type = ValueType::Bool;
+        v.boolVal = b;
+        return v;
+    }
+
+    static constexpr Value fromInt(int64_t i) noexcept {
+        Value v;
+        v.type = ValueType::Int;
+        v.intVal = i;
+        return v;
+    }
+
+    static constexpr Value fromFloat(double f) noexcept {
+        Value v;
+        v.type = ValueType::Float;
+        v.floatVal = f;
+        return v;
+    }
+
+    static constexpr Value fromString(StringObject* str) noexcept {
+        Value v;
+        v.type = ValueType::String;
+        v.strVal = str;
+        return v;
+    }
+
+    /**
+     * @brief checks if a value counts as true for branches, where only nil and false are false
+     */
+    constexpr bool isTruthy() const noexcept {
+        return (type != ValueType::Nil) && ((type != ValueType::Bool) || boolVal);
+    }
+};
+
+/**
+ * @brief prints a value as a script would show it, with strings left unquoted
+ */
+std::ostream& operator<<(std::ostream& os, const Value& value);
+
+} //end namespace fl
@@ -0,0 +1,386 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include "budget.hpp"
+#include "bytecode.hpp"
+#include "heap.hpp"
+#include "scheduler.hpp"
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+namespace fl {
+
+class Profiler;
+
+/*======================================================================================================*/
+/*                                       Execution State                                                */
+/*======================================================================================================*/
+
+/**
+ * @brief a single active function call
+ */
+struct CallFrame {
+    uint32_t function;      //Index into the function table
+    uint32_t pc;            //Where to resume once a call made from this frame returns
+    uint32_t base;          //The first register of this frame in `ExecutionState::registers`
+    uint16_t returnReg;     //The register in the calling frame that receives the result
+};
+
+/**
+ * @brief everything one thread of execution needs to run, kept apart from the VM so that execution
+ * never lives on the native stack, and can be paused and picked back up
+ */
+struct ExecutionState {
+    std::vector<Value> registers;
+    std::vector<CallFrame> frames;
+};
+
+/**
+ * @brief a handle to a script call that can be suspended inside a host call and resumed later, which is
+ * only valid on the VM that spawned it, and only until it finishes
+ */
+struct Coroutine {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+};
+
+/**
+ * @brief why a resumed coroutine stopped running
+ */
+enum class CoroutineStatus : uint8_t {
+    Suspended,      //Waiting on a host call, whose token is in `CoroutineStep::value`
+    Finished        //Returned, with its result in `CoroutineStep::value`
+};
+
+/**
+ * @brief where a coroutine got to after being resumed
+ */
+struct CoroutineStep {
+    CoroutineStatus status;
+    Value value;
+};
+
+/*======================================================================================================*/
+/*                                              VM                                                      */
+/*======================================================================================================*/
+
+/**
+ * @brief runs the code of a linked module
+ * @details the interpreter loop is not recursive, script calls only push a `CallFrame`. A callees
+ * frame starts on the callers argument window, so arguments are already in place and a call is
+ * a single lookup into the function table. Calling a stub compiles and links its function into the module first.
+ * Host functions are called straight through their thunk, and may call back into the VM
+ *
+ * Every VM is an isolate, with its own registers, frames and heap, so any number of them can run the same
+ * shared module at once as long as each is only driven by one thread at a time
+ *
+ * A `@parallel for` splits its iterations across the VM's scheduler, if it has one. Chunks run on the
+ * calling thread use this VM, while every other slot of the scheduler gets a worker VM of its own over
+ * the same module, made the first time a chunk lands on it. Without a scheduler, the whole loop runs
+ * as one chunk on this VM
+ *
+ * A coroutine owns an `ExecutionState` of its own, which is swapped in whenever it is resumed. A host
+ * function can suspend the coroutine calling it through `suspend`, leaving its frames exactly where they
+ * are, so a suspended coroutine costs only its registers and frames, and any number of them can be
+ * waiting on the host from a single thread
+ *
+ * Strings live on a generational `Heap`, collected only at safepoints in the interpreter loop, right after
+ * an instruction that can allocate. The roots are the constants, and the registers of every frame still
+ * running or suspended in a coroutine, while registers past the top frame are dead and cleared. Nothing
+ * is collected while a host function is running or a parallel loop is split, since either can hold values
+ * the roots don't see
+ *
+ * Strings, registers, frames and lazily compiled code are all charged to the VM's `MemoryAccount`, and a
+ * crossed limit is enforced at the next safepoint, after a full collection has freed whatever it can.
+ * Concatenating strings checks the hard limit before allocating, and calls check it once their frame is
+ * pushed, so a runaway script stops with a runtime error instead of taking the process down with it
+ *
+ * With a `Profiler` attached, the VM checks for a new tick at every call and backward jump, and samples
+ * its own frames when there is one, so a profiler that isn't ticking costs a load and a compare there
+ */
+class VM {
+public:
+    /**
+     * @brief creates a VM for a linked module, materializing its constants once up front
+     * @note stubs are compiled into `module` when first called
+     * @warning the module must outlive the VM
+     */
+    explicit VM(Module& module);
+
+    /**
+     * @brief creates a VM for a module shared read only between isolates, which it keeps alive
+     * @note the module is never changed, so calling a function that is still a stub is an error
+     */
+    explicit VM(std::shared_ptr<const Module> sharedModule);
+
+    //The VM owns every string it creates, so it can't be copied
+    VM(const VM&) = delete;
+    VM& operator=(const VM&) = delete;
+
+    /**
+     * @brief frees every object the VM created
+     */
+    ~VM();
+
+    /**
+     * @brief calls a function by its index in the function table and runs it to completion
+     * @returns the value the function returned, or a description of the runtime error that stopped it
+     */
+    Result<Value, Utf8String> call(uint32_t function, const std::vector<Value>& args);
+    Result<Value, Utf8String> call(uint32_t function, const Value* args, size_t argCount);
+
+    /**
+     * @brief sets up a call to a function as a coroutine, without running any of it yet
+     * @returns the handle to resume it through, or why the function could not be called
+     */
+    Result<Coroutine, Utf8String> spawn(uint32_t function, const Value* args, size_t argCount);
+
+    /**
+     * @brief runs a coroutine until it suspends again or returns, where `sent` becomes the result of the
+     * host call it was suspended in, and is ignored the first time it is resumed
+     * @returns where the coroutine stopped, or the runtime error that stopped it
+     * @note a coroutine that finishes or fails is freed, and its handle is no longer valid
+     * @warning a host function with a typed return must be sent a value of that type
+     */
+    Result<CoroutineStep, Utf8String> resume(Coroutine coroutine, const Value& sent);
+
+    /**
+     * @brief frees a coroutine without running the rest of it
+     */
+    void cancel(Coroutine coroutine);
+
+    /**
+     * @brief checks that a handle still refers to a coroutine that has not finished
+     */
+    bool isAlive(Coroutine coroutine) const noexcept {
+        return (coroutine.index < coroutines.size()) && coroutines[coroutine.index].alive && (coroutines[coroutine.index].generation == coroutine.generation);
+    }
+
+    /**
+     * @brief gets the number of coroutines spawned on this VM that have not finished yet
+     */
+    size_t getCoroutineCount() const noexcept {
+        return coroutines.size() - freeCoroutines.size();
+    }
+
+    /**
+     * @brief called by a host function to suspend the coroutine calling it once the function returns,
+     * handing `token` back to whoever resumed it
+     * @note suspending anywhere other than directly inside a coroutine is a runtime error, including from a
+     * script the host called back into, since that call is still on the host's native stack
+     */
+    void suspend(const Value& token) noexcept {
+        suspending = true;
+        suspendToken = token;
+    }
+
+    /**
+     * @brief creates a string value owned by this VM
+     * @note values held outside the VM's registers, like arguments being built for a call, stay valid until
+     * the VM next runs
+     */
+    Value newString(Utf8String&& text);
+
+    /**
+     * @brief runs a major collection and sweeps it to completion, giving back any registers and frames
+     * left over from deeper calls
+     * @note does nothing when called from inside a host function, since the host may hold values the
+     * roots don't see
+     */
+    void collectGarbage();
+
+    const HeapStats& getHeapStats() const noexcept {
+        return heap.getStats();
+    }
+
+    /**
+     * @brief sets the limits this isolate runs under, which workers running its parallel loops share the
+     * hard limit of
+     */
+    void setMemoryBudget(const MemoryBudget& budget);
+
+    const MemoryUsage& getMemoryUsage() const noexcept {
+        return account.getUsage();
+    }
+
+    /**
+     * @brief splits the iterations of parallel loops across `pool`, or runs them on the calling thread when null
+     * @warning the pool must outlive the VM, or be swapped out first
+     */
+    void setScheduler(TaskScheduler* pool) noexcept {
+        scheduler = pool;
+    }
+
+    /**
+     * @brief samples this VM, and workers running its parallel loops, into `sampler`, or stops sampling when null
+     * @warning the profiler must outlive the VM, or be swapped out first
+     */
+    void setProfiler(Profiler* sampler);
+
+private:
+    /**
+     * @brief creates a worker that runs chunks of parallel loops for another VM, never changing the module
+     */
+    VM(const Module& module, const std::shared_ptr<const Module>& sharedModule);
+
+    /**
+     * @brief the interpreter loop, which runs until the frame count drops back to `entryDepth`
+     */
+    Result<Value, Utf8String> run(size_t entryDepth);
+
+    /**
+     * @brief the execution state of a coroutine, which is only swapped out while it is running
+     */
+    struct CoroutineSlot {
+        ExecutionState state;
+        uint32_t generation = 0;
+
+        //The register in the top frame that receives whatever it is resumed with
+        uint16_t resumeReg = 0;
+        bool alive = false;
+        bool started = false;
+        bool running = false;
+    };
+
+    /**
+     * @brief checks a function can be called with `argCount` arguments, compiling it if it is a stub
+     */
+    std::optional<Utf8String> checkCall(uint32_t function, size_t argCount);
+
+    /**
+     * @brief frees a coroutine's state, and bumps its generation so stale handles to it are caught
+     */
+    void release(uint32_t coroutine);
+
+    /**
+     * @brief collects or sweeps once the heap asks for it, and enforces the budget once a limit is crossed,
+     * at a point where every live value is in a root
+     * @returns false if the isolate is still over its hard limit after collecting
+     */
+    bool safepoint() {
+        if (heap.needsCollection() || heap.isSweeping() || account.isFlagged()) {
+            return collectAtSafepoint();
+        }
+        return true;
+    }
+
+    bool collectAtSafepoint();
+
+    /**
+     * @brief collects everything it can to make room for `bytes` more under the hard limit
+     * @returns whether they fit afterwards
+     */
+    bool reclaim(size_t bytes);
+
+    /**
+     * @brief grows a state's registers to fit a frame and pushes it, charging for any memory that took
+     */
+    void enterFrame(ExecutionState& execution, const CallFrame& frame, uint32_t frameSize);
+
+    /**
+     * @brief charges or refunds however much a state's registers and frames have changed in capacity
+     */
+    void recharge(const ExecutionState& execution, size_t registerCapacity, size_t frameCapacity);
+
+    /**
+     * @brief runs a collection over every root, clearing the dead registers past each top frame
+     */
+    void collect(bool forceMajor);
+    void visitState(ExecutionState& execution);
+
+    /**
+     * @brief the number of registers from the bottom of a state up to the end of its top frame
+     */
+    size_t liveRegisters(const ExecutionState& execution) const;
+
+    /**
+     * @brief takes a sample once the profiler has ticked since the last one, where `pc` is the instruction
+     * the top frame is running
+     */
+    void sampleIfDue(uint32_t pc);
+
+    /**
+     * @brief compiles a function if it is still a stub, and materializes any constants it added to the module
+     */
+    std::optional<Utf8String> prepare(uint32_t function);
+
+    /**
+     * @brief turns every module constant the VM hasn't seen yet into a runtime value
+     */
+    void materializeConstants();
+
+    /**
+     * @brief builds a runtime error that names the function it happened in, and unwinds every frame
+     * above `entryDepth`
+     */
+    Result<Value, Utf8String> raise(const Utf8String& message, size_t entryDepth);
+    Result<Value, Utf8String> raise(const char* message, size_t entryDepth);
+
+    /**
+     * @brief the generic arithmetic path, taken when operand types could not be proven statically
+     * @returns nullptr on success, or a message describing why the operation failed
+     */
+    const char* arithmetic(OpCode op, const Value& lhs, const Value& rhs, Value& out);
+
+    /**
+     * @brief runs a parallel loop body over its whole range, split across the scheduler when there is one
+     * @param args the body's arguments, starting with the range and the reduction's starting value
+     * @returns the reduction combined over every chunk, or the first error one of them raised
+     */
+    Result<Value, Utf8String> runParallel(uint32_t body, const Value* args, size_t argCount);
+
+    /**
+     * @brief compiles every stub left in the module, since workers can never change it
+     * @returns false if some function failed to compile
+     */
+    bool compileEverything();
+
+    const Module& module;
+
+    //Set only when this VM may compile stubs into its module
+    Module* compilable = nullptr;
+
+    //Holds onto a module shared between isolates
+    std::shared_ptr<const Module> shared;
+
+    std::vector<Value> constants;
+    ExecutionState state;
+
+    //Every string the VM has made, charged to the account ahead of it, and the number of host calls and split
+    //parallel loops holding collections off
+    MemoryAccount account;
+    Heap heap{account};
+    uint32_t hostDepth = 0;
+    bool splitting = false;
+
+    //Every coroutine spawned here, with the slots of finished ones reused by later spawns
+    std::vector<CoroutineSlot> coroutines;
+    std::vector<uint32_t> freeCoroutines;
+
+    //Set while a coroutine is running, and by a host function asking to suspend it
+    bool suspendable = false;
+    bool suspending = false;
+    Value suspendToken;
+    uint16_t suspendedReg = 0;
+
+    //Where parallel loops are split, and a worker for each slot of it that has run a chunk
+    TaskScheduler* scheduler = nullptr;
+    std::vector<std::unique_ptr<VM>> workers;
+    bool fullyCompiled = false;
+
+    //Where samples go, and the profiler tick the last one was taken on
+    Profiler* profiler = nullptr;
+    uint32_t sampledTick = 0;
+};
+
+} //end namespace fl
@@ -0,0 +1,70 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "budget.hpp"
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Memory Usage                                                */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const MemoryKind kind) {
+    switch (kind) {
+        case MemoryKind::Strings: { return os << "strings"; }
+        case MemoryKind::Registers: { return os << "registers"; }
+        case MemoryKind::Frames: { return os << "frames"; }
+        case MemoryKind::Compiled: { return os << "compiled"; }
+        default: { return os << "unknown"; }
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage) {
+    for (size_t i = 0; i < memoryKindCount; i++) {
+        os << static_cast<MemoryKind>(i) << ": " << usage.bytes[i] << " bytes\n";
+    }
+    os << "total: " << usage.total << " bytes, peak: " << usage.peak << " bytes\n";
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                         Memory Account                                               */
+/*======================================================================================================*/
+
+void MemoryAccount::setBudget(MemoryBudget limits) {
+    budget = std::move(limits);
+    softFired = false;
+    pickNextCheck();
+    flagged = usage.total > nextCheck;
+}
+
+void MemoryAccount::pickNextCheck() noexcept {
+    const size_t hard = (budget.hardLimit == 0) ? SIZE_MAX : budget.hardLimit;
+    const size_t soft = ((budget.softLimit == 0) || softFired) ? SIZE_MAX : budget.softLimit;
+    nextCheck = std::min(hard, soft);
+}
+
+void MemoryAccount::settle() {
+    flagged = false;
+    const bool overSoft = (budget.softLimit != 0) && (usage.total > budget.softLimit);
+    if (overSoft && !softFired) {
+        //Fires once per crossing, and is rearmed once a collection brings the isolate back under it
+        softFired = true;
+        if (budget.onSoftLimit) {
+            budget.onSoftLimit(usage);
+        }
+    } else if (!overSoft) {
+        softFired = false;
+    }
+    pickNextCheck();
+}
+
+} //end namespace fl
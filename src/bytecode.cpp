@@ -0,0 +1,427 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "bytecode.hpp"
+#include "instrument.hpp"
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          OpCode                                                      */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const OpCode op) {
+    switch (op) {
+        case OpCode::LoadK: { os << "LOADK"; return os; }
+        case OpCode::Move: { os << "MOVE"; return os; }
+        case OpCode::Add: { os << "ADD"; return os; }
+        case OpCode::Sub: { os << "SUB"; return os; }
+        case OpCode::Mul: { os << "MUL"; return os; }
+        case OpCode::Div: { os << "DIV"; return os; }
+        case OpCode::Mod: { os << "MOD"; return os; }
+        case OpCode::Neg: { os << "NEG"; return os; }
+        case OpCode::Not: { os << "NOT"; return os; }
+        case OpCode::LessThan: { os << "LT"; return os; }
+        case OpCode::LessEqual: { os << "LE"; return os; }
+        case OpCode::GreaterThan: { os << "GT"; return os; }
+        case OpCode::GreaterEqual: { os << "GE"; return os; }
+        case OpCode::Equals: { os << "EQ"; return os; }
+        case OpCode::NotEquals: { os << "NE"; return os; }
+        case OpCode::AddInt: { os << "ADDI"; return os; }
+        case OpCode::SubInt: { os << "SUBI"; return os; }
+        case OpCode::MulInt: { os << "MULI"; return os; }
+        case OpCode::DivInt: { os << "DIVI"; return os; }
+        case OpCode::ModInt: { os << "MODI"; return os; }
+        case OpCode::NegInt: { os << "NEGI"; return os; }
+        case OpCode::AddFloat: { os << "ADDF"; return os; }
+        case OpCode::SubFloat: { os << "SUBF"; return os; }
+        case OpCode::MulFloat: { os << "MULF"; return os; }
+        case OpCode::DivFloat: { os << "DIVF"; return os; }
+        case OpCode::NegFloat: { os << "NEGF"; return os; }
+        case OpCode::LessThanInt: { os << "LTI"; return os; }
+        case OpCode::LessEqualInt: { os << "LEI"; return os; }
+        case OpCode::GreaterThanInt: { os << "GTI"; return os; }
+        case OpCode::GreaterEqualInt: { os << "GEI"; return os; }
+        case OpCode::EqualsInt: { os << "EQI"; return os; }
+        case OpCode::NotEqualsInt: { os << "NEI"; return os; }
+        case OpCode::LessThanFloat: { os << "LTF"; return os; }
+        case OpCode::LessEqualFloat: { os << "LEF"; return os; }
+        case OpCode::GreaterThanFloat: { os << "GTF"; return os; }
+        case OpCode::GreaterEqualFloat: { os << "GEF"; return os; }
+        case OpCode::EqualsFloat: { os << "EQF"; return os; }
+        case OpCode::NotEqualsFloat: { os << "NEF"; return os; }
+        case OpCode::Check: { os << "CHECK"; return os; }
+        case OpCode::Jump: { os << "JMP"; return os; }
+        case OpCode::JumpIfTrue: { os << "JMPT"; return os; }
+        case OpCode::JumpIfFalse: { os << "JMPF"; return os; }
+        case OpCode::Call: { os << "CALL"; return os; }
+        case OpCode::CallHost: { os << "CALLH"; return os; }
+        case OpCode::ParallelFor: { os << "PARFOR"; return os; }
+        case OpCode::Return: { os << "RET"; return os; }
+        case OpCode::ReturnNil: { os << "RETNIL"; return os; }
+        default: { os << "UNKNOWN"; return os; }
+    }
+}
+
+/*======================================================================================================*/
+/*                                         Disassembly                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief prints a run of instructions, where `calleeName` maps the op and `b` operand of a call onto the name
+ * of the function it calls, since that operand means something different before and after linking
+ */
+template <typename Constants, typename CalleeNameFn>
+static void disassemble(std::ostream& os, const Span<const Instruction>& code, uint32_t firstPc, const Constants& constants, CalleeNameFn calleeName) {
+    for (size_t i = 0; i < code.size(); i++) {
+        const Instruction& inst = code[i];
+        os << "  " << (firstPc + i) << "\t" << inst.op << "\t";
+        switch (inst.op) {
+            case OpCode::LoadK: {
+                os << "r" << inst.a << ", " << constants[inst.bx()];
+                break;
+            }
+            case OpCode::Move:
+            case OpCode::Neg:
+            case OpCode::NegInt:
+            case OpCode::NegFloat:
+            case OpCode::Not: {
+                os << "r" << inst.a << ", r" << inst.b;
+                break;
+            }
+            case OpCode::Jump: {
+                os << inst.bx();
+                break;
+            }
+            case OpCode::JumpIfTrue:
+            case OpCode::JumpIfFalse: {
+                os << "r" << inst.a << ", " << inst.bx();
+                break;
+            }
+            case OpCode::Call:
+            case OpCode::CallHost: {
+                os << "r" << inst.a << ", " << calleeName(inst.op, inst.b) << "(r" << inst.c << " x" << static_cast<uint32_t>(inst.argc) << ")";
+                break;
+            }
+            case OpCode::ParallelFor: {
+                os << "r" << inst.a << ", #" << inst.b << "(r" << inst.c << " x" << static_cast<uint32_t>(inst.argc) << ")";
+                break;
+            }
+            case OpCode::Check: {
+                os << "r" << inst.a << ", r" << inst.b << ", " << static_cast<ValueType>(inst.c);
+                break;
+            }
+            case OpCode::Return: {
+                os << "r" << inst.a;
+                break;
+            }
+            case OpCode::ReturnNil: {
+                break;
+            }
+            default: {
+                os << "r" << inst.a << ", r" << inst.b << ", r" << inst.c;
+                break;
+            }
+        }
+        os << std::endl;
+    }
+}
+
+/*======================================================================================================*/
+/*                                        FunctionProto                                                 */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const WithSymbols<FunctionProto>& printed) {
+    const FunctionProto& proto = printed.item;
+    os << "func " << printed.symbols.text(proto.name) << " [arity " << proto.arity << ", frame " << proto.frameSize << "]" << std::endl;
+    disassemble(os, Span<const Instruction>(proto.code.data(), proto.code.size()), 0, proto.constants, [&](OpCode, uint16_t callee) {
+        return printed.symbols.text(proto.callees[callee]);
+    });
+    for (size_t i = 0; i < proto.bodies.size(); i++) {
+        os << "body #" << i << " ";
+        os << WithSymbols{proto.bodies[i], printed.symbols};
+    }
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                           Module                                                     */
+/*======================================================================================================*/
+
+std::optional<uint32_t> Module::findFunction(const Utf8StringView& name) const {
+    std::optional<Symbol> symbol = symbols->find(name);
+    if (!symbol.has_value()) {
+        return std::nullopt;
+    }
+    auto found = functionIndices.find(symbol.value());
+    if (found == functionIndices.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+bool Module::isStub(uint32_t function) const noexcept {
+    return functionTable[function].entryPc == lazyEntryPc;
+}
+
+uint32_t Module::lineAt(uint32_t function, uint32_t pc) const noexcept {
+    const std::vector<SourceLine>& lines = functions[function].lines;
+    const uint32_t offset = pc - functionTable[function].entryPc;
+    auto after = std::upper_bound(lines.begin(), lines.end(), offset, [](uint32_t at, const SourceLine& mark) { return at < mark.pc; });
+    return (after == lines.begin()) ? 0 : (after - 1)->line;
+}
+
+std::optional<Utf8String> Module::compileStub(uint32_t function) {
+    if (!isStub(function)) {
+        return std::nullopt;
+    }
+    if (!lazyCompiler) {
+        return std::optional("Function `"_utf8 + symbols->text(functions[function].name) + "` was never compiled!"_utf8);
+    }
+    auto proto = lazyCompiler(function);
+    if (!proto.isOk()) {
+        return std::optional(proto.errValue());
+    }
+    return linkFunction(*this, function, std::move(proto.okValue()));
+}
+
+//Marks a resolved callee as an index into the host functions rather than the function table
+static constexpr uint32_t hostCallee = 1u << 31;
+
+/**
+ * @brief resolves the callee names of a function into function indices, or host function indices tagged
+ * with `hostCallee`, recording any that don't exist
+ */
+static std::vector<uint32_t> resolveCallees(const Module& module, const FunctionProto& proto, std::vector<Symbol>& unresolved) {
+    std::vector<uint32_t> resolved;
+    resolved.reserve(proto.callees.size());
+    for (Symbol callee : proto.callees) {
+        if (auto found = module.functionIndices.find(callee); found != module.functionIndices.end()) {
+            resolved.push_back(found->second);
+        } else if (auto host = module.hostIndices.find(callee); host != module.hostIndices.end()) {
+            resolved.push_back(host->second | hostCallee);
+        } else {
+            unresolved.push_back(callee);
+            resolved.push_back(0);
+        }
+    }
+    return resolved;
+}
+
+/**
+ * @brief builds the error reported for every call to a function that does not exist
+ */
+static Utf8String unresolvedError(const Module& module, const std::vector<Symbol>& unresolved) {
+    Utf8String message = "Call to undefined function"_utf8;
+    for (size_t i = 0; i < unresolved.size(); i++) {
+        message = message + ((i == 0) ? " `"_utf8 : ", `"_utf8) + module.symbols->text(unresolved[i]) + "`"_utf8;
+    }
+    return message + "!"_utf8;
+}
+
+/**
+ * @brief moves the parallel loop bodies of a function into the module as functions of their own, and points
+ * each of its loops at the function index its body ended up at
+ * @note nested bodies stay with the body they came from, so they are adopted once the walk reaches it
+ */
+static void adoptBodies(Module& module, uint32_t function) {
+    std::vector<FunctionProto> bodies = std::move(module.functions[function].bodies);
+    module.functions[function].bodies.clear();
+    if (bodies.empty()) {
+        return;
+    }
+    const uint32_t firstBody = module.functions.size();
+    for (Instruction& inst : module.functions[function].code) {
+        if (inst.op == OpCode::ParallelFor) {
+            inst.b = static_cast<uint16_t>(firstBody + inst.b);
+        }
+    }
+    for (FunctionProto& body : bodies) {
+        module.functions.push_back(std::move(body));
+    }
+}
+
+/**
+ * @brief appends the code of an already resolved function onto the end of the module, rebasing jumps,
+ * constants and calls onto module wide indices, then points its function table entry at it
+ * @note constants are merged into the module pool, so a literal used across many functions is stored once
+ */
+static std::optional<Utf8String> layOutFunction(Module& module, uint32_t function, const std::vector<uint32_t>& resolved) {
+    const FunctionProto& proto = module.functions[function];
+    for (const Instruction& inst : proto.code) {
+        if (inst.op != OpCode::Call) {
+            continue;
+        }
+        const uint32_t callee = resolved[inst.b];
+        const bool isHost = (callee & hostCallee) != 0;
+        const uint16_t arity = isHost ? module.hostFunctions[callee & ~hostCallee].arity : module.functions[callee].arity;
+        if (arity != inst.argc) {
+            const Symbol name = isHost ? module.hostFunctions[callee & ~hostCallee].name : module.functions[callee].name;
+            return std::optional("Function `"_utf8 + module.symbols->text(name) + "` is called with the wrong number of arguments!"_utf8);
+        }
+    }
+
+    const uint32_t entryPc = module.code.size();
+    std::vector<uint32_t> constantIndices;
+    constantIndices.reserve(proto.constants.size());
+    for (const Constant& constant : proto.constants) {
+        constantIndices.push_back(module.constants.intern(constant));
+    }
+
+    module.code.reserve(module.code.size() + proto.code.size());
+    for (Instruction inst : proto.code) {
+        switch (inst.op) {
+            case OpCode::LoadK: {
+                inst.setBx(constantIndices[inst.bx()]);
+                break;
+            }
+            case OpCode::Jump:
+            case OpCode::JumpIfTrue:
+            case OpCode::JumpIfFalse: {
+                inst.setBx(inst.bx() + entryPc);
+                break;
+            }
+            case OpCode::Call: {
+                if ((resolved[inst.b] & hostCallee) != 0) {
+                    inst.op = OpCode::CallHost;
+                }
+                inst.b = static_cast<uint16_t>(resolved[inst.b] & ~hostCallee);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+        module.code.push_back(inst);
+    }
+    module.functionTable[function] = FunctionDesc{.arity = proto.arity, .frameSize = proto.frameSize, .entryPc = entryPc};
+    return std::nullopt;
+}
+
+std::optional<Utf8String> link(Module& module) {
+    FL_STAGE(Link);
+    //Bodies are only adopted once, so linking again finds them already in place
+    for (size_t i = 0; i < module.functions.size(); i++) {
+        adoptBodies(module, i);
+    }
+    if ((module.functions.size() > UINT16_MAX) || (module.hostFunctions.size() > UINT16_MAX)) {
+        return std::optional("Module has more functions than a call can address!"_utf8);
+    }
+
+    //Names only exist until here, every call after linking goes straight through the function table
+    module.functionIndices.clear();
+    for (size_t i = 0; i < module.functions.size(); i++) {
+        if (module.functions[i].outlined) {
+            continue;
+        }
+        auto [it, inserted] = module.functionIndices.insert({module.functions[i].name, static_cast<uint32_t>(i)});
+        if (!inserted) {
+            return std::optional("Function `"_utf8 + module.symbols->text(module.functions[i].name) + "` is declared more than once!"_utf8);
+        }
+    }
+    module.hostIndices.clear();
+    for (size_t i = 0; i < module.hostFunctions.size(); i++) {
+        const Symbol name = module.hostFunctions[i].name;
+        bool taken = module.functionIndices.contains(name) || !module.hostIndices.insert({name, static_cast<uint32_t>(i)}).second;
+        if (taken) {
+            return std::optional("Function `"_utf8 + module.symbols->text(name) + "` is declared more than once!"_utf8);
+        }
+    }
+
+    //Every function starts as a stub, and only functions with code are laid out now
+    module.functionTable.clear();
+    module.code.clear();
+    module.constants.clear();
+    for (const FunctionProto& proto : module.functions) {
+        module.functionTable.push_back(FunctionDesc{.arity = proto.arity, .frameSize = 0, .entryPc = lazyEntryPc});
+    }
+
+    //Resolve every callee before touching the code, so that all unresolved calls are reported together
+    std::vector<std::vector<uint32_t>> resolved(module.functions.size());
+    std::vector<Symbol> unresolved;
+    for (size_t i = 0; i < module.functions.size(); i++) {
+        resolved[i] = resolveCallees(module, module.functions[i], unresolved);
+    }
+    if (!unresolved.empty()) {
+        return std::optional(unresolvedError(module, unresolved));
+    }
+
+    for (size_t i = 0; i < module.functions.size(); i++) {
+        if (module.functions[i].code.empty()) {
+            continue;
+        }
+        auto error = layOutFunction(module, i, resolved[i]);
+        if (error) {
+            return error;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Utf8String> linkFunction(Module& module, uint32_t function, FunctionProto&& proto) {
+    FL_STAGE(Link);
+    std::vector<Symbol> unresolved;
+    std::vector<uint32_t> resolved = resolveCallees(module, proto, unresolved);
+    if (!unresolved.empty()) {
+        return std::optional(unresolvedError(module, unresolved));
+    }
+    module.functions[function] = std::move(proto);
+
+    //Its parallel loop bodies are new functions, which are linked in along with it
+    const size_t firstBody = module.functions.size();
+    adoptBodies(module, function);
+    for (size_t i = firstBody; i < module.functions.size(); i++) {
+        adoptBodies(module, i);
+    }
+    if (module.functions.size() > UINT16_MAX) {
+        return std::optional("Module has more functions than a call can address!"_utf8);
+    }
+    for (size_t i = firstBody; i < module.functions.size(); i++) {
+        module.functionTable.push_back(FunctionDesc{.arity = module.functions[i].arity, .frameSize = 0, .entryPc = lazyEntryPc});
+        std::vector<uint32_t> bodyResolved = resolveCallees(module, module.functions[i], unresolved);
+        if (!unresolved.empty()) {
+            return std::optional(unresolvedError(module, unresolved));
+        }
+        auto error = layOutFunction(module, i, bodyResolved);
+        if (error) {
+            return error;
+        }
+    }
+    return layOutFunction(module, function, resolved);
+}
+
+std::ostream& operator<<(std::ostream& os, const Module& module) {
+    //Unlinked modules only have their per function code to show
+    if (module.functionTable.size() != module.functions.size()) {
+        for (const FunctionProto& proto : module.functions) {
+            os << WithSymbols{proto, *module.symbols} << std::endl;
+        }
+        return os;
+    }
+
+    for (size_t i = 0; i < module.functions.size(); i++) {
+        const FunctionDesc& desc = module.functionTable[i];
+        if (module.isStub(i)) {
+            os << "func #" << i << " " << module.symbols->text(module.functions[i].name) << " [arity " << desc.arity << ", not compiled yet]" << std::endl << std::endl;
+            continue;
+        }
+        const uint32_t endPc = desc.entryPc + module.functions[i].code.size();
+        os << "func #" << i << " " << module.symbols->text(module.functions[i].name) << (module.functions[i].outlined ? " parallel body" : "")
+           << " [arity " << desc.arity << ", frame " << desc.frameSize << ", entry " << desc.entryPc << "]" << std::endl;
+        disassemble(os, Span<const Instruction>(module.code.data() + desc.entryPc, endPc - desc.entryPc), desc.entryPc, module.constants, [&](OpCode op, uint16_t callee) {
+            return module.symbols->text((op == OpCode::CallHost) ? module.hostFunctions[callee].name : module.functions[callee].name);
+        });
+        os << std::endl;
+    }
+    return os;
+}
+
+} //end namespace fl
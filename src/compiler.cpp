@@ -0,0 +1,471 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "compiler.hpp"
+#include "ir_passes.hpp"
+#include "instrument.hpp"
+#include "transcode.hpp"
+#include <algorithm>
+#include <string>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                       Out of SSA Tools                                               */
+/*======================================================================================================*/
+
+/**
+ * @brief places an empty block on every edge that leaves a branching block and enters a block with
+ * several predecessors, so that phi moves always have a block of their own to live in
+ */
+static void splitCriticalEdges(IRFunction& func) {
+    const size_t blockCount = func.blocks.size();
+    for (BlockId b = 0; b < blockCount; b++) {
+        if (func.blocks[b].succs.size() < 2) {
+            continue;
+        }
+        for (size_t s = 0; s < func.blocks[b].succs.size(); s++) {
+            BlockId succ = func.blocks[b].succs[s];
+            if (func.blocks[succ].preds.size() < 2) {
+                continue;
+            }
+
+            //The new block takes the place of b in the successor preds, which keeps phi operands lined up
+            func.blocks.emplace_back();
+            BlockId split = func.blocks.size() - 1;
+            func.insts.push_back(IRInst{.op = IROp::Jump, .block = split});
+            func.insts.back().targets[0] = succ;
+            func.blocks[split].insts.push_back(func.insts.size() - 1);
+            func.blocks[split].preds.push_back(b);
+            func.blocks[split].succs.push_back(succ);
+
+            auto& succPreds = func.blocks[succ].preds;
+            *std::find(succPreds.begin(), succPreds.end(), b) = split;
+            func.blocks[b].succs[s] = split;
+            IRInst& term = func.insts[func.blocks[b].insts.back()];
+            for (BlockId& target : term.targets) {
+                if (target == succ) {
+                    target = split;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief emits a set of moves that all happen at once, ordering them so no source is overwritten
+ * before it is read, and breaking cycles through `scratch`
+ */
+static void emitParallelMoves(std::vector<Instruction>& code, std::vector<std::pair<uint16_t, uint16_t>> moves, uint16_t scratch) {
+    std::erase_if(moves, [](const auto& move) { return move.first == move.second; });
+    while (!moves.empty()) {
+        bool emitted = false;
+        for (size_t i = 0; i < moves.size(); i++) {
+            const uint16_t dst = moves[i].first;
+            bool isSource = std::any_of(moves.begin(), moves.end(), [&](const auto& other) {
+                return other.second == dst;
+            });
+            if (!isSource) {
+                code.push_back(Instruction{.op = OpCode::Move, .a = dst, .b = moves[i].second});
+                moves.erase(moves.begin() + i);
+                emitted = true;
+                break;
+            }
+        }
+
+        //Everything left is a cycle, so save one destination off to the side to free it
+        if (!emitted) {
+            const uint16_t dst = moves[0].first;
+            code.push_back(Instruction{.op = OpCode::Move, .a = scratch, .b = dst});
+            for (auto& move : moves) {
+                if (move.second == dst) {
+                    move.second = scratch;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief maps an arithmetic or comparison IR op onto its opcode
+ */
+static constexpr OpCode opCodeFor(IROp op) {
+    switch (op) {
+        case IROp::Add: { return OpCode::Add; }
+        case IROp::Sub: { return OpCode::Sub; }
+        case IROp::Mul: { return OpCode::Mul; }
+        case IROp::Div: { return OpCode::Div; }
+        case IROp::Mod: { return OpCode::Mod; }
+        case IROp::Neg: { return OpCode::Neg; }
+        case IROp::Not: { return OpCode::Not; }
+        case IROp::LessThan: { return OpCode::LessThan; }
+        case IROp::LessEqual: { return OpCode::LessEqual; }
+        case IROp::GreaterThan: { return OpCode::GreaterThan; }
+        case IROp::GreaterEqual: { return OpCode::GreaterEqual; }
+        case IROp::Equals: { return OpCode::Equals; }
+        default: { return OpCode::NotEquals; }
+    }
+}
+
+/**
+ * @brief picks the specialized opcode for an arithmetic or comparison op when every operand is
+ * statically an int, or every operand is statically a float, falling back to the generic opcode
+ */
+static constexpr OpCode specializedOpCodeFor(IROp op, IRType lhs, IRType rhs) {
+    if ((lhs != rhs) || ((lhs != IRType::Int) && (lhs != IRType::Float))) {
+        return opCodeFor(op);
+    }
+    const bool isInt = (lhs == IRType::Int);
+    switch (op) {
+        case IROp::Add: { return isInt ? OpCode::AddInt : OpCode::AddFloat; }
+        case IROp::Sub: { return isInt ? OpCode::SubInt : OpCode::SubFloat; }
+        case IROp::Mul: { return isInt ? OpCode::MulInt : OpCode::MulFloat; }
+        case IROp::Div: { return isInt ? OpCode::DivInt : OpCode::DivFloat; }
+        case IROp::Mod: { return isInt ? OpCode::ModInt : opCodeFor(op); }
+        case IROp::Neg: { return isInt ? OpCode::NegInt : OpCode::NegFloat; }
+        case IROp::LessThan: { return isInt ? OpCode::LessThanInt : OpCode::LessThanFloat; }
+        case IROp::LessEqual: { return isInt ? OpCode::LessEqualInt : OpCode::LessEqualFloat; }
+        case IROp::GreaterThan: { return isInt ? OpCode::GreaterThanInt : OpCode::GreaterThanFloat; }
+        case IROp::GreaterEqual: { return isInt ? OpCode::GreaterEqualInt : OpCode::GreaterEqualFloat; }
+        case IROp::Equals: { return isInt ? OpCode::EqualsInt : OpCode::EqualsFloat; }
+        case IROp::NotEquals: { return isInt ? OpCode::NotEqualsInt : OpCode::NotEqualsFloat; }
+        default: { return opCodeFor(op); }
+    }
+}
+
+/**
+ * @brief maps the static type a guard checks for onto the runtime type the VM sees
+ */
+static constexpr ValueType valueTypeFor(IRType type) {
+    switch (type) {
+        case IRType::Bool: { return ValueType::Bool; }
+        case IRType::Int: { return ValueType::Int; }
+        case IRType::Float: { return ValueType::Float; }
+        case IRType::String: { return ValueType::String; }
+        default: { return ValueType::Nil; }
+    }
+}
+
+/*======================================================================================================*/
+/*                                       Bytecode Emission                                              */
+/*======================================================================================================*/
+
+Result<FunctionProto, Utf8String> emitBytecode(IRFunction& func) {
+    FL_STAGE(Emit);
+    splitCriticalEdges(func);
+    func.computeDominators();
+
+    //Parameters sit in the lowest registers, followed by one register for every other live value
+    std::vector<uint32_t> regs(func.insts.size(), irNone);
+    uint32_t regCount = func.arity;
+    size_t maxArgc = 0;
+    for (BlockId b : func.rpo) {
+        for (ValueId v : func.blocks[b].insts) {
+            const IRInst& inst = func.insts[v];
+            if (inst.op == IROp::Param) {
+                regs[v] = inst.imm;
+            } else if (!isTerminator(inst.op)) {
+                regs[v] = regCount++;
+            }
+            if ((inst.op == IROp::Call) || (inst.op == IROp::ParallelFor)) {
+                maxArgc = std::max(maxArgc, inst.args.size());
+            }
+        }
+    }
+
+    //Calls take their arguments in a contiguous window after the values, followed by a scratch register for moves
+    const uint32_t callBase = regCount;
+    const uint32_t scratch = callBase + maxArgc;
+    if ((scratch + 1) > UINT16_MAX) {
+        return Result<FunctionProto, Utf8String>::Err("Function needs more registers than a frame can hold!"_utf8);
+    }
+
+    FunctionProto proto;
+    proto.name = func.name;
+    proto.arity = func.arity;
+    proto.frameSize = scratch + 1;
+    proto.constants = func.constants.entries();
+    proto.callees = func.callees;
+    proto.reduction = (func.reduction == IROp::Copy) ? OpCode::Move : opCodeFor(func.reduction);
+
+    std::vector<uint32_t> blockStart(func.blocks.size(), 0);
+    std::vector<std::pair<size_t, BlockId>> jumpFixups;
+    auto emitJumpTo = [&](OpCode op, uint16_t cond, BlockId target) {
+        jumpFixups.push_back({proto.code.size(), target});
+        proto.code.push_back(Instruction{.op = op, .a = cond});
+    };
+    //Runs of instructions lowered from the same line share a single mark
+    auto markLine = [&](const IRInst& inst) {
+        if (inst.lineCount == 0) {
+            return;
+        }
+        const SourceLine mark{.pc = static_cast<uint32_t>(proto.code.size()), .line = static_cast<uint32_t>(inst.lineCount)};
+        if (!proto.lines.empty() && (proto.lines.back().line == mark.line)) {
+            return;
+        }
+        if (!proto.lines.empty() && (proto.lines.back().pc == mark.pc)) {
+            proto.lines.back() = mark;
+        } else {
+            proto.lines.push_back(mark);
+        }
+    };
+
+    for (size_t order = 0; order < func.rpo.size(); order++) {
+        const BlockId b = func.rpo[order];
+        const BlockId nextBlock = ((order + 1) < func.rpo.size()) ? func.rpo[order + 1] : irNone;
+        const IRBlock& block = func.blocks[b];
+        blockStart[b] = proto.code.size();
+
+        for (ValueId v : block.insts) {
+            const IRInst& inst = func.insts[v];
+            const uint16_t dst = static_cast<uint16_t>(regs[v]);
+            markLine(inst);
+            switch (inst.op) {
+                case IROp::Param:
+                case IROp::Phi: {
+                    break;
+                }
+                case IROp::Const: {
+                    Instruction load{.op = OpCode::LoadK, .a = dst};
+                    load.setBx(inst.imm);
+                    proto.code.push_back(load);
+                    break;
+                }
+                case IROp::Copy: {
+                    proto.code.push_back(Instruction{.op = OpCode::Move, .a = dst, .b = static_cast<uint16_t>(regs[inst.args[0]])});
+                    break;
+                }
+                case IROp::Neg:
+                case IROp::Not: {
+                    const IRType type = func.insts[inst.args[0]].type;
+                    proto.code.push_back(Instruction{
+                        .op = specializedOpCodeFor(inst.op, type, type),
+                        .a = dst,
+                        .b = static_cast<uint16_t>(regs[inst.args[0]])
+                    });
+                    break;
+                }
+                case IROp::Guard: {
+                    proto.code.push_back(Instruction{
+                        .op = OpCode::Check,
+                        .a = dst,
+                        .b = static_cast<uint16_t>(regs[inst.args[0]]),
+                        .c = static_cast<uint16_t>(valueTypeFor(static_cast<IRType>(inst.imm)))
+                    });
+                    break;
+                }
+                case IROp::Call:
+                case IROp::ParallelFor: {
+                    if (inst.args.size() > UINT8_MAX) {
+                        return Result<FunctionProto, Utf8String>::Err((inst.op == IROp::Call) ? "Function call has too many arguments!"_utf8 :
+                                                                      "Parallel loop reads too many names from outside of it!"_utf8);
+                    }
+                    for (size_t i = 0; i < inst.args.size(); i++) {
+                        proto.code.push_back(Instruction{
+                            .op = OpCode::Move,
+                            .a = static_cast<uint16_t>(callBase + i),
+                            .b = static_cast<uint16_t>(regs[inst.args[i]])
+                        });
+                    }
+                    proto.code.push_back(Instruction{
+                        .op = (inst.op == IROp::Call) ? OpCode::Call : OpCode::ParallelFor,
+                        .argc = static_cast<uint8_t>(inst.args.size()),
+                        .a = dst,
+                        .b = static_cast<uint16_t>(inst.imm),
+                        .c = static_cast<uint16_t>(callBase)
+                    });
+                    break;
+                }
+                case IROp::Jump:
+                case IROp::Branch:
+                case IROp::Return: {
+                    //Terminators are handled once the phi moves are placed
+                    break;
+                }
+                default: {
+                    proto.code.push_back(Instruction{
+                        .op = specializedOpCodeFor(inst.op, func.insts[inst.args[0]].type, func.insts[inst.args[1]].type),
+                        .a = dst,
+                        .b = static_cast<uint16_t>(regs[inst.args[0]]),
+                        .c = static_cast<uint16_t>(regs[inst.args[1]])
+                    });
+                    break;
+                }
+            }
+        }
+
+        //A block with a single successor feeds that successors phis
+        if (block.succs.size() == 1) {
+            const IRBlock& succ = func.blocks[block.succs[0]];
+            const size_t predIndx = std::find(succ.preds.begin(), succ.preds.end(), b) - succ.preds.begin();
+            std::vector<std::pair<uint16_t, uint16_t>> moves;
+            for (ValueId v : succ.insts) {
+                if (func.insts[v].op != IROp::Phi) {
+                    break;
+                }
+                moves.push_back({static_cast<uint16_t>(regs[v]), static_cast<uint16_t>(regs[func.insts[v].args[predIndx]])});
+            }
+            emitParallelMoves(proto.code, std::move(moves), static_cast<uint16_t>(scratch));
+        }
+
+        //Jumps to the block laid out next fall through instead
+        const IRInst& term = func.insts[block.insts.back()];
+        markLine(term);
+        if (term.op == IROp::Jump) {
+            if (term.targets[0] != nextBlock) {
+                emitJumpTo(OpCode::Jump, 0, term.targets[0]);
+            }
+        } else if (term.op == IROp::Branch) {
+            const uint16_t cond = static_cast<uint16_t>(regs[term.args[0]]);
+            if (term.targets[0] == nextBlock) {
+                emitJumpTo(OpCode::JumpIfFalse, cond, term.targets[1]);
+            } else {
+                emitJumpTo(OpCode::JumpIfTrue, cond, term.targets[0]);
+                if (term.targets[1] != nextBlock) {
+                    emitJumpTo(OpCode::Jump, 0, term.targets[1]);
+                }
+            }
+        } else if (term.args.empty()) {
+            proto.code.push_back(Instruction{.op = OpCode::ReturnNil});
+        } else {
+            proto.code.push_back(Instruction{.op = OpCode::Return, .a = static_cast<uint16_t>(regs[term.args[0]])});
+        }
+    }
+
+    for (const auto& [pc, target] : jumpFixups) {
+        proto.code[pc].setBx(blockStart[target]);
+    }
+    return Result<FunctionProto, Utf8String>::Ok(std::move(proto));
+}
+
+/*======================================================================================================*/
+/*                                          Compiler                                                    */
+/*======================================================================================================*/
+
+/**
+ * @brief ends an error with the function it was found in, the way diagnostics name theirs
+ */
+static Utf8String inFunction(const Utf8String& error, const SymbolTable& symbols, Symbol name) {
+    return error + fromValidatedUtf8(" (in `" + symbols.text(name).toUtf8() + "`)").view();
+}
+
+/**
+ * @brief gathers the declared return type of every function, so calls can be typed before their callee is compiled,
+ * along with the return type of every host function that has one
+ */
+static Result<ReturnTypeMap, Utf8String> collectReturnTypes(const FlowParser& parser, const std::vector<HostFunction>& hosts, const SymbolTable& symbols) {
+    ReturnTypeMap returnTypes;
+    for (const HostFunction& host : hosts) {
+        if (host.typedReturn) {
+            //ValueType lines up with IRType, just past its Unknown
+            static_assert(static_cast<uint8_t>(IRType::String) == (static_cast<uint8_t>(ValueType::String) + 1));
+            returnTypes[host.name] = static_cast<IRType>(static_cast<uint8_t>(host.returnType) + 1);
+        }
+    }
+    const auto& ast = parser.getAst();
+    for (size_t funcNode : parser.getFunctionDecs()) {
+        const ASTNode& nameNode = ast[ast[funcNode].children[0]];
+        const ASTNode& retTypeNode = ast[ast[funcNode].children[1]];
+        auto type = typeFromName(retTypeNode.body.text);
+        if (!type.isOk()) {
+            const Token& at = retTypeNode.body;
+            const Utf8String located = renderLocated(at.lineCount, at.charCount, type.errValue().toUtf8().c_str());
+            return Result<ReturnTypeMap, Utf8String>::Err(inFunction(located, symbols, nameNode.body.symbol));
+        }
+        returnTypes[nameNode.body.symbol] = type.okValue();
+    }
+    return Result<ReturnTypeMap, Utf8String>::Ok(std::move(returnTypes));
+}
+
+/**
+ * @brief runs a function's IR through type inference, optimization and emission, along with the outlined
+ * bodies of its parallel loops
+ */
+static Result<FunctionProto, Utf8String> compileIR(IRFunction& func, const ReturnTypeMap& returnTypes) {
+    auto typeError = inferTypes(func, returnTypes);
+    if (typeError) {
+        return Result<FunctionProto, Utf8String>::Err(*typeError);
+    }
+    optimizeIR(func);
+    auto proto = emitBytecode(func);
+    if (!proto.isOk()) {
+        return proto;
+    }
+    for (IRFunction& body : func.bodies) {
+        auto bodyProto = compileIR(body, returnTypes);
+        if (!bodyProto.isOk()) {
+            return bodyProto;
+        }
+        bodyProto.okValue().outlined = true;
+        proto.okValue().bodies.push_back(std::move(bodyProto.okValue()));
+    }
+    return proto;
+}
+
+/**
+ * @brief runs a single parsed function through SSA construction, type inference, optimization and emission
+ * @returns the first error found, naming the function it is in the way diagnostics name theirs
+ */
+static Result<FunctionProto, Utf8String> compileFunction(const FlowParser& parser, size_t funcNode, const ReturnTypeMap& returnTypes, const SymbolTable& symbols) {
+    auto ir = buildIR(parser.getAst(), funcNode);
+    Result<FunctionProto, Utf8String> proto = ir.isOk() ? compileIR(ir.okValue(), returnTypes) : Result<FunctionProto, Utf8String>::Err(ir.errValue());
+    if (proto.isOk()) {
+        return proto;
+    }
+    const Symbol name = parser.getAst()[parser.getAst()[funcNode].children[0]].body.symbol;
+    return Result<FunctionProto, Utf8String>::Err(inFunction(proto.errValue(), symbols, name));
+}
+
+Result<Module, Utf8String> compile(FlowParser& parser, std::shared_ptr<const SymbolTable> symbols, const std::vector<HostFunction>& hosts) {
+    Module module;
+    module.symbols = std::move(symbols);
+    module.hostFunctions = hosts;
+    auto returnTypes = collectReturnTypes(parser, hosts, *module.symbols);
+    if (!returnTypes.isOk()) {
+        return Result<Module, Utf8String>::Err(returnTypes.errValue());
+    }
+
+    //Functions whose bodies were skipped by a lazy parse only get a stub, holding what callers need to link
+    const auto& ast = parser.getAst();
+    const auto& funcDecs = parser.getFunctionDecs();
+    for (size_t i = 0; i < funcDecs.size(); i++) {
+        if (!parser.isBodyParsed(i)) {
+            const ASTNode& funcHead = ast[funcDecs[i]];
+            FunctionProto stub;
+            stub.name = ast[funcHead.children[0]].body.symbol;
+            stub.arity = static_cast<uint16_t>((funcHead.children.size() - 2) / 2);
+            module.functions.push_back(std::move(stub));
+            continue;
+        }
+
+        auto proto = compileFunction(parser, funcDecs[i], returnTypes.okValue(), *module.symbols);
+        if (!proto.isOk()) {
+            return Result<Module, Utf8String>::Err(proto.errValue());
+        }
+        module.functions.push_back(std::move(proto.okValue()));
+    }
+
+    auto linkError = link(module);
+    if (linkError) {
+        return Result<Module, Utf8String>::Err(*linkError);
+    }
+
+    module.lazyCompiler = [&parser, symbols = module.symbols, returnTypes = std::move(returnTypes.okValue())](uint32_t function) {
+        auto parseError = parser.parseFunctionBody(function);
+        if (parseError) {
+            return Result<FunctionProto, Utf8String>::Err(renderDiagnostic(*parseError, *symbols));
+        }
+        return compileFunction(parser, parser.getFunctionDecs()[function], returnTypes, *symbols);
+    };
+    return Result<Module, Utf8String>::Ok(std::move(module));
+}
+
+} //end namespace fl
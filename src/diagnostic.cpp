@@ -0,0 +1,114 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "diagnostic.hpp"
+#include "transcode.hpp"
+#include <string>
+#include <iterator>
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                       Diagnostic Codes                                               */
+/*======================================================================================================*/
+
+//Lines up with DiagCode
+static constexpr const char* diagnosticMessages[] = {
+    "Comment was left unclosed!",
+    "String literal left unclosed!",
+    "Illegal Operator!",
+    "Charachter can not start a token!",
+
+    "Only functions can be declared at the top level!",
+    "Function block opened but improperly closed, are you missing an end token?",
+    "Function declaration is missing a name!",
+    "Function declaration expects a parenthetical parameter list, did you forget a `(`?",
+    "Function declaration parameter list is missing a closing parenthesis!",
+    "Function declaration is missing a return type!",
+    "Expected to see a parameter type!",
+    "Expected to see a parameter name!",
+    "Expected to see a comma!",
+
+    "Block opened but improperly closed, are you missing an end token?",
+    "An else branch must be the last branch of an if block!",
+    "Conditional branch is missing a `then`!",
+    "Conditional branch is missing a condition!",
+    "While block is missing a `do`!",
+    "While block is missing a condition!",
+    "For block is missing a `do`!",
+    "For block expects a loop variable, stop condition and advance condition separated by `;`!",
+    "For block has an empty loop variable, stop condition or advance condition!",
+    "Unknown preprocessor directive!",
+    "A `@parallel` directive must come right before a `for` block!",
+
+    "Unbounded expression, are you missing an end of line?",
+    "Unexpected tokens!",
+    "Expected to see a value or a name!",
+    "Expected to see a single operand!",
+    "Unexpected operator!",
+    "Expected to see an operand to the left of binary infix operator!",
+    "Expected to see an operand to the right of binary infix operator!",
+    "Unexpected tokens before a prefix operator!",
+    "A declaration expects a type and a name, like `let val foo`!",
+    "Expected to see an operand to the right of a prefix operator!",
+    "Unexpected tokens after a postfix operator!",
+    "Expected to see an operand to the left of a postfix operator!",
+    "Unexpected tokens before a function call!",
+    "Function call argument list is missing a closing parenthesis!",
+    "Unexpected tokens after a function call!",
+    "Function call has an empty argument!"
+};
+static_assert(std::size(diagnosticMessages) == static_cast<size_t>(DiagCode::Count), "Every diagnostic code needs a message!");
+
+const char* diagnosticMessage(DiagCode code) noexcept {
+    return diagnosticMessages[static_cast<size_t>(code)];
+}
+
+/*======================================================================================================*/
+/*                                          Rendering                                                   */
+/*======================================================================================================*/
+
+Utf8String renderDiagnostic(const Diagnostic& diagnostic, const SymbolTable& symbols) {
+    std::string text = "[L: " + std::to_string(diagnostic.line) + " C: " + std::to_string(diagnostic.column) + "] ";
+    text += diagnosticMessage(diagnostic.code);
+    if (diagnostic.arg != noSymbol) {
+        text += " (in `" + symbols.text(diagnostic.arg).toUtf8() + "`)";
+    }
+    return fromValidatedUtf8(text);
+}
+
+Utf8String renderLocated(size_t line, size_t column, const char* message) {
+    return fromValidatedUtf8("[L: " + std::to_string(line) + " C: " + std::to_string(column) + "] " + message);
+}
+
+std::ostream& operator<<(std::ostream& os, const WithSymbols<Diagnostic>& printed) {
+    const Diagnostic& diagnostic = printed.item;
+    os << "[L: " << diagnostic.line << " C: " << diagnostic.column << "] " << diagnosticMessage(diagnostic.code);
+    if (diagnostic.arg != noSymbol) {
+        os << " (in `" << printed.symbols.text(diagnostic.arg) << "`)";
+    }
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                      Diagnostic Buffer                                               */
+/*======================================================================================================*/
+
+void DiagnosticBuffer::sortByPosition(size_t from) {
+    if (from >= diagnostics.size()) {
+        return;
+    }
+    std::stable_sort(diagnostics.begin() + static_cast<std::ptrdiff_t>(from), diagnostics.end(), [](const Diagnostic& a, const Diagnostic& b) {
+        return (a.line < b.line) || ((a.line == b.line) && (a.column < b.column));
+    });
+}
+
+} //end namespace fl
@@ -0,0 +1,380 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "driver.hpp"
+#include "compiler.hpp"
+#include "instrument.hpp"
+#include "serialize.hpp"
+#include "tokenizer.hpp"
+#include "transcode.hpp"
+#include "vm.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <unordered_set>
+
+namespace fl {
+
+namespace fs = std::filesystem;
+
+/*======================================================================================================*/
+/*                                             Inputs                                                   */
+/*======================================================================================================*/
+
+Result<std::vector<FileResult>, Utf8String> collectInputs(const std::vector<std::string>& inputs) {
+    using Collected = Result<std::vector<FileResult>, Utf8String>;
+    std::vector<FileResult> files;
+    std::unordered_set<std::string> seen;
+    const auto add = [&](const fs::path& path, const fs::path& relative) {
+        if (seen.insert(path.lexically_normal().string()).second) {
+            files.push_back(FileResult{.path = path.string(), .relativePath = relative.string()});
+        }
+    };
+
+    //Nothing here throws, since release builds have no exceptions to catch
+    for (const std::string& input : inputs) {
+        const fs::path root(input);
+        std::error_code error;
+        const fs::file_status status = fs::status(root, error);
+        if (error || !fs::exists(status)) {
+            return Collected::Err(fromValidatedUtf8("Could not find `" + input + "`!"));
+        }
+        if (!fs::is_directory(status)) {
+            add(root, root.filename());
+            continue;
+        }
+
+        //Directory order depends on the filesystem, so whatever is found is sorted before it is used
+        std::vector<fs::path> found;
+        for (fs::recursive_directory_iterator it(root, error), end; !error && (it != end); it.increment(error)) {
+            std::error_code typeError;
+            if (it->is_regular_file(typeError) && (it->path().extension() == ".fl")) {
+                found.push_back(it->path());
+            }
+        }
+        if (error) {
+            return Collected::Err(fromValidatedUtf8("Could not search `" + input + "`: " + error.message()));
+        }
+        std::sort(found.begin(), found.end());
+        for (const fs::path& path : found) {
+            add(path, path.lexically_relative(root));
+        }
+    }
+    return Collected::Ok(std::move(files));
+}
+
+/*======================================================================================================*/
+/*                                            Pipeline                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief where a file's emitted output goes, beside its source unless there is an output directory
+ */
+static fs::path emitTarget(const FileResult& file, const DriverOptions& options) {
+    fs::path target = options.outDir.empty() ? fs::path(file.path) : (fs::path(options.outDir) / file.relativePath);
+    switch (options.emit) {
+        case EmitKind::Listing: { target.replace_extension(".fllist"); break; }
+        case EmitKind::AstDump: { target.replace_extension(".flast"); break; }
+        default: { target.replace_extension(".flbc"); break; }
+    }
+    return target;
+}
+
+/**
+ * @brief writes a file through `write(std::ostream&)`, creating any directories it goes in
+ */
+template <typename Write>
+static bool writeOutput(FileResult& file, const fs::path& target, Write&& write) {
+    std::error_code error;
+    if (target.has_parent_path()) {
+        fs::create_directories(target.parent_path(), error);
+    }
+    std::ofstream out(target, std::ios::binary);
+    if (error || !out) {
+        file.messages.push_back(file.path + ": could not write `" + target.string() + "`");
+        file.failed = true;
+        return false;
+    }
+    write(out);
+    return true;
+}
+
+/**
+ * @brief writes out a compiled module when asked for its bytecode or its listing
+ */
+static void emitModule(FileResult& file, const Module& module, const DriverOptions& options) {
+    if (options.emit == EmitKind::Bytecode) {
+        writeOutput(file, emitTarget(file, options), [&](std::ostream& out) {
+            auto error = writeModule(out, module);
+            if (error) {
+                file.messages.push_back(file.path + ": " + error->toUtf8());
+                file.failed = true;
+            }
+        });
+    } else if (options.emit == EmitKind::Listing) {
+        writeOutput(file, emitTarget(file, options), [&](std::ostream& out) { out << module; });
+    }
+}
+
+/**
+ * @brief loads a `.flbc` file written by an earlier run in place of compiling a source file
+ * @note a loaded module has no source to dump a parse tree from, and writing its bytecode again would only
+ * copy the file, so only a listing is emitted for it
+ */
+static void loadBytecode(FileResult& file, const DriverOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    std::ifstream in(file.path, std::ios::binary);
+    if (!in) {
+        file.messages.push_back(file.path + ": could not be opened");
+        file.failed = true;
+        return;
+    }
+    Result<Module, Utf8String> loaded = readModule(in);
+    if (!loaded.isOk()) {
+        file.messages.push_back(file.path + ": " + loaded.errValue().toUtf8());
+        file.failed = true;
+        return;
+    }
+    Module& module = loaded.okValue();
+    auto error = link(module);
+    if (error) {
+        file.messages.push_back(file.path + ": " + error->toUtf8());
+        file.failed = true;
+        return;
+    }
+    std::error_code sizeError;
+    file.bytes = static_cast<size_t>(fs::file_size(file.path, sizeError));
+    file.functions = module.functions.size();
+    file.times.read += std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (options.emit == EmitKind::Listing) {
+        const Clock::time_point emitStart = Clock::now();
+        emitModule(file, module, options);
+        file.times.emit += std::chrono::duration<double>(Clock::now() - emitStart).count();
+    }
+    if (options.run && !file.failed) {
+        file.module = std::move(loaded).okValue();
+    }
+}
+
+/**
+ * @brief runs one file through the whole pipeline, touching nothing but its own result
+ */
+static void compileFile(FileResult& file, const DriverOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point mark = Clock::now();
+    const auto lap = [&mark](double& into) {
+        const Clock::time_point now = Clock::now();
+        into += std::chrono::duration<double>(now - mark).count();
+        mark = now;
+    };
+    const auto fail = [&file](const std::string& message) {
+        file.messages.push_back(file.path + ": " + message);
+        file.failed = true;
+    };
+    if (fs::path(file.path).extension() == ".flbc") {
+        loadBytecode(file, options);
+        return;
+    }
+
+    std::ifstream in(file.path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        fail("could not be opened");
+        return;
+    }
+    std::string bytes(static_cast<size_t>(in.tellg()), '\0');
+    in.seekg(0, std::ios::beg);
+    if (!in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+        fail("could not be read");
+        return;
+    }
+    file.bytes = bytes.size();
+    lap(file.times.read);
+
+    Result<Utf8String, const char*> decoded = fromUtf8(bytes);
+    lap(file.times.decode);
+    if (!decoded.isOk()) {
+        fail(decoded.errValue());
+        return;
+    }
+    const Utf8String& text = decoded.okValue();
+    file.chars = text.getCharCount();
+
+    //Each pipeline interns into a table of its own, which its module takes hold of
+    std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    DiagnosticBuffer tokenizerErrors;
+    std::vector<Token> tokens = tokenize(text, *symbols, tokenizerErrors);
+    lap(file.times.tokenize);
+    file.tokens = tokens.size();
+    file.lines = tokens.empty() ? 0 : tokens.back().lineCount;
+
+    FlowParser parser;
+    Result<ASTNode*, Diagnostic> head = parser.parse(tokens);
+    lap(file.times.parse);
+    file.astNodes = parser.getAst().size();
+    file.functions = parser.getFunctionDecs().size();
+
+    //Both stages' errors are merged into one batch, read top to bottom through the file
+    DiagnosticBuffer errors = tokenizerErrors;
+    errors.append(parser.getDiagnostics());
+    errors.sortByPosition();
+    for (const Diagnostic& error : errors) {
+        fail(renderDiagnostic(error, *symbols).toUtf8());
+    }
+    if (file.failed) {
+        return;
+    }
+
+    if (options.emit == EmitKind::AstDump) {
+        const size_t root = static_cast<size_t>(head.okValue() - parser.getAst().data());
+        writeOutput(file, emitTarget(file, options), [&](std::ostream& out) {
+            writeAstDump(out, fingerprintBytes(bytes.data(), bytes.size()), parser.getAst(), root, parser.getFunctionDecs());
+        });
+        lap(file.times.emit);
+    }
+    if (options.syntaxOnly) {
+        return;
+    }
+
+    Result<Module, Utf8String> module = compile(parser, symbols);
+    lap(file.times.compile);
+    if (!module.isOk()) {
+        fail(module.errValue().toUtf8());
+        return;
+    }
+    emitModule(file, module.okValue(), options);
+    lap(file.times.emit);
+    if (options.run && !file.failed) {
+        file.module = std::move(module).okValue();
+    }
+}
+
+void compileFiles(std::vector<FileResult>& files, const DriverOptions& options, TaskScheduler& scheduler) {
+    //One file per chunk, so a few huge files never hold up the rest, since idle threads steal what is left
+    auto body = [&](size_t, int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+            compileFile(files[static_cast<size_t>(i)], options);
+        }
+    };
+    scheduler.parallelFor(0, static_cast<int64_t>(files.size()), 1, body);
+}
+
+/*======================================================================================================*/
+/*                                             Report                                                   */
+/*======================================================================================================*/
+
+void reportResults(std::ostream& os, const std::vector<FileResult>& files, const DriverOptions& options, double wallSeconds) {
+    for (const FileResult& file : files) {
+        for (const std::string& message : file.messages) {
+            os << message << '\n';
+        }
+    }
+    if (!options.stats) {
+        os.flush();
+        return;
+    }
+
+    FileResult total;
+    size_t failed = 0;
+    for (const FileResult& file : files) {
+        total.bytes += file.bytes;
+        total.chars += file.chars;
+        total.lines += file.lines;
+        total.tokens += file.tokens;
+        total.astNodes += file.astNodes;
+        total.functions += file.functions;
+        total.times += file.times;
+        failed += file.failed ? 1 : 0;
+    }
+
+    const std::ios_base::fmtflags flags = os.flags();
+    const double seconds = std::max(wallSeconds, 1e-9);
+    os << std::fixed << std::setprecision(2);
+    os << "files:     " << files.size() << " (" << failed << " failed) over " << options.jobs << " jobs\n";
+    os << "source:    " << total.bytes << " bytes, " << total.chars << " chars, " << total.lines << " lines\n";
+    os << "parsed:    " << total.tokens << " tokens, " << total.astNodes << " ast nodes, " << total.functions << " functions\n";
+    os << "wall:      " << (seconds * 1e3) << " ms, " << (static_cast<double>(total.bytes) / seconds / 1e6) << " MB/s, "
+       << (static_cast<double>(total.tokens) / seconds / 1e6) << " Mtokens/s, " << (static_cast<double>(files.size()) / seconds) << " files/s\n";
+
+    //Summed over every thread, so against the wall time these show how well the pool was kept busy
+    const std::pair<const char*, double> stages[] = {
+        {"read", total.times.read}, {"decode", total.times.decode}, {"tokenize", total.times.tokenize},
+        {"parse", total.times.parse}, {"compile", total.times.compile}, {"emit", total.times.emit}
+    };
+    os << "thread time per stage:\n";
+    for (const auto& [name, stageSeconds] : stages) {
+        os << "  " << std::left << std::setw(10) << name << std::right << std::setw(12) << (stageSeconds * 1e3) << " ms\n";
+    }
+    os.flags(flags);
+    if (instrumentationBuilt) {
+        os << collectInstrumentation();
+    }
+    os.flush();
+}
+
+/*======================================================================================================*/
+/*                                             Driver                                                   */
+/*======================================================================================================*/
+
+int runDriver(const DriverOptions& options, std::ostream& os) {
+    DriverOptions resolved = options;
+    if (resolved.jobs == 0) {
+        resolved.jobs = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    Result<std::vector<FileResult>, Utf8String> collected = collectInputs(resolved.inputs);
+    if (!collected.isOk()) {
+        os << collected.errValue() << std::endl;
+        return 1;
+    }
+    std::vector<FileResult>& files = collected.okValue();
+    if (resolved.stats) {
+        setInstrumentationEnabled(true);
+    }
+
+    //The calling thread works through files alongside the pool, so it only needs one thread less than the jobs
+    TaskScheduler scheduler(resolved.jobs - 1);
+    const auto start = std::chrono::steady_clock::now();
+    compileFiles(files, resolved, scheduler);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    reportResults(os, files, resolved, elapsed.count());
+
+    bool failed = std::any_of(files.begin(), files.end(), [](const FileResult& file) { return file.failed; });
+    if (!resolved.run) {
+        return failed ? 1 : 0;
+    }
+
+    //Scripts run one after another in input order, so whatever they print never interleaves
+    for (FileResult& file : files) {
+        if (!file.module.has_value()) {
+            continue;
+        }
+        const std::optional<uint32_t> entry = file.module->findFunction("main"_utf8);
+        if (!entry.has_value()) {
+            continue;
+        }
+        VM vm(*file.module);
+        vm.setScheduler(&scheduler);
+        Result<Value, Utf8String> result = vm.call(entry.value(), {});
+        if (result.isOk()) {
+            os << file.path << ": main returned " << result.okValue() << std::endl;
+        } else {
+            os << file.path << ": " << result.errValue() << std::endl;
+            failed = true;
+        }
+    }
+    return failed ? 1 : 0;
+}
+
+} //end namespace fl
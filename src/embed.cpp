@@ -0,0 +1,135 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "embed.hpp"
+#include "tokenizer.hpp"
+#include "parser.hpp"
+#include "compiler.hpp"
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                            Engine                                                    */
+/*======================================================================================================*/
+
+Engine::~Engine() = default;
+
+void Engine::addHost(const Utf8StringView& name, const HostFunction& host, std::shared_ptr<void> target) {
+    for (BoundHost& bound : hosts) {
+        if (bound.name == name) {
+            bound.host = host;
+            bound.target = std::move(target);
+            return;
+        }
+    }
+    hosts.push_back(BoundHost{.name = name.toOwned(), .host = host, .target = std::move(target)});
+}
+
+std::vector<HostFunction> Engine::hostsFor(const SymbolTable& symbols, std::vector<std::shared_ptr<void>>& targets) const {
+    std::vector<HostFunction> linked;
+    for (const BoundHost& bound : hosts) {
+        //Any name a script calls was interned while tokenizing it, so a host that isn't found is never called
+        std::optional<Symbol> name = symbols.find(bound.name);
+        if (!name.has_value()) {
+            continue;
+        }
+        linked.push_back(bound.host);
+        linked.back().name = name.value();
+        if (bound.target) {
+            targets.push_back(bound.target);
+        }
+    }
+    return linked;
+}
+
+std::optional<Utf8String> Engine::loadSource(const Utf8String& source) {
+    //Both stages recover from errors, so everything wrong with the script is reported at once
+    std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    DiagnosticBuffer tokenizerErrors;
+    std::vector<Token> tokens = tokenize(source, *symbols, tokenizerErrors);
+    FlowParser parser;
+    auto head = parser.parse(tokens);
+    if (!tokenizerErrors.isEmpty() || !head.isOk()) {
+        //Merged into one batch in source order, wherever each error was found
+        DiagnosticBuffer errors = tokenizerErrors;
+        errors.append(parser.getDiagnostics());
+        errors.sortByPosition();
+        Utf8String message;
+        for (const Diagnostic& error : errors) {
+            message = message + (message.getCharCount() == 0 ? ""_utf8 : "\n"_utf8) + renderDiagnostic(error, *symbols);
+        }
+        return std::optional(std::move(message));
+    }
+
+    //Everything is parsed eagerly, so the compiled module no longer needs the source, tokens or parser
+    std::vector<std::shared_ptr<void>> targets;
+    std::vector<HostFunction> linkedHosts = hostsFor(*symbols, targets);
+    auto compiled = compile(parser, symbols, linkedHosts);
+    if (!compiled.isOk()) {
+        return std::optional(std::move(compiled).errValue());
+    }
+    compiled.okValue().hostTargets = std::move(targets);
+    load(std::make_shared<const Module>(std::move(compiled).okValue()));
+    return std::nullopt;
+}
+
+std::optional<Utf8String> Engine::loadModule(Module&& compiled) {
+    compiled.hostTargets.clear();
+    compiled.hostFunctions = hostsFor(*compiled.symbols, compiled.hostTargets);
+    auto linkError = link(compiled);
+    if (linkError) {
+        return linkError;
+    }
+    load(std::make_shared<const Module>(std::move(compiled)));
+    return std::nullopt;
+}
+
+void Engine::load(std::shared_ptr<const Module> shared) {
+    machine.reset();
+    loaded = std::move(shared);
+    machine = std::make_unique<VM>(loaded);
+    machine->setScheduler(scheduler.get());
+    machine->setMemoryBudget(budget);
+    machine->setProfiler(profiler.get());
+}
+
+void Engine::setMemoryBudget(const MemoryBudget& limits) {
+    budget = limits;
+    if (machine) {
+        machine->setMemoryBudget(budget);
+    }
+}
+
+void Engine::setProfiler(std::shared_ptr<Profiler> sampler) {
+    profiler = std::move(sampler);
+    if (machine) {
+        machine->setProfiler(profiler.get());
+    }
+}
+
+void Engine::setScheduler(std::shared_ptr<TaskScheduler> pool) {
+    scheduler = std::move(pool);
+    if (machine) {
+        machine->setScheduler(scheduler.get());
+    }
+}
+
+std::optional<uint32_t> Engine::findIndex(const Utf8StringView& name, size_t arity) const {
+    if (!loaded) {
+        return std::nullopt;
+    }
+    auto index = loaded->findFunction(name);
+    if (!index.has_value() || (loaded->functionTable[index.value()].arity != arity)) {
+        return std::nullopt;
+    }
+    return index;
+}
+
+} //end namespace fl
@@ -0,0 +1,172 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "heap.hpp"
+#include <chrono>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                           Heap Stats                                                 */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const HeapStats& stats) {
+    os << "nursery: " << stats.nurseryObjects << " / " << stats.nurseryCapacity << " objects\n";
+    os << "old generation: " << stats.oldObjects << " objects, " << stats.oldBytes << " bytes\n";
+    os << "allocated: " << stats.allocatedBytes << " bytes\n";
+    os << "collections: " << stats.minorCollections << " minor, " << stats.majorCollections << " major\n";
+    os << "promoted: " << stats.promotedObjects << " objects, freed: " << stats.freedObjects << " objects\n";
+    os << "pauses: " << stats.lastPauseNs << "ns last, " << stats.maxPauseNs << "ns max, " << stats.totalPauseNs << "ns total\n";
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                              Heap                                                    */
+/*======================================================================================================*/
+
+Heap::Heap(MemoryAccount& account, size_t nurseryObjects) : account(account) {
+    nurseryBase = nurseryAllocator.allocate(nurseryObjects);
+    nurseryTop = nurseryBase;
+    nurseryEnd = nurseryBase + nurseryObjects;
+    stats.nurseryCapacity = nurseryObjects;
+}
+
+Heap::~Heap() {
+    std::destroy(nurseryBase, nurseryTop);
+    nurseryAllocator.deallocate(nurseryBase, stats.nurseryCapacity);
+    while (oldHead != nullptr) {
+        StringObject* next = oldHead->next;
+        delete oldHead;
+        oldHead = next;
+    }
+}
+
+StringObject* Heap::tenure(Utf8String&& text) {
+    //Marked with the current epoch, so a sweep still in progress never frees it
+    oldHead = new StringObject{.text = std::move(text), .next = oldHead, .owner = this, .mark = epoch};
+    stats.oldObjects++;
+    stats.oldBytes += objectBytes(oldHead->text.getCharCount());
+    if (stats.oldBytes >= majorThreshold) {
+        collectionDue = true;
+    }
+    return oldHead;
+}
+
+StringObject* Heap::allocateString(Utf8String&& text) {
+    StringObject* object = nullptr;
+    if (nurseryTop != nurseryEnd) {
+        object = std::construct_at(nurseryTop++, StringObject{.text = std::move(text), .next = nullptr, .owner = this, .mark = 0});
+        stats.nurseryObjects++;
+        if (nurseryTop == nurseryEnd) {
+            collectionDue = true;
+        }
+    } else {
+        //Nothing can be collected until the next safepoint, so anything past a full nursery goes straight to the old generation
+        object = tenure(std::move(text));
+    }
+    const size_t bytes = objectBytes(object->text.getCharCount());
+    stats.allocatedBytes += bytes;
+    account.charge(MemoryKind::Strings, bytes);
+    return object;
+}
+
+void Heap::startPause() {
+    pauseStart = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Heap::endPause() {
+    const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    stats.lastPauseNs = now - pauseStart;
+    stats.maxPauseNs = std::max(stats.maxPauseNs, stats.lastPauseNs);
+    stats.totalPauseNs += stats.lastPauseNs;
+}
+
+void Heap::beginCollection(bool forceMajor) {
+    startPause();
+    majorRunning = !isSweeping() && (forceMajor || (stats.oldBytes >= majorThreshold));
+    if (majorRunning) {
+        epoch++;
+    }
+}
+
+void Heap::visit(Value& root) {
+    if ((root.type != ValueType::String) || (root.strVal->owner != this)) {
+        return;
+    }
+    StringObject* object = root.strVal;
+    if ((object >= nurseryBase) && (object < nurseryTop)) {
+        //The first root to reach a nursery object promotes it, every later one just follows the forward
+        if (object->next == nullptr) {
+            object->next = tenure(std::move(object->text));
+            stats.promotedObjects++;
+        }
+        root.strVal = object->next;
+    } else if (majorRunning) {
+        object->mark = epoch;
+    }
+}
+
+void Heap::endCollection() {
+    //Promoted objects left only their moved from text behind, so every nursery object is destroyed alike
+    for (StringObject* object = nurseryBase; object != nurseryTop; object++) {
+        if (object->next == nullptr) {
+            stats.freedObjects++;
+            account.refund(MemoryKind::Strings, objectBytes(object->text.getCharCount()));
+        }
+    }
+    std::destroy(nurseryBase, nurseryTop);
+    nurseryTop = nurseryBase;
+    stats.nurseryObjects = 0;
+    stats.minorCollections++;
+
+    if (majorRunning) {
+        majorRunning = false;
+        sweepLink = &oldHead;
+        stats.majorCollections++;
+    }
+    //Promotions alone can put the old generation over its threshold, which then waits for any sweep to finish
+    collectionDue = !isSweeping() && (stats.oldBytes >= majorThreshold);
+    endPause();
+}
+
+void Heap::sweepSlice() {
+    if (!isSweeping()) {
+        return;
+    }
+    startPause();
+    for (size_t i = 0; (i < sweepSliceObjects) && (*sweepLink != nullptr); i++) {
+        StringObject* object = *sweepLink;
+        if (object->mark == epoch) {
+            sweepLink = &object->next;
+            continue;
+        }
+        *sweepLink = object->next;
+        const size_t bytes = objectBytes(object->text.getCharCount());
+        stats.oldObjects--;
+        stats.oldBytes -= bytes;
+        account.refund(MemoryKind::Strings, bytes);
+        stats.freedObjects++;
+        delete object;
+    }
+    if (*sweepLink == nullptr) {
+        //The next major collection waits until the old generation has doubled from what survived this one
+        sweepLink = nullptr;
+        majorThreshold = std::max<size_t>(initialMajorThreshold, stats.oldBytes * 2);
+    }
+    endPause();
+}
+
+void Heap::finishSweep() {
+    while (isSweeping()) {
+        sweepSlice();
+    }
+}
+
+} //end namespace fl
@@ -0,0 +1,331 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "instrument.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                             Stages                                                   */
+/*======================================================================================================*/
+
+static constexpr const char* stageNames[stageCount] = {
+    "decode", "tokenize",
+    "parse", "parseFunc", "parseFunctionBody", "parseIf", "parseWhile", "parseFor", "parseParallel",
+    "parseExprs", "parseExpr", "parseBinaryExpr", "parseRightUnaryExpr", "parseLeftUnaryExpr", "parseCallExpr",
+    "buildIR", "inferTypes", "optimize", "emit", "link", "execute"
+};
+
+std::ostream& operator<<(std::ostream& os, const Stage stage) {
+    const size_t indx = static_cast<size_t>(stage);
+    os << ((indx < stageCount) ? stageNames[indx] : "unknown");
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                         Instrument Report                                            */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const InstrumentReport& report) {
+    const std::ios_base::fmtflags flags = os.flags();
+    os << std::left << std::setw(22) << "stage" << std::setw(12) << "calls" << std::setw(14) << "ms"
+       << std::setw(14) << "allocations" << "bytes\n";
+    for (size_t i = 0; i < stageCount; i++) {
+        const StageStats& stats = report.stages[i];
+        if (stats.calls == 0) {
+            continue;
+        }
+        os << std::setw(22) << stageNames[i] << std::setw(12) << stats.calls << std::setw(14) << std::fixed << std::setprecision(3)
+           << (static_cast<double>(stats.nanoseconds) / 1e6) << std::setw(14) << stats.allocations << stats.allocatedBytes << "\n";
+    }
+    os.flags(flags);
+    return os;
+}
+
+void writeJson(std::ostream& os, const InstrumentReport& report) {
+    os << "{\n";
+    for (size_t i = 0; i < stageCount; i++) {
+        const StageStats& stats = report.stages[i];
+        os << "  \"" << stageNames[i] << "\": {\"calls\": " << stats.calls << ", \"nanoseconds\": " << stats.nanoseconds
+           << ", \"allocations\": " << stats.allocations << ", \"allocated_bytes\": " << stats.allocatedBytes << "}"
+           << (((i + 1) < stageCount) ? ",\n" : "\n");
+    }
+    os << "}\n";
+}
+
+/*======================================================================================================*/
+/*                                         Instrumentation                                              */
+/*======================================================================================================*/
+
+#if FL_INSTRUMENTATION
+
+namespace {
+
+/**
+ * @brief the counts of one stage on one thread, which only that thread writes, so plain loads and stores
+ * are enough and merging can read them at any time
+ */
+struct StageCounters {
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> nanoseconds = 0;
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> allocatedBytes = 0;
+};
+
+void bump(std::atomic<uint64_t>& counter, uint64_t by) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+}
+
+/**
+ * @brief the stages running on one thread, innermost last, and what each has counted
+ */
+struct ThreadCounters {
+    static constexpr uint32_t maxNesting = 256;
+
+    std::array<StageCounters, stageCount> stages;
+    std::array<Stage, maxNesting> running;
+    uint32_t depth = 0;
+
+    //When the innermost stage last started or resumed
+    uint64_t resumedAt = 0;
+};
+
+/**
+ * @brief every thread's counters, along with everything counted by threads that have since exited
+ */
+struct Registry {
+    std::mutex lock;
+    std::vector<ThreadCounters*> live;
+    std::array<StageStats, stageCount> retired = {};
+};
+
+std::atomic<bool> enabled = false;
+
+//Shared by every thread, unlike the counts of each stage
+std::atomic<uint64_t> totalAllocations = 0;
+std::atomic<uint64_t> totalAllocatedBytes = 0;
+
+Registry& registry() {
+    //Never destroyed, since threads can still exit while statics are being torn down
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+/**
+ * @brief owns a thread's counters, folding them into the registry when the thread exits
+ */
+struct ThreadOwner {
+    ThreadCounters* counters = nullptr;
+    ~ThreadOwner();
+};
+
+//Trivially constructed, so the allocation hook can read it without ever constructing anything
+thread_local ThreadCounters* threadCounters = nullptr;
+thread_local ThreadOwner threadOwner;
+
+ThreadOwner::~ThreadOwner() {
+    if (counters == nullptr) {
+        return;
+    }
+    threadCounters = nullptr;
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> guard(shared.lock);
+    for (size_t i = 0; i < stageCount; i++) {
+        shared.retired[i].calls += counters->stages[i].calls.load(std::memory_order_relaxed);
+        shared.retired[i].nanoseconds += counters->stages[i].nanoseconds.load(std::memory_order_relaxed);
+        shared.retired[i].allocations += counters->stages[i].allocations.load(std::memory_order_relaxed);
+        shared.retired[i].allocatedBytes += counters->stages[i].allocatedBytes.load(std::memory_order_relaxed);
+    }
+    std::erase(shared.live, counters);
+    delete counters;
+}
+
+ThreadCounters& currentThread() {
+    if (threadCounters == nullptr) {
+        //Nothing is running on this thread yet, so the allocations made registering it aren't counted
+        ThreadCounters* made = new ThreadCounters();
+        {
+            Registry& shared = registry();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            shared.live.push_back(made);
+        }
+        threadOwner.counters = made;
+        threadCounters = made;
+    }
+    return *threadCounters;
+}
+
+uint64_t nowNs() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief counts an allocation towards the totals, and against the innermost stage running on this thread
+ * if there is one
+ */
+void countAllocation(size_t size) noexcept {
+    if (enabled.load(std::memory_order_relaxed)) {
+        totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        totalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    ThreadCounters* counters = threadCounters;
+    if ((counters != nullptr) && (counters->depth != 0)) {
+        StageCounters& stage = counters->stages[static_cast<size_t>(counters->running[counters->depth - 1])];
+        bump(stage.allocations, 1);
+        bump(stage.allocatedBytes, size);
+    }
+}
+
+} //end anonymous namespace
+
+StageScope::StageScope(Stage stage) noexcept : active(enabled.load(std::memory_order_relaxed)) {
+    if (!active) {
+        return;
+    }
+    ThreadCounters& counters = currentThread();
+    if (counters.depth == ThreadCounters::maxNesting) {
+        //Too deep to track, so everything in here keeps counting against the stage it is nested in
+        active = false;
+        bump(counters.stages[static_cast<size_t>(stage)].calls, 1);
+        return;
+    }
+    const uint64_t now = nowNs();
+    if (counters.depth != 0) {
+        bump(counters.stages[static_cast<size_t>(counters.running[counters.depth - 1])].nanoseconds, now - counters.resumedAt);
+    }
+    counters.running[counters.depth++] = stage;
+    counters.resumedAt = now;
+    bump(counters.stages[static_cast<size_t>(stage)].calls, 1);
+}
+
+StageScope::~StageScope() {
+    if (!active) {
+        return;
+    }
+    ThreadCounters& counters = *threadCounters;
+    const uint64_t now = nowNs();
+    bump(counters.stages[static_cast<size_t>(counters.running[--counters.depth])].nanoseconds, now - counters.resumedAt);
+    counters.resumedAt = now;
+}
+
+void setInstrumentationEnabled(bool on) noexcept {
+    enabled.store(on, std::memory_order_relaxed);
+}
+
+bool isInstrumentationEnabled() noexcept {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+InstrumentReport collectInstrumentation() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> guard(shared.lock);
+    InstrumentReport report;
+    report.stages = shared.retired;
+    for (const ThreadCounters* counters : shared.live) {
+        for (size_t i = 0; i < stageCount; i++) {
+            report.stages[i].calls += counters->stages[i].calls.load(std::memory_order_relaxed);
+            report.stages[i].nanoseconds += counters->stages[i].nanoseconds.load(std::memory_order_relaxed);
+            report.stages[i].allocations += counters->stages[i].allocations.load(std::memory_order_relaxed);
+            report.stages[i].allocatedBytes += counters->stages[i].allocatedBytes.load(std::memory_order_relaxed);
+        }
+    }
+    return report;
+}
+
+AllocationTotals allocationTotals() noexcept {
+    return AllocationTotals{.allocations = totalAllocations.load(std::memory_order_relaxed),
+                            .allocatedBytes = totalAllocatedBytes.load(std::memory_order_relaxed)};
+}
+
+void resetInstrumentation() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> guard(shared.lock);
+    shared.retired = {};
+    totalAllocations.store(0, std::memory_order_relaxed);
+    totalAllocatedBytes.store(0, std::memory_order_relaxed);
+    for (ThreadCounters* counters : shared.live) {
+        for (StageCounters& stage : counters->stages) {
+            stage.calls.store(0, std::memory_order_relaxed);
+            stage.nanoseconds.store(0, std::memory_order_relaxed);
+            stage.allocations.store(0, std::memory_order_relaxed);
+            stage.allocatedBytes.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+#else
+
+void setInstrumentationEnabled(bool) noexcept {}
+
+bool isInstrumentationEnabled() noexcept {
+    return false;
+}
+
+InstrumentReport collectInstrumentation() {
+    return InstrumentReport{};
+}
+
+AllocationTotals allocationTotals() noexcept {
+    return AllocationTotals{};
+}
+
+void resetInstrumentation() {}
+
+#endif
+
+} //end namespace fl
+
+#if FL_INSTRUMENTATION
+
+/*======================================================================================================*/
+/*                                         Allocation Hook                                              */
+/*======================================================================================================*/
+
+//Replacing the global allocation functions is the only way to see allocations made inside the standard library
+static void* countedAlloc(size_t size) {
+    fl::countAllocation(size);
+    void* memory = std::malloc((size == 0) ? 1 : size);
+    if (memory == nullptr) {
+        std::abort();
+    }
+    return memory;
+}
+
+static void* countedAlignedAlloc(size_t size, std::align_val_t align) {
+    fl::countAllocation(size);
+    const size_t alignment = static_cast<size_t>(align);
+    void* memory = std::aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment);
+    if (memory == nullptr) {
+        std::abort();
+    }
+    return memory;
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void* operator new(size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void* operator new[](size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "intern.hpp"
+#include "fl_util.hpp"
+#include "unicode.hpp"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace fl {
+
+//Big enough that most scripts fit every spelling in a handful of chunks
+static constexpr size_t minChunkSize = 4096;
+
+/*======================================================================================================*/
+/*                                         SymbolTable                                                  */
+/*======================================================================================================*/
+
+SymbolTable::SymbolTable() : slots(256) {}
+
+static uint32_t hashText(const Utf8StringView& text) {
+    return static_cast<uint32_t>(hashUChars(text.getDataPointer(), text.getLen()));
+}
+
+size_t SymbolTable::probe(const Utf8StringView& text, uint32_t hash) const {
+    const size_t mask = slots.size() - 1;
+    size_t indx = hash & mask;
+    while (true) {
+        const Slot& slot = slots[indx];
+        if ((slot.symbol == noSymbol) || ((slot.hash == hash) && (spellings[slot.spelling] == text))) {
+            return indx;
+        }
+        indx = (indx + 1) & mask;
+    }
+}
+
+void SymbolTable::grow() {
+    std::vector<Slot> oldSlots(slots.size() * 2);
+    oldSlots.swap(slots);
+    const size_t mask = slots.size() - 1;
+    for (const Slot& slot : oldSlots) {
+        if (slot.symbol == noSymbol) {
+            continue;
+        }
+        size_t indx = slot.hash & mask;
+        while (slots[indx].symbol != noSymbol) {
+            indx = (indx + 1) & mask;
+        }
+        slots[indx] = slot;
+    }
+}
+
+Utf8StringView SymbolTable::store(const Utf8StringView& text) {
+    const size_t len = text.getLen();
+    //An empty spelling still needs a chunk to point into, even when it is the first one stored
+    if (chunks.empty() || ((chunkUsed + len) > chunkCapacity)) {
+        chunkCapacity = std::max(minChunkSize, len);
+        chunks.push_back(std::make_unique<uChar[]>(chunkCapacity));
+        chunkUsed = 0;
+    }
+    uChar* copy = chunks.back().get() + chunkUsed;
+    if (len != 0) {
+        std::memcpy(copy, text.getDataPointer(), len * sizeof(uChar));
+    }
+    chunkUsed += len;
+    return Utf8StringView(copy, len);
+}
+
+void SymbolTable::insertSlot(size_t indx, uint32_t hash, const Utf8StringView& spelling, Symbol symbol) {
+    slots[indx] = Slot{.hash = hash, .spelling = static_cast<uint32_t>(spellings.size()), .symbol = symbol};
+    spellings.push_back(spelling);
+
+    //Keep the table at most half full so probe runs stay short
+    if ((spellings.size() * 2) > slots.size()) {
+        grow();
+    }
+}
+
+Symbol SymbolTable::internNormalized(const Utf8StringView& text, uint32_t hash) {
+    const size_t indx = probe(text, hash);
+    if (slots[indx].symbol != noSymbol) {
+        return slots[indx].symbol;
+    }
+    const Utf8StringView copy = store(text);
+    const Symbol symbol = static_cast<Symbol>(texts.size());
+    texts.push_back(copy);
+    insertSlot(indx, hash, copy, symbol);
+    return symbol;
+}
+
+std::optional<Symbol> SymbolTable::find(const Utf8StringView& text) const {
+    const uint32_t hash = hashText(text);
+    {
+        std::shared_lock lock(mutex);
+        const Slot& slot = slots[probe(text, hash)];
+        if (slot.symbol != noSymbol) {
+            return slot.symbol;
+        }
+    }
+    if (quickCheckNfc(text) == NfcCheck::Yes) {
+        return std::nullopt;
+    }
+
+    //A spelling never seen before can still be equivalent to one that was
+    const Utf8String normalized = normalizeNfc(text);
+    const Utf8StringView normalView = normalized.view();
+    std::shared_lock lock(mutex);
+    const Slot& slot = slots[probe(normalView, hashText(normalView))];
+    if (slot.symbol == noSymbol) {
+        return std::nullopt;
+    }
+    return slot.symbol;
+}
+
+Symbol SymbolTable::intern(const Utf8StringView& text) {
+    const uint32_t hash = hashText(text);
+
+    //Nearly every lookup is a spelling that is already interned, which only needs the shared lock
+    {
+        std::shared_lock lock(mutex);
+        const Slot& slot = slots[probe(text, hash)];
+        if (slot.symbol != noSymbol) {
+            return slot.symbol;
+        }
+    }
+
+    //New spellings are normalized before taking the exclusive lock, and nearly all are already NFC
+    if (quickCheckNfc(text) == NfcCheck::Yes) {
+        std::unique_lock lock(mutex);
+        return internNormalized(text, hash);
+    }
+    const Utf8String normalized = normalizeNfc(text);
+    const Utf8StringView normalView = normalized.view();
+    const uint32_t normalHash = hashText(normalView);
+
+    //Another thread may have added it between the two locks, so the probe is repeated
+    std::unique_lock lock(mutex);
+    const size_t indx = probe(text, hash);
+    if (slots[indx].symbol != noSymbol) {
+        return slots[indx].symbol;
+    }
+    if (normalView == text) {
+        return internNormalized(text, hash);
+    }
+    const Symbol symbol = internNormalized(normalView, normalHash);
+
+    //Interning the normal form may have grown the table, so the alias needs a fresh probe
+    insertSlot(probe(text, hash), hash, store(text), symbol);
+    return symbol;
+}
+
+Utf8StringView SymbolTable::text(Symbol symbol) const {
+    std::shared_lock lock(mutex);
+    return texts[symbol];
+}
+
+size_t SymbolTable::size() const {
+    std::shared_lock lock(mutex);
+    return texts.size();
+}
+
+} //end namespace fl
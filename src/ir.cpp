@@ -0,0 +1,1162 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "ir.hpp"
+#include "instrument.hpp"
+#include "diagnostic.hpp"
+#include <optional>
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          IR Printing                                                 */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const IROp op) {
+    switch (op) {
+        case IROp::Const: { os << "const"; return os; }
+        case IROp::Param: { os << "param"; return os; }
+        case IROp::Phi: { os << "phi"; return os; }
+        case IROp::Copy: { os << "copy"; return os; }
+        case IROp::Add: { os << "add"; return os; }
+        case IROp::Sub: { os << "sub"; return os; }
+        case IROp::Mul: { os << "mul"; return os; }
+        case IROp::Div: { os << "div"; return os; }
+        case IROp::Mod: { os << "mod"; return os; }
+        case IROp::Neg: { os << "neg"; return os; }
+        case IROp::Not: { os << "not"; return os; }
+        case IROp::LessThan: { os << "lt"; return os; }
+        case IROp::LessEqual: { os << "le"; return os; }
+        case IROp::GreaterThan: { os << "gt"; return os; }
+        case IROp::GreaterEqual: { os << "ge"; return os; }
+        case IROp::Equals: { os << "eq"; return os; }
+        case IROp::NotEquals: { os << "ne"; return os; }
+        case IROp::Call: { os << "call"; return os; }
+        case IROp::ParallelFor: { os << "parfor"; return os; }
+        case IROp::Guard: { os << "guard"; return os; }
+        case IROp::Jump: { os << "jump"; return os; }
+        case IROp::Branch: { os << "branch"; return os; }
+        case IROp::Return: { os << "return"; return os; }
+        default: { os << "unknown"; return os; }
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const IRType type) {
+    switch (type) {
+        case IRType::Unknown: { os << "?"; return os; }
+        case IRType::Nil: { os << "nil"; return os; }
+        case IRType::Bool: { os << "bool"; return os; }
+        case IRType::Int: { os << "int"; return os; }
+        case IRType::Float: { os << "float"; return os; }
+        case IRType::String: { os << "str"; return os; }
+        default: { os << "val"; return os; }
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const WithSymbols<IRFunction>& printed) {
+    const IRFunction& func = printed.item;
+    os << "func " << printed.symbols.text(func.name) << " (" << func.arity << " params) returns " << func.returnType << std::endl;
+    for (BlockId b = 0; b < func.blocks.size(); b++) {
+        const IRBlock& block = func.blocks[b];
+        if (block.insts.empty()) {
+            continue;
+        }
+        os << "  b" << b << ":";
+        if (!block.preds.empty()) {
+            os << " preds";
+            for (BlockId p : block.preds) {
+                os << " b" << p;
+            }
+        }
+        os << std::endl;
+
+        for (ValueId v : block.insts) {
+            const IRInst& inst = func.insts[v];
+            os << "    ";
+            if (!isTerminator(inst.op)) {
+                os << "%" << v << ":" << inst.type << " = ";
+            }
+            os << inst.op;
+            for (ValueId arg : inst.args) {
+                os << " %" << arg;
+            }
+            if (inst.op == IROp::Const) {
+                os << " " << func.constants[inst.imm];
+            } else if (inst.op == IROp::Param) {
+                os << " " << inst.imm;
+            } else if (inst.op == IROp::Call) {
+                os << " " << printed.symbols.text(func.callees[inst.imm]);
+            } else if (inst.op == IROp::ParallelFor) {
+                os << " body" << inst.imm;
+            } else if (inst.op == IROp::Guard) {
+                os << " " << static_cast<IRType>(inst.imm);
+            }
+            for (BlockId t : inst.targets) {
+                if (t != irNone) {
+                    os << " b" << t;
+                }
+            }
+            os << std::endl;
+        }
+    }
+    for (size_t i = 0; i < func.bodies.size(); i++) {
+        os << "  body" << i << " reduced by " << func.bodies[i].reduction << ", ";
+        os << WithSymbols{func.bodies[i], printed.symbols};
+    }
+    return os;
+}
+
+/*======================================================================================================*/
+/*                                          Dominators                                                  */
+/*======================================================================================================*/
+
+void IRFunction::computeDominators() {
+    for (IRBlock& block : blocks) {
+        block.idom = irNone;
+        block.domChildren.clear();
+        block.reachable = false;
+    }
+    rpo.clear();
+    if (blocks.empty()) {
+        return;
+    }
+
+    //Walk the graph depth first from the entry to get a post order, which reversed gives the rpo
+    std::vector<uint32_t> rpoIndex(blocks.size(), irNone);
+    std::vector<std::pair<BlockId, size_t>> stack = {{0, 0}};
+    blocks[0].reachable = true;
+    while (!stack.empty()) {
+        auto& [block, nextSucc] = stack.back();
+        if (nextSucc < blocks[block].succs.size()) {
+            BlockId succ = blocks[block].succs[nextSucc++];
+            if (!blocks[succ].reachable) {
+                blocks[succ].reachable = true;
+                stack.push_back({succ, 0});
+            }
+        } else {
+            rpo.push_back(block);
+            stack.pop_back();
+        }
+    }
+    std::reverse(rpo.begin(), rpo.end());
+    for (uint32_t i = 0; i < rpo.size(); i++) {
+        rpoIndex[rpo[i]] = i;
+    }
+
+    //Iterate the dataflow until it settles, intersecting the dominators of every processed predecessor
+    //See Cooper, Harvey and Kennedy's "A Simple, Fast Dominance Algorithm"
+    blocks[0].idom = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 1; i < rpo.size(); i++) {
+            BlockId b = rpo[i];
+            BlockId newIdom = irNone;
+            for (BlockId p : blocks[b].preds) {
+                if (!blocks[p].reachable || (blocks[p].idom == irNone)) {
+                    continue;
+                }
+                if (newIdom == irNone) {
+                    newIdom = p;
+                    continue;
+                }
+                BlockId x = p;
+                BlockId y = newIdom;
+                while (x != y) {
+                    while (rpoIndex[x] > rpoIndex[y]) { x = blocks[x].idom; }
+                    while (rpoIndex[y] > rpoIndex[x]) { y = blocks[y].idom; }
+                }
+                newIdom = x;
+            }
+            if (blocks[b].idom != newIdom) {
+                blocks[b].idom = newIdom;
+                changed = true;
+            }
+        }
+    }
+
+    //Build the tree itself, and number it so dominance checks become two compares
+    for (BlockId b : rpo) {
+        if (b != 0) {
+            blocks[blocks[b].idom].domChildren.push_back(b);
+        }
+    }
+    uint32_t counter = 0;
+    std::vector<std::pair<BlockId, size_t>> walk = {{0, 0}};
+    blocks[0].domPre = counter++;
+    while (!walk.empty()) {
+        auto& [block, nextChild] = walk.back();
+        if (nextChild < blocks[block].domChildren.size()) {
+            BlockId child = blocks[block].domChildren[nextChild++];
+            blocks[child].domPre = counter++;
+            walk.push_back({child, 0});
+        } else {
+            blocks[block].domPost = counter++;
+            walk.pop_back();
+        }
+    }
+}
+
+/*======================================================================================================*/
+/*                                          IR Builder                                                  */
+/*======================================================================================================*/
+
+Result<IRType, Utf8String> typeFromName(const Utf8StringView& name) {
+    static const FlatMap<Utf8String, IRType> typeNames = {
+        {"val"_utf8, IRType::Dynamic}, {"int"_utf8, IRType::Int},
+        {"float"_utf8, IRType::Float}, {"bool"_utf8, IRType::Bool},
+        {"str"_utf8, IRType::String}
+    };
+    const auto found = typeNames.find(name);
+    if (found != typeNames.end()) {
+        return Result<IRType, Utf8String>::Ok(found->second);
+    }
+    return Result<IRType, Utf8String>::Err("Unknown type name!"_utf8);
+}
+
+/**
+ * @brief gets the value a typed declaration without an initial value starts out as
+ */
+static Constant zeroValueFor(IRType type) {
+    Constant constant;
+    switch (type) {
+        case IRType::Bool: { constant.type = ConstantType::Bool; break; }
+        case IRType::Int: { constant.type = ConstantType::Int; break; }
+        case IRType::Float: { constant.type = ConstantType::Float; break; }
+        case IRType::String: { constant.type = ConstantType::String; break; }
+        default: { break; }
+    }
+    return constant;
+}
+
+/**
+ * @brief maps the token type of an operator node onto the matching IR op
+ */
+static constexpr IROp binaryOpFor(TokenType type) {
+    switch (type) {
+        case TokenType::Add:
+        case TokenType::AddAssign: { return IROp::Add; }
+        case TokenType::Sub:
+        case TokenType::SubAssign: { return IROp::Sub; }
+        case TokenType::Mul:
+        case TokenType::MulAssign: { return IROp::Mul; }
+        case TokenType::Div:
+        case TokenType::DivAssign: { return IROp::Div; }
+        case TokenType::Mod: { return IROp::Mod; }
+        case TokenType::LessThan: { return IROp::LessThan; }
+        case TokenType::LessEqual: { return IROp::LessEqual; }
+        case TokenType::GreaterThan: { return IROp::GreaterThan; }
+        case TokenType::GreaterEqual: { return IROp::GreaterEqual; }
+        case TokenType::Equals: { return IROp::Equals; }
+        case TokenType::NotEquals: { return IROp::NotEquals; }
+        default: { return IROp::Copy; }
+    }
+}
+
+/**
+ * @brief the pieces of a `for` header that counts an int up by one, like `for let int i = a; i < b; i++; do`
+ */
+struct CountedLoop {
+    Symbol var = noSymbol;
+    size_t begin = 0;
+    size_t end = 0;
+    bool inclusive = false;
+};
+
+/**
+ * @brief picks apart a `for` header, if it counts an int up by one
+ */
+static std::optional<CountedLoop> matchCountedLoop(const std::vector<ASTNode>& ast, size_t forNode) {
+    const ASTNode& init = ast[ast[forNode].children[0]];
+    const ASTNode& cond = ast[ast[forNode].children[1]];
+    const ASTNode& advance = ast[ast[forNode].children[2]];
+    if ((init.body.type != TokenType::Assign) || (ast[init.children[0]].body.type != TokenType::Let)) {
+        return std::nullopt;
+    }
+    const ASTNode& decl = ast[init.children[0]];
+    auto type = typeFromName(ast[decl.children[0]].body.text);
+    if (!type.isOk() || (type.okValue() != IRType::Int)) {
+        return std::nullopt;
+    }
+
+    CountedLoop loop{.var = ast[decl.children[1]].body.symbol, .begin = init.children[1]};
+    const bool boundsVar = ((cond.body.type == TokenType::LessThan) || (cond.body.type == TokenType::LessEqual)) &&
+                           (ast[cond.children[0]].body.type == TokenType::Identifier) &&
+                           (ast[cond.children[0]].body.symbol == loop.var);
+    const bool stepsVar = (advance.body.type == TokenType::PostInc) &&
+                          (ast[advance.children[0]].body.type == TokenType::Identifier) &&
+                          (ast[advance.children[0]].body.symbol == loop.var);
+    if (!boundsVar || !stepsVar) {
+        return std::nullopt;
+    }
+    loop.end = cond.children[1];
+    loop.inclusive = (cond.body.type == TokenType::LessEqual);
+    return loop;
+}
+
+/**
+ * @brief every name a parallel loop body reads, and every compound update it makes, which together
+ * decide what the outlined body captures and which name it reduces
+ */
+struct ParallelScan {
+    std::vector<Symbol> reads;
+    std::vector<std::pair<Symbol, TokenType>> updates;
+};
+
+static void scanParallelBody(const std::vector<ASTNode>& ast, size_t node, ParallelScan& scan) {
+    const ASTNode& expr = ast[node];
+    const TokenType type = expr.body.type;
+    if (type == TokenType::Let) {
+        //The type and name of a declaration aren't reads
+        return;
+    }
+    if (type == TokenType::Identifier) {
+        if (std::find(scan.reads.begin(), scan.reads.end(), expr.body.symbol) == scan.reads.end()) {
+            scan.reads.push_back(expr.body.symbol);
+        }
+        return;
+    }
+    const bool isUpdate = (type == TokenType::AddAssign) || (type == TokenType::SubAssign) || (type == TokenType::MulAssign);
+    if (isUpdate && (ast[expr.children[0]].body.type == TokenType::Identifier)) {
+        scan.updates.push_back({ast[expr.children[0]].body.symbol, type});
+    }
+    for (size_t child : expr.children) {
+        scanParallelBody(ast, child, scan);
+    }
+}
+
+/**
+ * @brief maps the operator a reduction is updated with onto the op its chunks combine through
+ */
+static constexpr IROp reductionOpFor(TokenType type) {
+    return (type == TokenType::MulAssign) ? IROp::Mul : IROp::Add;
+}
+
+/**
+ * @brief prefixes an error with where in the source it happened, the way diagnostics are rendered
+ */
+static Utf8String locatedError(const Token& token, const char* message) {
+    return renderLocated(token.lineCount, token.charCount, message);
+}
+
+static Utf8String locatedError(const Token& token, const Utf8String& message) {
+    return locatedError(token, message.toUtf8().c_str());
+}
+
+/**
+ * @brief gets the value a reduction of the given type starts each chunk from
+ */
+static Constant identityFor(IROp reduction, IRType type) {
+    Constant constant;
+    if (type == IRType::Float) {
+        constant.type = ConstantType::Float;
+        constant.floatVal = (reduction == IROp::Mul) ? 1.0 : 0.0;
+    } else {
+        constant.type = ConstantType::Int;
+        constant.intVal = (reduction == IROp::Mul) ? 1 : 0;
+    }
+    return constant;
+}
+
+/**
+ * @brief a local read by a parallel loop body, which is passed into the outlined body as a parameter
+ */
+struct Capture {
+    Symbol name;
+    uint32_t var;
+    IRType type;
+};
+
+/**
+ * @brief a type alias to make writing the lowering functions cleaner
+ */
+using IRResult = Result<ValueId, Utf8String>;
+
+/**
+ * @brief walks a `func` subtree and emits SSA form into an IRFunction
+ * @details this follows Braun et al's "Simple and Efficient Construction of Static Single Assignment Form".
+ * Each variable tracks its latest definition per block, reads that miss walk up through the predecessors,
+ * and blocks whose predecessors are not all known yet (loop headers) get placeholder phis that are filled
+ * in once the block is sealed. Trivial phis are left for copy propagation to clean up
+ */
+class IRBuilder {
+public:
+    IRBuilder(const std::vector<ASTNode>& ast) : ast(ast) {}
+
+    Result<IRFunction, Utf8String> build(size_t funcNode);
+
+    /**
+     * @brief outlines the body of a `@parallel for` into a function that runs the iterations from its first
+     * parameter up to its second, accumulating the reduction, if there is one, from its third
+     */
+    Result<IRFunction, Utf8String> buildParallel(Symbol name, size_t forNode, Symbol loopVar, const std::vector<Capture>& captures,
+                                                 Symbol reduction, IRType reductionType, IROp reductionOp);
+
+private:
+    const std::vector<ASTNode>& ast;
+    IRFunction func;
+    BlockId current = 0;
+
+    //Per block variable state for SSA construction
+    std::vector<FlatMap<uint32_t, ValueId>> currentDef;
+    std::vector<FlatMap<uint32_t, ValueId>> incompletePhis;
+    std::vector<bool> sealed;
+
+    //Lexical scopes mapping names to variable ids, innermost last
+    std::vector<FlatMap<Symbol, uint32_t>> scopes;
+    std::vector<IRType> varTypes;
+
+    //Inside an outlined parallel body, every variable below firstLocal is shared by all of its iterations,
+    //so none of them can be written, apart from the reduction, which can only be updated through its operator
+    bool parallelBody = false;
+    uint32_t firstLocal = 0;
+    uint32_t reductionVar = irNone;
+    IROp reductionOp = IROp::Copy;
+
+    BlockId newBlock();
+    void sealBlock(BlockId block);
+    ValueId emit(IROp op, std::vector<ValueId> args, const Token& source, uint32_t imm = 0);
+    ValueId emitConst(const Constant& constant, const Token& source);
+    void emitJump(BlockId target, const Token& source);
+    void emitBranch(ValueId cond, BlockId ifTrue, BlockId ifFalse, const Token& source);
+    bool isTerminated() const;
+
+    void writeVariable(uint32_t var, BlockId block, ValueId value);
+    void assignVariable(uint32_t var, ValueId value, const Token& source);
+    ValueId guardType(ValueId value, IRType type, const Token& source);
+    ValueId readVariable(uint32_t var, BlockId block, const Token& source);
+    ValueId readVariableRecursive(uint32_t var, BlockId block, const Token& source);
+    ValueId addPhiOperands(uint32_t var, ValueId phi, const Token& source);
+
+    Result<uint32_t, Utf8String> declare(Symbol name, const Token& typeName);
+    uint32_t declareTyped(Symbol name, IRType type);
+    std::optional<uint32_t> lookup(Symbol name) const;
+
+    std::optional<Utf8String> lowerExprs(size_t parent, size_t firstChild);
+    std::optional<Utf8String> lowerStatement(size_t node);
+    std::optional<Utf8String> lowerIf(size_t node);
+    std::optional<Utf8String> lowerWhile(size_t node);
+    std::optional<Utf8String> lowerFor(size_t node);
+    std::optional<Utf8String> lowerParallel(size_t node);
+    IRResult lowerExpr(size_t node);
+    IRResult lowerAssign(size_t node);
+};
+
+BlockId IRBuilder::newBlock() {
+    func.blocks.emplace_back();
+    currentDef.emplace_back();
+    incompletePhis.emplace_back();
+    sealed.push_back(false);
+    return func.blocks.size() - 1;
+}
+
+void IRBuilder::sealBlock(BlockId block) {
+    //Every predecessor is known now, so the placeholder phis can be given their operands
+    auto pending = std::move(incompletePhis[block]);
+    incompletePhis[block].clear();
+    for (auto& [var, phi] : pending) {
+        addPhiOperands(var, phi, Token{});
+    }
+    sealed[block] = true;
+}
+
+ValueId IRBuilder::emit(IROp op, std::vector<ValueId> args, const Token& source, uint32_t imm) {
+    func.insts.push_back(IRInst{
+        .op = op,
+        .block = current,
+        .args = std::move(args),
+        .imm = imm,
+        .lineCount = source.lineCount,
+        .charCount = source.charCount
+    });
+    ValueId newValue = func.insts.size() - 1;
+    func.blocks[current].insts.push_back(newValue);
+    return newValue;
+}
+
+ValueId IRBuilder::emitConst(const Constant& constant, const Token& source) {
+    //Identical literals share a single constant slot
+    return emit(IROp::Const, {}, source, func.constants.intern(constant));
+}
+
+void IRBuilder::emitJump(BlockId target, const Token& source) {
+    ValueId jump = emit(IROp::Jump, {}, source);
+    func.insts[jump].targets[0] = target;
+    func.blocks[current].succs.push_back(target);
+    func.blocks[target].preds.push_back(current);
+}
+
+void IRBuilder::emitBranch(ValueId cond, BlockId ifTrue, BlockId ifFalse, const Token& source) {
+    ValueId branch = emit(IROp::Branch, {cond}, source);
+    func.insts[branch].targets[0] = ifTrue;
+    func.insts[branch].targets[1] = ifFalse;
+    func.blocks[current].succs.push_back(ifTrue);
+    func.blocks[current].succs.push_back(ifFalse);
+    func.blocks[ifTrue].preds.push_back(current);
+    func.blocks[ifFalse].preds.push_back(current);
+}
+
+bool IRBuilder::isTerminated() const {
+    return func.terminator(current) != nullptr;
+}
+
+void IRBuilder::writeVariable(uint32_t var, BlockId block, ValueId value) {
+    currentDef[block][var] = value;
+}
+
+ValueId IRBuilder::readVariable(uint32_t var, BlockId block, const Token& source) {
+    auto found = currentDef[block].find(var);
+    if (found != currentDef[block].end()) {
+        return found->second;
+    }
+    return readVariableRecursive(var, block, source);
+}
+
+ValueId IRBuilder::readVariableRecursive(uint32_t var, BlockId block, const Token& source) {
+    ValueId value = irNone;
+    const BlockId savedCurrent = current;
+    if (!sealed[block]) {
+        //Not every predecessor is known yet, so place a phi to be completed on sealing
+        current = block;
+        value = emit(IROp::Phi, {}, source);
+        auto& blockInsts = func.blocks[block].insts;
+        blockInsts.pop_back();
+        auto firstNonPhi = std::find_if(blockInsts.begin(), blockInsts.end(), [&](ValueId v) {
+            return func.insts[v].op != IROp::Phi;
+        });
+        blockInsts.insert(firstNonPhi, value);
+        incompletePhis[block][var] = value;
+    } else if (func.blocks[block].preds.size() == 1) {
+        //A single predecessor can never need a phi
+        value = readVariable(var, func.blocks[block].preds[0], source);
+    } else if (func.blocks[block].preds.empty()) {
+        //Reaching the entry or dead code without a definition reads as nil
+        current = block;
+        value = emitConst(Constant{}, source);
+        auto& blockInsts = func.blocks[block].insts;
+        if ((blockInsts.size() > 1) && isTerminator(func.insts[blockInsts[blockInsts.size() - 2]].op)) {
+            std::swap(blockInsts[blockInsts.size() - 1], blockInsts[blockInsts.size() - 2]);
+        }
+    } else {
+        //Break potential cycles by recording the phi before reading through the predecessors
+        current = block;
+        value = emit(IROp::Phi, {}, source);
+        auto& blockInsts = func.blocks[block].insts;
+        blockInsts.pop_back();
+        auto firstNonPhi = std::find_if(blockInsts.begin(), blockInsts.end(), [&](ValueId v) {
+            return func.insts[v].op != IROp::Phi;
+        });
+        blockInsts.insert(firstNonPhi, value);
+        writeVariable(var, block, value);
+        current = savedCurrent;
+        value = addPhiOperands(var, value, source);
+    }
+    current = savedCurrent;
+    writeVariable(var, block, value);
+    return value;
+}
+
+ValueId IRBuilder::addPhiOperands(uint32_t var, ValueId phi, const Token& source) {
+    //Index into the preds each time, since reading may append new blocks and instructions
+    const BlockId phiBlock = func.insts[phi].block;
+    for (size_t i = 0; i < func.blocks[phiBlock].preds.size(); i++) {
+        ValueId operand = readVariable(var, func.blocks[phiBlock].preds[i], source);
+        func.insts[phi].args.push_back(operand);
+    }
+    return phi;
+}
+
+void IRBuilder::assignVariable(uint32_t var, ValueId value, const Token& source) {
+    writeVariable(var, current, guardType(value, varTypes[var], source));
+}
+
+ValueId IRBuilder::guardType(ValueId value, IRType type, const Token& source) {
+    //Every value entering a typed slot is checked, and inference drops the checks it can prove
+    if (type == IRType::Dynamic) {
+        return value;
+    }
+    return emit(IROp::Guard, {value}, source, static_cast<uint32_t>(type));
+}
+
+Result<uint32_t, Utf8String> IRBuilder::declare(Symbol name, const Token& typeName) {
+    auto type = typeFromName(typeName.text);
+    if (!type.isOk()) {
+        return Result<uint32_t, Utf8String>::Err(locatedError(typeName, type.errValue()));
+    }
+    return Result<uint32_t, Utf8String>::Ok(declareTyped(name, type.okValue()));
+}
+
+uint32_t IRBuilder::declareTyped(Symbol name, IRType type) {
+    uint32_t var = varTypes.size();
+    varTypes.push_back(type);
+    scopes.back()[name] = var;
+    return var;
+}
+
+std::optional<uint32_t> IRBuilder::lookup(Symbol name) const {
+    for (auto scope = scopes.rbegin(); scope != scopes.rend(); scope++) {
+        auto found = scope->find(name);
+        if (found != scope->end()) {
+            return found->second;
+        }
+    }
+    return std::nullopt;
+}
+
+Result<IRFunction, Utf8String> IRBuilder::build(size_t funcNode) {
+    //The func node children are laid out as [name, return type, (param type, param name)*]
+    const ASTNode& funcHead = ast[funcNode];
+    const ASTNode& nameNode = ast[funcHead.children[0]];
+    func.name = nameNode.body.symbol;
+    func.arity = (funcHead.children.size() - 2) / 2;
+    auto returnType = typeFromName(ast[funcHead.children[1]].body.text);
+    if (!returnType.isOk()) {
+        return Result<IRFunction, Utf8String>::Err(locatedError(ast[funcHead.children[1]].body, returnType.errValue()));
+    }
+    func.returnType = returnType.okValue();
+
+    current = newBlock();
+    sealBlock(current);
+    scopes.emplace_back();
+
+    //Parameters are defined in the entry block in declaration order, and checked against their declared type
+    for (uint32_t p = 0; p < func.arity; p++) {
+        const ASTNode& paramType = ast[funcHead.children[2 + (p * 2)]];
+        const ASTNode& paramName = ast[funcHead.children[3 + (p * 2)]];
+        auto var = declare(paramName.body.symbol, paramType.body);
+        if (!var.isOk()) {
+            return Result<IRFunction, Utf8String>::Err(var.errValue());
+        }
+        assignVariable(var.okValue(), emit(IROp::Param, {}, paramName.body, p), paramName.body);
+    }
+
+    //The body expressions hang off of the name node
+    std::optional<Utf8String> bodyError = lowerExprs(funcHead.children[0], 0);
+    if (bodyError.has_value()) {
+        return Result<IRFunction, Utf8String>::Err(bodyError.value());
+    }
+
+    //Falling off the end of a function returns nil
+    if (!isTerminated()) {
+        if (func.returnType == IRType::Dynamic) {
+            emit(IROp::Return, {}, funcHead.body);
+        } else {
+            emit(IROp::Return, {guardType(emitConst(Constant{}, funcHead.body), func.returnType, funcHead.body)}, funcHead.body);
+        }
+    }
+    return Result<IRFunction, Utf8String>::Ok(std::move(func));
+}
+
+std::optional<Utf8String> IRBuilder::lowerExprs(size_t parent, size_t firstChild) {
+    const auto& children = ast[parent].children;
+    for (size_t i = firstChild; i < children.size(); i++) {
+        std::optional<Utf8String> error = lowerStatement(children[i]);
+        if (error.has_value()) {
+            return error;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Utf8String> IRBuilder::lowerStatement(size_t node) {
+    switch (ast[node].body.type) {
+        case TokenType::If: { return lowerIf(node); }
+        case TokenType::While: { return lowerWhile(node); }
+        case TokenType::For: { return lowerFor(node); }
+        case TokenType::Prepocessor: { return lowerParallel(node); }
+        default: {
+            IRResult value = lowerExpr(node);
+            if (!value.isOk()) {
+                return std::optional(value.errValue());
+            }
+            return std::nullopt;
+        }
+    }
+}
+
+std::optional<Utf8String> IRBuilder::lowerIf(size_t node) {
+    //Each branch tests its condition, and falls through to the next test when it fails
+    const ASTNode& ifHead = ast[node];
+    BlockId merge = newBlock();
+    for (size_t branchNode : ifHead.children) {
+        const ASTNode& branch = ast[branchNode];
+        scopes.emplace_back();
+        if (branch.body.type == TokenType::Then) {
+            IRResult cond = lowerExpr(branch.children[0]);
+            if (!cond.isOk()) {
+                return std::optional(cond.errValue());
+            }
+            BlockId thenBlock = newBlock();
+            BlockId nextTest = newBlock();
+            emitBranch(cond.okValue(), thenBlock, nextTest, branch.body);
+            sealBlock(thenBlock);
+            sealBlock(nextTest);
+
+            current = thenBlock;
+            std::optional<Utf8String> error = lowerExprs(branchNode, 1);
+            if (error.has_value()) {
+                return error;
+            }
+            if (!isTerminated()) {
+                emitJump(merge, branch.body);
+            }
+            current = nextTest;
+        } else {
+            //The else branch runs in the block reached when every condition failed
+            std::optional<Utf8String> error = lowerExprs(branchNode, 0);
+            if (error.has_value()) {
+                return error;
+            }
+        }
+        scopes.pop_back();
+    }
+
+    if (!isTerminated()) {
+        emitJump(merge, ifHead.body);
+    }
+    sealBlock(merge);
+    current = merge;
+    return std::nullopt;
+}
+
+std::optional<Utf8String> IRBuilder::lowerWhile(size_t node) {
+    //The header is left unsealed until the back edge from the body is added
+    const ASTNode& whileHead = ast[node];
+    BlockId header = newBlock();
+    emitJump(header, whileHead.body);
+    current = header;
+
+    IRResult cond = lowerExpr(whileHead.children[0]);
+    if (!cond.isOk()) {
+        return std::optional(cond.errValue());
+    }
+    BlockId body = newBlock();
+    BlockId exit = newBlock();
+    emitBranch(cond.okValue(), body, exit, whileHead.body);
+    sealBlock(body);
+
+    current = body;
+    scopes.emplace_back();
+    std::optional<Utf8String> error = lowerExprs(node, 1);
+    if (error.has_value()) {
+        return error;
+    }
+    scopes.pop_back();
+    if (!isTerminated()) {
+        emitJump(header, whileHead.body);
+    }
+
+    sealBlock(header);
+    sealBlock(exit);
+    current = exit;
+    return std::nullopt;
+}
+
+std::optional<Utf8String> IRBuilder::lowerFor(size_t node) {
+    //For children are laid out as [loop var, stop cond, advance cond, exprs*], and the loop var is
+    //only visible inside the loop
+    const ASTNode& forHead = ast[node];
+    scopes.emplace_back();
+    IRResult init = lowerExpr(forHead.children[0]);
+    if (!init.isOk()) {
+        return std::optional(init.errValue());
+    }
+
+    BlockId header = newBlock();
+    emitJump(header, forHead.body);
+    current = header;
+    IRResult cond = lowerExpr(forHead.children[1]);
+    if (!cond.isOk()) {
+        return std::optional(cond.errValue());
+    }
+    BlockId body = newBlock();
+    BlockId exit = newBlock();
+    emitBranch(cond.okValue(), body, exit, forHead.body);
+    sealBlock(body);
+
+    current = body;
+    scopes.emplace_back();
+    std::optional<Utf8String> error = lowerExprs(node, 3);
+    if (error.has_value()) {
+        return error;
+    }
+    scopes.pop_back();
+
+    //The advance condition runs at the end of every iteration that reaches the back edge
+    if (!isTerminated()) {
+        IRResult advance = lowerExpr(forHead.children[2]);
+        if (!advance.isOk()) {
+            return std::optional(advance.errValue());
+        }
+        emitJump(header, forHead.body);
+    }
+
+    sealBlock(header);
+    sealBlock(exit);
+    current = exit;
+    scopes.pop_back();
+    return std::nullopt;
+}
+
+std::optional<Utf8String> IRBuilder::lowerParallel(size_t node) {
+    //Directive children are laid out as [directive name, for block]
+    const Token& token = ast[node].body;
+    const size_t forNode = ast[node].children[1];
+    std::optional<CountedLoop> loop = matchCountedLoop(ast, forNode);
+    if (!loop.has_value()) {
+        return std::optional(locatedError(token, "A parallel loop must count an int up by one, like `for let int i = 0; i < n; i++; do`!"));
+    }
+    ParallelScan scan;
+    const auto& forChildren = ast[forNode].children;
+    for (size_t i = 3; i < forChildren.size(); i++) {
+        scanParallelBody(ast, forChildren[i], scan);
+    }
+
+    //A compound update to a name from outside of the loop makes it the reduction, which every chunk accumulates on its own
+    Symbol reduction = noSymbol;
+    IROp op = IROp::Copy;
+    for (const auto& [name, update] : scan.updates) {
+        if ((name == loop->var) || !lookup(name).has_value()) {
+            continue;
+        }
+        if (reduction == noSymbol) {
+            reduction = name;
+            op = reductionOpFor(update);
+        } else if (reduction != name) {
+            return std::optional(locatedError(token, "A parallel loop can only have a single reduction!"));
+        } else if (reductionOpFor(update) != op) {
+            return std::optional(locatedError(token, "A reduction must always be updated through the same operator!"));
+        }
+    }
+    uint32_t reductionTarget = irNone;
+    IRType reductionType = IRType::Dynamic;
+    if (reduction != noSymbol) {
+        reductionTarget = lookup(reduction).value();
+        reductionType = varTypes[reductionTarget];
+        if ((reductionType != IRType::Int) && (reductionType != IRType::Float)) {
+            return std::optional(locatedError(token, "A reduction must be declared as an int or a float!"));
+        }
+        //A nested loop can only reduce into a shared name by carrying on the reduction of the loop around it
+        if ((reductionTarget < firstLocal) && ((reductionTarget != reductionVar) || (op != reductionOp))) {
+            return std::optional(locatedError(token, "A parallel loop body can only write to names declared inside of it, apart from updating its reduction!"));
+        }
+    }
+
+    //Every other name from outside of the loop is captured by value, and passed into the body as a parameter
+    std::vector<Capture> captures;
+    for (Symbol name : scan.reads) {
+        std::optional<uint32_t> var = lookup(name);
+        if ((name == loop->var) || (name == reduction) || !var.has_value()) {
+            continue;
+        }
+        if (parallelBody && (var.value() == reductionVar)) {
+            return std::optional(locatedError(token, "A reduction can only be updated inside of a parallel loop body, never read!"));
+        }
+        captures.push_back(Capture{.name = name, .var = var.value(), .type = varTypes[var.value()]});
+    }
+
+    IRBuilder outliner(ast);
+    auto body = outliner.buildParallel(func.name, forNode, loop->var, captures, reduction, reductionType, op);
+    if (!body.isOk()) {
+        return std::optional(body.errValue());
+    }
+
+    //The bounds are only read once, since nothing in the body can write to a local they depend on
+    IRResult begin = lowerExpr(loop->begin);
+    if (!begin.isOk()) {
+        return std::optional(begin.errValue());
+    }
+    const ValueId beginValue = guardType(begin.okValue(), IRType::Int, token);
+    IRResult end = lowerExpr(loop->end);
+    if (!end.isOk()) {
+        return std::optional(end.errValue());
+    }
+    ValueId endValue = guardType(end.okValue(), IRType::Int, token);
+    if (loop->inclusive) {
+        Constant one;
+        one.type = ConstantType::Int;
+        one.intVal = 1;
+        endValue = emit(IROp::Add, {endValue, emitConst(one, token)}, token);
+    }
+
+    const Constant start = (reduction == noSymbol) ? Constant{} : identityFor(op, reductionType);
+    std::vector<ValueId> args = {beginValue, endValue, emitConst(start, token)};
+    for (const Capture& capture : captures) {
+        args.push_back(readVariable(capture.var, current, token));
+    }
+    const ValueId reduced = emit(IROp::ParallelFor, std::move(args), token, func.bodies.size());
+    func.bodies.push_back(std::move(body.okValue()));
+    if (reduction != noSymbol) {
+        assignVariable(reductionTarget, emit(op, {readVariable(reductionTarget, current, token), reduced}, token), token);
+    }
+    return std::nullopt;
+}
+
+Result<IRFunction, Utf8String> IRBuilder::buildParallel(Symbol name, size_t forNode, Symbol loopVar, const std::vector<Capture>& captures,
+                                                        Symbol reduction, IRType reductionType, IROp op) {
+    //Errors in the body report the function it was written in
+    const Token& token = ast[forNode].body;
+    func.name = name;
+    func.arity = 3 + captures.size();
+    func.returnType = (reduction == noSymbol) ? IRType::Dynamic : reductionType;
+    func.reduction = (reduction == noSymbol) ? IROp::Copy : op;
+    parallelBody = true;
+
+    current = newBlock();
+    sealBlock(current);
+    scopes.emplace_back();
+
+    //Parameters come in as `(begin, end, reduction start, captured values...)`
+    const ValueId begin = guardType(emit(IROp::Param, {}, token, 0), IRType::Int, token);
+    const ValueId end = guardType(emit(IROp::Param, {}, token, 1), IRType::Int, token);
+    if (reduction != noSymbol) {
+        reductionVar = declareTyped(reduction, reductionType);
+        reductionOp = op;
+        assignVariable(reductionVar, emit(IROp::Param, {}, token, 2), token);
+    }
+    for (uint32_t i = 0; i < captures.size(); i++) {
+        const uint32_t var = declareTyped(captures[i].name, captures[i].type);
+        assignVariable(var, emit(IROp::Param, {}, token, 3 + i), token);
+    }
+    const uint32_t counter = declareTyped(loopVar, IRType::Int);
+    writeVariable(counter, current, begin);
+    firstLocal = varTypes.size();
+
+    //Everything from here is a plain for loop over the chunk
+    BlockId header = newBlock();
+    emitJump(header, token);
+    current = header;
+    const ValueId cond = emit(IROp::LessThan, {readVariable(counter, current, token), end}, token);
+    BlockId body = newBlock();
+    BlockId exit = newBlock();
+    emitBranch(cond, body, exit, token);
+    sealBlock(body);
+
+    current = body;
+    scopes.emplace_back();
+    std::optional<Utf8String> error = lowerExprs(forNode, 3);
+    if (error.has_value()) {
+        return Result<IRFunction, Utf8String>::Err(error.value());
+    }
+    scopes.pop_back();
+    Constant one;
+    one.type = ConstantType::Int;
+    one.intVal = 1;
+    writeVariable(counter, current, emit(IROp::Add, {readVariable(counter, current, token), emitConst(one, token)}, token));
+    emitJump(header, token);
+
+    sealBlock(header);
+    sealBlock(exit);
+    current = exit;
+    if (reduction == noSymbol) {
+        emit(IROp::Return, {}, token);
+    } else {
+        emit(IROp::Return, {readVariable(reductionVar, current, token)}, token);
+    }
+    return Result<IRFunction, Utf8String>::Ok(std::move(func));
+}
+
+IRResult IRBuilder::lowerExpr(size_t node) {
+    const ASTNode& expr = ast[node];
+    const Token& token = expr.body;
+    switch (token.type) {
+        case TokenType::Number: {
+            auto constant = constantFromNumber(token.text);
+            if (!constant.isOk()) {
+                return IRResult::Err(locatedError(token, constant.errValue()));
+            }
+            return IRResult::Ok(emitConst(constant.okValue(), token));
+        }
+        case TokenType::StringLit: {
+            //Strip the surrounding quotes from the literal
+            Constant constant;
+            constant.type = ConstantType::String;
+            constant.strVal = token.text.substr(1, token.text.getLen() - 1).toOwned();
+            return IRResult::Ok(emitConst(constant, token));
+        }
+        case TokenType::Identifier: {
+            std::optional<uint32_t> var = lookup(token.symbol);
+            if (!var.has_value()) {
+                return IRResult::Err(locatedError(token, "Use of an undeclared name!"));
+            }
+            if (parallelBody && (var.value() == reductionVar)) {
+                return IRResult::Err(locatedError(token, "A reduction can only be updated inside of a parallel loop body, never read!"));
+            }
+            return IRResult::Ok(readVariable(var.value(), current, token));
+        }
+        case TokenType::Let: {
+            //A bare declaration starts out as the zero value of its type
+            auto var = declare(ast[expr.children[1]].body.symbol, ast[expr.children[0]].body);
+            if (!var.isOk()) {
+                return IRResult::Err(var.errValue());
+            }
+            ValueId zero = emitConst(zeroValueFor(varTypes[var.okValue()]), token);
+            writeVariable(var.okValue(), current, zero);
+            return IRResult::Ok(zero);
+        }
+        case TokenType::Assign:
+        case TokenType::AddAssign:
+        case TokenType::SubAssign:
+        case TokenType::MulAssign:
+        case TokenType::DivAssign:
+        case TokenType::PostInc:
+        case TokenType::PostDec: {
+            return lowerAssign(node);
+        }
+        case TokenType::Add:
+        case TokenType::Sub:
+        case TokenType::LogNot: {
+            //A single child means these are prefix operators
+            if (expr.children.size() == 1) {
+                IRResult operand = lowerExpr(expr.children[0]);
+                if (!operand.isOk()) {
+                    return operand;
+                }
+                if (token.type == TokenType::Add) {
+                    return operand;
+                }
+                IROp op = (token.type == TokenType::Sub) ? IROp::Neg : IROp::Not;
+                return IRResult::Ok(emit(op, {operand.okValue()}, token));
+            }
+            [[fallthrough]];
+        }
+        case TokenType::Mul:
+        case TokenType::Div:
+        case TokenType::Mod:
+        case TokenType::LessThan:
+        case TokenType::LessEqual:
+        case TokenType::GreaterThan:
+        case TokenType::GreaterEqual:
+        case TokenType::Equals:
+        case TokenType::NotEquals: {
+            IRResult lhs = lowerExpr(expr.children[0]);
+            if (!lhs.isOk()) {
+                return lhs;
+            }
+            IRResult rhs = lowerExpr(expr.children[1]);
+            if (!rhs.isOk()) {
+                return rhs;
+            }
+            return IRResult::Ok(emit(binaryOpFor(token.type), {lhs.okValue(), rhs.okValue()}, token));
+        }
+        case TokenType::FuncCall: {
+            std::vector<ValueId> args;
+            for (size_t child : expr.children) {
+                IRResult arg = lowerExpr(child);
+                if (!arg.isOk()) {
+                    return arg;
+                }
+                args.push_back(arg.okValue());
+            }
+
+            //Callees are recorded by name, every call to the same function shares one slot
+            uint32_t calleeIndx = 0;
+            while ((calleeIndx < func.callees.size()) && (func.callees[calleeIndx] != token.symbol)) {
+                calleeIndx++;
+            }
+            if (calleeIndx == func.callees.size()) {
+                func.callees.push_back(token.symbol);
+            }
+            return IRResult::Ok(emit(IROp::Call, std::move(args), token, calleeIndx));
+        }
+        case TokenType::Return: {
+            if (parallelBody) {
+                return IRResult::Err(locatedError(token, "A parallel loop body can't return out of the function around it!"));
+            }
+            std::vector<ValueId> args;
+            if (!expr.children.empty()) {
+                IRResult value = lowerExpr(expr.children[0]);
+                if (!value.isOk()) {
+                    return value;
+                }
+                args.push_back(guardType(value.okValue(), func.returnType, token));
+            } else if (func.returnType != IRType::Dynamic) {
+                args.push_back(guardType(emitConst(Constant{}, token), func.returnType, token));
+            }
+            ValueId ret = emit(IROp::Return, std::move(args), token);
+
+            //Anything after a return is unreachable, so give it a block with no predecessors
+            current = newBlock();
+            sealBlock(current);
+            return IRResult::Ok(ret);
+        }
+        default: {
+            return IRResult::Err(locatedError(token, "This expression is not supported by the compiler yet!"));
+        }
+    }
+}
+
+IRResult IRBuilder::lowerAssign(size_t node) {
+    const ASTNode& expr = ast[node];
+    const Token& token = expr.body;
+    const ASTNode& target = ast[expr.children[0]];
+
+    //Only plain assignment may declare its target
+    uint32_t var = 0;
+    if ((target.body.type == TokenType::Let) && (token.type == TokenType::Assign)) {
+        IRResult value = lowerExpr(expr.children[1]);
+        if (!value.isOk()) {
+            return value;
+        }
+        auto declared = declare(ast[target.children[1]].body.symbol, ast[target.children[0]].body);
+        if (!declared.isOk()) {
+            return IRResult::Err(declared.errValue());
+        }
+        assignVariable(declared.okValue(), value.okValue(), token);
+        return value;
+    }
+    if (target.body.type != TokenType::Identifier) {
+        return IRResult::Err(locatedError(target.body, "Only a name can be assigned to!"));
+    }
+    std::optional<uint32_t> found = lookup(target.body.symbol);
+    if (!found.has_value()) {
+        return IRResult::Err(locatedError(target.body, "Assignment to an undeclared name!"));
+    }
+    var = found.value();
+    if (var < firstLocal) {
+        const bool isUpdate = (token.type == TokenType::AddAssign) || (token.type == TokenType::SubAssign) || (token.type == TokenType::MulAssign);
+        if ((var != reductionVar) || !isUpdate || (reductionOpFor(token.type) != reductionOp)) {
+            return IRResult::Err(locatedError(token, "A parallel loop body can only write to names declared inside of it, apart from updating its reduction!"));
+        }
+    }
+
+    ValueId result = irNone;
+    ValueId newValue = irNone;
+    if ((token.type == TokenType::PostInc) || (token.type == TokenType::PostDec)) {
+        //Postfix operators give back the value from before the update
+        Constant one;
+        one.type = ConstantType::Int;
+        one.intVal = 1;
+        result = readVariable(var, current, token);
+        IROp op = (token.type == TokenType::PostInc) ? IROp::Add : IROp::Sub;
+        newValue = emit(op, {result, emitConst(one, token)}, token);
+    } else {
+        IRResult rhs = lowerExpr(expr.children[1]);
+        if (!rhs.isOk()) {
+            return rhs;
+        }
+        newValue = rhs.okValue();
+        if (token.type != TokenType::Assign) {
+            newValue = emit(binaryOpFor(token.type), {readVariable(var, current, token), newValue}, token);
+        }
+        result = newValue;
+    }
+    assignVariable(var, newValue, token);
+    return IRResult::Ok(result);
+}
+
+Result<IRFunction, Utf8String> buildIR(const std::vector<ASTNode>& ast, size_t funcNode) {
+    FL_STAGE(BuildIR);
+    IRBuilder builder(ast);
+    return builder.build(funcNode);
+}
+
+} //end namespace fl
@@ -0,0 +1,568 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "ir_passes.hpp"
+#include "diagnostic.hpp"
+#include "instrument.hpp"
+#include <map>
+#include <tuple>
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                       General Pass Tools                                             */
+/*======================================================================================================*/
+
+/**
+ * @brief follows a chain of copies back to the value they all forward
+ */
+static ValueId resolveCopy(const IRFunction& func, ValueId value) {
+    while (func.insts[value].op == IROp::Copy) {
+        value = func.insts[value].args[0];
+    }
+    return value;
+}
+
+/**
+ * @brief removes an instruction from the instruction list of its block
+ */
+static void detachInst(IRFunction& func, ValueId value) {
+    auto& blockInsts = func.blocks[func.insts[value].block].insts;
+    blockInsts.erase(std::find(blockInsts.begin(), blockInsts.end(), value));
+}
+
+/**
+ * @brief turns an instruction into a copy of another value in place, so every use of it forwards
+ */
+static void replaceWithCopy(IRFunction& func, ValueId value, ValueId replacement) {
+    IRInst& inst = func.insts[value];
+    inst.op = IROp::Copy;
+    inst.args = {replacement};
+    inst.imm = 0;
+}
+
+/**
+ * @brief checks if a type is one of the number types
+ */
+static constexpr bool isNumeric(IRType type) {
+    return (type == IRType::Int) || (type == IRType::Float);
+}
+
+/**
+ * @brief checks if an instruction can never raise a runtime error with the operand types it was inferred with
+ */
+static bool isSpeculatable(const IRFunction& func, const IRInst& inst) {
+    auto allArgsAre = [&](auto predicate) {
+        return std::all_of(inst.args.begin(), inst.args.end(), [&](ValueId arg) {
+            return predicate(func.insts[arg].type);
+        });
+    };
+    switch (inst.op) {
+        case IROp::Const:
+        case IROp::Copy:
+        case IROp::Not:
+        case IROp::Equals:
+        case IROp::NotEquals: {
+            return true;
+        }
+        case IROp::Add: {
+            return allArgsAre(isNumeric) || allArgsAre([](IRType t) { return t == IRType::String; });
+        }
+        case IROp::Sub:
+        case IROp::Mul:
+        case IROp::Neg:
+        case IROp::LessThan:
+        case IROp::LessEqual:
+        case IROp::GreaterThan:
+        case IROp::GreaterEqual: {
+            return allArgsAre(isNumeric);
+        }
+        case IROp::Div: {
+            //Only integer division can fail, by dividing by zero
+            return allArgsAre([](IRType t) { return t == IRType::Float; });
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/*======================================================================================================*/
+/*                                       Type Inference                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief merges the types flowing into a phi, where any disagreement can only be settled at runtime
+ */
+static constexpr IRType joinTypes(IRType a, IRType b) {
+    if (a == IRType::Unknown) {
+        return b;
+    }
+    if (b == IRType::Unknown) {
+        return a;
+    }
+    return (a == b) ? a : IRType::Dynamic;
+}
+
+/**
+ * @brief gets the static type a constant always has
+ */
+static constexpr IRType typeOfConstant(ConstantType type) {
+    switch (type) {
+        case ConstantType::Bool: { return IRType::Bool; }
+        case ConstantType::Int: { return IRType::Int; }
+        case ConstantType::Float: { return IRType::Float; }
+        case ConstantType::String: { return IRType::String; }
+        default: { return IRType::Nil; }
+    }
+}
+
+/**
+ * @brief works out the type an instruction produces from the current types of its operands
+ * @param valid is cleared if the operand types are fully known and the operation can never succeed on them
+ */
+static IRType resultType(const IRFunction& func, const IRInst& inst, const ReturnTypeMap& returnTypes, bool& valid) {
+    valid = true;
+    const IRType lhs = inst.args.empty() ? IRType::Unknown : func.insts[inst.args[0]].type;
+    const IRType rhs = (inst.args.size() < 2) ? lhs : func.insts[inst.args[1]].type;
+    const bool pending = (lhs == IRType::Unknown) || (rhs == IRType::Unknown);
+    const bool dynamic = (lhs == IRType::Dynamic) || (rhs == IRType::Dynamic);
+
+    switch (inst.op) {
+        case IROp::Const: {
+            return typeOfConstant(func.constants[inst.imm].type);
+        }
+        case IROp::Param: {
+            return IRType::Dynamic;
+        }
+        case IROp::Phi: {
+            IRType joined = IRType::Unknown;
+            for (ValueId arg : inst.args) {
+                joined = joinTypes(joined, func.insts[arg].type);
+            }
+            return joined;
+        }
+        case IROp::Copy: {
+            return lhs;
+        }
+        case IROp::Call: {
+            auto found = returnTypes.find(func.callees[inst.imm]);
+            return (found == returnTypes.end()) ? IRType::Dynamic : found->second;
+        }
+        case IROp::ParallelFor: {
+            return func.bodies[inst.imm].returnType;
+        }
+        case IROp::Guard: {
+            //Ints are allowed into float slots, and are converted on the way in
+            const IRType expected = static_cast<IRType>(inst.imm);
+            valid = pending || dynamic || (lhs == expected) || ((lhs == IRType::Int) && (expected == IRType::Float));
+            return expected;
+        }
+        case IROp::Not:
+        case IROp::Equals:
+        case IROp::NotEquals: {
+            return IRType::Bool;
+        }
+        case IROp::LessThan:
+        case IROp::LessEqual:
+        case IROp::GreaterThan:
+        case IROp::GreaterEqual: {
+            valid = pending || dynamic || (isNumeric(lhs) && isNumeric(rhs)) || ((lhs == IRType::String) && (rhs == IRType::String));
+            return IRType::Bool;
+        }
+        default: {
+            break;
+        }
+    }
+
+    //Everything left is arithmetic
+    if (pending) {
+        return IRType::Unknown;
+    }
+    if (dynamic) {
+        return IRType::Dynamic;
+    }
+    if ((inst.op == IROp::Add) && (lhs == IRType::String) && (rhs == IRType::String)) {
+        return IRType::String;
+    }
+    if (!isNumeric(lhs) || !isNumeric(rhs)) {
+        valid = false;
+        return IRType::Dynamic;
+    }
+    return ((lhs == IRType::Int) && (rhs == IRType::Int)) ? IRType::Int : IRType::Float;
+}
+
+std::optional<Utf8String> inferTypes(IRFunction& func, const ReturnTypeMap& returnTypes) {
+    FL_STAGE(InferTypes);
+    eliminateDeadCode(func);
+    for (IRInst& inst : func.insts) {
+        inst.type = IRType::Unknown;
+    }
+
+    //Types only ever move up from unknown, to a concrete type, to dynamic, so this always settles
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (BlockId b : func.rpo) {
+            for (ValueId v : func.blocks[b].insts) {
+                IRInst& inst = func.insts[v];
+                if (isTerminator(inst.op)) {
+                    continue;
+                }
+                bool valid = true;
+                IRType newType = resultType(func, inst, returnTypes, valid);
+                if (newType != inst.type) {
+                    inst.type = newType;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    //Anything never pinned down, like a phi that only feeds itself, falls back to runtime checks
+    for (IRInst& inst : func.insts) {
+        if (!inst.dead && !isTerminator(inst.op) && (inst.type == IRType::Unknown)) {
+            inst.type = IRType::Dynamic;
+        }
+    }
+
+    //With every type settled, report operations that can never succeed, and drop guards that always pass
+    for (BlockId b : func.rpo) {
+        for (ValueId v : func.blocks[b].insts) {
+            IRInst& inst = func.insts[v];
+            if (isTerminator(inst.op)) {
+                continue;
+            }
+            bool valid = true;
+            resultType(func, inst, returnTypes, valid);
+            if (!valid) {
+                const char* message = (inst.op == IROp::Guard) ? "Value does not match its declared type!" : "Operator can not be used with these types!";
+                return std::optional(renderLocated(inst.lineCount, inst.charCount, message));
+            }
+            if ((inst.op == IROp::Guard) && (func.insts[inst.args[0]].type == inst.type)) {
+                replaceWithCopy(func, v, inst.args[0]);
+            }
+        }
+    }
+    propagateCopies(func);
+    return std::nullopt;
+}
+
+/*======================================================================================================*/
+/*                                       Copy Propagation                                               */
+/*======================================================================================================*/
+
+void propagateCopies(IRFunction& func) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        //Rewrite every operand to skip past copies
+        for (IRInst& inst : func.insts) {
+            if (inst.dead) {
+                continue;
+            }
+            for (ValueId& arg : inst.args) {
+                ValueId resolved = resolveCopy(func, arg);
+                if (resolved != arg) {
+                    arg = resolved;
+                    changed = true;
+                }
+            }
+        }
+
+        //A phi whose operands are all itself or one other value is just that other value
+        for (ValueId v = 0; v < func.insts.size(); v++) {
+            IRInst& inst = func.insts[v];
+            if (inst.dead || (inst.op != IROp::Phi)) {
+                continue;
+            }
+            ValueId same = irNone;
+            bool trivial = true;
+            for (ValueId arg : inst.args) {
+                if ((arg == v) || (arg == same)) {
+                    continue;
+                }
+                if (same != irNone) {
+                    trivial = false;
+                    break;
+                }
+                same = arg;
+            }
+            if (trivial && (same != irNone)) {
+                replaceWithCopy(func, v, same);
+                changed = true;
+            }
+        }
+    }
+
+    //Nothing refers to a copy anymore, so they can all be dropped
+    for (ValueId v = 0; v < func.insts.size(); v++) {
+        IRInst& inst = func.insts[v];
+        if (!inst.dead && (inst.op == IROp::Copy)) {
+            detachInst(func, v);
+            inst.dead = true;
+        }
+    }
+}
+
+/*======================================================================================================*/
+/*                                    Global Value Numbering                                            */
+/*======================================================================================================*/
+
+/**
+ * @brief the identity of a pure instruction, two instructions with the same key compute the same value
+ */
+using ValueKey = std::tuple<IROp, uint32_t, std::vector<ValueId>>;
+
+void numberValues(IRFunction& func) {
+    //Values found in a block are visible to every block it dominates, so walk the dominator tree
+    //keeping a table of available values, and undo each blocks additions on the way back up
+    std::map<ValueKey, ValueId> available;
+    std::vector<std::pair<BlockId, size_t>> walk = {{0, 0}};
+    std::vector<std::vector<ValueKey>> added = {{}};
+    bool anyReplaced = false;
+
+    auto visit = [&](BlockId block, std::vector<ValueKey>& blockAdded) {
+        for (ValueId v : func.blocks[block].insts) {
+            IRInst& inst = func.insts[v];
+            if (!isPure(inst.op) || (inst.op == IROp::Copy)) {
+                continue;
+            }
+            std::vector<ValueId> args = inst.args;
+            for (ValueId& arg : args) {
+                arg = resolveCopy(func, arg);
+            }
+            if (isCommutative(inst.op)) {
+                std::sort(args.begin(), args.end());
+            }
+
+            //Phis are only redundant with other phis in the same block, since their operands are tied to edges
+            uint32_t imm = (inst.op == IROp::Phi) ? block : inst.imm;
+            ValueKey key = {inst.op, imm, std::move(args)};
+            auto found = available.find(key);
+            if (found != available.end()) {
+                replaceWithCopy(func, v, found->second);
+                anyReplaced = true;
+            } else {
+                available.emplace(key, v);
+                blockAdded.push_back(std::move(key));
+            }
+        }
+    };
+
+    visit(0, added.back());
+    while (!walk.empty()) {
+        auto [block, nextChild] = walk.back();
+        if (nextChild < func.blocks[block].domChildren.size()) {
+            walk.back().second++;
+            BlockId child = func.blocks[block].domChildren[nextChild];
+            walk.push_back({child, 0});
+            added.emplace_back();
+            visit(child, added.back());
+        } else {
+            for (const ValueKey& key : added.back()) {
+                available.erase(key);
+            }
+            added.pop_back();
+            walk.pop_back();
+        }
+    }
+
+    if (anyReplaced) {
+        propagateCopies(func);
+    }
+}
+
+/*======================================================================================================*/
+/*                                     Dead Code Elimination                                            */
+/*======================================================================================================*/
+
+void eliminateDeadCode(IRFunction& func) {
+    func.computeDominators();
+
+    //Unreachable blocks lose all of their instructions, and their edges into reachable blocks
+    for (BlockId b = 0; b < func.blocks.size(); b++) {
+        IRBlock& block = func.blocks[b];
+        if (block.reachable) {
+            continue;
+        }
+        for (BlockId succ : block.succs) {
+            IRBlock& succBlock = func.blocks[succ];
+            for (size_t p = succBlock.preds.size(); p-- > 0;) {
+                if (succBlock.preds[p] != b) {
+                    continue;
+                }
+                succBlock.preds.erase(succBlock.preds.begin() + p);
+                for (ValueId v : succBlock.insts) {
+                    if (func.insts[v].op == IROp::Phi) {
+                        func.insts[v].args.erase(func.insts[v].args.begin() + p);
+                    }
+                }
+            }
+        }
+        for (ValueId v : block.insts) {
+            func.insts[v].dead = true;
+        }
+        block.insts.clear();
+        block.succs.clear();
+        block.preds.clear();
+    }
+
+    //Removing edges can leave phis trivial
+    propagateCopies(func);
+
+    //Mark everything reachable from an instruction with side effects as live
+    std::vector<bool> live(func.insts.size(), false);
+    std::vector<ValueId> worklist;
+    for (ValueId v = 0; v < func.insts.size(); v++) {
+        const IRInst& inst = func.insts[v];
+        if (!inst.dead && !isPure(inst.op) && (inst.op != IROp::Param)) {
+            live[v] = true;
+            worklist.push_back(v);
+        }
+    }
+    while (!worklist.empty()) {
+        ValueId v = worklist.back();
+        worklist.pop_back();
+        for (ValueId arg : func.insts[v].args) {
+            if (!live[arg]) {
+                live[arg] = true;
+                worklist.push_back(arg);
+            }
+        }
+    }
+
+    //Parameters always keep their place, since the caller fills them in
+    for (ValueId v = 0; v < func.insts.size(); v++) {
+        IRInst& inst = func.insts[v];
+        if (!inst.dead && !live[v] && (inst.op != IROp::Param)) {
+            detachInst(func, v);
+            inst.dead = true;
+        }
+    }
+}
+
+/*======================================================================================================*/
+/*                                  Loop Invariant Code Motion                                          */
+/*======================================================================================================*/
+
+void hoistLoopInvariants(IRFunction& func) {
+    //Every edge into a block that dominates its source is a back edge, and each one forms a natural loop
+    std::map<BlockId, std::vector<BlockId>> loops;
+    for (BlockId b : func.rpo) {
+        for (BlockId succ : func.blocks[b].succs) {
+            if (func.dominates(succ, b)) {
+                loops[succ].push_back(b);
+            }
+        }
+    }
+
+    //Collect the body of each loop, and handle inner loops first so their invariants can keep bubbling out
+    std::vector<std::pair<BlockId, std::vector<bool>>> loopBodies;
+    for (auto& [header, latches] : loops) {
+        std::vector<bool> inLoop(func.blocks.size(), false);
+        inLoop[header] = true;
+        std::vector<BlockId> worklist = latches;
+        while (!worklist.empty()) {
+            BlockId b = worklist.back();
+            worklist.pop_back();
+            if (inLoop[b]) {
+                continue;
+            }
+            inLoop[b] = true;
+            for (BlockId p : func.blocks[b].preds) {
+                worklist.push_back(p);
+            }
+        }
+        loopBodies.push_back({header, std::move(inLoop)});
+    }
+    std::sort(loopBodies.begin(), loopBodies.end(), [](const auto& a, const auto& b) {
+        return std::count(a.second.begin(), a.second.end(), true) < std::count(b.second.begin(), b.second.end(), true);
+    });
+
+    for (auto& [header, inLoop] : loopBodies) {
+        //Invariants can only move if there is a single block entering the loop that always falls into it
+        BlockId preheader = irNone;
+        for (BlockId p : func.blocks[header].preds) {
+            if (inLoop[p]) {
+                continue;
+            }
+            preheader = (preheader == irNone) ? p : irNone - 1;
+        }
+        if ((preheader >= irNone - 1) || (func.blocks[preheader].succs.size() != 1)) {
+            continue;
+        }
+
+        //Blocks that dominate every exit from the loop run on every trip into it
+        std::vector<BlockId> exits;
+        for (BlockId b = 0; b < func.blocks.size(); b++) {
+            if (!inLoop[b]) {
+                continue;
+            }
+            for (BlockId succ : func.blocks[b].succs) {
+                if (!inLoop[succ]) {
+                    exits.push_back(b);
+                }
+            }
+        }
+
+        //Walk the loop in rpo so that operands are always visited before their uses
+        for (BlockId b : func.rpo) {
+            if (!inLoop[b]) {
+                continue;
+            }
+            bool alwaysRuns = std::all_of(exits.begin(), exits.end(), [&](BlockId exit) {
+                return func.dominates(b, exit);
+            });
+
+            std::vector<ValueId> blockInsts = func.blocks[b].insts;
+            for (ValueId v : blockInsts) {
+                IRInst& inst = func.insts[v];
+                if (!isPure(inst.op) || (inst.op == IROp::Phi)) {
+                    continue;
+                }
+                if (!alwaysRuns && !isSpeculatable(func, inst)) {
+                    continue;
+                }
+                bool invariant = std::all_of(inst.args.begin(), inst.args.end(), [&](ValueId arg) {
+                    return !inLoop[func.insts[arg].block];
+                });
+                if (!invariant) {
+                    continue;
+                }
+
+                //Move it to just before the preheader terminator
+                detachInst(func, v);
+                auto& preInsts = func.blocks[preheader].insts;
+                preInsts.insert(preInsts.end() - 1, v);
+                inst.block = preheader;
+            }
+        }
+    }
+}
+
+/*======================================================================================================*/
+/*                                          Pipeline                                                    */
+/*======================================================================================================*/
+
+void optimizeIR(IRFunction& func) {
+    FL_STAGE(Optimize);
+    eliminateDeadCode(func);
+    numberValues(func);
+    hoistLoopInvariants(func);
+
+    //Hoisted values from sibling loops can now be redundant with each other
+    numberValues(func);
+    eliminateDeadCode(func);
+}
+
+} //end namespace fl
@@ -1,44 +1,79 @@
 #include <iostream>
 #include <string>
-#include "utf8string.hpp"
-#include "tokenizer.hpp"
-#include "parser.hpp"
-#include "fl_util.hpp"
+#include <cerrno>
+#include <cstdlib>
+#include "driver.hpp"
 
 /**
- * @brief THIS IS A TESTING FILE ONLY
+ * @brief the command line driver, compiling any number of scripts at once
+ * @details usage: `FlowLang [--jobs N] [--emit bytecode|listing|ast-dump] [--out DIR] [--syntax-only] [--run] [--stats]
+ * <file or directory>...`, where directories are searched for `.fl` files, `.flbc` files are loaded in place of
+ * being compiled, and every error is reported in the order the files were given no matter how many jobs compiled them
  */
 
 using namespace fl;
 
-int main() {
-    Utf8String::setLocale();
-    std::string filePath = "/mnt/c/Users/Moose/Desktop/Programming/FlowLang/test.fl";
-    Utf8String fileContent = Utf8String::fromFile(filePath.c_str());
+static int usage(const char* program) {
+    std::cout << "usage: " << program << " [options] <file or directory>...\n"
+              << "  -j, --jobs N       compile N files at once, every hardware thread by default\n"
+              << "  --emit KIND        write `bytecode` as .flbc, a disassembled `listing` as .fllist, or an `ast-dump`\n"
+              << "                     of the parse tree as .flast for every clean file\n"
+              << "  --out DIR          write emitted files under DIR instead of beside their sources\n"
+              << "  --syntax-only      stop after parsing\n"
+              << "  --run              call `main` in every file that has one, in input order\n"
+              << "  --stats            print a throughput summary\n";
+    return 1;
+}
 
-    auto tokensRes = tokenize(fileContent);
-    std::vector<Token> tokens = {};
-    if (tokensRes.isOk()) {
-        tokens = tokensRes.okValue();
-    } else {
-        std::cout << "Tokenizer error: " << tokensRes.errValue() << std::endl;
-        return 1;
+int main(int argc, char** argv) {
+    DriverOptions options;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1) < argc;
+        if (((arg == "--jobs") || (arg == "-j")) && hasValue) {
+            //Anything but a whole number of at least one, like `0`, `-2` or `4x`, is a mistake worth stopping on
+            const char* value = argv[++i];
+            char* parsedEnd = nullptr;
+            errno = 0;
+            const unsigned long long jobs = std::strtoull(value, &parsedEnd, 10);
+            if ((value[0] < '0') || (value[0] > '9') || (*parsedEnd != '\0') || (errno == ERANGE) || (jobs == 0)) {
+                std::cout << "`--jobs` takes a whole number of at least 1, not `" << value << "`" << std::endl;
+                return usage(argv[0]);
+            }
+            options.jobs = static_cast<size_t>(jobs);
+        } else if ((arg == "--emit") && hasValue) {
+            const std::string kind = argv[++i];
+            if (kind == "bytecode") {
+                options.emit = EmitKind::Bytecode;
+            } else if (kind == "listing") {
+                options.emit = EmitKind::Listing;
+            } else if (kind == "ast-dump") {
+                options.emit = EmitKind::AstDump;
+            } else {
+                std::cout << "Unknown emit kind `" << kind << "`" << std::endl;
+                return usage(argv[0]);
+            }
+        } else if ((arg == "--out") && hasValue) {
+            options.outDir = argv[++i];
+        } else if (arg == "--syntax-only") {
+            options.syntaxOnly = true;
+        } else if (arg == "--run") {
+            options.run = true;
+        } else if (arg == "--stats") {
+            options.stats = true;
+        } else if (!arg.empty() && (arg[0] == '-')) {
+            std::cout << "Unknown argument `" << arg << "`" << std::endl;
+            return usage(argv[0]);
+        } else {
+            options.inputs.push_back(arg);
+        }
     }
-
-    // for (auto t : tokens) {
-    //     std::cout << t << std::endl;
-    // }
-
-    auto parser = FlowParser();
-    auto head = parser.parse(tokens);
-
-    std::cout << "Parser finished!" << std::endl;
-    if (head.isOk()) {
-        parser.log();
-    } else {
-        std::cout << "Parser Failure: " << head.errValue() << std::endl;
+    if (options.inputs.empty()) {
+        return usage(argv[0]);
+    }
+    if (options.syntaxOnly && ((options.emit == EmitKind::Bytecode) || (options.emit == EmitKind::Listing))) {
+        std::cout << "Bytecode can't be emitted when stopping after parsing" << std::endl;
         return 1;
     }
-
-    return 0;
-}
\ No newline at end of file
+    return runDriver(options, std::cout);
+}
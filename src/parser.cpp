@@ -10,6 +10,7 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 
 #include "parser.hpp"
 #include "fl_util.hpp"
+#include "instrument.hpp"
 #include <stdint.h>
 
 namespace fl {
@@ -83,6 +84,9 @@ constexpr int64_t getPrescedence(const Token& token) {
         case TokenType::DivAssign: {
             return 11;
         }
+        case TokenType::Return: {
+            return 12;
+        }
         case TokenType::OpenParen:
         case TokenType::CloseParen: {
             return -2;
@@ -103,6 +107,7 @@ constexpr BindingType getBindingType(const Token& t) {
             return BindingType::LeftUnary;
         }
         case TokenType::Let:
+        case TokenType::Return:
         case TokenType::LogNot: {
             return BindingType::RightUnary;
         }
@@ -131,21 +136,88 @@ constexpr BindingType getBindingType(const Token& t) {
     }
 }
 
+/**
+ * @brief builds a diagnostic located at `tokens[indx]`, falling back to the last token when `indx` runs
+ * past the end, like when a block is missing its closing token
+ */
+static Diagnostic diagnoseAt(const Span<Token>& tokens, size_t indx, DiagCode code, Symbol arg = noSymbol) {
+    if (tokens.size() == 0) {
+        return Diagnostic{.code = code, .arg = arg};
+    }
+    const Token& at = tokens[std::min(indx, tokens.size() - 1)];
+    return Diagnostic{
+        .line = static_cast<uint32_t>(at.lineCount),
+        .column = static_cast<uint32_t>(at.charCount),
+        .code = code,
+        .arg = arg
+    };
+}
+
 /**
  * @brief loops over a set of tokens which is expected to be just constants and parenthesis
  */
-Result<int64_t, Utf8String> extractSingle(const Span<Token>& tokens) {
+Result<int64_t, Diagnostic> extractSingle(const Span<Token>& tokens) {
     int64_t nextConst = -1;
     for (int i = 0; i < tokens.size(); i++) {
         if ((tokens[i].type != TokenType::OpenParen) && (tokens[i].type != TokenType::CloseParen)) {
             if (nextConst == -1) {
                 nextConst = i;
             } else {
-                return Result<int64_t, Utf8String>::Err("Expected to see a single operand!"_utf8);
+                return Result<int64_t, Diagnostic>::Err(diagnoseAt(tokens, i, DiagCode::ExpectedSingleOperand));
             }
         }
     }
-    return Result<int64_t, Utf8String>::Ok(nextConst);
+    return Result<int64_t, Diagnostic>::Ok(nextConst);
+}
+
+/**
+ * @brief checks if the `+` or `-` at `indx` is a prefix sign rather than a binary infix operator,
+ * which is the case when it has no left operand, i.e it leads the expression or follows another operator
+ */
+constexpr bool isPrefixSign(const Span<Token>& tokens, size_t indx) {
+    const TokenType type = tokens[indx].type;
+    if ((type != TokenType::Add) && (type != TokenType::Sub)) {
+        return false;
+    }
+    if (indx == 0) {
+        return true;
+    }
+    const Token& prev = tokens[indx - 1];
+    if ((prev.type == TokenType::OpenParen) || (prev.type == TokenType::Comma)) {
+        return true;
+    }
+    return (getPrescedence(prev) > 0) && (getBindingType(prev) != BindingType::LeftUnary) && (prev.type != TokenType::FuncCall);
+}
+
+/**
+ * @brief checks if an operator groups right to left, which is true for all prefix operators and assignments
+ */
+constexpr bool isRightAssociative(const Span<Token>& tokens, size_t indx) {
+    switch (tokens[indx].type) {
+        case TokenType::Assign:
+        case TokenType::AddAssign:
+        case TokenType::SubAssign:
+        case TokenType::MulAssign:
+        case TokenType::DivAssign: {
+            return true;
+        }
+        default: {
+            return isPrefixSign(tokens, indx) || (getBindingType(tokens[indx]) == BindingType::RightUnary);
+        }
+    }
+}
+
+/**
+ * @brief checks if a span is empty apart from parenthesis, which is left over around operands after
+ * an expression is split on its operator
+ */
+constexpr bool isOnlyParens(const Span<Token>& tokens) {
+    for (const Token& t : tokens) {
+        if ((t.type != TokenType::OpenParen) && (t.type != TokenType::CloseParen)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 /*======================================================================================================*/
@@ -157,6 +229,9 @@ Result<int64_t, Utf8String> extractSingle(const Span<Token>& tokens) {
  *  1. if there are 1+ operators in the token stream, the index of that operator is returned as Result::Ok
  *  2. if there are no operators but a single literal, return Result::Err >= 0 with that literal
  *  3. if there are no operators, multiple literals, or just parenthesis, return Result::Err(-1)
+ * @note the operator returned is the one that binds last, so it becomes the head of the expression tree.
+ * Between operators of equal prescedence the rightmost is returned for left associative operators, and the
+ * leftmost for right associative ones
  * @todo this is a bit of a mess so I would like to rework this
  */
 Result<size_t, int64_t> findNextOp(const Span<Token>& tokens) {
@@ -175,12 +250,13 @@ Result<size_t, int64_t> findNextOp(const Span<Token>& tokens) {
             currentPPower--;
             continue;
         } else {
-            int64_t thisPres = getPrescedence(t);
+            //Prefix signs bind as tightly as a logical not
+            int64_t thisPres = isPrefixSign(tokens, i) ? 3 : getPrescedence(t);
             //Check to see if its a non-op
             if (thisPres == -1) {
                 //If no previous const is found, we should mark it as the potential next const to return
                 if (nextConst == -1) {
-                    nextConst == i;
+                    nextConst = i;
                 } else {
                     singleConst = false;
                 }
@@ -193,8 +269,9 @@ Result<size_t, int64_t> findNextOp(const Span<Token>& tokens) {
                 nextOpPres = thisPres;
                 nextOpIndx = i;
                 
-            //If they are equal in parenthetical power, then we care about operator prescedence
-            } else if ((currentPPower == nextOpPPower) && (thisPres > nextOpPres)) {
+            //If they are equal in parenthetical power, then we care about operator prescedence and associativity
+            } else if ((currentPPower == nextOpPPower) && 
+                      ((thisPres > nextOpPres) || ((thisPres == nextOpPres) && !isRightAssociative(tokens, i)))) {
                 nextOpPPower = currentPPower;
                 nextOpPres = thisPres;
                 nextOpIndx = i;
@@ -204,19 +281,7 @@ Result<size_t, int64_t> findNextOp(const Span<Token>& tokens) {
 
     //Lets check what we have found
     if (nextOpIndx == -1) {
-        if (singleConst == true) {
-            std::cout << "Next const succsessfully extracted from tokens:" << std::endl;
-            for (const auto& t : tokens) {
-                std::cout << t << std::endl;
-            }
-            return Result<size_t, int64_t>::Err(nextConst);
-        } else {
-            std::cout << "Next const FAILED to be extracted from tokens:" << std::endl;
-            for (const auto& t : tokens) {
-                std::cout << t << std::endl;
-            }
-            return Result<size_t, int64_t>::Err(-1);
-        }
+        return Result<size_t, int64_t>::Err(singleConst ? nextConst : -1);
     } else {
         return Result<size_t, int64_t>::Ok(nextOpIndx);
     }
@@ -293,50 +358,85 @@ static constexpr int64_t seekNext(const Span<Token>& tokens, TokenType search) {
     return -1;
 }
 
+/**
+ * @brief will search through `tokens` for the next `elif` or `else` that belongs to the same
+ * `if` block as the tokens at the start of the span, skipping over the branches of any nested blocks
+ * @returns the index into `tokens` of the next branch, or `tokens.size()` if this is the last branch
+ */
+static constexpr int64_t seekNextBranch(const Span<Token>& tokens) {
+    int count = 0;
+    int64_t endPos = 0;
+    for (const Token& t : tokens) {
+        if (
+            (t.type == TokenType::Func) || 
+            (t.type == TokenType::If) || 
+            (t.type == TokenType::While) || 
+            (t.type == TokenType::For)
+        ) {
+            count++;
+        } else if (t.type == TokenType::End) {
+            count--;
+        } else if ((count == 0) && ((t.type == TokenType::Elif) || (t.type == TokenType::Else))) {
+            return endPos;
+        }
+        endPos++;
+    }
+    return endPos;
+}
+
 /*======================================================================================================*/
 /*                                          Parsers                                                     */
 /*======================================================================================================*/
 
-ParseResult FlowParser::parseGlobal(const Span<Token>& tokens) {
+void FlowParser::recover(const Diagnostic& error, size_t errorsBefore) {
+    if (diagnostics.size() == errorsBefore) {
+        diagnostics.report(error);
+    }
+}
+
+size_t FlowParser::parseGlobal(const Span<Token>& tokens) {
+    FL_STAGE(Parse);
     //Create an initial empty head to put all top level compilation frags into
     size_t globalHead = addAstNode();
 
-    int curTokenIndx = 0;
+    size_t curTokenIndx = 0;
     while (curTokenIndx < tokens.size()) {
         if (tokens[curTokenIndx].type == TokenType::Func) {
             //Seek the matching end to this function block
             int64_t end = seekNextBlockEnd(tokens.subspan(curTokenIndx));
 
-            //Err if not found
+            //Without a matching end, nothing after this point can be told apart from the function body
             if (end == -1) {
-                return ParseResult::Err("Function block opened but improperly closed, are you missing an end token?"_utf8);
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx, DiagCode::UnclosedFunction));
+                break;
             }
 
-            //Otherwise, parse the function block
-            auto funcTree = parseFunc(tokens.subspan(curTokenIndx, curTokenIndx + end));
-
-            //Check to ensure that the function parsing went good
-            if (!funcTree.isOk()) {
-                return ParseResult::Err(funcTree.errValue());
+            //Otherwise, parse the function block, keeping it only if it parsed cleanly
+            const size_t errorsBefore = diagnostics.size();
+            auto funcTree = parseFunc(tokens.subspan(curTokenIndx, end));
+            if (funcTree.isOk()) {
+                ast[globalHead].addChild(funcTree.okValue());
+            } else {
+                recover(funcTree.errValue(), errorsBefore);
             }
 
-            //Everything is valid, we have a func head node ready to get pushed up
-            ast[globalHead].addChild(funcTree.okValue());
-
-            //Advance to the next token type
-            curTokenIndx += end + 1; //Advance past this section
+            //Advance to the next token type, syncing on the end of this function either way
+            curTokenIndx += end + 1;
         }
         else {
-            std::cout << "Illegal top level token: " << tokens[curTokenIndx] << std::endl;
-            curTokenIndx++;
+            //Stray tokens are skipped up to the next function
+            diagnostics.report(diagnoseAt(tokens, curTokenIndx, DiagCode::IllegalTopLevelToken));
+            while ((curTokenIndx < tokens.size()) && (tokens[curTokenIndx].type != TokenType::Func)) {
+                curTokenIndx++;
+            }
         }
     }
 
-    //All parsing is aOk, we can return
-    return ParseResult::Ok(globalHead);
+    return globalHead;
 }
 
 ParseResult FlowParser::parseFunc(const Span<Token>& tokens) {
+    FL_STAGE(ParseFunc);
     size_t tokenCount = tokens.size();
     //Tokens contains the entire contents of a function body, so the node we want to return is at the top level,
     //a func token, which is at 0, which we know exists becuase it came down from the top level parser
@@ -344,220 +444,489 @@ ParseResult FlowParser::parseFunc(const Span<Token>& tokens) {
 
     //The first child must then be the function name, which is the next token
     if ((tokenCount < 2) || (tokens[1].type != TokenType::FuncCall)) {
-        return ParseResult::Err("Function declaration is missing a name!"_utf8);
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::MissingFunctionName));
     }
     size_t funcName = addAstNode(&tokens[1], funcHead);
+    const Symbol name = tokens[1].symbol;
 
     //Next we should expect a parenthesis
     if ((tokenCount < 3) || (tokens[2].type != TokenType::OpenParen)) {
-        return ParseResult::Err("Function declaration expects a parenthetical parameter list, did you forget a `(`?"_utf8);
+        return ParseResult::Err(diagnoseAt(tokens, 2, DiagCode::MissingParamList, name));
     }
 
     //Now we should expect to see an arg list until we hit a close paren, lets look for that
     int64_t closeParen = seekNextBalanced(tokens.subspan(2), TokenType::OpenParen, TokenType::CloseParen);
     if (closeParen == -1) {
-        return ParseResult::Err("Function declaration parameter list is missing a closing parenthesis!"_utf8);
+        return ParseResult::Err(diagnoseAt(tokens, 2, DiagCode::UnclosedParamList, name));
     }
     closeParen += 2; //Adjust to make it relative to the whole expression
 
-    //Before we get our parameters, lets capture our return type
-    bool retCheck = (tokenCount < closeParen + 2) || 
+    //Before we get our parameters, lets capture our return type, where a header ending on `returns` has no
+    //type to read and nothing past it to take a body from
+    const size_t bodyStart = static_cast<size_t>(closeParen) + 3;
+    bool retCheck = (bodyStart > tokenCount) || 
                     (tokens[closeParen + 1].type != TokenType::Returns);
     if (retCheck) {
-        return ParseResult::Err("Function declaration is missing a return type!"_utf8);
+        return ParseResult::Err(diagnoseAt(tokens, closeParen + 1, DiagCode::MissingReturnType, name));
     }
-    size_t retType = addAstNode(&tokens[closeParen + 2], funcHead);
+    addAstNode(&tokens[closeParen + 2], funcHead);
 
     //Now we can walk through the pairs of [type, identifier, comma?] in the parameter list and add them
     int curTokenIndx = 3;
     while (curTokenIndx < closeParen) {
         if (tokens[curTokenIndx].type != TokenType::Identifier) {
-            return ParseResult::Err("Expected to see a parameter type!"_utf8);
+            return ParseResult::Err(diagnoseAt(tokens, curTokenIndx, DiagCode::MissingParamType, name));
         }
         addAstNode(&tokens[curTokenIndx], funcHead);
         curTokenIndx++;
 
         if (tokens[curTokenIndx].type != TokenType::Identifier) {
-            return ParseResult::Err("Expected to see a parameter name!"_utf8);
+            return ParseResult::Err(diagnoseAt(tokens, curTokenIndx, DiagCode::MissingParamName, name));
         }
         addAstNode(&tokens[curTokenIndx], funcHead);
         curTokenIndx++;
 
         if (curTokenIndx != closeParen) {
             if (tokens[curTokenIndx].type != TokenType::Comma) {
-                return ParseResult::Err("Expected to see a comma!"_utf8);
+                return ParseResult::Err(diagnoseAt(tokens, curTokenIndx, DiagCode::MissingParamComma, name));
             }
             curTokenIndx++;
         }
     }
 
-    //Now "all" thats left is the actual body of the function, which consists of expressions and blocks
-    std::optional<Utf8String> exprError = parseExprs(funcName, tokens.subspan(closeParen + 3));
-    if (exprError.has_value()) {
-        return ParseResult::Err(exprError.value());
+    //Now "all" thats left is the actual body of the function, which consists of expressions and blocks,
+    //and in lazy mode those are only held onto until the function is first needed
+    const Span<Token> body = tokens.subspan(bodyStart);
+    if (mode == ParseMode::Lazy) {
+        pendingBodies.push_back(body);
+    } else {
+        std::optional<Diagnostic> exprError = parseExprs(funcName, body);
+        if (exprError.has_value()) {
+            return ParseResult::Err(exprError.value());
+        }
+        pendingBodies.push_back(std::nullopt);
     }
-    
+
     //Everything was good, return the new tree, and add this node to our top level registry of functions
-    functionDecs.insert({ast[funcName].body.text, funcHead});
+    functionDecs.push_back(funcHead);
     return ParseResult::Ok(funcHead);
 }
 
-std::optional<Utf8String> FlowParser::parseExprs(size_t parent, const Span<Token>& tokens) {
+std::optional<Diagnostic> FlowParser::parseFunctionBody(size_t funcIndex) {
+    FL_STAGE(ParseFunctionBody);
+    if (!pendingBodies[funcIndex].has_value()) {
+        return std::nullopt;
+    }
+
+    const size_t funcName = ast[functionDecs[funcIndex]].children[0];
+    const size_t errorsBefore = diagnostics.size();
+    std::optional<Diagnostic> exprError = parseExprs(funcName, pendingBodies[funcIndex].value());
+    if (exprError.has_value()) {
+        //Drop any partial body, so a retry can't see half a function
+        ast[funcName].children.clear();
+        diagnostics.sortByPosition(errorsBefore);
+        return (diagnostics.size() != errorsBefore) ? std::optional(diagnostics[errorsBefore]) : exprError;
+    }
+    pendingBodies[funcIndex] = std::nullopt;
+    return std::nullopt;
+}
+
+ParseResult FlowParser::parseIf(const Span<Token>& tokens) {
+    FL_STAGE(ParseIf);
+    //The if node heads the block, and each branch becomes a child of it in order
+    size_t ifHead = addAstNode(&tokens[0]);
+
+    size_t branchStart = 0;
+    while (branchStart < tokens.size()) {
+        //Each branch runs from its opening keyword up to the next branch at this depth
+        size_t branchLen = seekNextBranch(tokens.subspan(branchStart + 1)) + 1;
+        const Span<Token> branch = tokens.subspan(branchStart, branchLen);
+        const bool isLastBranch = (branchStart + branchLen) >= tokens.size();
+
+        if (branch[0].type == TokenType::Else) {
+            //An else branch has no condition, and must be the last branch of the block
+            if (!isLastBranch) {
+                return ParseResult::Err(diagnoseAt(branch, 0, DiagCode::MisplacedElse));
+            }
+            size_t elseNode = addAstNode(&branch[0], ifHead);
+            std::optional<Diagnostic> exprError = parseExprs(elseNode, branch.subspan(1));
+            if (exprError.has_value()) {
+                return ParseResult::Err(exprError.value());
+            }
+        } else {
+            //Both if and elif branches look like `%keyword% %cond% then %exprs%`
+            int64_t thenPos = seekNext(branch, TokenType::Then);
+            if (thenPos == -1) {
+                return ParseResult::Err(diagnoseAt(branch, 0, DiagCode::MissingThen));
+            }
+            if (thenPos == 1) {
+                return ParseResult::Err(diagnoseAt(branch, thenPos, DiagCode::MissingBranchCondition));
+            }
+
+            //The then token heads the branch, with the condition first and the branch expressions following
+            size_t thenNode = addAstNode(&branch[thenPos], ifHead);
+            auto cond = parseExpr(branch.subspan(1, thenPos - 1));
+            if (!cond.isOk()) {
+                return cond;
+            }
+            ast[thenNode].addChild(cond.okValue());
+
+            std::optional<Diagnostic> exprError = parseExprs(thenNode, branch.subspan(thenPos + 1));
+            if (exprError.has_value()) {
+                return ParseResult::Err(exprError.value());
+            }
+        }
+        branchStart += branchLen;
+    }
+
+    return ParseResult::Ok(ifHead);
+}
+
+ParseResult FlowParser::parseWhile(const Span<Token>& tokens) {
+    FL_STAGE(ParseWhile);
+    size_t whileHead = addAstNode(&tokens[0]);
+
+    //The stopping condition runs from the while token up to the do token
+    int64_t doPos = seekNext(tokens, TokenType::Do);
+    if (doPos == -1) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::MissingWhileDo));
+    }
+    if (doPos == 1) {
+        return ParseResult::Err(diagnoseAt(tokens, doPos, DiagCode::MissingWhileCondition));
+    }
+    auto cond = parseExpr(tokens.subspan(1, doPos - 1));
+    if (!cond.isOk()) {
+        return cond;
+    }
+    ast[whileHead].addChild(cond.okValue());
+
+    //Everything after the do is the loop body
+    std::optional<Diagnostic> exprError = parseExprs(whileHead, tokens.subspan(doPos + 1));
+    if (exprError.has_value()) {
+        return ParseResult::Err(exprError.value());
+    }
+    return ParseResult::Ok(whileHead);
+}
+
+ParseResult FlowParser::parseFor(const Span<Token>& tokens) {
+    FL_STAGE(ParseFor);
+    size_t forHead = addAstNode(&tokens[0]);
+
+    //A for header is made of `%loopVar%; %stopCond%; %advCond%`, with an optional EOL before the do
+    int64_t doPos = seekNext(tokens, TokenType::Do);
+    if (doPos == -1) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::MissingForDo));
+    }
+    int64_t varEnd = seekNext(tokens.subspan(1, doPos - 1), TokenType::EOL);
+    int64_t stopEnd = (varEnd == -1) ? -1 : seekNext(tokens.subspan(varEnd + 2, doPos - varEnd - 2), TokenType::EOL);
+    if (stopEnd == -1) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::MalformedForHeader));
+    }
+    varEnd += 1;
+    stopEnd += varEnd + 1;
+    int64_t advEnd = (tokens[doPos - 1].type == TokenType::EOL) ? doPos - 1 : doPos;
+    if ((varEnd == 1) || (stopEnd == varEnd + 1) || (advEnd <= stopEnd + 1)) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::EmptyForHeader));
+    }
+
+    //Each header piece is a child in order, followed by the body expressions
+    const Span<Token> headerParts[3] = {
+        tokens.subspan(1, varEnd - 1),
+        tokens.subspan(varEnd + 1, stopEnd - varEnd - 1),
+        tokens.subspan(stopEnd + 1, advEnd - stopEnd - 1)
+    };
+    for (const Span<Token>& part : headerParts) {
+        auto partTree = parseExpr(part);
+        if (!partTree.isOk()) {
+            return partTree;
+        }
+        ast[forHead].addChild(partTree.okValue());
+    }
+
+    std::optional<Diagnostic> exprError = parseExprs(forHead, tokens.subspan(doPos + 1));
+    if (exprError.has_value()) {
+        return ParseResult::Err(exprError.value());
+    }
+    return ParseResult::Ok(forHead);
+}
+
+ParseResult FlowParser::parseParallel(const Span<Token>& tokens) {
+    FL_STAGE(ParseParallel);
+    //The directive heads the block, with its name first and the for block it applies to second
+    size_t directiveHead = addAstNode(&tokens[0]);
+    addAstNode(&tokens[1], directiveHead);
+    auto forTree = parseFor(tokens.subspan(2));
+    if (!forTree.isOk()) {
+        return forTree;
+    }
+    ast[directiveHead].addChild(forTree.okValue());
+    return ParseResult::Ok(directiveHead);
+}
+
+std::optional<Diagnostic> FlowParser::parseExprs(size_t parent, const Span<Token>& tokens) {
+    FL_STAGE(ParseExprs);
+    const size_t errorsBefore = diagnostics.size();
     size_t curTokenIndx = 0;
     while (curTokenIndx < tokens.size()) {
         const Token& nextExprStart = tokens[curTokenIndx];
-        if (nextExprStart.type == TokenType::If) {
-
-        } else if (nextExprStart.type == TokenType::For) {
+        const size_t statementErrors = diagnostics.size();
+        if (
+            (nextExprStart.type == TokenType::If) ||
+            (nextExprStart.type == TokenType::For) ||
+            (nextExprStart.type == TokenType::While)
+        ) {
+            //Blocks run up to their matching end, which is consumed here
+            int64_t blockEnd = seekNextBlockEnd(tokens.subspan(curTokenIndx));
+            if (blockEnd == -1) {
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx, DiagCode::UnclosedBlock));
+                break;
+            }
 
-        } else if (nextExprStart.type == TokenType::While) {
+            const Span<Token> blockTokens = tokens.subspan(curTokenIndx, blockEnd);
+            const ParseResult blockTree = (nextExprStart.type == TokenType::If) ? parseIf(blockTokens) :
+                                          (nextExprStart.type == TokenType::For) ? parseFor(blockTokens) :
+                                          parseWhile(blockTokens);
+            if (blockTree.isOk()) {
+                ast[parent].addChild(blockTree.okValue());
+            } else {
+                recover(blockTree.errValue(), statementErrors);
+            }
+            curTokenIndx += blockEnd + 1;
+        } else if (nextExprStart.type == TokenType::Prepocessor) {
+            //`@parallel` is the only directive so far, and it applies to the for block right after it
+            const bool isParallel = ((curTokenIndx + 1) < tokens.size()) &&
+                                    (tokens[curTokenIndx + 1].type == TokenType::Identifier) &&
+                                    (tokens[curTokenIndx + 1].text == "parallel"_utf8.view());
+            if (!isParallel) {
+                //Skipping the directive's name too leaves whatever it was attached to to parse as usual
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx + 1, DiagCode::UnknownDirective));
+                const bool named = ((curTokenIndx + 1) < tokens.size()) && (tokens[curTokenIndx + 1].type == TokenType::Identifier);
+                curTokenIndx += named ? 2 : 1;
+                continue;
+            }
+            if (((curTokenIndx + 2) >= tokens.size()) || (tokens[curTokenIndx + 2].type != TokenType::For)) {
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx, DiagCode::MisplacedParallel));
+                curTokenIndx += 2;
+                continue;
+            }
 
+            int64_t blockEnd = seekNextBlockEnd(tokens.subspan(curTokenIndx + 2));
+            if (blockEnd == -1) {
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx + 2, DiagCode::UnclosedBlock));
+                break;
+            }
+            const ParseResult blockTree = parseParallel(tokens.subspan(curTokenIndx, blockEnd + 2));
+            if (blockTree.isOk()) {
+                ast[parent].addChild(blockTree.okValue());
+            } else {
+                recover(blockTree.errValue(), statementErrors);
+            }
+            curTokenIndx += blockEnd + 3;
+        } else if (nextExprStart.type == TokenType::EOL) {
+            //Empty statements are simply skipped
+            curTokenIndx++;
         } else {
             //Our next line is simply an expression
             int64_t endOfLine = seekNext(tokens.subspan(curTokenIndx), TokenType::EOL);
             if (endOfLine == -1) {
-
-                return std::optional("Unbounded expression, are you missing an end of line?"_utf8);
+                diagnostics.report(diagnoseAt(tokens, curTokenIndx, DiagCode::UnboundedExpression));
+                break;
             }
 
-            //Parse the expression tree
-            std::cout << "Parsing new Expression for tokens: " << std::endl;
-            for (const auto& t : tokens.subspan(curTokenIndx, endOfLine)) {
-                std::cout << t << std::endl;
-            }
-            std::cout << "end expression tokens" << std::endl;
+            //Parse the expression tree, and add it as a child to parent if it went fine
             auto exprTree = parseExpr(tokens.subspan(curTokenIndx, endOfLine));
-            if (!exprTree.isOk()) {
-                return std::optional(exprTree.errValue());
+            if (exprTree.isOk()) {
+                ast[parent].addChild(exprTree.okValue());
+            } else {
+                recover(exprTree.errValue(), statementErrors);
             }
-
-            //Everything went fine, add it as a child to parent
-            ast[parent].addChild(exprTree.okValue());
             curTokenIndx += endOfLine + 1;
         }
     }
 
-    //Everything went fine
+    //Hand back the first error, so blocks and functions holding these lines know they failed
+    if (diagnostics.size() != errorsBefore) {
+        return std::optional(diagnostics[errorsBefore]);
+    }
     return std::nullopt;
 }
 
 ParseResult FlowParser::parseExpr(const Span<Token>& tokens) {
-
+    FL_STAGE(ParseExpr);
     auto nextOpRes = findNextOp(tokens);
     if (!nextOpRes.isOk()) {
         //Its either an err or a constant to look at
         int64_t nextConstPos = nextOpRes.errValue();
-        std::cout << "Next Const Pos is " << nextConstPos << std::endl;
         if (nextConstPos == -1) {
-            return ParseResult::Err("Unexpected tokens!"_utf8);
-        } else {
-            auto newTerminal = addAstNode(&tokens[nextConstPos]);
-            return ParseResult::Ok(newTerminal);
+            return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::UnexpectedTokens));
+        }
+
+        //Only literals and names can stand on their own
+        const TokenType constType = tokens[nextConstPos].type;
+        if ((constType != TokenType::Number) && (constType != TokenType::StringLit) && (constType != TokenType::Identifier)) {
+            return ParseResult::Err(diagnoseAt(tokens, nextConstPos, DiagCode::ExpectedValue));
         }
+        auto newTerminal = addAstNode(&tokens[nextConstPos]);
+        return ParseResult::Ok(newTerminal);
     }
 
-    //Its not terminal, so get the operator
+    //Its not terminal, so dispatch on how the operator binds
     size_t nextOp = nextOpRes.okValue();
-
-    auto binding = getBindingType(tokens[nextOp]);
-    if (binding != BindingType::BinaryInfix) {
-        std::cout << "Testing with invalid binding type!" << std::endl;
+    const BindingType binding = isPrefixSign(tokens, nextOp) ? BindingType::RightUnary : getBindingType(tokens[nextOp]);
+    switch (binding) {
+        case BindingType::BinaryInfix: {
+            return parseBinaryExpr(nextOp, tokens);
+        }
+        case BindingType::RightUnary: {
+            return parseRightUnaryExpr(nextOp, tokens);
+        }
+        case BindingType::LeftUnary: {
+            return parseLeftUnaryExpr(nextOp, tokens);
+        }
+        case BindingType::Functional: {
+            return parseCallExpr(nextOp, tokens);
+        }
+        default: {
+            return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::UnexpectedOperator));
+        }
     }
+}
 
-    auto newHead = addAstNode(&tokens[nextOp]);
-    
+ParseResult FlowParser::parseBinaryExpr(size_t nextOp, const Span<Token>& tokens) {
+    FL_STAGE(ParseBinaryExpr);
+    //Since this is binary we create a new head representing the op
+    size_t newHead = addAstNode(&tokens[nextOp]);
+
+    //And parse everything to the left of it
+    if (isOnlyParens(tokens.subspan(0, nextOp))) {
+        return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::MissingLeftOperand));
+    }
     auto lhs = parseExpr(tokens.subspan(0, nextOp));
     if (!lhs.isOk()) {
         return lhs;
     }
     ast[newHead].addChild(lhs.okValue());
 
+    //And parse everything to the right of it
+    if (isOnlyParens(tokens.subspan(nextOp + 1))) {
+        return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::MissingRightOperand));
+    }
     auto rhs = parseExpr(tokens.subspan(nextOp + 1));
     if (!rhs.isOk()) {
         return rhs;
     }
     ast[newHead].addChild(rhs.okValue());
 
+    //Full binary expression parsed succsessfully
+    return ParseResult::Ok(newHead);
+}
+
+ParseResult FlowParser::parseRightUnaryExpr(size_t nextOp, const Span<Token>& tokens) {
+    FL_STAGE(ParseRightUnaryExpr);
+    if (!isOnlyParens(tokens.subspan(0, nextOp))) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::TokensBeforePrefix));
+    }
+    size_t newHead = addAstNode(&tokens[nextOp]);
+    const Span<Token> operand = tokens.subspan(nextOp + 1);
+
+    //A declaration is always `let %type% %name%`, so both become children directly
+    if (tokens[nextOp].type == TokenType::Let) {
+        bool isDecl = (operand.size() >= 2) && 
+                      (operand[0].type == TokenType::Identifier) && 
+                      (operand[1].type == TokenType::Identifier) &&
+                      isOnlyParens(operand.subspan(2));
+        if (!isDecl) {
+            return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::MalformedDeclaration));
+        }
+        addAstNode(&operand[0], newHead);
+        addAstNode(&operand[1], newHead);
+        return ParseResult::Ok(newHead);
+    }
+
+    //A bare return is the only prefix operator allowed to have no operand
+    if (isOnlyParens(operand)) {
+        if (tokens[nextOp].type == TokenType::Return) {
+            return ParseResult::Ok(newHead);
+        }
+        return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::MissingPrefixOperand));
+    }
+
+    auto rhs = parseExpr(operand);
+    if (!rhs.isOk()) {
+        return rhs;
+    }
+    ast[newHead].addChild(rhs.okValue());
+    return ParseResult::Ok(newHead);
+}
+
+ParseResult FlowParser::parseLeftUnaryExpr(size_t nextOp, const Span<Token>& tokens) {
+    FL_STAGE(ParseLeftUnaryExpr);
+    if (!isOnlyParens(tokens.subspan(nextOp + 1))) {
+        return ParseResult::Err(diagnoseAt(tokens, nextOp + 1, DiagCode::TokensAfterPostfix));
+    }
+    if (isOnlyParens(tokens.subspan(0, nextOp))) {
+        return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::MissingPostfixOperand));
+    }
+    size_t newHead = addAstNode(&tokens[nextOp]);
+    auto lhs = parseExpr(tokens.subspan(0, nextOp));
+    if (!lhs.isOk()) {
+        return lhs;
+    }
+    ast[newHead].addChild(lhs.okValue());
     return ParseResult::Ok(newHead);
 }
 
-// ParseResult FlowParser::parseExpr(const Span<Token>& tokens) {
-//     //Check to see if tokens is just a constant, or there is an error in the parsing code
-//     size_t tokenCount = tokens.size();
-//     if (tokenCount == 0) {
-//         //Todo this might actually be dead code, will need to experiment more
-//         return ParseResult::Err("Attempted to parse a zero token expression!"_utf8);
-//     } else if (tokenCount == 1) {
-//         std::cout << "Constant Node established: " << tokens[0] << std::endl;
-//         size_t tNode = addAstNode(&tokens[0]);
-//         return ParseResult::Ok(tNode);
-//     }
-
-//     //Scan for the operator to act upon
-//     auto nextOp = findNextOp(tokens);
-//     if (!nextOp.isOk()) {
-//         return ParseResult::Err(nextOp.errValue());
-//     }
-
-//     //Unwrap the next op and see what we are dealing with
-//     int64_t nextOpIndx = nextOp.okValue();
-
-//     //Check to see if the next side is just some parenthesis and a single non-parenthesis item
-//     if (nextOpIndx == -1) {
-
-//         //If no extra non-parenthesis item is found, err
-//         auto constRes = extractSingle(tokens);
-//         if (!constRes.isOk()) {
-//             return ParseResult::Err(constRes.errValue());
-//         }
-
-//         //If all good, return our new constant node
-//         size_t tNode = addAstNode(&tokens[constRes.okValue()]);
-//         return ParseResult::Ok(tNode);
-//     }
-
-//     std::cout << "Parse expression has identified the next op: " << tokens[nextOpIndx] << std::endl;
-
-//     //Lets dispatch these based on binding direction
-//     BindingType bindType = getBindingType(tokens[nextOpIndx]);
-//     switch (bindType) {
-//         case BindingType::BinaryInfix: {
-//             //If we have a binary operator next, then we have to parse that
-//             auto binaryRes = parseBinaryExpr(nextOpIndx, tokens);
-//             return binaryRes;
-//         }
-//     }
-
-
-//     return ParseResult::Err("Invalid Expression: Generic Flavour!"_utf8);
-// }
-
-// ParseResult FlowParser::parseBinaryExpr(size_t nextOp, const Span<Token>& tokens) {
-//     //Since this is binary we create a new head representing the op
-//     size_t newHead = addAstNode(&tokens[nextOp]);
-
-//     //And parse everything to the left of it
-//     if (nextOp == 0) {
-//         return ParseResult::Err("Expected to see an operand to the left of binary infix operator!"_utf8);
-//     }
-//     auto lhs = parseExpr(tokens.subspan(0, nextOp));
-//     if (!lhs.isOk()) {
-//         return lhs;
-//     }
-//     ast[newHead].addChild(lhs.okValue());
-
-//     //And parse everything to the right of it
-//     if (nextOp == (tokens.size() - 1)) {
-//         return ParseResult::Err("Expected to see an operand to the right of binary infix operator!"_utf8);
-//     }
-//     auto rhs = parseExpr(tokens.subspan(nextOp + 1));
-//     if (!rhs.isOk()) {
-//         return rhs;
-//     }
-//     ast[newHead].addChild(rhs.okValue());
-
-//     //Full binary expression parsed succsessfully
-//     return ParseResult::Ok(newHead);
-// }
+ParseResult FlowParser::parseCallExpr(size_t nextOp, const Span<Token>& tokens) {
+    FL_STAGE(ParseCallExpr);
+    if (!isOnlyParens(tokens.subspan(0, nextOp))) {
+        return ParseResult::Err(diagnoseAt(tokens, 0, DiagCode::TokensBeforeCall, tokens[nextOp].symbol));
+    }
+
+    //The tokenizer only marks a call when a parenthesis follows, so find where the argument list closes
+    int64_t closeParen = seekNextBalanced(tokens.subspan(nextOp + 1), TokenType::OpenParen, TokenType::CloseParen);
+    if (closeParen == -1) {
+        return ParseResult::Err(diagnoseAt(tokens, nextOp, DiagCode::UnclosedCallArgs, tokens[nextOp].symbol));
+    }
+    closeParen += nextOp + 1;
+    if (!isOnlyParens(tokens.subspan(closeParen + 1))) {
+        return ParseResult::Err(diagnoseAt(tokens, closeParen + 1, DiagCode::TokensAfterCall, tokens[nextOp].symbol));
+    }
+
+    //Each comma at the top level of the argument list seperates one argument, which becomes a child in order
+    size_t newHead = addAstNode(&tokens[nextOp]);
+    size_t argStart = nextOp + 2;
+    int64_t depth = 0;
+    for (size_t i = argStart; i <= static_cast<size_t>(closeParen); i++) {
+        const TokenType type = tokens[i].type;
+        if ((type == TokenType::OpenParen) || (type == TokenType::OpenSquare) || (type == TokenType::OpenCurly)) {
+            depth++;
+            continue;
+        }
+        bool argClosed = ((depth == 0) && (type == TokenType::Comma)) || (i == static_cast<size_t>(closeParen));
+        if ((type == TokenType::CloseParen) || (type == TokenType::CloseSquare) || (type == TokenType::CloseCurly)) {
+            depth--;
+        }
+        if (!argClosed) {
+            continue;
+        }
+
+        //An empty argument is only allowed when the whole list is empty, like `foo()`
+        const Span<Token> arg = tokens.subspan(argStart, i - argStart);
+        if (arg.size() == 0) {
+            if ((type == TokenType::Comma) || (ast[newHead].children.size() > 0)) {
+                return ParseResult::Err(diagnoseAt(tokens, i, DiagCode::EmptyCallArgument, tokens[nextOp].symbol));
+            }
+            break;
+        }
+        auto argTree = parseExpr(arg);
+        if (!argTree.isOk()) {
+            return argTree;
+        }
+        ast[newHead].addChild(argTree.okValue());
+        argStart = i + 1;
+    }
+
+    return ParseResult::Ok(newHead);
+}
 
 } //end namespace fl
\ No newline at end of file
@@ -0,0 +1,195 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "profiler.hpp"
+#include "transcode.hpp"
+#include "vm.hpp"
+#include <algorithm>
+#include <bit>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Profile Timer                                               */
+/*======================================================================================================*/
+
+//The tick of the running profiler, the only thing a signal handler can safely touch
+static std::atomic<std::atomic<uint32_t>*> activeTick = nullptr;
+
+#if !defined(_WIN32)
+static void onProfileSignal(int) {
+    std::atomic<uint32_t>* target = activeTick.load(std::memory_order_relaxed);
+    if (target != nullptr) {
+        target->fetch_add(1, std::memory_order_relaxed);
+    }
+}
+#endif
+
+/*======================================================================================================*/
+/*                                            Profiler                                                  */
+/*======================================================================================================*/
+
+Profiler::Profiler(size_t capacity) {
+    const size_t slotCount = std::bit_ceil(std::max<size_t>(capacity, 2));
+    ring = std::make_unique<Slot[]>(slotCount);
+    mask = slotCount - 1;
+    for (size_t i = 0; i < slotCount; i++) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+Profiler::~Profiler() {
+    stop();
+}
+
+std::optional<Utf8String> Profiler::start(uint32_t intervalUs) {
+#if defined(_WIN32)
+    (void)intervalUs;
+    return std::optional("Profiling needs interval timers, which this platform does not have!"_utf8);
+#else
+    if (running) {
+        return std::nullopt;
+    }
+    std::atomic<uint32_t>* expected = nullptr;
+    if (!activeTick.compare_exchange_strong(expected, &tick)) {
+        return std::optional("Another profiler is already running!"_utf8);
+    }
+
+    struct sigaction action = {};
+    action.sa_handler = onProfileSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, nullptr);
+
+    const uint32_t interval = std::max<uint32_t>(intervalUs, 1);
+    itimerval timer = {};
+    timer.it_interval.tv_sec = interval / 1000000;
+    timer.it_interval.tv_usec = interval % 1000000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        activeTick.store(nullptr);
+        return std::optional("Could not start the profiling timer!"_utf8);
+    }
+    running = true;
+    return std::nullopt;
+#endif
+}
+
+void Profiler::stop() {
+#if !defined(_WIN32)
+    if (!running) {
+        return;
+    }
+    itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    //The handler stays installed, so a signal already on its way lands on a null tick instead of killing the process
+    activeTick.store(nullptr);
+    running = false;
+#endif
+}
+
+void Profiler::retain(std::shared_ptr<const SymbolTable> symbols) {
+    std::lock_guard<std::mutex> guard(drainLock);
+    if (std::find(retained.begin(), retained.end(), symbols) == retained.end()) {
+        retained.push_back(std::move(symbols));
+    }
+}
+
+void Profiler::record(const Module& module, const CallFrame* frames, size_t frameCount, uint32_t pc) noexcept {
+    samples.fetch_add(1, std::memory_order_relaxed);
+
+    //Claims a slot the consumer has finished with, the ring being full when the next one is still a lap behind
+    size_t position = head.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &ring[position & mask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == position) {
+            if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < position) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    //Frames are stored innermost first, every frame below the top one being parked just past its call
+    const size_t depth = std::min(frameCount, maxSampleDepth);
+    for (size_t i = 0; i < depth; i++) {
+        const CallFrame& frame = frames[frameCount - 1 - i];
+        const uint32_t at = (i == 0) ? pc : (frame.pc - 1);
+        slot->frames[i] = ProfileFrame{.function = module.functions[frame.function].name, .line = module.lineAt(frame.function, at)};
+    }
+    slot->symbols = module.symbols.get();
+    slot->depth = static_cast<uint32_t>(depth);
+    slot->truncated = frameCount > maxSampleDepth;
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void Profiler::drain() {
+    std::lock_guard<std::mutex> guard(drainLock);
+    std::ostringstream line;
+    while (true) {
+        Slot& slot = ring[tail & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != (tail + 1)) {
+            return;
+        }
+
+        line.str("");
+        if (slot.truncated) {
+            line << "[truncated];";
+        }
+        for (size_t i = slot.depth; i-- > 0;) {
+            const ProfileFrame& frame = slot.frames[i];
+            line << slot.symbols->text(frame.function) << ':' << frame.line << ((i == 0) ? "" : ";");
+        }
+        stacks[fromValidatedUtf8(line.str())]++;
+
+        //Hands the slot back to producers for their next lap around the ring
+        slot.sequence.store(tail + mask + 1, std::memory_order_release);
+        tail++;
+    }
+}
+
+void Profiler::writeCollapsed(std::ostream& os) {
+    drain();
+    std::lock_guard<std::mutex> guard(drainLock);
+    //Sorted so the same profile always prints the same way, and diffs between runs stay readable
+    std::vector<std::pair<std::string, uint64_t>> sorted;
+    sorted.reserve(stacks.size());
+    for (const auto& [stack, count] : stacks) {
+        std::ostringstream text;
+        text << stack;
+        sorted.push_back({text.str(), count});
+    }
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto& [stack, count] : sorted) {
+        os << stack << ' ' << count << '\n';
+    }
+}
+
+void Profiler::clear() {
+    drain();
+    std::lock_guard<std::mutex> guard(drainLock);
+    stacks.clear();
+    samples.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+}
+
+} //end namespace fl
@@ -0,0 +1,170 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "scheduler.hpp"
+#include <algorithm>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Task Scheduler                                                */
+/*======================================================================================================*/
+
+TaskScheduler::TaskScheduler() : TaskScheduler(std::max(1u, std::thread::hardware_concurrency()) - 1) {}
+
+TaskScheduler::TaskScheduler(size_t workerCount) : slotCount(workerCount + 1), slots(std::make_unique<Slot[]>(workerCount + 1)) {
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void TaskScheduler::workerLoop(size_t slot) {
+    while (true) {
+        std::optional<Task> task = take(slot, nullptr);
+        if (task.has_value()) {
+            runTask(slot, task.value());
+            continue;
+        }
+
+        //Counted as asleep before checking for work, so a push either sees this worker or this worker sees it
+        std::unique_lock<std::mutex> guard(sleepLock);
+        sleeping++;
+        wake.wait(guard, [this]() { return stopping || (queued.load() != 0); });
+        sleeping--;
+        if (stopping && (queued.load() == 0)) {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::push(size_t slot, const Task& task) {
+    {
+        std::lock_guard<std::mutex> guard(slots[slot].lock);
+        slots[slot].tasks.push_back(task);
+    }
+    queued++;
+    task.job->queued++;
+
+    //The job can't finish while the task splitting it is still running, so it is safe to read here
+    if (task.job->callerWaiting.load()) {
+        { std::lock_guard<std::mutex> guard(sleepLock); }
+        finished.notify_all();
+    }
+    if (sleeping.load() != 0) {
+        //Taking the lock orders this wake after a worker that is about to sleep has checked for work
+        { std::lock_guard<std::mutex> guard(sleepLock); }
+        wake.notify_one();
+    }
+}
+
+std::optional<TaskScheduler::Task> TaskScheduler::take(size_t slot, const Job* only) {
+    for (size_t i = 0; i < slotCount; i++) {
+        //Start on our own deque, then walk the others from our neighbour onwards to spread out the steals
+        const size_t victim = (slot + i) % slotCount;
+        Slot& from = slots[victim];
+        std::lock_guard<std::mutex> guard(from.lock);
+        if (from.tasks.empty()) {
+            continue;
+        }
+
+        //Our own newest task is the smallest and hottest in cache, while the oldest elsewhere is the biggest to steal
+        const bool own = (victim == slot);
+        auto found = from.tasks.end();
+        if (only == nullptr) {
+            found = own ? (from.tasks.end() - 1) : from.tasks.begin();
+        } else if (own) {
+            auto last = std::find_if(from.tasks.rbegin(), from.tasks.rend(), [only](const Task& task) { return task.job == only; });
+            found = (last == from.tasks.rend()) ? from.tasks.end() : (last + 1).base();
+        } else {
+            found = std::find_if(from.tasks.begin(), from.tasks.end(), [only](const Task& task) { return task.job == only; });
+        }
+        if (found == from.tasks.end()) {
+            continue;
+        }
+
+        const Task task = *found;
+        from.tasks.erase(found);
+        queued--;
+        task.job->queued--;
+        return task;
+    }
+    return std::nullopt;
+}
+
+void TaskScheduler::runTask(size_t slot, Task task) {
+    Job& job = *task.job;
+    while ((task.end - task.begin) > job.grain) {
+        const int64_t middle = task.begin + ((task.end - task.begin) / 2);
+        push(slot, Task{.job = &job, .begin = middle, .end = task.end});
+        task.end = middle;
+    }
+    job.thunk(job.target, slot, task.begin, task.end);
+
+    //The caller may return as soon as this hits zero, so the job is never touched after it
+    const int64_t ran = task.end - task.begin;
+    if (job.remaining.fetch_sub(ran) == ran) {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        finished.notify_all();
+    }
+}
+
+size_t TaskScheduler::currentSlot() const noexcept {
+    const std::thread::id self = std::this_thread::get_id();
+    for (size_t i = 0; i < workers.size(); i++) {
+        if (workers[i].get_id() == self) {
+            return i;
+        }
+    }
+    return slotCount - 1;
+}
+
+void TaskScheduler::run(int64_t begin, int64_t end, int64_t grain, ChunkThunk thunk, void* target) {
+    if (end <= begin) {
+        return;
+    }
+
+    //Without a pool, or from inside a chunk that already holds its slot, the whole range runs right here
+    const size_t slot = currentSlot();
+    if ((slotCount == 1) || (slot != (slotCount - 1))) {
+        thunk(target, slot, begin, end);
+        return;
+    }
+
+    Job job{.thunk = thunk, .target = target, .grain = std::max<int64_t>(grain, 1), .remaining = end - begin};
+    push(slot, Task{.job = &job, .begin = begin, .end = end});
+    while (job.remaining.load() != 0) {
+        std::optional<Task> task = take(slot, &job);
+        if (task.has_value()) {
+            runTask(slot, task.value());
+            continue;
+        }
+
+        //Everything left of the range is running on the workers, so sleep until one of them splits off a
+        //half to steal, or the last chunk finishes. Flagged before checking, the same way workers count as asleep
+        std::unique_lock<std::mutex> guard(sleepLock);
+        job.callerWaiting.store(true);
+        finished.wait(guard, [&job]() { return (job.remaining.load() == 0) || (job.queued.load() != 0); });
+        job.callerWaiting.store(false);
+    }
+}
+
+} //end namespace fl
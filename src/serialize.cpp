@@ -0,0 +1,400 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "serialize.hpp"
+#include "transcode.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                            Encoding                                                  */
+/*======================================================================================================*/
+
+static void putU16(std::ostream& os, uint16_t value) {
+    const char bytes[2] = {static_cast<char>(value), static_cast<char>(value >> 8)};
+    os.write(bytes, sizeof(bytes));
+}
+
+static void putU32(std::ostream& os, uint32_t value) {
+    const char bytes[4] = {
+        static_cast<char>(value), static_cast<char>(value >> 8), static_cast<char>(value >> 16), static_cast<char>(value >> 24)
+    };
+    os.write(bytes, sizeof(bytes));
+}
+
+static void putU64(std::ostream& os, uint64_t value) {
+    putU32(os, static_cast<uint32_t>(value));
+    putU32(os, static_cast<uint32_t>(value >> 32));
+}
+
+static void putText(std::ostream& os, const Utf8StringView& text) {
+    const std::string utf8 = text.toUtf8();
+    putU32(os, static_cast<uint32_t>(utf8.size()));
+    os.write(utf8.data(), static_cast<std::streamsize>(utf8.size()));
+}
+
+/**
+ * @brief pulls little endian values out of a stream, where any read past the end leaves the stream
+ * failed and every value after it zero, so a truncated file is only noticed once, at the end
+ */
+class ByteReader {
+public:
+    explicit ByteReader(std::istream& is) : is(is) {}
+
+    uint8_t u8() {
+        char byte = 0;
+        is.read(&byte, 1);
+        return is ? static_cast<uint8_t>(byte) : 0;
+    }
+
+    uint16_t u16() {
+        const uint16_t low = u8();
+        return static_cast<uint16_t>(low | (static_cast<uint16_t>(u8()) << 8));
+    }
+
+    uint32_t u32() {
+        const uint32_t low = u16();
+        return low | (static_cast<uint32_t>(u16()) << 16);
+    }
+
+    uint64_t u64() {
+        const uint64_t low = u32();
+        return low | (static_cast<uint64_t>(u32()) << 32);
+    }
+
+    /**
+     * @brief reads a length prefixed run of utf8, in pieces so a corrupt length can't ask for gigabytes up front
+     */
+    std::string bytes() {
+        const uint32_t len = u32();
+        std::string out;
+        char piece[4096];
+        for (uint32_t left = len; is && (left != 0);) {
+            const uint32_t take = std::min<uint32_t>(left, sizeof(piece));
+            is.read(piece, take);
+            out.append(piece, static_cast<size_t>(is.gcount()));
+            left -= take;
+        }
+        return out;
+    }
+
+    bool good() const {
+        return static_cast<bool>(is);
+    }
+
+    bool atEnd() {
+        return is.peek() == std::istream::traits_type::eof();
+    }
+
+private:
+    std::istream& is;
+};
+
+/*======================================================================================================*/
+/*                                         Bytecode Files                                               */
+/*======================================================================================================*/
+
+static void writeFunction(std::ostream& os, const FunctionProto& proto) {
+    putU32(os, proto.name);
+    putU16(os, proto.arity);
+    putU16(os, proto.frameSize);
+    os.put(static_cast<char>(proto.outlined ? 1 : 0));
+    os.put(static_cast<char>(proto.reduction));
+
+    putU32(os, static_cast<uint32_t>(proto.code.size()));
+    for (const Instruction& inst : proto.code) {
+        os.put(static_cast<char>(inst.op));
+        os.put(static_cast<char>(inst.argc));
+        putU16(os, inst.a);
+        putU16(os, inst.b);
+        putU16(os, inst.c);
+    }
+
+    putU32(os, static_cast<uint32_t>(proto.constants.size()));
+    for (const Constant& constant : proto.constants) {
+        os.put(static_cast<char>(constant.type));
+        switch (constant.type) {
+            case ConstantType::Bool:
+            case ConstantType::Int: { putU64(os, static_cast<uint64_t>(constant.intVal)); break; }
+            case ConstantType::Float: {
+                uint64_t bits = 0;
+                std::memcpy(&bits, &constant.floatVal, sizeof(bits));
+                putU64(os, bits);
+                break;
+            }
+            case ConstantType::String: { putText(os, constant.strVal.view()); break; }
+            default: { break; }
+        }
+    }
+
+    putU32(os, static_cast<uint32_t>(proto.callees.size()));
+    for (Symbol callee : proto.callees) {
+        putU32(os, callee);
+    }
+
+    putU32(os, static_cast<uint32_t>(proto.lines.size()));
+    for (const SourceLine& line : proto.lines) {
+        putU32(os, line.pc);
+        putU32(os, line.line);
+    }
+}
+
+std::optional<Utf8String> writeModule(std::ostream& os, const Module& module) {
+    for (const FunctionProto& proto : module.functions) {
+        if (proto.code.empty() || !proto.bodies.empty()) {
+            return std::optional("Function `"_utf8 + module.symbols->text(proto.name) + "` has to be compiled and linked before it can be written!"_utf8);
+        }
+    }
+
+    os.write("FLBC", 4);
+    os.put(static_cast<char>(bytecodeVersion));
+    const uint32_t symbolCount = static_cast<uint32_t>(module.symbols->size());
+    putU32(os, symbolCount);
+    for (Symbol symbol = 0; symbol < symbolCount; symbol++) {
+        putText(os, module.symbols->text(symbol));
+    }
+    putU32(os, static_cast<uint32_t>(module.functions.size()));
+    for (const FunctionProto& proto : module.functions) {
+        writeFunction(os, proto);
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief checks if an op is one a parallel loop's chunks can be combined through, which `VM::arithmetic` handles
+ */
+static constexpr bool isReduction(OpCode op) {
+    return (op == OpCode::Move) || ((op >= OpCode::Add) && (op <= OpCode::Mod));
+}
+
+/**
+ * @brief checks every operand of every instruction in a loaded function against the function and the module
+ * around it, so the VM, which trusts compiled code completely, never reads outside of what exists
+ */
+static std::optional<const char*> verifyFunction(const Module& module, const FunctionProto& proto, size_t symbolCount) {
+    if ((proto.name >= symbolCount) || (proto.arity > proto.frameSize) || !isReduction(proto.reduction)) {
+        return std::optional("a function header is malformed");
+    }
+    for (Symbol callee : proto.callees) {
+        if (callee >= symbolCount) {
+            return std::optional("a call names a symbol that does not exist");
+        }
+    }
+    for (const Constant& constant : proto.constants) {
+        if (constant.type > ConstantType::String) {
+            return std::optional("a constant has no type");
+        }
+    }
+    uint32_t lastPc = 0;
+    for (const SourceLine& line : proto.lines) {
+        if ((line.pc < lastPc) || (line.pc >= proto.code.size())) {
+            return std::optional("the source lines are out of order");
+        }
+        lastPc = line.pc;
+    }
+
+    if (proto.code.empty()) {
+        return std::optional("a function has no code");
+    }
+    const OpCode last = proto.code.back().op;
+    if ((last != OpCode::Return) && (last != OpCode::ReturnNil) && (last != OpCode::Jump)) {
+        return std::optional("a function runs off the end of its code");
+    }
+
+    const auto reg = [&proto](uint32_t r) { return r < proto.frameSize; };
+    for (const Instruction& inst : proto.code) {
+        bool valid = true;
+        switch (inst.op) {
+            case OpCode::LoadK: { valid = reg(inst.a) && (inst.bx() < proto.constants.size()); break; }
+            case OpCode::Move:
+            case OpCode::Neg:
+            case OpCode::Not:
+            case OpCode::NegInt:
+            case OpCode::NegFloat: { valid = reg(inst.a) && reg(inst.b); break; }
+            case OpCode::Check: { valid = reg(inst.a) && reg(inst.b) && (inst.c <= static_cast<uint16_t>(ValueType::String)); break; }
+            case OpCode::Jump: { valid = inst.bx() < proto.code.size(); break; }
+            case OpCode::JumpIfTrue:
+            case OpCode::JumpIfFalse: { valid = reg(inst.a) && (inst.bx() < proto.code.size()); break; }
+            case OpCode::Call: {
+                valid = reg(inst.a) && (inst.b < proto.callees.size()) && ((inst.c + inst.argc) <= proto.frameSize);
+                break;
+            }
+            case OpCode::ParallelFor: {
+                //Bodies are functions of their own by now, which the loop passes its bounds, start and captures to
+                valid = reg(inst.a) && (inst.b < module.functions.size()) && (inst.argc >= 3) && ((inst.c + inst.argc) <= proto.frameSize) &&
+                        module.functions[inst.b].outlined && (module.functions[inst.b].arity == inst.argc);
+                break;
+            }
+            case OpCode::Return: { valid = reg(inst.a); break; }
+            case OpCode::ReturnNil: { break; }
+            default: {
+                //Every binary op, along with anything past the last op, which includes `CallHost` that only linking makes
+                valid = (inst.op < OpCode::CallHost) && reg(inst.a) && reg(inst.b) && reg(inst.c);
+                break;
+            }
+        }
+        if (!valid) {
+            return std::optional("an instruction has an operand out of range");
+        }
+    }
+    return std::nullopt;
+}
+
+static std::optional<const char*> readFunction(ByteReader& in, FunctionProto& proto) {
+    proto.name = in.u32();
+    proto.arity = in.u16();
+    proto.frameSize = in.u16();
+    proto.outlined = in.u8() != 0;
+    proto.reduction = static_cast<OpCode>(in.u8());
+
+    //Counts are never reserved up front, a truncated file just stops every loop once the stream fails
+    const uint32_t codeCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < codeCount); i++) {
+        Instruction inst{.op = static_cast<OpCode>(in.u8())};
+        inst.argc = in.u8();
+        inst.a = in.u16();
+        inst.b = in.u16();
+        inst.c = in.u16();
+        proto.code.push_back(inst);
+    }
+
+    const uint32_t constantCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < constantCount); i++) {
+        Constant constant;
+        constant.type = static_cast<ConstantType>(in.u8());
+        switch (constant.type) {
+            case ConstantType::Bool:
+            case ConstantType::Int: { constant.intVal = static_cast<int64_t>(in.u64()); break; }
+            case ConstantType::Float: {
+                const uint64_t bits = in.u64();
+                std::memcpy(&constant.floatVal, &bits, sizeof(bits));
+                break;
+            }
+            case ConstantType::String: {
+                Result<Utf8String, const char*> text = fromUtf8(in.bytes());
+                if (!text.isOk()) {
+                    return std::optional(text.errValue());
+                }
+                constant.strVal = std::move(text).okValue();
+                break;
+            }
+            default: { break; }
+        }
+        proto.constants.push_back(std::move(constant));
+    }
+
+    const uint32_t calleeCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < calleeCount); i++) {
+        proto.callees.push_back(in.u32());
+    }
+
+    const uint32_t lineCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < lineCount); i++) {
+        const uint32_t pc = in.u32();
+        proto.lines.push_back(SourceLine{.pc = pc, .line = in.u32()});
+    }
+    return std::nullopt;
+}
+
+Result<Module, Utf8String> readModule(std::istream& is) {
+    using Loaded = Result<Module, Utf8String>;
+    const auto fail = [](const char* why) { return Loaded::Err("Could not load bytecode: "_utf8 + Utf8String(why, std::strlen(why))); };
+
+    ByteReader in(is);
+    char magic[4] = {};
+    is.read(magic, sizeof(magic));
+    if (!is || (std::memcmp(magic, "FLBC", sizeof(magic)) != 0)) {
+        return fail("the file is not bytecode");
+    }
+    if (in.u8() != bytecodeVersion) {
+        return fail("the file was written by a different version");
+    }
+
+    //Symbols go back in the order they were handed out, so every symbol in the file keeps its number
+    std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    const uint32_t symbolCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < symbolCount); i++) {
+        Result<Utf8String, const char*> text = fromUtf8(in.bytes());
+        if (!in.good()) {
+            break;
+        }
+        if (!text.isOk()) {
+            return fail(text.errValue());
+        }
+        if (symbols->intern(text.okValue().view()) != i) {
+            return fail("the symbol table repeats a spelling");
+        }
+    }
+
+    Module module;
+    const uint32_t functionCount = in.u32();
+    for (uint32_t i = 0; in.good() && (i < functionCount); i++) {
+        module.functions.emplace_back();
+        auto error = readFunction(in, module.functions.back());
+        if (error) {
+            return fail(error.value());
+        }
+    }
+    if (!in.good()) {
+        return fail("the file is truncated");
+    }
+    if (!in.atEnd()) {
+        return fail("the file has bytes past its last function");
+    }
+
+    for (const FunctionProto& proto : module.functions) {
+        auto error = verifyFunction(module, proto, symbolCount);
+        if (error) {
+            return fail(error.value());
+        }
+    }
+    module.symbols = std::move(symbols);
+    return Loaded::Ok(std::move(module));
+}
+
+/*======================================================================================================*/
+/*                                            AST Dumps                                                 */
+/*======================================================================================================*/
+
+void writeAstDump(std::ostream& os, uint64_t sourceHash, const std::vector<ASTNode>& ast, size_t root, const std::vector<size_t>& functions) {
+    os.write("FLAST", 5);
+    os.put(static_cast<char>(astDumpVersion));
+    putU64(os, sourceHash);
+    putU32(os, static_cast<uint32_t>(ast.size()));
+    putU32(os, static_cast<uint32_t>(root));
+    for (const ASTNode& node : ast) {
+        os.put(static_cast<char>(node.body.type));
+        putU32(os, static_cast<uint32_t>(node.body.lineCount));
+        putU32(os, static_cast<uint32_t>(node.body.charCount));
+        putText(os, node.body.text);
+        putU32(os, static_cast<uint32_t>(node.children.size()));
+        for (size_t child : node.children) {
+            putU32(os, static_cast<uint32_t>(child));
+        }
+    }
+    putU32(os, static_cast<uint32_t>(functions.size()));
+    for (size_t function : functions) {
+        putU32(os, static_cast<uint32_t>(function));
+    }
+}
+
+uint64_t fingerprintBytes(const char* data, size_t len) noexcept {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+} //end namespace fl
@@ -10,7 +10,9 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 
 #include "tokenizer.hpp"
 #include "utf8string.hpp"
-#include <map>
+#include "fl_util.hpp"
+#include "unicode.hpp"
+#include "instrument.hpp"
 #include <algorithm>
 
 namespace fl {
@@ -69,62 +71,6 @@ static constexpr bool isWhitespace(uChar c) {
     }
 }
 
-/**
- * @brief checks if a given uchar is NOT double quotes
- * @todo explore making this just a lambda
- */
-static constexpr bool isntDoubleQuotes(uChar c) {
-    return (c != "\""_u);
-}
-
-/**
- * @brief checks if a uChar is anything but a comment close sign
- * @todo explore making this just a lambda in the actual tokenizer call
- */
-static constexpr bool isntTag(uChar c) {
-    return (c != "#"_u);
-}
-
-/**
- * @brief a macro to detect if a given uChar is part of the ascii subset of reserved
- * single chars that form their own tokens
- */
-static constexpr bool isReservedChar(uChar c) {
-    switch (c.n) {
-        case "@"_u.n:
-        case ";"_u.n:
-        case "("_u.n:
-        case ")"_u.n:
-        case "["_u.n:
-        case "]"_u.n: 
-        case "{"_u.n:
-        case "}"_u.n:
-        case "."_u.n:
-        case ","_u.n:
-        case "\""_u.n:
-        {
-            return true;
-        }
-        default: {
-            return false;
-        }
-    }
-}
-
-/**
- * @brief a macro that sees if its any of the non-special or non reserved charachters,
- * these charachters are all valid to be part of an identifier
- */
-static constexpr bool isIdentifier(uChar c) {
-    return (c.writeSize() > 2) ? true : 
-                    (!isWhitespace(c) && 
-                    !isOperatorChar(c) && 
-                    !isNumber(c) &&
-                    !isReservedChar(c) &&
-                    isntDoubleQuotes(c)) &&
-                    isntTag(c);
-}
-
 /**
  * @brief a templated macro that is inspired by rust's iter take_while which takes a predicate
  * and takes from an iter. It is used to search through the given input, under a given predicate
@@ -149,14 +95,22 @@ static constexpr size_t countTakeWhile(const Utf8String& text, size_t curPos, Pr
 /*                                       Tokenizer                                                      */
 /*======================================================================================================*/
 
+/**
+ * @brief builds a tokenizer diagnostic at the given position
+ */
+static Diagnostic diagnoseAt(size_t lineCount, size_t charCount, DiagCode code) {
+    return Diagnostic{.line = static_cast<uint32_t>(lineCount), .column = static_cast<uint32_t>(charCount), .code = code};
+}
+
 /**
  * @brief tokenizes a given input as a Utf8String. This is a state machine approach that builds
  * views over the original text to minimize copies. It is also implemented to be easy to add
  * single char special charachters, and defined keywords by putting them in a map which is then
- * checked against
- * @todo check error handling
+ * checked against. Identifiers and literals are interned into `symbols` as they are found.
+ * Errors are reported and skipped over, so one pass finds every error in the text
  */
-Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
+std::vector<Token> tokenize(const Utf8String& text, SymbolTable& symbols, DiagnosticBuffer& diagnostics) {
+    FL_STAGE(Tokenize);
     std::vector<Token> tokens;
 
     size_t curPos = 0;
@@ -164,24 +118,26 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
     size_t lineCount = 1;
     size_t charCount = 1;
 
-    const std::map<uChar, TokenType> singleCharTokenMap = {
+    //Built once and shared by every call, every lookup is a single hashed probe
+    static const FlatMap<uChar, TokenType> singleCharTokenMap = {
         {";"_u, TokenType::EOL}, {"@"_u, TokenType::Prepocessor}, 
         {"("_u, TokenType::OpenParen}, {")"_u, TokenType::CloseParen},
         {"["_u, TokenType::OpenSquare}, {"]"_u, TokenType::CloseSquare},
-        {"{"_u, TokenType::OpenCurly}, {";"_u, TokenType::CloseCurly},
+        {"{"_u, TokenType::OpenCurly}, {"}"_u, TokenType::CloseCurly},
         {","_u, TokenType::Comma},
     };
 
-    const std::map<Utf8String, TokenType> keywordMap = {
+    static const FlatMap<Utf8String, TokenType> keywordMap = {
         {"func"_utf8, TokenType::Func}, {"if"_utf8, TokenType::If},
         {"elif"_utf8, TokenType::Elif}, {"else"_utf8, TokenType::Else},
         {"then"_utf8, TokenType::Then}, {"do"_utf8, TokenType::Do},
         {"while"_utf8, TokenType::While}, {"for"_utf8, TokenType::For},
         {"import"_utf8, TokenType::Import}, {"returns"_utf8, TokenType::Returns},
+        {"return"_utf8, TokenType::Return},
         {"let"_utf8, TokenType::Let}, {"end"_utf8, TokenType::End}
     };
 
-    const std::map<Utf8String, TokenType> validOperators = {
+    static const FlatMap<Utf8String, TokenType> validOperators = {
         {"++"_utf8, TokenType::PostInc}, {"--"_utf8, TokenType::PostDec}, 
         {"."_utf8, TokenType::Period},
         {"!"_utf8, TokenType::LogNot},
@@ -197,6 +153,7 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
 
 
     const size_t maxCharCount = text.getCharCount();
+    const Utf8StringView source = text.view();
     while (curPos < maxCharCount) {
         uChar curChar = text[curPos];
         TokenType newType = TokenType::Undefined;
@@ -210,11 +167,14 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
             }
             continue;
         } else if (curChar == "#"_u) {
-            size_t savedPos = curPos; //Utilize this later for erros
-            curPos = countTakeWhile(text, curPos + 1, isntTag) + 1;
-            if (curPos >= maxCharCount) {
-                return Result<std::vector<Token>, Utf8String>::Err("Comment was left unclosed!"_utf8);
+            //Comments can run long, so the closing tag is found with the vectorized search
+            const size_t closePos = source.find("#"_u, curPos + 1);
+            if (closePos == Utf8StringView::npos) {
+                //The rest of the text is the comment, so there is nothing left to tokenize
+                diagnostics.report(diagnoseAt(lineCount, charCount, DiagCode::UnclosedComment));
+                break;
             }
+            curPos = closePos + 1;
             //Even on comments, ensure that chars are advanced
             charCount += (curPos - lastPos);
             lastPos = curPos;
@@ -224,16 +184,16 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
             newType = TokenType::Operator;
 
             //Test to see if operator is valid
-            auto testView = Utf8StringView(text, lastPos, curPos);
-            for (const auto& pair : validOperators) {
-                if (testView == pair.first) {
-                    newType = pair.second;
-                    break;
-                }
+            const auto op = validOperators.find(Utf8StringView(text, lastPos, curPos));
+            if (op != validOperators.end()) {
+                newType = op->second;
             }
 
             if (newType == TokenType::Operator) {
-                return Result<std::vector<Token>, Utf8String>::Err("Illegal Operator!"_utf8);
+                diagnostics.report(diagnoseAt(lineCount, charCount, DiagCode::IllegalOperator));
+                charCount += (curPos - lastPos);
+                lastPos = curPos;
+                continue;
             }
 
         } else if (isNumber(curChar)) {
@@ -247,41 +207,53 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
             newType = TokenType::Number;
 
         } else if (curChar == "\""_u) {
-            size_t savedPos = curPos; //remmeber this for erros later
-            curPos = countTakeWhile(text, curPos + 1, isntDoubleQuotes) + 1;
-            if (curPos >= maxCharCount) {
-                return Result<std::vector<Token>, Utf8String>::Err("String literal left unclosed!"_utf8);
+            const size_t closePos = source.find("\""_u, curPos + 1);
+            if (closePos == Utf8StringView::npos) {
+                //Sync on the next line, since the literal would otherwise swallow the rest of the text
+                diagnostics.report(diagnoseAt(lineCount, charCount, DiagCode::UnclosedString));
+                const size_t lineEnd = source.find("\n"_u, curPos + 1);
+                curPos = (lineEnd == Utf8StringView::npos) ? maxCharCount : lineEnd;
+                charCount += (curPos - lastPos);
+                lastPos = curPos;
+                continue;
             }
+            curPos = closePos + 1;
             newType = TokenType::StringLit;
-        } else if (singleCharTokenMap.contains(curChar)) {
+        } else if (const auto single = singleCharTokenMap.find(curChar); single != singleCharTokenMap.end()) {
             curPos++;
             //Conditionally change identifiers to function calls
             if ((tokens.size() > 0) && (curChar == "("_u) && (tokens.back().type == TokenType::Identifier)) {
                 tokens.back().type = TokenType::FuncCall;
             }
 
-            newType = singleCharTokenMap.at(curChar);
-        } else {
-            curPos = countTakeWhile(text, curPos, isIdentifier);
+            newType = single->second;
+        } else if (isIdentifierStart(curChar)) {
+            curPos = takeIdentifier(source, curPos + 1);
 
             //Set the base type to identifer, and create a test view to look over
             //This view is compared against the keyword map to assign it to all of our keywords
             newType = TokenType::Identifier;
-            auto testView = Utf8StringView(text, lastPos, curPos);
-            for (const auto& pair : keywordMap) {
-                if (testView == pair.first) {
-                    newType = pair.second;
-                    break;
-                }
+            const auto keyword = keywordMap.find(Utf8StringView(text, lastPos, curPos));
+            if (keyword != keywordMap.end()) {
+                newType = keyword->second;
             }
+        } else {
+            diagnostics.report(diagnoseAt(lineCount, charCount, DiagCode::InvalidTokenStart));
+            curPos++;
+            charCount++;
+            lastPos = curPos;
+            continue;
         }
 
-        //Push back our new token
+        //Push back our new token, interning the spelling of anything that names or holds a value
+        const Utf8StringView tokenText(text, lastPos, curPos);
+        const bool isInterned = (newType == TokenType::Identifier) || (newType == TokenType::Number) || (newType == TokenType::StringLit);
         tokens.push_back(Token{
             .type = newType,
-            .text = Utf8StringView(text, lastPos, curPos),
+            .text = tokenText,
             .lineCount = lineCount,
-            .charCount = charCount
+            .charCount = charCount,
+            .symbol = isInterned ? symbols.intern(tokenText) : noSymbol
         });
 
         //Advance current charachter by the number of charachters advanced
@@ -290,7 +262,16 @@ Result<std::vector<Token>, Utf8String> tokenize(const Utf8String& text) {
     }
 
     //After everything we can return our tokens
-    return Result<std::vector<Token>, Utf8String>::Ok(tokens);
+    return tokens;
+}
+
+Result<std::vector<Token>, Diagnostic> tokenize(const Utf8String& text, SymbolTable& symbols) {
+    DiagnosticBuffer diagnostics;
+    std::vector<Token> tokens = tokenize(text, symbols, diagnostics);
+    if (!diagnostics.isEmpty()) {
+        return Result<std::vector<Token>, Diagnostic>::Err(diagnostics[0]);
+    }
+    return Result<std::vector<Token>, Diagnostic>::Ok(std::move(tokens));
 }
 
 } //end namespace fl
\ No newline at end of file
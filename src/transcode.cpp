@@ -0,0 +1,212 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "transcode.hpp"
+#include "unicode.hpp"
+#include "instrument.hpp"
+#include <bit>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Decoding                                                      */
+/*======================================================================================================*/
+
+Result<size_t, const char*> decodeUtf16(const char16_t* data, size_t len, uChar* out) noexcept {
+    uChar* cursor = out;
+    size_t i = 0;
+    while (i < len) {
+#if FL_HAS_SSE2
+        //Eight ascii code units are widened at once, by zero extending and adding the size byte
+        if ((i + 8) <= len) {
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i high = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF) {
+                const __m128i sizeByte = _mm_set1_epi32(0x01000000);
+                __m128i* dst = reinterpret_cast<__m128i*>(cursor);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_unpacklo_epi16(units, _mm_setzero_si128()), sizeByte));
+                _mm_storeu_si128(dst + 1, _mm_or_si128(_mm_unpackhi_epi16(units, _mm_setzero_si128()), sizeByte));
+                cursor += 8;
+                i += 8;
+                continue;
+            }
+        }
+#endif
+        uint32_t cp = data[i++];
+        if ((cp >= 0xD800) && (cp <= 0xDBFF)) {
+            if ((i == len) || (data[i] < 0xDC00) || (data[i] > 0xDFFF)) {
+                return Result<size_t, const char*>::Err("Unpaired utf16 surrogate!");
+            }
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (data[i++] - 0xDC00);
+        } else if ((cp >= 0xDC00) && (cp <= 0xDFFF)) {
+            return Result<size_t, const char*>::Err("Unpaired utf16 surrogate!");
+        }
+        *cursor++ = uCharFromCodePoint(cp);
+    }
+    return Result<size_t, const char*>::Ok(static_cast<size_t>(cursor - out));
+}
+
+Result<size_t, const char*> decodeUtf32(const char32_t* data, size_t len, uChar* out) noexcept {
+    size_t i = 0;
+#if FL_HAS_SSE2
+    const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+    const __m128i sizeByte = _mm_set1_epi32(0x01000000);
+    for (; (i + 4) <= len; i += 4) {
+        const __m128i points = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(points, nonAscii), _mm_setzero_si128())) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_or_si128(points, sizeByte));
+    }
+#endif
+    for (; i < len; i++) {
+        const uint32_t cp = data[i];
+        if ((cp > 0x10FFFF) || ((cp >= 0xD800) && (cp <= 0xDFFF))) {
+            return Result<size_t, const char*>::Err("Invalid utf32 code point!");
+        }
+        out[i] = uCharFromCodePoint(cp);
+    }
+    return Result<size_t, const char*>::Ok(len);
+}
+
+/*======================================================================================================*/
+/*                                        Encoding                                                      */
+/*======================================================================================================*/
+
+#if FL_HAS_SSE2
+/**
+ * @brief checks if four uChars are all ascii, handing back their code points if they are
+ */
+static inline bool asciiLanes(const uChar* data, __m128i& points) noexcept {
+    points = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_set1_epi32(0x01000000));
+    const __m128i high = _mm_and_si128(points, _mm_set1_epi32(~0x7F));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF;
+}
+#endif
+
+size_t encodeUtf16(const uChar* data, size_t count, char16_t* out) noexcept {
+    char16_t* cursor = out;
+    size_t i = 0;
+    while (i < count) {
+#if FL_HAS_SSE2
+        if ((i + 8) <= count) {
+            __m128i lo;
+            __m128i hi;
+            if (asciiLanes(data + i, lo) && asciiLanes(data + i + 4, hi)) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(cursor), _mm_packs_epi32(lo, hi));
+                cursor += 8;
+                i += 8;
+                continue;
+            }
+        }
+#endif
+        const uint32_t cp = codePointOf(data[i++]);
+        if (cp >= 0x10000) {
+            *cursor++ = static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+            *cursor++ = static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        } else {
+            *cursor++ = static_cast<char16_t>(cp);
+        }
+    }
+    return static_cast<size_t>(cursor - out);
+}
+
+void encodeUtf32(const uChar* data, size_t count, char32_t* out) noexcept {
+    size_t i = 0;
+#if FL_HAS_SSE2
+    while ((i + 4) <= count) {
+        __m128i points;
+        if (asciiLanes(data + i, points)) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), points);
+            i += 4;
+            continue;
+        }
+        for (const size_t blockEnd = i + 4; i < blockEnd; i++) {
+            out[i] = codePointOf(data[i]);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = codePointOf(data[i]);
+    }
+}
+
+/*======================================================================================================*/
+/*                                        Owning Forms                                                  */
+/*======================================================================================================*/
+
+Result<Utf8String, const char*> fromUtf8(std::string_view text) {
+    FL_STAGE(Decode);
+    uint32_t code = 0;
+    Utf8String str = Utf8String::build(text.size(), [&](uChar* out) {
+        size_t count = 0;
+        code = decodeUtf8(text.data(), text.size(), out, count);
+        return count;
+    });
+    if (code != 0) {
+        return Result<Utf8String, const char*>::Err("Malformed utf8!");
+    }
+    return Result<Utf8String, const char*>::Ok(std::move(str));
+}
+
+Utf8String fromValidatedUtf8(std::string_view text) {
+    return Utf8String::build(text.size(), [&](uChar* out) {
+        //Decoding stops at the first malformed sequence, so bad input is only ever cut short
+        size_t count = 0;
+        decodeUtf8(text.data(), text.size(), out, count);
+        return count;
+    });
+}
+
+Result<Utf8String, const char*> fromUtf16(std::u16string_view text) {
+    const char* error = nullptr;
+    Utf8String str = Utf8String::build(text.size(), [&](uChar* out) -> size_t {
+        auto res = decodeUtf16(text.data(), text.size(), out);
+        if (!res.isOk()) {
+            error = res.errValue();
+            return 0;
+        }
+        return res.okValue();
+    });
+    if (error != nullptr) {
+        return Result<Utf8String, const char*>::Err(error);
+    }
+    return Result<Utf8String, const char*>::Ok(std::move(str));
+}
+
+Result<Utf8String, const char*> fromUtf32(std::u32string_view text) {
+    const char* error = nullptr;
+    Utf8String str = Utf8String::build(text.size(), [&](uChar* out) -> size_t {
+        auto res = decodeUtf32(text.data(), text.size(), out);
+        if (!res.isOk()) {
+            error = res.errValue();
+            return 0;
+        }
+        return res.okValue();
+    });
+    if (error != nullptr) {
+        return Result<Utf8String, const char*>::Err(error);
+    }
+    return Result<Utf8String, const char*>::Ok(std::move(str));
+}
+
+std::u16string toUtf16(const Utf8StringView& text) {
+    std::u16string out(maxUtf16Units(text.getLen()), u'\0');
+    out.resize(encodeUtf16(text.getDataPointer(), text.getLen(), out.data()));
+    return out;
+}
+
+std::u32string toUtf32(const Utf8StringView& text) {
+    std::u32string out(text.getLen(), U'\0');
+    encodeUtf32(text.getDataPointer(), text.getLen(), out.data());
+    return out;
+}
+
+} //end namespace fl
@@ -0,0 +1,237 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "unicode.hpp"
+#include "fl_util.hpp"
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                        Ascii Checks                                                  */
+/*======================================================================================================*/
+
+size_t countLeadingAscii(const uChar* data, size_t count) noexcept {
+    size_t i = 0;
+#if FL_HAS_SSE2
+    //Every ascii uChar has exactly 1 in its size byte and nothing above its low 7 bits
+    const __m128i nonAsciiBits = _mm_set1_epi32(static_cast<int>(0xFFFFFF80u));
+    const __m128i asciiHigh = _mm_set1_epi32(0x01000000);
+    for (; (i + 4) <= count; i += 4) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i isAsciiLane = _mm_cmpeq_epi32(_mm_and_si128(block, nonAsciiBits), asciiHigh);
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(isAsciiLane));
+        if (mask != 0xFFFFu) {
+            return i + (std::countr_one(mask) / 4);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (!isAscii(data[i])) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/*======================================================================================================*/
+/*                                        Identifiers                                                   */
+/*======================================================================================================*/
+
+size_t takeIdentifier(const Utf8StringView& text, size_t pos) noexcept {
+    constexpr size_t asciiBlock = 16;
+    const uChar* data = text.getDataPointer();
+    const size_t len = text.getLen();
+    while (pos < len) {
+        const size_t block = std::min(asciiBlock, len - pos);
+        const size_t asciiEnd = pos + countLeadingAscii(data + pos, block);
+        for (; pos < asciiEnd; pos++) {
+            if ((detail::asciiIdentifierFlags[data[pos].n & 0x7F] & detail::asciiContinueFlag) == 0) {
+                return pos;
+            }
+        }
+        //Either the whole block was ascii, or this is the non ascii uChar that ended the run
+        if ((pos == len) || isAscii(data[pos])) {
+            continue;
+        }
+        if (!isIdentifierContinue(data[pos])) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+/*======================================================================================================*/
+/*                                        Normalization                                                 */
+/*======================================================================================================*/
+
+//Hangul syllables are composed and decomposed by formula rather than by table
+static constexpr uint32_t hangulSBase = 0xAC00;
+static constexpr uint32_t hangulLBase = 0x1100;
+static constexpr uint32_t hangulVBase = 0x1161;
+static constexpr uint32_t hangulTBase = 0x11A7;
+static constexpr uint32_t hangulLCount = 19;
+static constexpr uint32_t hangulVCount = 21;
+static constexpr uint32_t hangulTCount = 28;
+static constexpr uint32_t hangulNCount = hangulVCount * hangulTCount;
+static constexpr uint32_t hangulSCount = hangulLCount * hangulNCount;
+
+static constexpr uint16_t nfcNoFlag = 1 << 8;
+static constexpr uint16_t nfcMaybeFlag = 1 << 9;
+
+//Nothing below the first combining mark has a combining class or can change under NFC
+static constexpr uint32_t firstNormalizingCodePoint = 0x300;
+
+static uint16_t normalizationPropsOf(uint32_t cp) noexcept {
+    const size_t block = cp >> 6;
+    if (block >= detail::normalizationBlockCount) {
+        return 0;
+    }
+    return detail::normalizationProps[(static_cast<size_t>(detail::normalizationBlockIndex[block]) << 6) | (cp & 0x3F)];
+}
+
+static uint8_t combiningClassOf(uint32_t cp) noexcept {
+    return static_cast<uint8_t>(normalizationPropsOf(cp) & 0xFF);
+}
+
+NfcCheck quickCheckNfc(const Utf8StringView& text) noexcept {
+    const uChar* data = text.getDataPointer();
+    const size_t len = text.getLen();
+    NfcCheck result = NfcCheck::Yes;
+    uint8_t lastClass = 0;
+    for (size_t i = countLeadingAscii(data, len); i < len; i++) {
+        const uint32_t cp = codePointOf(data[i]);
+        if (cp < firstNormalizingCodePoint) {
+            lastClass = 0;
+            continue;
+        }
+        const uint16_t props = normalizationPropsOf(cp);
+        const uint8_t ccc = static_cast<uint8_t>(props & 0xFF);
+        //Marks out of canonical order can never be NFC
+        if ((ccc != 0) && (lastClass > ccc)) {
+            return NfcCheck::No;
+        }
+        if ((props & nfcNoFlag) != 0) {
+            return NfcCheck::No;
+        }
+        if ((props & nfcMaybeFlag) != 0) {
+            result = NfcCheck::Maybe;
+        }
+        lastClass = ccc;
+    }
+    return result;
+}
+
+/**
+ * @brief appends the full canonical decomposition of a code point
+ */
+static void decompose(uint32_t cp, std::vector<uint32_t>& out) {
+    if ((cp >= hangulSBase) && (cp < (hangulSBase + hangulSCount))) {
+        const uint32_t index = cp - hangulSBase;
+        out.push_back(hangulLBase + (index / hangulNCount));
+        out.push_back(hangulVBase + ((index % hangulNCount) / hangulTCount));
+        if ((index % hangulTCount) != 0) {
+            out.push_back(hangulTBase + (index % hangulTCount));
+        }
+        return;
+    }
+    const uint32_t* keysEnd = detail::decompositionKeys + detail::decompositionCount;
+    const uint32_t* found = std::lower_bound(detail::decompositionKeys, keysEnd, cp);
+    if ((found == keysEnd) || (*found != cp)) {
+        out.push_back(cp);
+        return;
+    }
+    const uint32_t range = detail::decompositionRanges[found - detail::decompositionKeys];
+    const uint32_t* first = detail::decompositionData + (range >> 8);
+    out.insert(out.end(), first, first + (range & 0xFF));
+}
+
+/**
+ * @brief finds the primary composite of two code points
+ * @returns the composite, or 0 if the pair does not compose
+ */
+static uint32_t compose(uint32_t first, uint32_t second) noexcept {
+    if ((first >= hangulLBase) && (first < (hangulLBase + hangulLCount)) &&
+        (second >= hangulVBase) && (second < (hangulVBase + hangulVCount))) {
+        return hangulSBase + ((((first - hangulLBase) * hangulVCount) + (second - hangulVBase)) * hangulTCount);
+    }
+    if ((first >= hangulSBase) && (first < (hangulSBase + hangulSCount)) && (((first - hangulSBase) % hangulTCount) == 0) &&
+        (second > hangulTBase) && (second < (hangulTBase + hangulTCount))) {
+        return first + (second - hangulTBase);
+    }
+    const uint64_t key = (static_cast<uint64_t>(first) << 32) | second;
+    const uint64_t* keysEnd = detail::compositionKeys + detail::compositionCount;
+    const uint64_t* found = std::lower_bound(detail::compositionKeys, keysEnd, key);
+    if ((found == keysEnd) || (*found != key)) {
+        return 0;
+    }
+    return detail::compositionValues[found - detail::compositionKeys];
+}
+
+Utf8String normalizeNfc(const Utf8StringView& text) {
+    if (quickCheckNfc(text) == NfcCheck::Yes) {
+        return text.toOwned();
+    }
+
+    //Fully decompose, then put every run of marks into canonical order
+    std::vector<uint32_t> decomposed;
+    decomposed.reserve(text.getLen() + 8);
+    for (size_t i = 0; i < text.getLen(); i++) {
+        decompose(codePointOf(text[i]), decomposed);
+    }
+    for (size_t i = 1; i < decomposed.size(); i++) {
+        const uint8_t ccc = combiningClassOf(decomposed[i]);
+        if (ccc == 0) {
+            continue;
+        }
+        size_t j = i;
+        while ((j > 0) && (combiningClassOf(decomposed[j - 1]) > ccc)) {
+            std::swap(decomposed[j], decomposed[j - 1]);
+            j--;
+        }
+    }
+
+    //Compose each mark onto the last starter, unless something in between blocks it
+    std::vector<uint32_t> composed;
+    composed.reserve(decomposed.size());
+    size_t starter = SIZE_MAX;
+    uint8_t lastClass = 0;
+    for (const uint32_t cp : decomposed) {
+        const uint8_t ccc = combiningClassOf(cp);
+        if (starter != SIZE_MAX) {
+            const bool adjacent = (composed.size() - 1) == starter;
+            const bool blocked = !adjacent && ((lastClass == 0) || (lastClass >= ccc));
+            if (!blocked) {
+                const uint32_t composite = compose(composed[starter], cp);
+                if (composite != 0) {
+                    composed[starter] = composite;
+                    continue;
+                }
+            }
+        }
+        if (ccc == 0) {
+            starter = composed.size();
+        }
+        lastClass = ccc;
+        composed.push_back(cp);
+    }
+
+    std::vector<uChar> out;
+    out.reserve(composed.size());
+    for (const uint32_t cp : composed) {
+        out.push_back(uCharFromCodePoint(cp));
+    }
+    return Utf8String(out.data(), out.size());
+}
+
+} //end namespace fl
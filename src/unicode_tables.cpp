@@ -0,0 +1,2366 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+//GENERATED by tools/gen_unicode_tables.py from unicode 14.0.0, do not edit by hand
+
+#include "unicode.hpp"
+
+namespace fl::detail {
+
+const uint8_t asciiIdentifierFlags[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+};
+
+const size_t identifierBlockCount = 14344;
+
+const uint16_t identifierBlockIndex[14344] = {
+    0, 1, 2, 3, 4, 4, 4, 4, 4, 4, 4, 5, 6, 7, 8, 9, 4, 4, 10, 4, 11, 12, 13, 14,
+    15, 16, 4, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 4, 4, 4, 4,
+    4, 58, 59, 60, 61, 62, 63, 64, 65, 4, 4, 4, 4, 4, 4, 4, 4, 66, 67, 68, 69, 70, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 4, 4, 4, 6,
+    4, 4, 4, 4, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 4, 4, 4, 105, 106, 107, 108, 109, 104, 104, 104, 104, 104, 104, 104, 104,
+    110, 65, 111, 112, 113, 4, 114, 115, 104, 104, 104, 104, 104, 104, 104, 104, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 104,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 116, 117, 4, 4, 4, 4, 118, 119, 120, 121, 122, 4, 123, 124,
+    125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 4, 139, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 140, 141,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 4, 4, 4, 4, 142, 4, 143, 144, 145, 146, 147,
+    4, 148, 4, 4, 149, 150, 151, 152, 153, 154, 4, 155, 156, 157, 158, 159, 160, 161, 4, 162, 104, 163, 104, 164,
+    104, 104, 165, 166, 167, 168, 169, 170, 4, 4, 171, 172, 173, 174, 175, 104, 4, 4, 4, 4, 176, 177, 178, 104,
+    179, 180, 181, 182, 183, 104, 184, 104, 185, 186, 187, 188, 76, 189, 190, 104, 4, 103, 191, 191, 192, 104, 104, 104,
+    104, 104, 193, 104, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 104, 207, 208, 209, 210, 104, 104,
+    211, 212, 213, 214, 104, 104, 215, 216, 213, 217, 218, 219, 220, 221, 104, 104, 222, 104, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 74, 104, 104, 104, 104, 232, 233, 234, 104, 235, 236, 237, 104, 104, 104, 104, 238, 104, 104, 239, 104,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 143, 104, 4, 240, 4, 4, 4, 241, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 150, 242, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 240, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 221, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    4, 4, 4, 4, 4, 4, 4, 4, 74, 243, 244, 245, 246, 247, 248, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 4, 104, 104, 4, 249, 250, 251, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 252, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 253, 103, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 254,
+    4, 4, 4, 4, 255, 256, 4, 4, 4, 4, 4, 257, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    4, 258, 259, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 260, 261, 104, 104, 104, 104, 104, 104, 104, 262, 263, 104, 104, 264, 104, 104, 104, 104, 104, 104,
+    4, 265, 266, 267, 268, 269, 4, 4, 4, 4, 270, 271, 272, 273, 274, 275, 104, 104, 104, 104, 104, 104, 104, 104,
+    276, 277, 278, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 181, 104, 104, 104,
+    279, 104, 104, 104, 280, 281, 104, 104, 104, 104, 282, 283, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 284, 4, 4, 4, 285, 4, 286, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 287, 288, 289, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 290, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 74, 4, 4, 4,
+    169, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 291, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 292, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 4, 4, 4, 4, 4, 4, 4,
+    293, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 294, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 6, 6, 6, 295,
+};
+
+const uint64_t xidStartBits[296] = {
+    0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0420040000000000ull, 0xFF7FFFFFFF7FFFFFull,
+    0xFFFFFFFFFFFFFFFFull, 0x0000501F0003FFC3ull, 0x0000000000000000ull, 0xB8DF000000000000ull,
+    0xFFFFFFFBFFFFD740ull, 0xFFBFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFC03ull, 0xFFFEFFFFFFFFFFFFull,
+    0xFFFFFFFF027FFFFFull, 0x00000000000001FFull, 0x000787FFFFFF0000ull, 0xFFFFFFFF00000000ull,
+    0xFFFEC000000007FFull, 0x9C00C060002FFFFFull, 0x0000FFFFFFFD0000ull, 0xFFFFFFFFFFFFE000ull,
+    0x0002003FFFFFFFFFull, 0x043007FFFFFFFC00ull, 0x00000110043FFFFFull, 0xFFFF07FF01FFFFFFull,
+    0xFFFFFFFF00007EFFull, 0x00000000000003FFull, 0x23FFFFFFFFFFFFF0ull, 0xFFFE0003FF010000ull,
+    0x23C5FDFFFFF99FE1ull, 0x10030003B0004000ull, 0x036DFDFFFFF987E0ull, 0x001C00005E000000ull,
+    0x23EDFDFFFFFBBFE0ull, 0x0200000300010000ull, 0x23EDFDFFFFF99FE0ull, 0x00020003B0000000ull,
+    0x03FFC718D63DC7E8ull, 0x0000000000010000ull, 0x23FFFDFFFFFDDFE0ull, 0x0000000327000000ull,
+    0x23EFFDFFFFFDDFE1ull, 0x0006000360000000ull, 0x27FFFFFFFFFDDFF0ull, 0xFC00000380704000ull,
+    0x2FFBFFFFFC7FFFE0ull, 0x000000000000007Full, 0x0005FFFFFFFFFFFEull, 0x000000000000007Full,
+    0x2005FFAFFFFFF7D6ull, 0x00000000F000005Full, 0x0000000000000001ull, 0x00001FFFFFFFFEFFull,
+    0x0000000000001F00ull, 0x0000000000000000ull, 0x800007FFFFFFFFFFull, 0xFFE1C0623C3F0000ull,
+    0xFFFFFFFF00004003ull, 0xF7FFFFFFFFFF20BFull, 0xFFFFFFFF3D7F3DFFull, 0x7F3DFFFFFFFF3DFFull,
+    0xFFFFFFFFFF7FFF3Dull, 0xFFFFFFFFFF3DFFFFull, 0x0000000007FFFFFFull, 0xFFFFFFFF0000FFFFull,
+    0x3F3FFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xFFFF9FFFFFFFFFFFull, 0xFFFFFFFF07FFFFFEull,
+    0x01FFC7FFFFFFFFFFull, 0x0003FFFF8003FFFFull, 0x0001DFFF0003FFFFull, 0x000FFFFFFFFFFFFFull,
+    0x0000000010800000ull, 0xFFFFFFFF00000000ull, 0x01FFFFFFFFFFFFFFull, 0xFFFF05FFFFFFFFFFull,
+    0x003FFFFFFFFFFFFFull, 0x000000007FFFFFFFull, 0x001F3FFFFFFF0000ull, 0xFFFF0FFFFFFFFFFFull,
+    0x00000000000003FFull, 0xFFFFFFFF007FFFFFull, 0x00000000001FFFFFull, 0x0000008000000000ull,
+    0x0000000000000000ull, 0x000FFFFFFFFFFFE0ull, 0x0000000000001FE0ull, 0xFC00C001FFFFFFF8ull,
+    0x0000003FFFFFFFFFull, 0x0000000FFFFFFFFFull, 0x3FFFFFFFFC00E000ull, 0xE7FFFFFFFFFF01FFull,
+    0x046FDE0000000000ull, 0xFFFFFFFF3F3FFFFFull, 0x3FFFFFFFAAFF3F3Full, 0x5FDFFFFFFFFFFFFFull,
+    0x1FDC1FFF0FCF1FDCull, 0x0000000000000000ull, 0x8002000000000000ull, 0x000000001FFF0000ull,
+    0x0000000000000000ull, 0xF3FFFD503F2FFC84ull, 0xFFFFFFFF000043E0ull, 0x00000000000001FFull,
+    0x0000000000000000ull, 0x000C781FFFFFFFFFull, 0xFFFF20BFFFFFFFFFull, 0x000080FFFFFFFFFFull,
+    0x7F7F7F7F007FFFFFull, 0x000000007F7F7F7Full, 0x1F3E03FE000000E0ull, 0xFFFFFFFEE07FFFFFull,
+    0xF7FFFFFFFFFFFFFFull, 0xFFFEFFFFFFFFFFE0ull, 0xFFFFFFFF00007FFFull, 0xFFFF000000000000ull,
+    0x0000000000001FFFull, 0x3FFFFFFFFFFF0000ull, 0x00000C00FFFF1FFFull, 0x80007FFFFFFFFFFFull,
+    0xFFFFFFFF3FFFFFFFull, 0x0000FFFFFFFFFFFFull, 0xFFFFFFFCFF800000ull, 0xFFFFFFFFFFFFF9FFull,
+    0xFFFC000003EB07FFull, 0x00000007FFFFF7BBull, 0x000FFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFCull,
+    0x68FC000000000000ull, 0xFFFF003FFFFFFC00ull, 0x1FFFFFFF0000007Full, 0x0007FFFFFFFFFFF0ull,
+    0x7C00FFDF00008000ull, 0x000001FFFFFFFFFFull, 0xC47FFFFF00000FF7ull, 0x3E62FFFFFFFFFFFFull,
+    0x001C07FF38000005ull, 0xFFFF7F7F007E7E7Eull, 0xFFFF03FFF7FFFFFFull, 0x00000007FFFFFFFFull,
+    0xFFFF000FFFFFFFFFull, 0x0FFFFFFFFFFFF87Full, 0xFFFF3FFFFFFFFFFFull, 0x0000000003FFFFFFull,
+    0x5F7FFDFFA0F8007Full, 0xFFFFFFFFFFFFFFDBull, 0x0003FFFFFFFFFFFFull, 0xFFFFFFFFFFF80000ull,
+    0xFFFFFFF03FFFFFFFull, 0x3FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFCFFFFull,
+    0x03FF0000000000FFull, 0x0000000000000000ull, 0xAA8A000000000000ull, 0x1FFFFFFFFFFFFFFFull,
+    0x07FFFFFE00000000ull, 0xFFFFFFC007FFFFFEull, 0x7FFFFFFF3FFFFFFFull, 0x000000001CFCFCFCull,
+    0xB7FFFF7FFFFFEFFFull, 0x000000003FFF3FFFull, 0x07FFFFFFFFFFFFFFull, 0x001FFFFFFFFFFFFFull,
+    0x0000000000000000ull, 0xFFFFFFFF1FFFFFFFull, 0x000000000001FFFFull, 0xFFFFE000FFFFFFFFull,
+    0x003FFFFFFFFF07FFull, 0xFFFFFFFF3FFFFFFFull, 0x00000000003EFF0Full, 0xFFFF00003FFFFFFFull,
+    0x0FFFFFFFFF0FFFFFull, 0xFFFF00FFFFFFFFFFull, 0xF7FF000FFFFFFFFFull, 0x1BFBFFFBFFB7F7FFull,
+    0x007FFFFFFFFFFFFFull, 0x000000FF003FFFFFull, 0x07FDFFFFFFFFFFBFull, 0x91BFFFFFFFFFFD3Full,
+    0x007FFFFF003FFFFFull, 0x000000007FFFFFFFull, 0x0037FFFF00000000ull, 0x03FFFFFF003FFFFFull,
+    0xC0FFFFFFFFFFFFFFull, 0x003FFFFFFEEF0001ull, 0x1FFFFFFF00000000ull, 0x000000001FFFFFFFull,
+    0x0000001FFFFFFEFFull, 0x0007FFFF003FFFFFull, 0x000000000003FFFFull, 0x0007FFFFFFFFFFFFull,
+    0x0000000FFFFFFFFFull, 0x000303FFFFFFFFFFull, 0xFFFF00801FFFFFFFull, 0xFFFF00000000003Full,
+    0xFFFF000000000003ull, 0x007FFFFF0000001Full, 0x00FFFFFFFFFFFFF8ull, 0x0026000000000000ull,
+    0x0000FFFFFFFFFFF8ull, 0x000001FFFFFF0000ull, 0x0000007FFFFFFFF8ull, 0x0047FFFFFFFF0090ull,
+    0x0007FFFFFFFFFFF8ull, 0x000000001400001Eull, 0x00000FFFFFFBFFFFull, 0xFFFF01FFBFFFBD7Full,
+    0x000000007FFFFFFFull, 0x23EDFDFFFFF99FE0ull, 0x00000003E0010000ull, 0x001FFFFFFFFFFFFFull,
+    0x0000000380000780ull, 0x0000FFFFFFFFFFFFull, 0x00000000000000B0ull, 0x00007FFFFFFFFFFFull,
+    0x000000000F000000ull, 0x0000000000000010ull, 0x010007FFFFFFFFFFull, 0x0000000000000000ull,
+    0x0000000007FFFFFFull, 0x000000000000007Full, 0x00000FFFFFFFFFFFull, 0xFFFFFFFF00000000ull,
+    0x80000000FFFFFFFFull, 0x8000FFFFFF6FF27Full, 0x0000000000000002ull, 0xFFFFFCFF00000000ull,
+    0x0000000A0001FFFFull, 0x0407FFFFFFFFF801ull, 0xFFFFFFFFF0010000ull, 0xFFFF0000200003FFull,
+    0x00007FFFFFFFFDFFull, 0xFFFC000000000001ull, 0x000000000000FFFFull, 0x0001FFFFFFFFFB7Full,
+    0xFFFFFDBF00000040ull, 0x00000000010003FFull, 0x0007FFFF00000000ull, 0x0001000000000000ull,
+    0x00007FFFFFFFFFFFull, 0x000000000000000Full, 0x0001FFFFFFFFFFFFull, 0xFFFF00007FFFFFFFull,
+    0x7FFFFFFFFFFFFFFFull, 0x00003FFFFFFF0000ull, 0x0000FFFFFFFFFFFFull, 0xE0FFFFF80000000Full,
+    0x000000000000FFFFull, 0x00000000000107FFull, 0x00000000FFF80000ull, 0x0000000B00000000ull,
+    0x00FFFFFFFFFFFFFFull, 0x00000000003FFFFFull, 0x6FEF000000000000ull, 0x00000007FFFFFFFFull,
+    0xFFFF00F000070000ull, 0x0FFFFFFFFFFFFFFFull, 0x1FFF07FFFFFFFFFFull, 0x0000000003FF01FFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0xFFFFFFFFFFDFFFFFull, 0xEBFFDE64DFFFFFFFull, 0xFFFFFFFFFFFFFFEFull,
+    0x7BFFFFFFDFDFE7BFull, 0xFFFFFFFFFFFDFC5Full, 0xFFFFFF3FFFFFFFFFull, 0xF7FFFFFFF7FFFFFDull,
+    0xFFDFFFFFFFDFFFFFull, 0xFFFF7FFFFFFF7FFFull, 0xFFFFFDFFFFFFFDFFull, 0x0000000000000FF7ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x3F801FFFFFFFFFFFull, 0x0000000000004000ull, 0x00003FFFFFFF0000ull, 0x00000FFFFFFFFFFFull,
+    0x7FFF6F7F00000000ull, 0x000000000000001Full, 0x000000000000080Full, 0x0AF7FE96FFFFFFEFull,
+    0x5EF7F796AA96EA84ull, 0x0FFFFBEE0FFFFBFFull, 0x00000000FFFFFFFFull, 0xFFFF0003FFFFFFFFull,
+    0x00000001FFFFFFFFull, 0x000000003FFFFFFFull, 0x00000000000007FFull, 0x0000000000000000ull,
+};
+
+const uint64_t xidContinueBits[296] = {
+    0x03FF000000000000ull, 0x07FFFFFE87FFFFFEull, 0x04A0040000000000ull, 0xFF7FFFFFFF7FFFFFull,
+    0xFFFFFFFFFFFFFFFFull, 0x0000501F0003FFC3ull, 0xFFFFFFFFFFFFFFFFull, 0xB8DFFFFFFFFFFFFFull,
+    0xFFFFFFFBFFFFD7C0ull, 0xFFBFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFCFBull, 0xFFFEFFFFFFFFFFFFull,
+    0xFFFFFFFF027FFFFFull, 0xBFFFFFFFFFFE01FFull, 0x000787FFFFFF00B6ull, 0xFFFFFFFF07FF0000ull,
+    0xFFFFC3FFFFFFFFFFull, 0x9FFFFDFF9FEFFFFFull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFFE7FFull,
+    0x0003FFFFFFFFFFFFull, 0x243FFFFFFFFFFFFFull, 0x00003FFFFFFFFFFFull, 0xFFFF07FF0FFFFFFFull,
+    0xFFFFFFFFFF007EFFull, 0xFFFFFFFBFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFEFFCFFFFFFFFFull,
+    0xF3C5FDFFFFF99FEFull, 0x5003FFCFB080799Full, 0xD36DFDFFFFF987EEull, 0x003FFFC05E023987ull,
+    0xF3EDFDFFFFFBBFEEull, 0xFE00FFCF00013BBFull, 0xF3EDFDFFFFF99FEEull, 0x0002FFCFB0E0399Full,
+    0xC3FFC718D63DC7ECull, 0x0000FFC000813DC7ull, 0xF3FFFDFFFFFDDFFFull, 0x0000FFCF27603DDFull,
+    0xF3EFFDFFFFFDDFEFull, 0x0006FFCF60603DDFull, 0xFFFFFFFFFFFDDFFFull, 0xFC00FFCF80F07DDFull,
+    0x2FFBFFFFFC7FFFEEull, 0x000CFFC0FF5F847Full, 0x07FFFFFFFFFFFFFEull, 0x0000000003FF7FFFull,
+    0x3FFFFFAFFFFFF7D6ull, 0x00000000F3FF3F5Full, 0xC2A003FF03000001ull, 0xFFFE1FFFFFFFFEFFull,
+    0x1FFFFFFFFEFFFFDFull, 0x0000000000000040ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF03FFull,
+    0xFFFFFFFF3FFFFFFFull, 0xF7FFFFFFFFFF20BFull, 0xFFFFFFFF3D7F3DFFull, 0x7F3DFFFFFFFF3DFFull,
+    0xFFFFFFFFFF7FFF3Dull, 0xFFFFFFFFFF3DFFFFull, 0x0003FE00E7FFFFFFull, 0xFFFFFFFF0000FFFFull,
+    0x3F3FFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xFFFF9FFFFFFFFFFFull, 0xFFFFFFFF07FFFFFEull,
+    0x01FFC7FFFFFFFFFFull, 0x001FFFFF803FFFFFull, 0x000DDFFF000FFFFFull, 0xFFFFFFFFFFFFFFFFull,
+    0x000003FF308FFFFFull, 0xFFFFFFFF03FFB800ull, 0x01FFFFFFFFFFFFFFull, 0xFFFF07FFFFFFFFFFull,
+    0x003FFFFFFFFFFFFFull, 0x0FFF0FFF7FFFFFFFull, 0x001F3FFFFFFFFFC0ull, 0xFFFF0FFFFFFFFFFFull,
+    0x0000000007FF03FFull, 0xFFFFFFFF0FFFFFFFull, 0x9FFFFFFF7FFFFFFFull, 0xBFFF008003FF03FFull,
+    0x0000000000007FFFull, 0xFFFFFFFFFFFFFFFFull, 0x000FF80003FF1FFFull, 0xFFFFFFFFFFFFFFFFull,
+    0x000FFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x3FFFFFFFFFFFE3FFull, 0xE7FFFFFFFFFF01FFull,
+    0x07FFFFFFFFF70000ull, 0xFFFFFFFF3F3FFFFFull, 0x3FFFFFFFAAFF3F3Full, 0x5FDFFFFFFFFFFFFFull,
+    0x1FDC1FFF0FCF1FDCull, 0x8000000000000000ull, 0x8002000000100001ull, 0x000000001FFF0000ull,
+    0x0001FFE21FFF0000ull, 0xF3FFFD503F2FFC84ull, 0xFFFFFFFF000043E0ull, 0x00000000000001FFull,
+    0x0000000000000000ull, 0x000FF81FFFFFFFFFull, 0xFFFF20BFFFFFFFFFull, 0x800080FFFFFFFFFFull,
+    0x7F7F7F7F007FFFFFull, 0xFFFFFFFF7F7F7F7Full, 0x1F3EFFFE000000E0ull, 0xFFFFFFFEE67FFFFFull,
+    0xF7FFFFFFFFFFFFFFull, 0xFFFEFFFFFFFFFFE0ull, 0xFFFFFFFF00007FFFull, 0xFFFF000000000000ull,
+    0x0000000000001FFFull, 0x3FFFFFFFFFFF0000ull, 0x00000FFFFFFF1FFFull, 0xBFF0FFFFFFFFFFFFull,
+    0xFFFFFFFFFFFFFFFFull, 0x0003FFFFFFFFFFFFull, 0xFFFFFFFCFF800000ull, 0xFFFFFFFFFFFFF9FFull,
+    0xFFFC000003EB07FFull, 0x000010FFFFFFFFFFull, 0x000FFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+    0xE8FFFFFF03FF003Full, 0xFFFF3FFFFFFFFFFFull, 0x1FFFFFFF000FFFFFull, 0xFFFFFFFFFFFFFFFFull,
+    0x7FFFFFFF03FF8001ull, 0x007FFFFFFFFFFFFFull, 0xFC7FFFFF03FF3FFFull, 0xFFFFFFFFFFFFFFFFull,
+    0x007CFFFF38000007ull, 0xFFFF7F7F007E7E7Eull, 0xFFFF03FFF7FFFFFFull, 0x03FF37FFFFFFFFFFull,
+    0xFFFF000FFFFFFFFFull, 0x0FFFFFFFFFFFF87Full, 0xFFFF3FFFFFFFFFFFull, 0x0000000003FFFFFFull,
+    0x5F7FFDFFE0F8007Full, 0xFFFFFFFFFFFFFFDBull, 0x0003FFFFFFFFFFFFull, 0xFFFFFFFFFFF80000ull,
+    0xFFFFFFF03FFFFFFFull, 0x3FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0000ull, 0xFFFFFFFFFFFCFFFFull,
+    0x03FF0000000000FFull, 0x0018FFFF0000FFFFull, 0xAA8A00000000E000ull, 0x1FFFFFFFFFFFFFFFull,
+    0x87FFFFFE03FF0000ull, 0xFFFFFFC007FFFFFEull, 0x7FFFFFFFFFFFFFFFull, 0x000000001CFCFCFCull,
+    0xB7FFFF7FFFFFEFFFull, 0x000000003FFF3FFFull, 0x07FFFFFFFFFFFFFFull, 0x001FFFFFFFFFFFFFull,
+    0x2000000000000000ull, 0xFFFFFFFF1FFFFFFFull, 0x000000010001FFFFull, 0xFFFFE000FFFFFFFFull,
+    0x07FFFFFFFFFF07FFull, 0xFFFFFFFF3FFFFFFFull, 0x00000000003EFF0Full, 0xFFFF03FF3FFFFFFFull,
+    0x0FFFFFFFFF0FFFFFull, 0xFFFF00FFFFFFFFFFull, 0xF7FF000FFFFFFFFFull, 0x1BFBFFFBFFB7F7FFull,
+    0x007FFFFFFFFFFFFFull, 0x000000FF003FFFFFull, 0x07FDFFFFFFFFFFBFull, 0x91BFFFFFFFFFFD3Full,
+    0x007FFFFF003FFFFFull, 0x000000007FFFFFFFull, 0x0037FFFF00000000ull, 0x03FFFFFF003FFFFFull,
+    0xC0FFFFFFFFFFFFFFull, 0x873FFFFFFEEFF06Full, 0x1FFFFFFF00000000ull, 0x000000001FFFFFFFull,
+    0x0000007FFFFFFEFFull, 0x0007FFFF003FFFFFull, 0x000000000003FFFFull, 0x0007FFFFFFFFFFFFull,
+    0x03FF00FFFFFFFFFFull, 0x00031BFFFFFFFFFFull, 0xFFFF00801FFFFFFFull, 0xFFFF00000001FFFFull,
+    0xFFFF00000000003Full, 0x007FFFFF0000001Full, 0xFFFFFFFFFFFFFFFFull, 0x803FFFC00000007Full,
+    0x07FFFFFFFFFFFFFFull, 0x03FF01FFFFFF0004ull, 0xFFDFFFFFFFFFFFFFull, 0x004FFFFFFFFF00F0ull,
+    0xFFFFFFFFFFFFFFFFull, 0x0000000017FFDE1Full, 0x40FFFFFFFFFBFFFFull, 0xFFFF01FFBFFFBD7Full,
+    0x03FF07FFFFFFFFFFull, 0xFBEDFDFFFFF99FEFull, 0x001F1FCFE081399Full, 0xFFFFFFFFFFFFFFFFull,
+    0x00000003C3FF07FFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000003FF00BFull, 0xFF3FFFFFFFFFFFFFull,
+    0x000000003F000001ull, 0x0000000003FF0011ull, 0x01FFFFFFFFFFFFFFull, 0x00000000000003FFull,
+    0x03FF0FFFE7FFFFFFull, 0x000000000000007Full, 0x07FFFFFFFFFFFFFFull, 0xFFFFFFFF00000000ull,
+    0x800003FFFFFFFFFFull, 0xF9BFFFFFFF6FF27Full, 0x0000000003FF000Full, 0xFFFFFCFF00000000ull,
+    0x0000001BFCFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFF0080ull, 0xFFFF000023FFFFFFull,
+    0xFF7FFFFFFFFFFDFFull, 0xFFFC000003FF0001ull, 0x007FFEFFFFFCFFFFull, 0xB47FFFFFFFFFFB7Full,
+    0xFFFFFDBF03FF00FFull, 0x000003FF01FB7FFFull, 0x007FFFFF00000000ull, 0x0001000000000000ull,
+    0x00007FFFFFFFFFFFull, 0x000000000000000Full, 0x0001FFFFFFFFFFFFull, 0xFFFF03FF7FFFFFFFull,
+    0x7FFFFFFFFFFFFFFFull, 0x001F3FFFFFFF03FFull, 0x007FFFFFFFFFFFFFull, 0xE0FFFFF803FF000Full,
+    0x000000000000FFFFull, 0xFFFFFFFFFFFF87FFull, 0x00000000FFFF80FFull, 0x0003001B00000000ull,
+    0x00FFFFFFFFFFFFFFull, 0x00000000003FFFFFull, 0x6FEF000000000000ull, 0x00000007FFFFFFFFull,
+    0xFFFF00F000070000ull, 0x0FFFFFFFFFFFFFFFull, 0x1FFF07FFFFFFFFFFull, 0x0000000063FF01FFull,
+    0xFFFF3FFFFFFFFFFFull, 0x000000000000007Full, 0xF807E3E000000000ull, 0x00003C0000000FE7ull,
+    0x000000000000001Cull, 0xFFFFFFFFFFDFFFFFull, 0xEBFFDE64DFFFFFFFull, 0xFFFFFFFFFFFFFFEFull,
+    0x7BFFFFFFDFDFE7BFull, 0xFFFFFFFFFFFDFC5Full, 0xFFFFFF3FFFFFFFFFull, 0xF7FFFFFFF7FFFFFDull,
+    0xFFDFFFFFFFDFFFFFull, 0xFFFF7FFFFFFF7FFFull, 0xFFFFFDFFFFFFFDFFull, 0xFFFFFFFFFFFFCFF7ull,
+    0xF87FFFFFFFFFFFFFull, 0x00201FFFFFFFFFFFull, 0x0000FFFEF8000010ull, 0x000007DBF9FFFF7Full,
+    0x3FFF1FFFFFFFFFFFull, 0x00000000000043FFull, 0x00007FFFFFFF0000ull, 0x03FFFFFFFFFFFFFFull,
+    0x7FFF6F7F00000000ull, 0x00000000007F001Full, 0x0000000003FF0FFFull, 0x0AF7FE96FFFFFFEFull,
+    0x5EF7F796AA96EA84ull, 0x0FFFFBEE0FFFFBFFull, 0x00000000FFFFFFFFull, 0xFFFF0003FFFFFFFFull,
+    0x00000001FFFFFFFFull, 0x000000003FFFFFFFull, 0x00000000000007FFull, 0x0000FFFFFFFFFFFFull,
+};
+
+const size_t normalizationBlockCount = 3049;
+
+const uint8_t normalizationBlockIndex[3049] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0, 0, 0, 4, 0, 0, 0, 5, 6,
+    7, 8, 0, 9, 10, 11, 0, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 19, 25, 26, 27,
+    23, 28, 23, 29, 30, 27, 0, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 41, 0, 0, 42, 43, 44,
+    0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 47,
+    0, 0, 48, 0, 49, 0, 0, 0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 0, 0, 59, 0, 0, 0, 60,
+    0, 0, 0, 0, 0, 61, 62, 63, 64, 0, 0, 65, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 69, 0, 70, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+    72, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 75, 76, 0, 0, 0, 0,
+    77, 0, 0, 78, 79, 80, 81, 82, 0, 0, 83, 84, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 86, 86, 86, 87, 88, 86, 89, 90, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    0, 0, 0, 94, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0,
+    0, 0, 99, 0, 0, 100, 101, 0, 0, 102, 103, 0, 104, 81, 0, 105, 106, 0, 0, 107, 108, 109, 0, 0,
+    0, 110, 111, 112, 0, 0, 113, 114, 70, 0, 115, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 119, 0, 120,
+    121, 122, 123, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 124, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 131, 132, 0, 133, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    134, 0, 0, 0, 127, 0, 0, 0, 0, 0, 135, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 86, 86, 86, 86, 86, 86, 86,
+    139,
+};
+
+const uint16_t normalizationProps[8960] = {
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x0E6, 0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x2E6, 0x0E6, 0x0E6, 0x2E6,
+    0x0E6, 0x2E6, 0x0E6, 0x2E6, 0x2E6, 0x0E8, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E8, 0x2D8, 0x0DC, 0x0DC, 0x0DC, 0x0DC,
+    0x0DC, 0x0CA, 0x0CA, 0x2DC, 0x2DC, 0x2DC, 0x2DC, 0x2CA, 0x2CA, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x2DC, 0x2DC, 0x0DC,
+    0x2DC, 0x2DC, 0x0DC, 0x0DC, 0x001, 0x001, 0x001, 0x001, 0x201, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6,
+    0x1E6, 0x1E6, 0x2E6, 0x1E6, 0x1E6, 0x2F0, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E8, 0x0DC, 0x0DC, 0x0E6, 0x0E9, 0x0EA, 0x0EA, 0x0E9,
+    0x0EA, 0x0EA, 0x0E9, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0DE, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DE, 0x0E4, 0x0E6,
+    0x00A, 0x00B, 0x00C, 0x00D, 0x00E, 0x00F, 0x010, 0x011, 0x012, 0x013, 0x013, 0x014, 0x015, 0x016, 0x000, 0x017,
+    0x000, 0x018, 0x019, 0x000, 0x0E6, 0x0DC, 0x000, 0x012, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x01E, 0x01F, 0x020, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x01B, 0x01C, 0x01D, 0x01E, 0x01F,
+    0x020, 0x021, 0x022, 0x2E6, 0x2E6, 0x2DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DC,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x023, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x000, 0x000, 0x0E6, 0x0E6, 0x000, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x024, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0DC, 0x0DC, 0x0E6, 0x0DC, 0x0E6,
+    0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0DC, 0x0E6, 0x0DC, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x0DC, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC,
+    0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x000, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC,
+    0x01B, 0x01C, 0x01D, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x207, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x200, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x000, 0x100,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x100, 0x000, 0x000, 0x100, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x200, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x054, 0x25B, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x009, 0x000, 0x200, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x209, 0x000, 0x000, 0x000, 0x000, 0x200,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x067, 0x067, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x06B, 0x06B, 0x06B, 0x06B, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x076, 0x076, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07A, 0x07A, 0x07A, 0x07A, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x0DC, 0x000, 0x0D8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000,
+    0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x081, 0x082, 0x100, 0x084, 0x100, 0x100, 0x000, 0x100, 0x000, 0x082, 0x082, 0x082, 0x082, 0x000, 0x000,
+    0x082, 0x100, 0x0E6, 0x0E6, 0x009, 0x000, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000,
+    0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200,
+    0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200,
+    0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200, 0x200,
+    0x200, 0x200, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E4, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DE, 0x0E6, 0x0DC, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x0DC,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x000, 0x0DC,
+    0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x007, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x000, 0x001, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0DC,
+    0x0E6, 0x000, 0x001, 0x001, 0x001, 0x001, 0x001, 0x001, 0x001, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x0E6, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0E6, 0x0EA, 0x0D6, 0x0DC,
+    0x0CA, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E8, 0x0E4, 0x0E4, 0x0DC, 0x0DA, 0x0E6, 0x0E9, 0x0DC, 0x0E6, 0x0DC,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x100, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x100, 0x100,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x100, 0x000, 0x100, 0x000, 0x000,
+    0x100, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x001, 0x001, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x001, 0x001, 0x001, 0x0E6, 0x0E6, 0x000, 0x000, 0x000,
+    0x000, 0x0E6, 0x000, 0x000, 0x000, 0x001, 0x001, 0x0E6, 0x0DC, 0x0E6, 0x001, 0x001, 0x0DC, 0x0DC, 0x0DC, 0x0DC,
+    0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000, 0x100, 0x100, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6,
+    0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DA, 0x0E4, 0x0E8, 0x0DE, 0x0E0, 0x0E0,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x208, 0x208, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x000, 0x0E6, 0x0E6, 0x0DC, 0x000, 0x000, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6,
+    0x000, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x000,
+    0x100, 0x000, 0x100, 0x000, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000,
+    0x100, 0x000, 0x100, 0x000, 0x000, 0x100, 0x100, 0x000, 0x000, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x000,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x01A, 0x100,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x100, 0x000,
+    0x100, 0x100, 0x000, 0x100, 0x100, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x000, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x001, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x009,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0E6, 0x0DC, 0x0DC, 0x0DC,
+    0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x0E6, 0x0DC, 0x0E6, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x207, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x007, 0x007, 0x000, 0x200, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200, 0x000, 0x000, 0x200, 0x000, 0x000,
+    0x000, 0x000, 0x009, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x200,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009,
+    0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x200, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x009, 0x000,
+    0x000, 0x000, 0x000, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x007, 0x000, 0x009, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x009, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x001, 0x001, 0x001, 0x001, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x006, 0x006, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x001, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x0D8, 0x0D8, 0x001, 0x001, 0x001, 0x000, 0x000, 0x000, 0x0E2, 0x0D8, 0x0D8,
+    0x0D8, 0x0D8, 0x0D8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC,
+    0x0DC, 0x0DC, 0x0DC, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0DC, 0x0DC, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x0DC, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x0E6, 0x007, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+    0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+};
+
+const size_t decompositionCount = 2061;
+
+const uint32_t decompositionKeys[2061] = {
+    0x000C0, 0x000C1, 0x000C2, 0x000C3, 0x000C4, 0x000C5, 0x000C7, 0x000C8, 0x000C9, 0x000CA, 0x000CB, 0x000CC,
+    0x000CD, 0x000CE, 0x000CF, 0x000D1, 0x000D2, 0x000D3, 0x000D4, 0x000D5, 0x000D6, 0x000D9, 0x000DA, 0x000DB,
+    0x000DC, 0x000DD, 0x000E0, 0x000E1, 0x000E2, 0x000E3, 0x000E4, 0x000E5, 0x000E7, 0x000E8, 0x000E9, 0x000EA,
+    0x000EB, 0x000EC, 0x000ED, 0x000EE, 0x000EF, 0x000F1, 0x000F2, 0x000F3, 0x000F4, 0x000F5, 0x000F6, 0x000F9,
+    0x000FA, 0x000FB, 0x000FC, 0x000FD, 0x000FF, 0x00100, 0x00101, 0x00102, 0x00103, 0x00104, 0x00105, 0x00106,
+    0x00107, 0x00108, 0x00109, 0x0010A, 0x0010B, 0x0010C, 0x0010D, 0x0010E, 0x0010F, 0x00112, 0x00113, 0x00114,
+    0x00115, 0x00116, 0x00117, 0x00118, 0x00119, 0x0011A, 0x0011B, 0x0011C, 0x0011D, 0x0011E, 0x0011F, 0x00120,
+    0x00121, 0x00122, 0x00123, 0x00124, 0x00125, 0x00128, 0x00129, 0x0012A, 0x0012B, 0x0012C, 0x0012D, 0x0012E,
+    0x0012F, 0x00130, 0x00134, 0x00135, 0x00136, 0x00137, 0x00139, 0x0013A, 0x0013B, 0x0013C, 0x0013D, 0x0013E,
+    0x00143, 0x00144, 0x00145, 0x00146, 0x00147, 0x00148, 0x0014C, 0x0014D, 0x0014E, 0x0014F, 0x00150, 0x00151,
+    0x00154, 0x00155, 0x00156, 0x00157, 0x00158, 0x00159, 0x0015A, 0x0015B, 0x0015C, 0x0015D, 0x0015E, 0x0015F,
+    0x00160, 0x00161, 0x00162, 0x00163, 0x00164, 0x00165, 0x00168, 0x00169, 0x0016A, 0x0016B, 0x0016C, 0x0016D,
+    0x0016E, 0x0016F, 0x00170, 0x00171, 0x00172, 0x00173, 0x00174, 0x00175, 0x00176, 0x00177, 0x00178, 0x00179,
+    0x0017A, 0x0017B, 0x0017C, 0x0017D, 0x0017E, 0x001A0, 0x001A1, 0x001AF, 0x001B0, 0x001CD, 0x001CE, 0x001CF,
+    0x001D0, 0x001D1, 0x001D2, 0x001D3, 0x001D4, 0x001D5, 0x001D6, 0x001D7, 0x001D8, 0x001D9, 0x001DA, 0x001DB,
+    0x001DC, 0x001DE, 0x001DF, 0x001E0, 0x001E1, 0x001E2, 0x001E3, 0x001E6, 0x001E7, 0x001E8, 0x001E9, 0x001EA,
+    0x001EB, 0x001EC, 0x001ED, 0x001EE, 0x001EF, 0x001F0, 0x001F4, 0x001F5, 0x001F8, 0x001F9, 0x001FA, 0x001FB,
+    0x001FC, 0x001FD, 0x001FE, 0x001FF, 0x00200, 0x00201, 0x00202, 0x00203, 0x00204, 0x00205, 0x00206, 0x00207,
+    0x00208, 0x00209, 0x0020A, 0x0020B, 0x0020C, 0x0020D, 0x0020E, 0x0020F, 0x00210, 0x00211, 0x00212, 0x00213,
+    0x00214, 0x00215, 0x00216, 0x00217, 0x00218, 0x00219, 0x0021A, 0x0021B, 0x0021E, 0x0021F, 0x00226, 0x00227,
+    0x00228, 0x00229, 0x0022A, 0x0022B, 0x0022C, 0x0022D, 0x0022E, 0x0022F, 0x00230, 0x00231, 0x00232, 0x00233,
+    0x00340, 0x00341, 0x00343, 0x00344, 0x00374, 0x0037E, 0x00385, 0x00386, 0x00387, 0x00388, 0x00389, 0x0038A,
+    0x0038C, 0x0038E, 0x0038F, 0x00390, 0x003AA, 0x003AB, 0x003AC, 0x003AD, 0x003AE, 0x003AF, 0x003B0, 0x003CA,
+    0x003CB, 0x003CC, 0x003CD, 0x003CE, 0x003D3, 0x003D4, 0x00400, 0x00401, 0x00403, 0x00407, 0x0040C, 0x0040D,
+    0x0040E, 0x00419, 0x00439, 0x00450, 0x00451, 0x00453, 0x00457, 0x0045C, 0x0045D, 0x0045E, 0x00476, 0x00477,
+    0x004C1, 0x004C2, 0x004D0, 0x004D1, 0x004D2, 0x004D3, 0x004D6, 0x004D7, 0x004DA, 0x004DB, 0x004DC, 0x004DD,
+    0x004DE, 0x004DF, 0x004E2, 0x004E3, 0x004E4, 0x004E5, 0x004E6, 0x004E7, 0x004EA, 0x004EB, 0x004EC, 0x004ED,
+    0x004EE, 0x004EF, 0x004F0, 0x004F1, 0x004F2, 0x004F3, 0x004F4, 0x004F5, 0x004F8, 0x004F9, 0x00622, 0x00623,
+    0x00624, 0x00625, 0x00626, 0x006C0, 0x006C2, 0x006D3, 0x00929, 0x00931, 0x00934, 0x00958, 0x00959, 0x0095A,
+    0x0095B, 0x0095C, 0x0095D, 0x0095E, 0x0095F, 0x009CB, 0x009CC, 0x009DC, 0x009DD, 0x009DF, 0x00A33, 0x00A36,
+    0x00A59, 0x00A5A, 0x00A5B, 0x00A5E, 0x00B48, 0x00B4B, 0x00B4C, 0x00B5C, 0x00B5D, 0x00B94, 0x00BCA, 0x00BCB,
+    0x00BCC, 0x00C48, 0x00CC0, 0x00CC7, 0x00CC8, 0x00CCA, 0x00CCB, 0x00D4A, 0x00D4B, 0x00D4C, 0x00DDA, 0x00DDC,
+    0x00DDD, 0x00DDE, 0x00F43, 0x00F4D, 0x00F52, 0x00F57, 0x00F5C, 0x00F69, 0x00F73, 0x00F75, 0x00F76, 0x00F78,
+    0x00F81, 0x00F93, 0x00F9D, 0x00FA2, 0x00FA7, 0x00FAC, 0x00FB9, 0x01026, 0x01B06, 0x01B08, 0x01B0A, 0x01B0C,
+    0x01B0E, 0x01B12, 0x01B3B, 0x01B3D, 0x01B40, 0x01B41, 0x01B43, 0x01E00, 0x01E01, 0x01E02, 0x01E03, 0x01E04,
+    0x01E05, 0x01E06, 0x01E07, 0x01E08, 0x01E09, 0x01E0A, 0x01E0B, 0x01E0C, 0x01E0D, 0x01E0E, 0x01E0F, 0x01E10,
+    0x01E11, 0x01E12, 0x01E13, 0x01E14, 0x01E15, 0x01E16, 0x01E17, 0x01E18, 0x01E19, 0x01E1A, 0x01E1B, 0x01E1C,
+    0x01E1D, 0x01E1E, 0x01E1F, 0x01E20, 0x01E21, 0x01E22, 0x01E23, 0x01E24, 0x01E25, 0x01E26, 0x01E27, 0x01E28,
+    0x01E29, 0x01E2A, 0x01E2B, 0x01E2C, 0x01E2D, 0x01E2E, 0x01E2F, 0x01E30, 0x01E31, 0x01E32, 0x01E33, 0x01E34,
+    0x01E35, 0x01E36, 0x01E37, 0x01E38, 0x01E39, 0x01E3A, 0x01E3B, 0x01E3C, 0x01E3D, 0x01E3E, 0x01E3F, 0x01E40,
+    0x01E41, 0x01E42, 0x01E43, 0x01E44, 0x01E45, 0x01E46, 0x01E47, 0x01E48, 0x01E49, 0x01E4A, 0x01E4B, 0x01E4C,
+    0x01E4D, 0x01E4E, 0x01E4F, 0x01E50, 0x01E51, 0x01E52, 0x01E53, 0x01E54, 0x01E55, 0x01E56, 0x01E57, 0x01E58,
+    0x01E59, 0x01E5A, 0x01E5B, 0x01E5C, 0x01E5D, 0x01E5E, 0x01E5F, 0x01E60, 0x01E61, 0x01E62, 0x01E63, 0x01E64,
+    0x01E65, 0x01E66, 0x01E67, 0x01E68, 0x01E69, 0x01E6A, 0x01E6B, 0x01E6C, 0x01E6D, 0x01E6E, 0x01E6F, 0x01E70,
+    0x01E71, 0x01E72, 0x01E73, 0x01E74, 0x01E75, 0x01E76, 0x01E77, 0x01E78, 0x01E79, 0x01E7A, 0x01E7B, 0x01E7C,
+    0x01E7D, 0x01E7E, 0x01E7F, 0x01E80, 0x01E81, 0x01E82, 0x01E83, 0x01E84, 0x01E85, 0x01E86, 0x01E87, 0x01E88,
+    0x01E89, 0x01E8A, 0x01E8B, 0x01E8C, 0x01E8D, 0x01E8E, 0x01E8F, 0x01E90, 0x01E91, 0x01E92, 0x01E93, 0x01E94,
+    0x01E95, 0x01E96, 0x01E97, 0x01E98, 0x01E99, 0x01E9B, 0x01EA0, 0x01EA1, 0x01EA2, 0x01EA3, 0x01EA4, 0x01EA5,
+    0x01EA6, 0x01EA7, 0x01EA8, 0x01EA9, 0x01EAA, 0x01EAB, 0x01EAC, 0x01EAD, 0x01EAE, 0x01EAF, 0x01EB0, 0x01EB1,
+    0x01EB2, 0x01EB3, 0x01EB4, 0x01EB5, 0x01EB6, 0x01EB7, 0x01EB8, 0x01EB9, 0x01EBA, 0x01EBB, 0x01EBC, 0x01EBD,
+    0x01EBE, 0x01EBF, 0x01EC0, 0x01EC1, 0x01EC2, 0x01EC3, 0x01EC4, 0x01EC5, 0x01EC6, 0x01EC7, 0x01EC8, 0x01EC9,
+    0x01ECA, 0x01ECB, 0x01ECC, 0x01ECD, 0x01ECE, 0x01ECF, 0x01ED0, 0x01ED1, 0x01ED2, 0x01ED3, 0x01ED4, 0x01ED5,
+    0x01ED6, 0x01ED7, 0x01ED8, 0x01ED9, 0x01EDA, 0x01EDB, 0x01EDC, 0x01EDD, 0x01EDE, 0x01EDF, 0x01EE0, 0x01EE1,
+    0x01EE2, 0x01EE3, 0x01EE4, 0x01EE5, 0x01EE6, 0x01EE7, 0x01EE8, 0x01EE9, 0x01EEA, 0x01EEB, 0x01EEC, 0x01EED,
+    0x01EEE, 0x01EEF, 0x01EF0, 0x01EF1, 0x01EF2, 0x01EF3, 0x01EF4, 0x01EF5, 0x01EF6, 0x01EF7, 0x01EF8, 0x01EF9,
+    0x01F00, 0x01F01, 0x01F02, 0x01F03, 0x01F04, 0x01F05, 0x01F06, 0x01F07, 0x01F08, 0x01F09, 0x01F0A, 0x01F0B,
+    0x01F0C, 0x01F0D, 0x01F0E, 0x01F0F, 0x01F10, 0x01F11, 0x01F12, 0x01F13, 0x01F14, 0x01F15, 0x01F18, 0x01F19,
+    0x01F1A, 0x01F1B, 0x01F1C, 0x01F1D, 0x01F20, 0x01F21, 0x01F22, 0x01F23, 0x01F24, 0x01F25, 0x01F26, 0x01F27,
+    0x01F28, 0x01F29, 0x01F2A, 0x01F2B, 0x01F2C, 0x01F2D, 0x01F2E, 0x01F2F, 0x01F30, 0x01F31, 0x01F32, 0x01F33,
+    0x01F34, 0x01F35, 0x01F36, 0x01F37, 0x01F38, 0x01F39, 0x01F3A, 0x01F3B, 0x01F3C, 0x01F3D, 0x01F3E, 0x01F3F,
+    0x01F40, 0x01F41, 0x01F42, 0x01F43, 0x01F44, 0x01F45, 0x01F48, 0x01F49, 0x01F4A, 0x01F4B, 0x01F4C, 0x01F4D,
+    0x01F50, 0x01F51, 0x01F52, 0x01F53, 0x01F54, 0x01F55, 0x01F56, 0x01F57, 0x01F59, 0x01F5B, 0x01F5D, 0x01F5F,
+    0x01F60, 0x01F61, 0x01F62, 0x01F63, 0x01F64, 0x01F65, 0x01F66, 0x01F67, 0x01F68, 0x01F69, 0x01F6A, 0x01F6B,
+    0x01F6C, 0x01F6D, 0x01F6E, 0x01F6F, 0x01F70, 0x01F71, 0x01F72, 0x01F73, 0x01F74, 0x01F75, 0x01F76, 0x01F77,
+    0x01F78, 0x01F79, 0x01F7A, 0x01F7B, 0x01F7C, 0x01F7D, 0x01F80, 0x01F81, 0x01F82, 0x01F83, 0x01F84, 0x01F85,
+    0x01F86, 0x01F87, 0x01F88, 0x01F89, 0x01F8A, 0x01F8B, 0x01F8C, 0x01F8D, 0x01F8E, 0x01F8F, 0x01F90, 0x01F91,
+    0x01F92, 0x01F93, 0x01F94, 0x01F95, 0x01F96, 0x01F97, 0x01F98, 0x01F99, 0x01F9A, 0x01F9B, 0x01F9C, 0x01F9D,
+    0x01F9E, 0x01F9F, 0x01FA0, 0x01FA1, 0x01FA2, 0x01FA3, 0x01FA4, 0x01FA5, 0x01FA6, 0x01FA7, 0x01FA8, 0x01FA9,
+    0x01FAA, 0x01FAB, 0x01FAC, 0x01FAD, 0x01FAE, 0x01FAF, 0x01FB0, 0x01FB1, 0x01FB2, 0x01FB3, 0x01FB4, 0x01FB6,
+    0x01FB7, 0x01FB8, 0x01FB9, 0x01FBA, 0x01FBB, 0x01FBC, 0x01FBE, 0x01FC1, 0x01FC2, 0x01FC3, 0x01FC4, 0x01FC6,
+    0x01FC7, 0x01FC8, 0x01FC9, 0x01FCA, 0x01FCB, 0x01FCC, 0x01FCD, 0x01FCE, 0x01FCF, 0x01FD0, 0x01FD1, 0x01FD2,
+    0x01FD3, 0x01FD6, 0x01FD7, 0x01FD8, 0x01FD9, 0x01FDA, 0x01FDB, 0x01FDD, 0x01FDE, 0x01FDF, 0x01FE0, 0x01FE1,
+    0x01FE2, 0x01FE3, 0x01FE4, 0x01FE5, 0x01FE6, 0x01FE7, 0x01FE8, 0x01FE9, 0x01FEA, 0x01FEB, 0x01FEC, 0x01FED,
+    0x01FEE, 0x01FEF, 0x01FF2, 0x01FF3, 0x01FF4, 0x01FF6, 0x01FF7, 0x01FF8, 0x01FF9, 0x01FFA, 0x01FFB, 0x01FFC,
+    0x01FFD, 0x02000, 0x02001, 0x02126, 0x0212A, 0x0212B, 0x0219A, 0x0219B, 0x021AE, 0x021CD, 0x021CE, 0x021CF,
+    0x02204, 0x02209, 0x0220C, 0x02224, 0x02226, 0x02241, 0x02244, 0x02247, 0x02249, 0x02260, 0x02262, 0x0226D,
+    0x0226E, 0x0226F, 0x02270, 0x02271, 0x02274, 0x02275, 0x02278, 0x02279, 0x02280, 0x02281, 0x02284, 0x02285,
+    0x02288, 0x02289, 0x022AC, 0x022AD, 0x022AE, 0x022AF, 0x022E0, 0x022E1, 0x022E2, 0x022E3, 0x022EA, 0x022EB,
+    0x022EC, 0x022ED, 0x02329, 0x0232A, 0x02ADC, 0x0304C, 0x0304E, 0x03050, 0x03052, 0x03054, 0x03056, 0x03058,
+    0x0305A, 0x0305C, 0x0305E, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071, 0x03073, 0x03074,
+    0x03076, 0x03077, 0x03079, 0x0307A, 0x0307C, 0x0307D, 0x03094, 0x0309E, 0x030AC, 0x030AE, 0x030B0, 0x030B2,
+    0x030B4, 0x030B6, 0x030B8, 0x030BA, 0x030BC, 0x030BE, 0x030C0, 0x030C2, 0x030C5, 0x030C7, 0x030C9, 0x030D0,
+    0x030D1, 0x030D3, 0x030D4, 0x030D6, 0x030D7, 0x030D9, 0x030DA, 0x030DC, 0x030DD, 0x030F4, 0x030F7, 0x030F8,
+    0x030F9, 0x030FA, 0x030FE, 0x0F900, 0x0F901, 0x0F902, 0x0F903, 0x0F904, 0x0F905, 0x0F906, 0x0F907, 0x0F908,
+    0x0F909, 0x0F90A, 0x0F90B, 0x0F90C, 0x0F90D, 0x0F90E, 0x0F90F, 0x0F910, 0x0F911, 0x0F912, 0x0F913, 0x0F914,
+    0x0F915, 0x0F916, 0x0F917, 0x0F918, 0x0F919, 0x0F91A, 0x0F91B, 0x0F91C, 0x0F91D, 0x0F91E, 0x0F91F, 0x0F920,
+    0x0F921, 0x0F922, 0x0F923, 0x0F924, 0x0F925, 0x0F926, 0x0F927, 0x0F928, 0x0F929, 0x0F92A, 0x0F92B, 0x0F92C,
+    0x0F92D, 0x0F92E, 0x0F92F, 0x0F930, 0x0F931, 0x0F932, 0x0F933, 0x0F934, 0x0F935, 0x0F936, 0x0F937, 0x0F938,
+    0x0F939, 0x0F93A, 0x0F93B, 0x0F93C, 0x0F93D, 0x0F93E, 0x0F93F, 0x0F940, 0x0F941, 0x0F942, 0x0F943, 0x0F944,
+    0x0F945, 0x0F946, 0x0F947, 0x0F948, 0x0F949, 0x0F94A, 0x0F94B, 0x0F94C, 0x0F94D, 0x0F94E, 0x0F94F, 0x0F950,
+    0x0F951, 0x0F952, 0x0F953, 0x0F954, 0x0F955, 0x0F956, 0x0F957, 0x0F958, 0x0F959, 0x0F95A, 0x0F95B, 0x0F95C,
+    0x0F95D, 0x0F95E, 0x0F95F, 0x0F960, 0x0F961, 0x0F962, 0x0F963, 0x0F964, 0x0F965, 0x0F966, 0x0F967, 0x0F968,
+    0x0F969, 0x0F96A, 0x0F96B, 0x0F96C, 0x0F96D, 0x0F96E, 0x0F96F, 0x0F970, 0x0F971, 0x0F972, 0x0F973, 0x0F974,
+    0x0F975, 0x0F976, 0x0F977, 0x0F978, 0x0F979, 0x0F97A, 0x0F97B, 0x0F97C, 0x0F97D, 0x0F97E, 0x0F97F, 0x0F980,
+    0x0F981, 0x0F982, 0x0F983, 0x0F984, 0x0F985, 0x0F986, 0x0F987, 0x0F988, 0x0F989, 0x0F98A, 0x0F98B, 0x0F98C,
+    0x0F98D, 0x0F98E, 0x0F98F, 0x0F990, 0x0F991, 0x0F992, 0x0F993, 0x0F994, 0x0F995, 0x0F996, 0x0F997, 0x0F998,
+    0x0F999, 0x0F99A, 0x0F99B, 0x0F99C, 0x0F99D, 0x0F99E, 0x0F99F, 0x0F9A0, 0x0F9A1, 0x0F9A2, 0x0F9A3, 0x0F9A4,
+    0x0F9A5, 0x0F9A6, 0x0F9A7, 0x0F9A8, 0x0F9A9, 0x0F9AA, 0x0F9AB, 0x0F9AC, 0x0F9AD, 0x0F9AE, 0x0F9AF, 0x0F9B0,
+    0x0F9B1, 0x0F9B2, 0x0F9B3, 0x0F9B4, 0x0F9B5, 0x0F9B6, 0x0F9B7, 0x0F9B8, 0x0F9B9, 0x0F9BA, 0x0F9BB, 0x0F9BC,
+    0x0F9BD, 0x0F9BE, 0x0F9BF, 0x0F9C0, 0x0F9C1, 0x0F9C2, 0x0F9C3, 0x0F9C4, 0x0F9C5, 0x0F9C6, 0x0F9C7, 0x0F9C8,
+    0x0F9C9, 0x0F9CA, 0x0F9CB, 0x0F9CC, 0x0F9CD, 0x0F9CE, 0x0F9CF, 0x0F9D0, 0x0F9D1, 0x0F9D2, 0x0F9D3, 0x0F9D4,
+    0x0F9D5, 0x0F9D6, 0x0F9D7, 0x0F9D8, 0x0F9D9, 0x0F9DA, 0x0F9DB, 0x0F9DC, 0x0F9DD, 0x0F9DE, 0x0F9DF, 0x0F9E0,
+    0x0F9E1, 0x0F9E2, 0x0F9E3, 0x0F9E4, 0x0F9E5, 0x0F9E6, 0x0F9E7, 0x0F9E8, 0x0F9E9, 0x0F9EA, 0x0F9EB, 0x0F9EC,
+    0x0F9ED, 0x0F9EE, 0x0F9EF, 0x0F9F0, 0x0F9F1, 0x0F9F2, 0x0F9F3, 0x0F9F4, 0x0F9F5, 0x0F9F6, 0x0F9F7, 0x0F9F8,
+    0x0F9F9, 0x0F9FA, 0x0F9FB, 0x0F9FC, 0x0F9FD, 0x0F9FE, 0x0F9FF, 0x0FA00, 0x0FA01, 0x0FA02, 0x0FA03, 0x0FA04,
+    0x0FA05, 0x0FA06, 0x0FA07, 0x0FA08, 0x0FA09, 0x0FA0A, 0x0FA0B, 0x0FA0C, 0x0FA0D, 0x0FA10, 0x0FA12, 0x0FA15,
+    0x0FA16, 0x0FA17, 0x0FA18, 0x0FA19, 0x0FA1A, 0x0FA1B, 0x0FA1C, 0x0FA1D, 0x0FA1E, 0x0FA20, 0x0FA22, 0x0FA25,
+    0x0FA26, 0x0FA2A, 0x0FA2B, 0x0FA2C, 0x0FA2D, 0x0FA2E, 0x0FA2F, 0x0FA30, 0x0FA31, 0x0FA32, 0x0FA33, 0x0FA34,
+    0x0FA35, 0x0FA36, 0x0FA37, 0x0FA38, 0x0FA39, 0x0FA3A, 0x0FA3B, 0x0FA3C, 0x0FA3D, 0x0FA3E, 0x0FA3F, 0x0FA40,
+    0x0FA41, 0x0FA42, 0x0FA43, 0x0FA44, 0x0FA45, 0x0FA46, 0x0FA47, 0x0FA48, 0x0FA49, 0x0FA4A, 0x0FA4B, 0x0FA4C,
+    0x0FA4D, 0x0FA4E, 0x0FA4F, 0x0FA50, 0x0FA51, 0x0FA52, 0x0FA53, 0x0FA54, 0x0FA55, 0x0FA56, 0x0FA57, 0x0FA58,
+    0x0FA59, 0x0FA5A, 0x0FA5B, 0x0FA5C, 0x0FA5D, 0x0FA5E, 0x0FA5F, 0x0FA60, 0x0FA61, 0x0FA62, 0x0FA63, 0x0FA64,
+    0x0FA65, 0x0FA66, 0x0FA67, 0x0FA68, 0x0FA69, 0x0FA6A, 0x0FA6B, 0x0FA6C, 0x0FA6D, 0x0FA70, 0x0FA71, 0x0FA72,
+    0x0FA73, 0x0FA74, 0x0FA75, 0x0FA76, 0x0FA77, 0x0FA78, 0x0FA79, 0x0FA7A, 0x0FA7B, 0x0FA7C, 0x0FA7D, 0x0FA7E,
+    0x0FA7F, 0x0FA80, 0x0FA81, 0x0FA82, 0x0FA83, 0x0FA84, 0x0FA85, 0x0FA86, 0x0FA87, 0x0FA88, 0x0FA89, 0x0FA8A,
+    0x0FA8B, 0x0FA8C, 0x0FA8D, 0x0FA8E, 0x0FA8F, 0x0FA90, 0x0FA91, 0x0FA92, 0x0FA93, 0x0FA94, 0x0FA95, 0x0FA96,
+    0x0FA97, 0x0FA98, 0x0FA99, 0x0FA9A, 0x0FA9B, 0x0FA9C, 0x0FA9D, 0x0FA9E, 0x0FA9F, 0x0FAA0, 0x0FAA1, 0x0FAA2,
+    0x0FAA3, 0x0FAA4, 0x0FAA5, 0x0FAA6, 0x0FAA7, 0x0FAA8, 0x0FAA9, 0x0FAAA, 0x0FAAB, 0x0FAAC, 0x0FAAD, 0x0FAAE,
+    0x0FAAF, 0x0FAB0, 0x0FAB1, 0x0FAB2, 0x0FAB3, 0x0FAB4, 0x0FAB5, 0x0FAB6, 0x0FAB7, 0x0FAB8, 0x0FAB9, 0x0FABA,
+    0x0FABB, 0x0FABC, 0x0FABD, 0x0FABE, 0x0FABF, 0x0FAC0, 0x0FAC1, 0x0FAC2, 0x0FAC3, 0x0FAC4, 0x0FAC5, 0x0FAC6,
+    0x0FAC7, 0x0FAC8, 0x0FAC9, 0x0FACA, 0x0FACB, 0x0FACC, 0x0FACD, 0x0FACE, 0x0FACF, 0x0FAD0, 0x0FAD1, 0x0FAD2,
+    0x0FAD3, 0x0FAD4, 0x0FAD5, 0x0FAD6, 0x0FAD7, 0x0FAD8, 0x0FAD9, 0x0FB1D, 0x0FB1F, 0x0FB2A, 0x0FB2B, 0x0FB2C,
+    0x0FB2D, 0x0FB2E, 0x0FB2F, 0x0FB30, 0x0FB31, 0x0FB32, 0x0FB33, 0x0FB34, 0x0FB35, 0x0FB36, 0x0FB38, 0x0FB39,
+    0x0FB3A, 0x0FB3B, 0x0FB3C, 0x0FB3E, 0x0FB40, 0x0FB41, 0x0FB43, 0x0FB44, 0x0FB46, 0x0FB47, 0x0FB48, 0x0FB49,
+    0x0FB4A, 0x0FB4B, 0x0FB4C, 0x0FB4D, 0x0FB4E, 0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C,
+    0x114BB, 0x114BC, 0x114BE, 0x115BA, 0x115BB, 0x11938, 0x1D15E, 0x1D15F, 0x1D160, 0x1D161, 0x1D162, 0x1D163,
+    0x1D164, 0x1D1BB, 0x1D1BC, 0x1D1BD, 0x1D1BE, 0x1D1BF, 0x1D1C0, 0x2F800, 0x2F801, 0x2F802, 0x2F803, 0x2F804,
+    0x2F805, 0x2F806, 0x2F807, 0x2F808, 0x2F809, 0x2F80A, 0x2F80B, 0x2F80C, 0x2F80D, 0x2F80E, 0x2F80F, 0x2F810,
+    0x2F811, 0x2F812, 0x2F813, 0x2F814, 0x2F815, 0x2F816, 0x2F817, 0x2F818, 0x2F819, 0x2F81A, 0x2F81B, 0x2F81C,
+    0x2F81D, 0x2F81E, 0x2F81F, 0x2F820, 0x2F821, 0x2F822, 0x2F823, 0x2F824, 0x2F825, 0x2F826, 0x2F827, 0x2F828,
+    0x2F829, 0x2F82A, 0x2F82B, 0x2F82C, 0x2F82D, 0x2F82E, 0x2F82F, 0x2F830, 0x2F831, 0x2F832, 0x2F833, 0x2F834,
+    0x2F835, 0x2F836, 0x2F837, 0x2F838, 0x2F839, 0x2F83A, 0x2F83B, 0x2F83C, 0x2F83D, 0x2F83E, 0x2F83F, 0x2F840,
+    0x2F841, 0x2F842, 0x2F843, 0x2F844, 0x2F845, 0x2F846, 0x2F847, 0x2F848, 0x2F849, 0x2F84A, 0x2F84B, 0x2F84C,
+    0x2F84D, 0x2F84E, 0x2F84F, 0x2F850, 0x2F851, 0x2F852, 0x2F853, 0x2F854, 0x2F855, 0x2F856, 0x2F857, 0x2F858,
+    0x2F859, 0x2F85A, 0x2F85B, 0x2F85C, 0x2F85D, 0x2F85E, 0x2F85F, 0x2F860, 0x2F861, 0x2F862, 0x2F863, 0x2F864,
+    0x2F865, 0x2F866, 0x2F867, 0x2F868, 0x2F869, 0x2F86A, 0x2F86B, 0x2F86C, 0x2F86D, 0x2F86E, 0x2F86F, 0x2F870,
+    0x2F871, 0x2F872, 0x2F873, 0x2F874, 0x2F875, 0x2F876, 0x2F877, 0x2F878, 0x2F879, 0x2F87A, 0x2F87B, 0x2F87C,
+    0x2F87D, 0x2F87E, 0x2F87F, 0x2F880, 0x2F881, 0x2F882, 0x2F883, 0x2F884, 0x2F885, 0x2F886, 0x2F887, 0x2F888,
+    0x2F889, 0x2F88A, 0x2F88B, 0x2F88C, 0x2F88D, 0x2F88E, 0x2F88F, 0x2F890, 0x2F891, 0x2F892, 0x2F893, 0x2F894,
+    0x2F895, 0x2F896, 0x2F897, 0x2F898, 0x2F899, 0x2F89A, 0x2F89B, 0x2F89C, 0x2F89D, 0x2F89E, 0x2F89F, 0x2F8A0,
+    0x2F8A1, 0x2F8A2, 0x2F8A3, 0x2F8A4, 0x2F8A5, 0x2F8A6, 0x2F8A7, 0x2F8A8, 0x2F8A9, 0x2F8AA, 0x2F8AB, 0x2F8AC,
+    0x2F8AD, 0x2F8AE, 0x2F8AF, 0x2F8B0, 0x2F8B1, 0x2F8B2, 0x2F8B3, 0x2F8B4, 0x2F8B5, 0x2F8B6, 0x2F8B7, 0x2F8B8,
+    0x2F8B9, 0x2F8BA, 0x2F8BB, 0x2F8BC, 0x2F8BD, 0x2F8BE, 0x2F8BF, 0x2F8C0, 0x2F8C1, 0x2F8C2, 0x2F8C3, 0x2F8C4,
+    0x2F8C5, 0x2F8C6, 0x2F8C7, 0x2F8C8, 0x2F8C9, 0x2F8CA, 0x2F8CB, 0x2F8CC, 0x2F8CD, 0x2F8CE, 0x2F8CF, 0x2F8D0,
+    0x2F8D1, 0x2F8D2, 0x2F8D3, 0x2F8D4, 0x2F8D5, 0x2F8D6, 0x2F8D7, 0x2F8D8, 0x2F8D9, 0x2F8DA, 0x2F8DB, 0x2F8DC,
+    0x2F8DD, 0x2F8DE, 0x2F8DF, 0x2F8E0, 0x2F8E1, 0x2F8E2, 0x2F8E3, 0x2F8E4, 0x2F8E5, 0x2F8E6, 0x2F8E7, 0x2F8E8,
+    0x2F8E9, 0x2F8EA, 0x2F8EB, 0x2F8EC, 0x2F8ED, 0x2F8EE, 0x2F8EF, 0x2F8F0, 0x2F8F1, 0x2F8F2, 0x2F8F3, 0x2F8F4,
+    0x2F8F5, 0x2F8F6, 0x2F8F7, 0x2F8F8, 0x2F8F9, 0x2F8FA, 0x2F8FB, 0x2F8FC, 0x2F8FD, 0x2F8FE, 0x2F8FF, 0x2F900,
+    0x2F901, 0x2F902, 0x2F903, 0x2F904, 0x2F905, 0x2F906, 0x2F907, 0x2F908, 0x2F909, 0x2F90A, 0x2F90B, 0x2F90C,
+    0x2F90D, 0x2F90E, 0x2F90F, 0x2F910, 0x2F911, 0x2F912, 0x2F913, 0x2F914, 0x2F915, 0x2F916, 0x2F917, 0x2F918,
+    0x2F919, 0x2F91A, 0x2F91B, 0x2F91C, 0x2F91D, 0x2F91E, 0x2F91F, 0x2F920, 0x2F921, 0x2F922, 0x2F923, 0x2F924,
+    0x2F925, 0x2F926, 0x2F927, 0x2F928, 0x2F929, 0x2F92A, 0x2F92B, 0x2F92C, 0x2F92D, 0x2F92E, 0x2F92F, 0x2F930,
+    0x2F931, 0x2F932, 0x2F933, 0x2F934, 0x2F935, 0x2F936, 0x2F937, 0x2F938, 0x2F939, 0x2F93A, 0x2F93B, 0x2F93C,
+    0x2F93D, 0x2F93E, 0x2F93F, 0x2F940, 0x2F941, 0x2F942, 0x2F943, 0x2F944, 0x2F945, 0x2F946, 0x2F947, 0x2F948,
+    0x2F949, 0x2F94A, 0x2F94B, 0x2F94C, 0x2F94D, 0x2F94E, 0x2F94F, 0x2F950, 0x2F951, 0x2F952, 0x2F953, 0x2F954,
+    0x2F955, 0x2F956, 0x2F957, 0x2F958, 0x2F959, 0x2F95A, 0x2F95B, 0x2F95C, 0x2F95D, 0x2F95E, 0x2F95F, 0x2F960,
+    0x2F961, 0x2F962, 0x2F963, 0x2F964, 0x2F965, 0x2F966, 0x2F967, 0x2F968, 0x2F969, 0x2F96A, 0x2F96B, 0x2F96C,
+    0x2F96D, 0x2F96E, 0x2F96F, 0x2F970, 0x2F971, 0x2F972, 0x2F973, 0x2F974, 0x2F975, 0x2F976, 0x2F977, 0x2F978,
+    0x2F979, 0x2F97A, 0x2F97B, 0x2F97C, 0x2F97D, 0x2F97E, 0x2F97F, 0x2F980, 0x2F981, 0x2F982, 0x2F983, 0x2F984,
+    0x2F985, 0x2F986, 0x2F987, 0x2F988, 0x2F989, 0x2F98A, 0x2F98B, 0x2F98C, 0x2F98D, 0x2F98E, 0x2F98F, 0x2F990,
+    0x2F991, 0x2F992, 0x2F993, 0x2F994, 0x2F995, 0x2F996, 0x2F997, 0x2F998, 0x2F999, 0x2F99A, 0x2F99B, 0x2F99C,
+    0x2F99D, 0x2F99E, 0x2F99F, 0x2F9A0, 0x2F9A1, 0x2F9A2, 0x2F9A3, 0x2F9A4, 0x2F9A5, 0x2F9A6, 0x2F9A7, 0x2F9A8,
+    0x2F9A9, 0x2F9AA, 0x2F9AB, 0x2F9AC, 0x2F9AD, 0x2F9AE, 0x2F9AF, 0x2F9B0, 0x2F9B1, 0x2F9B2, 0x2F9B3, 0x2F9B4,
+    0x2F9B5, 0x2F9B6, 0x2F9B7, 0x2F9B8, 0x2F9B9, 0x2F9BA, 0x2F9BB, 0x2F9BC, 0x2F9BD, 0x2F9BE, 0x2F9BF, 0x2F9C0,
+    0x2F9C1, 0x2F9C2, 0x2F9C3, 0x2F9C4, 0x2F9C5, 0x2F9C6, 0x2F9C7, 0x2F9C8, 0x2F9C9, 0x2F9CA, 0x2F9CB, 0x2F9CC,
+    0x2F9CD, 0x2F9CE, 0x2F9CF, 0x2F9D0, 0x2F9D1, 0x2F9D2, 0x2F9D3, 0x2F9D4, 0x2F9D5, 0x2F9D6, 0x2F9D7, 0x2F9D8,
+    0x2F9D9, 0x2F9DA, 0x2F9DB, 0x2F9DC, 0x2F9DD, 0x2F9DE, 0x2F9DF, 0x2F9E0, 0x2F9E1, 0x2F9E2, 0x2F9E3, 0x2F9E4,
+    0x2F9E5, 0x2F9E6, 0x2F9E7, 0x2F9E8, 0x2F9E9, 0x2F9EA, 0x2F9EB, 0x2F9EC, 0x2F9ED, 0x2F9EE, 0x2F9EF, 0x2F9F0,
+    0x2F9F1, 0x2F9F2, 0x2F9F3, 0x2F9F4, 0x2F9F5, 0x2F9F6, 0x2F9F7, 0x2F9F8, 0x2F9F9, 0x2F9FA, 0x2F9FB, 0x2F9FC,
+    0x2F9FD, 0x2F9FE, 0x2F9FF, 0x2FA00, 0x2FA01, 0x2FA02, 0x2FA03, 0x2FA04, 0x2FA05, 0x2FA06, 0x2FA07, 0x2FA08,
+    0x2FA09, 0x2FA0A, 0x2FA0B, 0x2FA0C, 0x2FA0D, 0x2FA0E, 0x2FA0F, 0x2FA10, 0x2FA11, 0x2FA12, 0x2FA13, 0x2FA14,
+    0x2FA15, 0x2FA16, 0x2FA17, 0x2FA18, 0x2FA19, 0x2FA1A, 0x2FA1B, 0x2FA1C, 0x2FA1D,
+};
+
+//Each entry is the offset into `decompositionData` shifted up by 8, and the length in the low byte
+const uint32_t decompositionRanges[2061] = {
+    0x000002, 0x000202, 0x000402, 0x000602, 0x000802, 0x000A02, 0x000C02, 0x000E02, 0x001002, 0x001202, 0x001402, 0x001602,
+    0x001802, 0x001A02, 0x001C02, 0x001E02, 0x002002, 0x002202, 0x002402, 0x002602, 0x002802, 0x002A02, 0x002C02, 0x002E02,
+    0x003002, 0x003202, 0x003402, 0x003602, 0x003802, 0x003A02, 0x003C02, 0x003E02, 0x004002, 0x004202, 0x004402, 0x004602,
+    0x004802, 0x004A02, 0x004C02, 0x004E02, 0x005002, 0x005202, 0x005402, 0x005602, 0x005802, 0x005A02, 0x005C02, 0x005E02,
+    0x006002, 0x006202, 0x006402, 0x006602, 0x006802, 0x006A02, 0x006C02, 0x006E02, 0x007002, 0x007202, 0x007402, 0x007602,
+    0x007802, 0x007A02, 0x007C02, 0x007E02, 0x008002, 0x008202, 0x008402, 0x008602, 0x008802, 0x008A02, 0x008C02, 0x008E02,
+    0x009002, 0x009202, 0x009402, 0x009602, 0x009802, 0x009A02, 0x009C02, 0x009E02, 0x00A002, 0x00A202, 0x00A402, 0x00A602,
+    0x00A802, 0x00AA02, 0x00AC02, 0x00AE02, 0x00B002, 0x00B202, 0x00B402, 0x00B602, 0x00B802, 0x00BA02, 0x00BC02, 0x00BE02,
+    0x00C002, 0x00C202, 0x00C402, 0x00C602, 0x00C802, 0x00CA02, 0x00CC02, 0x00CE02, 0x00D002, 0x00D202, 0x00D402, 0x00D602,
+    0x00D802, 0x00DA02, 0x00DC02, 0x00DE02, 0x00E002, 0x00E202, 0x00E402, 0x00E602, 0x00E802, 0x00EA02, 0x00EC02, 0x00EE02,
+    0x00F002, 0x00F202, 0x00F402, 0x00F602, 0x00F802, 0x00FA02, 0x00FC02, 0x00FE02, 0x010002, 0x010202, 0x010402, 0x010602,
+    0x010802, 0x010A02, 0x010C02, 0x010E02, 0x011002, 0x011202, 0x011402, 0x011602, 0x011802, 0x011A02, 0x011C02, 0x011E02,
+    0x012002, 0x012202, 0x012402, 0x012602, 0x012802, 0x012A02, 0x012C02, 0x012E02, 0x013002, 0x013202, 0x013402, 0x013602,
+    0x013802, 0x013A02, 0x013C02, 0x013E02, 0x014002, 0x014202, 0x014402, 0x014602, 0x014802, 0x014A02, 0x014C02, 0x014E02,
+    0x015002, 0x015202, 0x015402, 0x015602, 0x015802, 0x015A03, 0x015D03, 0x016003, 0x016303, 0x016603, 0x016903, 0x016C03,
+    0x016F03, 0x017203, 0x017503, 0x017803, 0x017B03, 0x017E02, 0x018002, 0x018202, 0x018402, 0x018602, 0x018802, 0x018A02,
+    0x018C02, 0x018E03, 0x019103, 0x019402, 0x019602, 0x019802, 0x019A02, 0x019C02, 0x019E02, 0x01A002, 0x01A203, 0x01A503,
+    0x01A802, 0x01AA02, 0x01AC02, 0x01AE02, 0x01B002, 0x01B202, 0x01B402, 0x01B602, 0x01B802, 0x01BA02, 0x01BC02, 0x01BE02,
+    0x01C002, 0x01C202, 0x01C402, 0x01C602, 0x01C802, 0x01CA02, 0x01CC02, 0x01CE02, 0x01D002, 0x01D202, 0x01D402, 0x01D602,
+    0x01D802, 0x01DA02, 0x01DC02, 0x01DE02, 0x01E002, 0x01E202, 0x01E402, 0x01E602, 0x01E802, 0x01EA02, 0x01EC02, 0x01EE02,
+    0x01F002, 0x01F202, 0x01F403, 0x01F703, 0x01FA03, 0x01FD03, 0x020002, 0x020202, 0x020403, 0x020703, 0x020A02, 0x020C02,
+    0x020E01, 0x020F01, 0x021001, 0x021102, 0x021301, 0x021401, 0x021502, 0x021702, 0x021901, 0x021A02, 0x021C02, 0x021E02,
+    0x022002, 0x022202, 0x022402, 0x022603, 0x022902, 0x022B02, 0x022D02, 0x022F02, 0x023102, 0x023302, 0x023503, 0x023802,
+    0x023A02, 0x023C02, 0x023E02, 0x024002, 0x024202, 0x024402, 0x024602, 0x024802, 0x024A02, 0x024C02, 0x024E02, 0x025002,
+    0x025202, 0x025402, 0x025602, 0x025802, 0x025A02, 0x025C02, 0x025E02, 0x026002, 0x026202, 0x026402, 0x026602, 0x026802,
+    0x026A02, 0x026C02, 0x026E02, 0x027002, 0x027202, 0x027402, 0x027602, 0x027802, 0x027A02, 0x027C02, 0x027E02, 0x028002,
+    0x028202, 0x028402, 0x028602, 0x028802, 0x028A02, 0x028C02, 0x028E02, 0x029002, 0x029202, 0x029402, 0x029602, 0x029802,
+    0x029A02, 0x029C02, 0x029E02, 0x02A002, 0x02A202, 0x02A402, 0x02A602, 0x02A802, 0x02AA02, 0x02AC02, 0x02AE02, 0x02B002,
+    0x02B202, 0x02B402, 0x02B602, 0x02B802, 0x02BA02, 0x02BC02, 0x02BE02, 0x02C002, 0x02C202, 0x02C402, 0x02C602, 0x02C802,
+    0x02CA02, 0x02CC02, 0x02CE02, 0x02D002, 0x02D202, 0x02D402, 0x02D602, 0x02D802, 0x02DA02, 0x02DC02, 0x02DE02, 0x02E002,
+    0x02E202, 0x02E402, 0x02E602, 0x02E802, 0x02EA02, 0x02EC02, 0x02EE02, 0x02F002, 0x02F202, 0x02F402, 0x02F602, 0x02F802,
+    0x02FA02, 0x02FC02, 0x02FE02, 0x030002, 0x030202, 0x030402, 0x030603, 0x030902, 0x030B02, 0x030D02, 0x030F02, 0x031102,
+    0x031303, 0x031602, 0x031802, 0x031A02, 0x031C02, 0x031E02, 0x032002, 0x032202, 0x032402, 0x032602, 0x032802, 0x032A02,
+    0x032C02, 0x032E02, 0x033002, 0x033202, 0x033402, 0x033602, 0x033802, 0x033A02, 0x033C02, 0x033E02, 0x034002, 0x034202,
+    0x034402, 0x034602, 0x034802, 0x034A02, 0x034C02, 0x034E02, 0x035002, 0x035202, 0x035402, 0x035602, 0x035802, 0x035A02,
+    0x035C02, 0x035E02, 0x036002, 0x036203, 0x036503, 0x036802, 0x036A02, 0x036C02, 0x036E02, 0x037002, 0x037202, 0x037402,
+    0x037602, 0x037802, 0x037A02, 0x037C03, 0x037F03, 0x038203, 0x038503, 0x038802, 0x038A02, 0x038C02, 0x038E02, 0x039003,
+    0x039303, 0x039602, 0x039802, 0x039A02, 0x039C02, 0x039E02, 0x03A002, 0x03A202, 0x03A402, 0x03A602, 0x03A802, 0x03AA02,
+    0x03AC02, 0x03AE02, 0x03B002, 0x03B202, 0x03B402, 0x03B603, 0x03B903, 0x03BC02, 0x03BE02, 0x03C002, 0x03C202, 0x03C402,
+    0x03C602, 0x03C802, 0x03CA02, 0x03CC03, 0x03CF03, 0x03D202, 0x03D402, 0x03D602, 0x03D802, 0x03DA02, 0x03DC02, 0x03DE02,
+    0x03E002, 0x03E202, 0x03E402, 0x03E602, 0x03E802, 0x03EA02, 0x03EC02, 0x03EE02, 0x03F002, 0x03F202, 0x03F402, 0x03F603,
+    0x03F903, 0x03FC03, 0x03FF03, 0x040203, 0x040503, 0x040803, 0x040B03, 0x040E02, 0x041002, 0x041202, 0x041402, 0x041602,
+    0x041802, 0x041A02, 0x041C02, 0x041E03, 0x042103, 0x042402, 0x042602, 0x042802, 0x042A02, 0x042C02, 0x042E02, 0x043003,
+    0x043303, 0x043603, 0x043903, 0x043C03, 0x043F03, 0x044202, 0x044402, 0x044602, 0x044802, 0x044A02, 0x044C02, 0x044E02,
+    0x045002, 0x045202, 0x045402, 0x045602, 0x045802, 0x045A02, 0x045C02, 0x045E03, 0x046103, 0x046403, 0x046703, 0x046A02,
+    0x046C02, 0x046E02, 0x047002, 0x047202, 0x047402, 0x047602, 0x047802, 0x047A02, 0x047C02, 0x047E02, 0x048002, 0x048202,
+    0x048402, 0x048602, 0x048802, 0x048A02, 0x048C02, 0x048E02, 0x049002, 0x049202, 0x049402, 0x049602, 0x049802, 0x049A02,
+    0x049C02, 0x049E02, 0x04A002, 0x04A202, 0x04A402, 0x04A602, 0x04A802, 0x04AA02, 0x04AC02, 0x04AE02, 0x04B003, 0x04B303,
+    0x04B603, 0x04B903, 0x04BC03, 0x04BF03, 0x04C203, 0x04C503, 0x04C803, 0x04CB03, 0x04CE03, 0x04D103, 0x04D403, 0x04D703,
+    0x04DA03, 0x04DD03, 0x04E003, 0x04E303, 0x04E603, 0x04E903, 0x04EC02, 0x04EE02, 0x04F002, 0x04F202, 0x04F402, 0x04F602,
+    0x04F803, 0x04FB03, 0x04FE03, 0x050103, 0x050403, 0x050703, 0x050A03, 0x050D03, 0x051003, 0x051303, 0x051602, 0x051802,
+    0x051A02, 0x051C02, 0x051E02, 0x052002, 0x052202, 0x052402, 0x052603, 0x052903, 0x052C03, 0x052F03, 0x053203, 0x053503,
+    0x053803, 0x053B03, 0x053E03, 0x054103, 0x054403, 0x054703, 0x054A03, 0x054D03, 0x055003, 0x055303, 0x055603, 0x055903,
+    0x055C03, 0x055F03, 0x056202, 0x056402, 0x056602, 0x056802, 0x056A03, 0x056D03, 0x057003, 0x057303, 0x057603, 0x057903,
+    0x057C03, 0x057F03, 0x058203, 0x058503, 0x058802, 0x058A02, 0x058C02, 0x058E02, 0x059002, 0x059202, 0x059402, 0x059602,
+    0x059802, 0x059A02, 0x059C03, 0x059F03, 0x05A203, 0x05A503, 0x05A803, 0x05AB03, 0x05AE02, 0x05B002, 0x05B203, 0x05B503,
+    0x05B803, 0x05BB03, 0x05BE03, 0x05C103, 0x05C402, 0x05C602, 0x05C803, 0x05CB03, 0x05CE03, 0x05D103, 0x05D402, 0x05D602,
+    0x05D803, 0x05DB03, 0x05DE03, 0x05E103, 0x05E402, 0x05E602, 0x05E803, 0x05EB03, 0x05EE03, 0x05F103, 0x05F403, 0x05F703,
+    0x05FA02, 0x05FC02, 0x05FE03, 0x060103, 0x060403, 0x060703, 0x060A03, 0x060D03, 0x061002, 0x061202, 0x061403, 0x061703,
+    0x061A03, 0x061D03, 0x062003, 0x062303, 0x062602, 0x062802, 0x062A03, 0x062D03, 0x063003, 0x063303, 0x063603, 0x063903,
+    0x063C02, 0x063E02, 0x064003, 0x064303, 0x064603, 0x064903, 0x064C02, 0x064E02, 0x065003, 0x065303, 0x065603, 0x065903,
+    0x065C02, 0x065E02, 0x066003, 0x066303, 0x066603, 0x066903, 0x066C03, 0x066F03, 0x067202, 0x067403, 0x067703, 0x067A03,
+    0x067D02, 0x067F02, 0x068103, 0x068403, 0x068703, 0x068A03, 0x068D03, 0x069003, 0x069302, 0x069502, 0x069703, 0x069A03,
+    0x069D03, 0x06A003, 0x06A303, 0x06A603, 0x06A902, 0x06AB02, 0x06AD02, 0x06AF02, 0x06B102, 0x06B302, 0x06B502, 0x06B702,
+    0x06B902, 0x06BB02, 0x06BD02, 0x06BF02, 0x06C102, 0x06C302, 0x06C503, 0x06C803, 0x06CB04, 0x06CF04, 0x06D304, 0x06D704,
+    0x06DB04, 0x06DF04, 0x06E303, 0x06E603, 0x06E904, 0x06ED04, 0x06F104, 0x06F504, 0x06F904, 0x06FD04, 0x070103, 0x070403,
+    0x070704, 0x070B04, 0x070F04, 0x071304, 0x071704, 0x071B04, 0x071F03, 0x072203, 0x072504, 0x072904, 0x072D04, 0x073104,
+    0x073504, 0x073904, 0x073D03, 0x074003, 0x074304, 0x074704, 0x074B04, 0x074F04, 0x075304, 0x075704, 0x075B03, 0x075E03,
+    0x076104, 0x076504, 0x076904, 0x076D04, 0x077104, 0x077504, 0x077902, 0x077B02, 0x077D03, 0x078002, 0x078203, 0x078502,
+    0x078703, 0x078A02, 0x078C02, 0x078E02, 0x079002, 0x079202, 0x079401, 0x079502, 0x079703, 0x079A02, 0x079C03, 0x079F02,
+    0x07A103, 0x07A402, 0x07A602, 0x07A802, 0x07AA02, 0x07AC02, 0x07AE02, 0x07B002, 0x07B202, 0x07B402, 0x07B602, 0x07B803,
+    0x07BB03, 0x07BE02, 0x07C003, 0x07C302, 0x07C502, 0x07C702, 0x07C902, 0x07CB02, 0x07CD02, 0x07CF02, 0x07D102, 0x07D302,
+    0x07D503, 0x07D803, 0x07DB02, 0x07DD02, 0x07DF02, 0x07E103, 0x07E402, 0x07E602, 0x07E802, 0x07EA02, 0x07EC02, 0x07EE02,
+    0x07F002, 0x07F201, 0x07F303, 0x07F602, 0x07F803, 0x07FB02, 0x07FD03, 0x080002, 0x080202, 0x080402, 0x080602, 0x080802,
+    0x080A01, 0x080B01, 0x080C01, 0x080D01, 0x080E01, 0x080F02, 0x081102, 0x081302, 0x081502, 0x081702, 0x081902, 0x081B02,
+    0x081D02, 0x081F02, 0x082102, 0x082302, 0x082502, 0x082702, 0x082902, 0x082B02, 0x082D02, 0x082F02, 0x083102, 0x083302,
+    0x083502, 0x083702, 0x083902, 0x083B02, 0x083D02, 0x083F02, 0x084102, 0x084302, 0x084502, 0x084702, 0x084902, 0x084B02,
+    0x084D02, 0x084F02, 0x085102, 0x085302, 0x085502, 0x085702, 0x085902, 0x085B02, 0x085D02, 0x085F02, 0x086102, 0x086302,
+    0x086502, 0x086702, 0x086901, 0x086A01, 0x086B02, 0x086D02, 0x086F02, 0x087102, 0x087302, 0x087502, 0x087702, 0x087902,
+    0x087B02, 0x087D02, 0x087F02, 0x088102, 0x088302, 0x088502, 0x088702, 0x088902, 0x088B02, 0x088D02, 0x088F02, 0x089102,
+    0x089302, 0x089502, 0x089702, 0x089902, 0x089B02, 0x089D02, 0x089F02, 0x08A102, 0x08A302, 0x08A502, 0x08A702, 0x08A902,
+    0x08AB02, 0x08AD02, 0x08AF02, 0x08B102, 0x08B302, 0x08B502, 0x08B702, 0x08B902, 0x08BB02, 0x08BD02, 0x08BF02, 0x08C102,
+    0x08C302, 0x08C502, 0x08C702, 0x08C902, 0x08CB02, 0x08CD02, 0x08CF02, 0x08D102, 0x08D302, 0x08D502, 0x08D702, 0x08D902,
+    0x08DB02, 0x08DD02, 0x08DF02, 0x08E101, 0x08E201, 0x08E301, 0x08E401, 0x08E501, 0x08E601, 0x08E701, 0x08E801, 0x08E901,
+    0x08EA01, 0x08EB01, 0x08EC01, 0x08ED01, 0x08EE01, 0x08EF01, 0x08F001, 0x08F101, 0x08F201, 0x08F301, 0x08F401, 0x08F501,
+    0x08F601, 0x08F701, 0x08F801, 0x08F901, 0x08FA01, 0x08FB01, 0x08FC01, 0x08FD01, 0x08FE01, 0x08FF01, 0x090001, 0x090101,
+    0x090201, 0x090301, 0x090401, 0x090501, 0x090601, 0x090701, 0x090801, 0x090901, 0x090A01, 0x090B01, 0x090C01, 0x090D01,
+    0x090E01, 0x090F01, 0x091001, 0x091101, 0x091201, 0x091301, 0x091401, 0x091501, 0x091601, 0x091701, 0x091801, 0x091901,
+    0x091A01, 0x091B01, 0x091C01, 0x091D01, 0x091E01, 0x091F01, 0x092001, 0x092101, 0x092201, 0x092301, 0x092401, 0x092501,
+    0x092601, 0x092701, 0x092801, 0x092901, 0x092A01, 0x092B01, 0x092C01, 0x092D01, 0x092E01, 0x092F01, 0x093001, 0x093101,
+    0x093201, 0x093301, 0x093401, 0x093501, 0x093601, 0x093701, 0x093801, 0x093901, 0x093A01, 0x093B01, 0x093C01, 0x093D01,
+    0x093E01, 0x093F01, 0x094001, 0x094101, 0x094201, 0x094301, 0x094401, 0x094501, 0x094601, 0x094701, 0x094801, 0x094901,
+    0x094A01, 0x094B01, 0x094C01, 0x094D01, 0x094E01, 0x094F01, 0x095001, 0x095101, 0x095201, 0x095301, 0x095401, 0x095501,
+    0x095601, 0x095701, 0x095801, 0x095901, 0x095A01, 0x095B01, 0x095C01, 0x095D01, 0x095E01, 0x095F01, 0x096001, 0x096101,
+    0x096201, 0x096301, 0x096401, 0x096501, 0x096601, 0x096701, 0x096801, 0x096901, 0x096A01, 0x096B01, 0x096C01, 0x096D01,
+    0x096E01, 0x096F01, 0x097001, 0x097101, 0x097201, 0x097301, 0x097401, 0x097501, 0x097601, 0x097701, 0x097801, 0x097901,
+    0x097A01, 0x097B01, 0x097C01, 0x097D01, 0x097E01, 0x097F01, 0x098001, 0x098101, 0x098201, 0x098301, 0x098401, 0x098501,
+    0x098601, 0x098701, 0x098801, 0x098901, 0x098A01, 0x098B01, 0x098C01, 0x098D01, 0x098E01, 0x098F01, 0x099001, 0x099101,
+    0x099201, 0x099301, 0x099401, 0x099501, 0x099601, 0x099701, 0x099801, 0x099901, 0x099A01, 0x099B01, 0x099C01, 0x099D01,
+    0x099E01, 0x099F01, 0x09A001, 0x09A101, 0x09A201, 0x09A301, 0x09A401, 0x09A501, 0x09A601, 0x09A701, 0x09A801, 0x09A901,
+    0x09AA01, 0x09AB01, 0x09AC01, 0x09AD01, 0x09AE01, 0x09AF01, 0x09B001, 0x09B101, 0x09B201, 0x09B301, 0x09B401, 0x09B501,
+    0x09B601, 0x09B701, 0x09B801, 0x09B901, 0x09BA01, 0x09BB01, 0x09BC01, 0x09BD01, 0x09BE01, 0x09BF01, 0x09C001, 0x09C101,
+    0x09C201, 0x09C301, 0x09C401, 0x09C501, 0x09C601, 0x09C701, 0x09C801, 0x09C901, 0x09CA01, 0x09CB01, 0x09CC01, 0x09CD01,
+    0x09CE01, 0x09CF01, 0x09D001, 0x09D101, 0x09D201, 0x09D301, 0x09D401, 0x09D501, 0x09D601, 0x09D701, 0x09D801, 0x09D901,
+    0x09DA01, 0x09DB01, 0x09DC01, 0x09DD01, 0x09DE01, 0x09DF01, 0x09E001, 0x09E101, 0x09E201, 0x09E301, 0x09E401, 0x09E501,
+    0x09E601, 0x09E701, 0x09E801, 0x09E901, 0x09EA01, 0x09EB01, 0x09EC01, 0x09ED01, 0x09EE01, 0x09EF01, 0x09F001, 0x09F101,
+    0x09F201, 0x09F301, 0x09F401, 0x09F501, 0x09F601, 0x09F701, 0x09F801, 0x09F901, 0x09FA01, 0x09FB01, 0x09FC01, 0x09FD01,
+    0x09FE01, 0x09FF01, 0x0A0001, 0x0A0101, 0x0A0201, 0x0A0301, 0x0A0401, 0x0A0501, 0x0A0601, 0x0A0701, 0x0A0801, 0x0A0901,
+    0x0A0A01, 0x0A0B01, 0x0A0C01, 0x0A0D01, 0x0A0E01, 0x0A0F01, 0x0A1001, 0x0A1101, 0x0A1201, 0x0A1301, 0x0A1401, 0x0A1501,
+    0x0A1601, 0x0A1701, 0x0A1801, 0x0A1901, 0x0A1A01, 0x0A1B01, 0x0A1C01, 0x0A1D01, 0x0A1E01, 0x0A1F01, 0x0A2001, 0x0A2101,
+    0x0A2201, 0x0A2301, 0x0A2401, 0x0A2501, 0x0A2601, 0x0A2701, 0x0A2801, 0x0A2901, 0x0A2A01, 0x0A2B01, 0x0A2C01, 0x0A2D01,
+    0x0A2E01, 0x0A2F01, 0x0A3001, 0x0A3101, 0x0A3201, 0x0A3301, 0x0A3401, 0x0A3501, 0x0A3601, 0x0A3701, 0x0A3801, 0x0A3901,
+    0x0A3A01, 0x0A3B01, 0x0A3C01, 0x0A3D01, 0x0A3E01, 0x0A3F01, 0x0A4001, 0x0A4101, 0x0A4201, 0x0A4301, 0x0A4401, 0x0A4501,
+    0x0A4601, 0x0A4701, 0x0A4801, 0x0A4901, 0x0A4A01, 0x0A4B01, 0x0A4C01, 0x0A4D01, 0x0A4E01, 0x0A4F01, 0x0A5001, 0x0A5101,
+    0x0A5201, 0x0A5301, 0x0A5401, 0x0A5501, 0x0A5601, 0x0A5701, 0x0A5801, 0x0A5901, 0x0A5A01, 0x0A5B01, 0x0A5C01, 0x0A5D01,
+    0x0A5E01, 0x0A5F01, 0x0A6001, 0x0A6101, 0x0A6201, 0x0A6301, 0x0A6401, 0x0A6501, 0x0A6601, 0x0A6701, 0x0A6801, 0x0A6901,
+    0x0A6A01, 0x0A6B01, 0x0A6C01, 0x0A6D01, 0x0A6E01, 0x0A6F01, 0x0A7001, 0x0A7101, 0x0A7201, 0x0A7301, 0x0A7401, 0x0A7501,
+    0x0A7601, 0x0A7701, 0x0A7801, 0x0A7901, 0x0A7A01, 0x0A7B01, 0x0A7C01, 0x0A7D01, 0x0A7E01, 0x0A7F01, 0x0A8001, 0x0A8101,
+    0x0A8201, 0x0A8301, 0x0A8401, 0x0A8501, 0x0A8601, 0x0A8701, 0x0A8801, 0x0A8901, 0x0A8A01, 0x0A8B01, 0x0A8C01, 0x0A8D01,
+    0x0A8E01, 0x0A8F01, 0x0A9001, 0x0A9101, 0x0A9201, 0x0A9301, 0x0A9401, 0x0A9501, 0x0A9601, 0x0A9701, 0x0A9801, 0x0A9901,
+    0x0A9A01, 0x0A9B01, 0x0A9C01, 0x0A9D01, 0x0A9E01, 0x0A9F01, 0x0AA001, 0x0AA101, 0x0AA201, 0x0AA301, 0x0AA401, 0x0AA501,
+    0x0AA601, 0x0AA701, 0x0AA801, 0x0AA901, 0x0AAA01, 0x0AAB01, 0x0AAC01, 0x0AAD02, 0x0AAF02, 0x0AB102, 0x0AB302, 0x0AB503,
+    0x0AB803, 0x0ABB02, 0x0ABD02, 0x0ABF02, 0x0AC102, 0x0AC302, 0x0AC502, 0x0AC702, 0x0AC902, 0x0ACB02, 0x0ACD02, 0x0ACF02,
+    0x0AD102, 0x0AD302, 0x0AD502, 0x0AD702, 0x0AD902, 0x0ADB02, 0x0ADD02, 0x0ADF02, 0x0AE102, 0x0AE302, 0x0AE502, 0x0AE702,
+    0x0AE902, 0x0AEB02, 0x0AED02, 0x0AEF02, 0x0AF102, 0x0AF302, 0x0AF502, 0x0AF702, 0x0AF902, 0x0AFB02, 0x0AFD02, 0x0AFF02,
+    0x0B0102, 0x0B0302, 0x0B0502, 0x0B0702, 0x0B0902, 0x0B0B02, 0x0B0D02, 0x0B0F02, 0x0B1103, 0x0B1403, 0x0B1703, 0x0B1A03,
+    0x0B1D03, 0x0B2002, 0x0B2202, 0x0B2403, 0x0B2703, 0x0B2A03, 0x0B2D03, 0x0B3001, 0x0B3101, 0x0B3201, 0x0B3301, 0x0B3401,
+    0x0B3501, 0x0B3601, 0x0B3701, 0x0B3801, 0x0B3901, 0x0B3A01, 0x0B3B01, 0x0B3C01, 0x0B3D01, 0x0B3E01, 0x0B3F01, 0x0B4001,
+    0x0B4101, 0x0B4201, 0x0B4301, 0x0B4401, 0x0B4501, 0x0B4601, 0x0B4701, 0x0B4801, 0x0B4901, 0x0B4A01, 0x0B4B01, 0x0B4C01,
+    0x0B4D01, 0x0B4E01, 0x0B4F01, 0x0B5001, 0x0B5101, 0x0B5201, 0x0B5301, 0x0B5401, 0x0B5501, 0x0B5601, 0x0B5701, 0x0B5801,
+    0x0B5901, 0x0B5A01, 0x0B5B01, 0x0B5C01, 0x0B5D01, 0x0B5E01, 0x0B5F01, 0x0B6001, 0x0B6101, 0x0B6201, 0x0B6301, 0x0B6401,
+    0x0B6501, 0x0B6601, 0x0B6701, 0x0B6801, 0x0B6901, 0x0B6A01, 0x0B6B01, 0x0B6C01, 0x0B6D01, 0x0B6E01, 0x0B6F01, 0x0B7001,
+    0x0B7101, 0x0B7201, 0x0B7301, 0x0B7401, 0x0B7501, 0x0B7601, 0x0B7701, 0x0B7801, 0x0B7901, 0x0B7A01, 0x0B7B01, 0x0B7C01,
+    0x0B7D01, 0x0B7E01, 0x0B7F01, 0x0B8001, 0x0B8101, 0x0B8201, 0x0B8301, 0x0B8401, 0x0B8501, 0x0B8601, 0x0B8701, 0x0B8801,
+    0x0B8901, 0x0B8A01, 0x0B8B01, 0x0B8C01, 0x0B8D01, 0x0B8E01, 0x0B8F01, 0x0B9001, 0x0B9101, 0x0B9201, 0x0B9301, 0x0B9401,
+    0x0B9501, 0x0B9601, 0x0B9701, 0x0B9801, 0x0B9901, 0x0B9A01, 0x0B9B01, 0x0B9C01, 0x0B9D01, 0x0B9E01, 0x0B9F01, 0x0BA001,
+    0x0BA101, 0x0BA201, 0x0BA301, 0x0BA401, 0x0BA501, 0x0BA601, 0x0BA701, 0x0BA801, 0x0BA901, 0x0BAA01, 0x0BAB01, 0x0BAC01,
+    0x0BAD01, 0x0BAE01, 0x0BAF01, 0x0BB001, 0x0BB101, 0x0BB201, 0x0BB301, 0x0BB401, 0x0BB501, 0x0BB601, 0x0BB701, 0x0BB801,
+    0x0BB901, 0x0BBA01, 0x0BBB01, 0x0BBC01, 0x0BBD01, 0x0BBE01, 0x0BBF01, 0x0BC001, 0x0BC101, 0x0BC201, 0x0BC301, 0x0BC401,
+    0x0BC501, 0x0BC601, 0x0BC701, 0x0BC801, 0x0BC901, 0x0BCA01, 0x0BCB01, 0x0BCC01, 0x0BCD01, 0x0BCE01, 0x0BCF01, 0x0BD001,
+    0x0BD101, 0x0BD201, 0x0BD301, 0x0BD401, 0x0BD501, 0x0BD601, 0x0BD701, 0x0BD801, 0x0BD901, 0x0BDA01, 0x0BDB01, 0x0BDC01,
+    0x0BDD01, 0x0BDE01, 0x0BDF01, 0x0BE001, 0x0BE101, 0x0BE201, 0x0BE301, 0x0BE401, 0x0BE501, 0x0BE601, 0x0BE701, 0x0BE801,
+    0x0BE901, 0x0BEA01, 0x0BEB01, 0x0BEC01, 0x0BED01, 0x0BEE01, 0x0BEF01, 0x0BF001, 0x0BF101, 0x0BF201, 0x0BF301, 0x0BF401,
+    0x0BF501, 0x0BF601, 0x0BF701, 0x0BF801, 0x0BF901, 0x0BFA01, 0x0BFB01, 0x0BFC01, 0x0BFD01, 0x0BFE01, 0x0BFF01, 0x0C0001,
+    0x0C0101, 0x0C0201, 0x0C0301, 0x0C0401, 0x0C0501, 0x0C0601, 0x0C0701, 0x0C0801, 0x0C0901, 0x0C0A01, 0x0C0B01, 0x0C0C01,
+    0x0C0D01, 0x0C0E01, 0x0C0F01, 0x0C1001, 0x0C1101, 0x0C1201, 0x0C1301, 0x0C1401, 0x0C1501, 0x0C1601, 0x0C1701, 0x0C1801,
+    0x0C1901, 0x0C1A01, 0x0C1B01, 0x0C1C01, 0x0C1D01, 0x0C1E01, 0x0C1F01, 0x0C2001, 0x0C2101, 0x0C2201, 0x0C2301, 0x0C2401,
+    0x0C2501, 0x0C2601, 0x0C2701, 0x0C2801, 0x0C2901, 0x0C2A01, 0x0C2B01, 0x0C2C01, 0x0C2D01, 0x0C2E01, 0x0C2F01, 0x0C3001,
+    0x0C3101, 0x0C3201, 0x0C3301, 0x0C3401, 0x0C3501, 0x0C3601, 0x0C3701, 0x0C3801, 0x0C3901, 0x0C3A01, 0x0C3B01, 0x0C3C01,
+    0x0C3D01, 0x0C3E01, 0x0C3F01, 0x0C4001, 0x0C4101, 0x0C4201, 0x0C4301, 0x0C4401, 0x0C4501, 0x0C4601, 0x0C4701, 0x0C4801,
+    0x0C4901, 0x0C4A01, 0x0C4B01, 0x0C4C01, 0x0C4D01, 0x0C4E01, 0x0C4F01, 0x0C5001, 0x0C5101, 0x0C5201, 0x0C5301, 0x0C5401,
+    0x0C5501, 0x0C5601, 0x0C5701, 0x0C5801, 0x0C5901, 0x0C5A01, 0x0C5B01, 0x0C5C01, 0x0C5D01, 0x0C5E01, 0x0C5F01, 0x0C6001,
+    0x0C6101, 0x0C6201, 0x0C6301, 0x0C6401, 0x0C6501, 0x0C6601, 0x0C6701, 0x0C6801, 0x0C6901, 0x0C6A01, 0x0C6B01, 0x0C6C01,
+    0x0C6D01, 0x0C6E01, 0x0C6F01, 0x0C7001, 0x0C7101, 0x0C7201, 0x0C7301, 0x0C7401, 0x0C7501, 0x0C7601, 0x0C7701, 0x0C7801,
+    0x0C7901, 0x0C7A01, 0x0C7B01, 0x0C7C01, 0x0C7D01, 0x0C7E01, 0x0C7F01, 0x0C8001, 0x0C8101, 0x0C8201, 0x0C8301, 0x0C8401,
+    0x0C8501, 0x0C8601, 0x0C8701, 0x0C8801, 0x0C8901, 0x0C8A01, 0x0C8B01, 0x0C8C01, 0x0C8D01, 0x0C8E01, 0x0C8F01, 0x0C9001,
+    0x0C9101, 0x0C9201, 0x0C9301, 0x0C9401, 0x0C9501, 0x0C9601, 0x0C9701, 0x0C9801, 0x0C9901, 0x0C9A01, 0x0C9B01, 0x0C9C01,
+    0x0C9D01, 0x0C9E01, 0x0C9F01, 0x0CA001, 0x0CA101, 0x0CA201, 0x0CA301, 0x0CA401, 0x0CA501, 0x0CA601, 0x0CA701, 0x0CA801,
+    0x0CA901, 0x0CAA01, 0x0CAB01, 0x0CAC01, 0x0CAD01, 0x0CAE01, 0x0CAF01, 0x0CB001, 0x0CB101, 0x0CB201, 0x0CB301, 0x0CB401,
+    0x0CB501, 0x0CB601, 0x0CB701, 0x0CB801, 0x0CB901, 0x0CBA01, 0x0CBB01, 0x0CBC01, 0x0CBD01, 0x0CBE01, 0x0CBF01, 0x0CC001,
+    0x0CC101, 0x0CC201, 0x0CC301, 0x0CC401, 0x0CC501, 0x0CC601, 0x0CC701, 0x0CC801, 0x0CC901, 0x0CCA01, 0x0CCB01, 0x0CCC01,
+    0x0CCD01, 0x0CCE01, 0x0CCF01, 0x0CD001, 0x0CD101, 0x0CD201, 0x0CD301, 0x0CD401, 0x0CD501, 0x0CD601, 0x0CD701, 0x0CD801,
+    0x0CD901, 0x0CDA01, 0x0CDB01, 0x0CDC01, 0x0CDD01, 0x0CDE01, 0x0CDF01, 0x0CE001, 0x0CE101, 0x0CE201, 0x0CE301, 0x0CE401,
+    0x0CE501, 0x0CE601, 0x0CE701, 0x0CE801, 0x0CE901, 0x0CEA01, 0x0CEB01, 0x0CEC01, 0x0CED01, 0x0CEE01, 0x0CEF01, 0x0CF001,
+    0x0CF101, 0x0CF201, 0x0CF301, 0x0CF401, 0x0CF501, 0x0CF601, 0x0CF701, 0x0CF801, 0x0CF901, 0x0CFA01, 0x0CFB01, 0x0CFC01,
+    0x0CFD01, 0x0CFE01, 0x0CFF01, 0x0D0001, 0x0D0101, 0x0D0201, 0x0D0301, 0x0D0401, 0x0D0501, 0x0D0601, 0x0D0701, 0x0D0801,
+    0x0D0901, 0x0D0A01, 0x0D0B01, 0x0D0C01, 0x0D0D01, 0x0D0E01, 0x0D0F01, 0x0D1001, 0x0D1101, 0x0D1201, 0x0D1301, 0x0D1401,
+    0x0D1501, 0x0D1601, 0x0D1701, 0x0D1801, 0x0D1901, 0x0D1A01, 0x0D1B01, 0x0D1C01, 0x0D1D01, 0x0D1E01, 0x0D1F01, 0x0D2001,
+    0x0D2101, 0x0D2201, 0x0D2301, 0x0D2401, 0x0D2501, 0x0D2601, 0x0D2701, 0x0D2801, 0x0D2901, 0x0D2A01, 0x0D2B01, 0x0D2C01,
+    0x0D2D01, 0x0D2E01, 0x0D2F01, 0x0D3001, 0x0D3101, 0x0D3201, 0x0D3301, 0x0D3401, 0x0D3501, 0x0D3601, 0x0D3701, 0x0D3801,
+    0x0D3901, 0x0D3A01, 0x0D3B01, 0x0D3C01, 0x0D3D01, 0x0D3E01, 0x0D3F01, 0x0D4001, 0x0D4101, 0x0D4201, 0x0D4301, 0x0D4401,
+    0x0D4501, 0x0D4601, 0x0D4701, 0x0D4801, 0x0D4901, 0x0D4A01, 0x0D4B01, 0x0D4C01, 0x0D4D01,
+};
+
+const uint32_t decompositionData[3406] = {
+    0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303, 0x00041, 0x00308, 0x00041, 0x0030A,
+    0x00043, 0x00327, 0x00045, 0x00300, 0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+    0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303, 0x0004F, 0x00300, 0x0004F, 0x00301,
+    0x0004F, 0x00302, 0x0004F, 0x00303, 0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+    0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301, 0x00061, 0x00302, 0x00061, 0x00303,
+    0x00061, 0x00308, 0x00061, 0x0030A, 0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+    0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302, 0x00069, 0x00308, 0x0006E, 0x00303,
+    0x0006F, 0x00300, 0x0006F, 0x00301, 0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+    0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301, 0x00079, 0x00308, 0x00041, 0x00304,
+    0x00061, 0x00304, 0x00041, 0x00306, 0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+    0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307, 0x00063, 0x00307, 0x00043, 0x0030C,
+    0x00063, 0x0030C, 0x00044, 0x0030C, 0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+    0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328, 0x00065, 0x00328, 0x00045, 0x0030C,
+    0x00065, 0x0030C, 0x00047, 0x00302, 0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+    0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302, 0x00068, 0x00302, 0x00049, 0x00303,
+    0x00069, 0x00303, 0x00049, 0x00304, 0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+    0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302, 0x0004B, 0x00327, 0x0006B, 0x00327,
+    0x0004C, 0x00301, 0x0006C, 0x00301, 0x0004C, 0x00327, 0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C,
+    0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327, 0x0004E, 0x0030C, 0x0006E, 0x0030C,
+    0x0004F, 0x00304, 0x0006F, 0x00304, 0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+    0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327, 0x00052, 0x0030C, 0x00072, 0x0030C,
+    0x00053, 0x00301, 0x00073, 0x00301, 0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+    0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327, 0x00054, 0x0030C, 0x00074, 0x0030C,
+    0x00055, 0x00303, 0x00075, 0x00303, 0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+    0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B, 0x00055, 0x00328, 0x00075, 0x00328,
+    0x00057, 0x00302, 0x00077, 0x00302, 0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301,
+    0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C, 0x0007A, 0x0030C, 0x0004F, 0x0031B,
+    0x0006F, 0x0031B, 0x00055, 0x0031B, 0x00075, 0x0031B, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+    0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C, 0x00075, 0x0030C, 0x00055, 0x00308,
+    0x00304, 0x00075, 0x00308, 0x00304, 0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+    0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075, 0x00308, 0x00300, 0x00041, 0x00308,
+    0x00304, 0x00061, 0x00308, 0x00304, 0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+    0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C, 0x0006B, 0x0030C, 0x0004F, 0x00328,
+    0x0006F, 0x00328, 0x0004F, 0x00328, 0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+    0x0006A, 0x0030C, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300, 0x0006E, 0x00300, 0x00041, 0x0030A,
+    0x00301, 0x00061, 0x0030A, 0x00301, 0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301,
+    0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311, 0x00045, 0x0030F, 0x00065, 0x0030F,
+    0x00045, 0x00311, 0x00065, 0x00311, 0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311,
+    0x0004F, 0x0030F, 0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311, 0x00052, 0x0030F, 0x00072, 0x0030F,
+    0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+    0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326, 0x00048, 0x0030C, 0x00068, 0x0030C,
+    0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327, 0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F,
+    0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304, 0x0004F, 0x00307, 0x0006F, 0x00307,
+    0x0004F, 0x00307, 0x00304, 0x0006F, 0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+    0x00313, 0x00308, 0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391, 0x00301, 0x000B7, 0x00395, 0x00301,
+    0x00397, 0x00301, 0x00399, 0x00301, 0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301, 0x003B9, 0x00308,
+    0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5, 0x00301, 0x003B7, 0x00301, 0x003B9,
+    0x00301, 0x003C5, 0x00308, 0x00301, 0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301,
+    0x003C9, 0x00301, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x00415, 0x00300, 0x00415, 0x00308, 0x00413, 0x00301,
+    0x00406, 0x00308, 0x0041A, 0x00301, 0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+    0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308, 0x0043A, 0x00301, 0x00438, 0x00300,
+    0x00443, 0x00306, 0x00474, 0x0030F, 0x00475, 0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+    0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306, 0x00435, 0x00306, 0x004D8, 0x00308,
+    0x004D9, 0x00308, 0x00416, 0x00308, 0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+    0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308, 0x0043E, 0x00308, 0x004E8, 0x00308,
+    0x004E9, 0x00308, 0x0042D, 0x00308, 0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+    0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308, 0x00447, 0x00308, 0x0042B, 0x00308,
+    0x0044B, 0x00308, 0x00627, 0x00653, 0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654,
+    0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C, 0x00930, 0x0093C, 0x00933, 0x0093C,
+    0x00915, 0x0093C, 0x00916, 0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+    0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7, 0x009A1, 0x009BC, 0x009A2, 0x009BC,
+    0x009AF, 0x009BC, 0x00A32, 0x00A3C, 0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C,
+    0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57, 0x00B21, 0x00B3C, 0x00B22, 0x00B3C,
+    0x00B92, 0x00BD7, 0x00BC6, 0x00BBE, 0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5,
+    0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2, 0x00CD5, 0x00D46, 0x00D3E, 0x00D47,
+    0x00D3E, 0x00D46, 0x00D57, 0x00DD9, 0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF,
+    0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7, 0x00F5B, 0x00FB7, 0x00F40, 0x00FB5,
+    0x00F71, 0x00F72, 0x00F71, 0x00F74, 0x00FB2, 0x00F80, 0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+    0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7, 0x00F90, 0x00FB5, 0x01025, 0x0102E,
+    0x01B05, 0x01B35, 0x01B07, 0x01B35, 0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+    0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35, 0x01B42, 0x01B35, 0x00041, 0x00325,
+    0x00061, 0x00325, 0x00042, 0x00307, 0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+    0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064, 0x00307,
+    0x00044, 0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+    0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065, 0x00304, 0x00300, 0x00045, 0x00304,
+    0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330, 0x00065, 0x00330,
+    0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047, 0x00304,
+    0x00067, 0x00304, 0x00048, 0x00307, 0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+    0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E, 0x00068, 0x0032E, 0x00049, 0x00330,
+    0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+    0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331, 0x0004C, 0x00323, 0x0006C, 0x00323,
+    0x0004C, 0x00323, 0x00304, 0x0006C, 0x00323, 0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D,
+    0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307, 0x0006D, 0x00307, 0x0004D, 0x00323,
+    0x0006D, 0x00323, 0x0004E, 0x00307, 0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331,
+    0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303, 0x00301, 0x0006F, 0x00303, 0x00301,
+    0x0004F, 0x00303, 0x00308, 0x0006F, 0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F, 0x00304, 0x00300,
+    0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050, 0x00307,
+    0x00070, 0x00307, 0x00052, 0x00307, 0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+    0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073, 0x00307,
+    0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+    0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073, 0x00323, 0x00307, 0x00054, 0x00307,
+    0x00074, 0x00307, 0x00054, 0x00323, 0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D,
+    0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055, 0x0032D,
+    0x00075, 0x0032D, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+    0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323, 0x00076, 0x00323, 0x00057, 0x00300,
+    0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+    0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058, 0x00308,
+    0x00078, 0x00308, 0x00059, 0x00307, 0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323,
+    0x0007A, 0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077, 0x0030A,
+    0x00079, 0x0030A, 0x0017F, 0x00307, 0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+    0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300, 0x00061, 0x00302, 0x00300,
+    0x00041, 0x00302, 0x00309, 0x00061, 0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+    0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306, 0x00301, 0x00061, 0x00306, 0x00301,
+    0x00041, 0x00306, 0x00300, 0x00061, 0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+    0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323, 0x00306, 0x00061, 0x00323, 0x00306,
+    0x00045, 0x00323, 0x00065, 0x00323, 0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+    0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300, 0x00065, 0x00302, 0x00300,
+    0x00045, 0x00302, 0x00309, 0x00065, 0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+    0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309, 0x00069, 0x00309, 0x00049, 0x00323,
+    0x00069, 0x00323, 0x0004F, 0x00323, 0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+    0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F, 0x00302, 0x00300, 0x0004F, 0x00302,
+    0x00309, 0x0006F, 0x00302, 0x00309, 0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323,
+    0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F, 0x0031B, 0x00301, 0x0004F, 0x0031B,
+    0x00300, 0x0006F, 0x0031B, 0x00300, 0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B,
+    0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F, 0x0031B, 0x00323, 0x00055, 0x00323,
+    0x00075, 0x00323, 0x00055, 0x00309, 0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301,
+    0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B, 0x00309, 0x00075, 0x0031B, 0x00309,
+    0x00055, 0x0031B, 0x00303, 0x00075, 0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323,
+    0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323, 0x00059, 0x00309, 0x00079, 0x00309,
+    0x00059, 0x00303, 0x00079, 0x00303, 0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+    0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301, 0x003B1, 0x00313, 0x00342, 0x003B1,
+    0x00314, 0x00342, 0x00391, 0x00313, 0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+    0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313, 0x00342, 0x00391, 0x00314, 0x00342,
+    0x003B5, 0x00313, 0x003B5, 0x00314, 0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313,
+    0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314, 0x00395, 0x00313, 0x00300, 0x00395,
+    0x00314, 0x00300, 0x00395, 0x00313, 0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314,
+    0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313, 0x00301, 0x003B7, 0x00314, 0x00301,
+    0x003B7, 0x00313, 0x00342, 0x003B7, 0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+    0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397, 0x00314, 0x00301, 0x00397, 0x00313,
+    0x00342, 0x00397, 0x00314, 0x00342, 0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+    0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301, 0x003B9, 0x00313, 0x00342, 0x003B9,
+    0x00314, 0x00342, 0x00399, 0x00313, 0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+    0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313, 0x00342, 0x00399, 0x00314, 0x00342,
+    0x003BF, 0x00313, 0x003BF, 0x00314, 0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313,
+    0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314, 0x0039F, 0x00313, 0x00300, 0x0039F,
+    0x00314, 0x00300, 0x0039F, 0x00313, 0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314,
+    0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313, 0x00301, 0x003C5, 0x00314, 0x00301,
+    0x003C5, 0x00313, 0x00342, 0x003C5, 0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5,
+    0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9, 0x00314, 0x003C9, 0x00313, 0x00300,
+    0x003C9, 0x00314, 0x00300, 0x003C9, 0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+    0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9, 0x00313, 0x00300, 0x003A9, 0x00314,
+    0x00300, 0x003A9, 0x00313, 0x00301, 0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314,
+    0x00342, 0x003B1, 0x00300, 0x003B1, 0x00301, 0x003B5, 0x00300, 0x003B5, 0x00301, 0x003B7, 0x00300, 0x003B7,
+    0x00301, 0x003B9, 0x00300, 0x003B9, 0x00301, 0x003BF, 0x00300, 0x003BF, 0x00301, 0x003C5, 0x00300, 0x003C5,
+    0x00301, 0x003C9, 0x00300, 0x003C9, 0x00301, 0x003B1, 0x00313, 0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1,
+    0x00313, 0x00300, 0x00345, 0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345, 0x003B1,
+    0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345, 0x003B1, 0x00314, 0x00342, 0x00345, 0x00391,
+    0x00313, 0x00345, 0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314, 0x00300,
+    0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342,
+    0x00345, 0x00391, 0x00314, 0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345, 0x003B7,
+    0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345, 0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7,
+    0x00314, 0x00301, 0x00345, 0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345, 0x00397,
+    0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300,
+    0x00345, 0x00397, 0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342,
+    0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313, 0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9,
+    0x00313, 0x00300, 0x00345, 0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345, 0x003C9,
+    0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345, 0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9,
+    0x00313, 0x00345, 0x003A9, 0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314, 0x00300,
+    0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314, 0x00301, 0x00345, 0x003A9, 0x00313, 0x00342,
+    0x00345, 0x003A9, 0x00314, 0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300, 0x00345,
+    0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342, 0x003B1, 0x00342, 0x00345, 0x00391, 0x00306,
+    0x00391, 0x00304, 0x00391, 0x00300, 0x00391, 0x00301, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7,
+    0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7, 0x00342, 0x003B7, 0x00342, 0x00345,
+    0x00395, 0x00300, 0x00395, 0x00301, 0x00397, 0x00300, 0x00397, 0x00301, 0x00397, 0x00345, 0x01FBF, 0x00300,
+    0x01FBF, 0x00301, 0x01FBF, 0x00342, 0x003B9, 0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9,
+    0x00308, 0x00301, 0x003B9, 0x00342, 0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+    0x00300, 0x00399, 0x00301, 0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE, 0x00342, 0x003C5, 0x00306, 0x003C5,
+    0x00304, 0x003C5, 0x00308, 0x00300, 0x003C5, 0x00308, 0x00301, 0x003C1, 0x00313, 0x003C1, 0x00314, 0x003C5,
+    0x00342, 0x003C5, 0x00308, 0x00342, 0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A5, 0x00301,
+    0x003A1, 0x00314, 0x000A8, 0x00300, 0x000A8, 0x00301, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345,
+    0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345, 0x0039F, 0x00300, 0x0039F, 0x00301,
+    0x003A9, 0x00300, 0x003A9, 0x00301, 0x003A9, 0x00345, 0x000B4, 0x02002, 0x02003, 0x003A9, 0x0004B, 0x00041,
+    0x0030A, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2,
+    0x00338, 0x02203, 0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225, 0x00338, 0x0223C,
+    0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003D, 0x00338, 0x02261, 0x00338, 0x0224D,
+    0x00338, 0x0003C, 0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273,
+    0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A, 0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283,
+    0x00338, 0x02286, 0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9, 0x00338, 0x022AB,
+    0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3,
+    0x00338, 0x022B4, 0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B, 0x03099, 0x0304D,
+    0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059,
+    0x03099, 0x0305B, 0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066,
+    0x03099, 0x03068, 0x03099, 0x0306F, 0x03099, 0x0306F, 0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A, 0x03075,
+    0x03099, 0x03075, 0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046,
+    0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD, 0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3,
+    0x03099, 0x030B5, 0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD, 0x03099, 0x030BF,
+    0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6, 0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF,
+    0x0309A, 0x030D2, 0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8, 0x03099, 0x030D8,
+    0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6, 0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1,
+    0x03099, 0x030F2, 0x03099, 0x030FD, 0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1, 0x04E32, 0x053E5,
+    0x09F9C, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6, 0x07669, 0x07F85, 0x0863F, 0x087BA, 0x088F8,
+    0x0908F, 0x06A02, 0x06D1B, 0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04, 0x0721B,
+    0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9, 0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A,
+    0x072FC, 0x090CE, 0x04F86, 0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606, 0x0865C,
+    0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9, 0x09304, 0x09E7F, 0x08AD6, 0x058DF,
+    0x05F04, 0x07C60, 0x0807E, 0x07262, 0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F,
+    0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C, 0x07DBE, 0x083F1, 0x09675, 0x08B80,
+    0x062CF, 0x06A02, 0x08AFE, 0x04E39, 0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9,
+    0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449, 0x08AAA, 0x06BBA, 0x08FB0, 0x06C88,
+    0x062FE, 0x082E5, 0x063A0, 0x07565, 0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+    0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD, 0x09A6A, 0x09E97, 0x09ECE, 0x0529B,
+    0x066C6, 0x06B77, 0x08F62, 0x05E74, 0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4,
+    0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD, 0x070C8, 0x088C2, 0x08AAA, 0x05EC9,
+    0x05FF5, 0x0637B, 0x06BAE, 0x07C3E, 0x07375, 0x04EE4, 0x056F9, 0x05BE7, 0x05DBA, 0x0601C, 0x073B2, 0x07469,
+    0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4, 0x096B8, 0x060E1, 0x04E86,
+    0x050DA, 0x05BEE, 0x05C3F, 0x06599, 0x06A02, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E,
+    0x05289, 0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10, 0x0985E, 0x0516D, 0x0622E,
+    0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540F,
+    0x05C65, 0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x091CC, 0x096E2,
+    0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA, 0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8,
+    0x07ACB, 0x07B20, 0x07C92, 0x072C0, 0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3,
+    0x07CD6, 0x05B85, 0x06D1E, 0x066B4, 0x08F3B, 0x0884C, 0x0964D, 0x0898B, 0x05ED3, 0x05140, 0x055C0, 0x0585A,
+    0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE, 0x07FBD, 0x08612,
+    0x08AF8, 0x09038, 0x090FD, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7, 0x0514D,
+    0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8, 0x05C64, 0x05C6E, 0x06094, 0x06168,
+    0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691, 0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422,
+    0x07891, 0x0793E, 0x07949, 0x07948, 0x07950, 0x07956, 0x0795D, 0x0798D, 0x0798E, 0x07A40, 0x07A81, 0x07BC0,
+    0x07DF4, 0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08279, 0x08457, 0x08910, 0x08996, 0x08B01,
+    0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x09038, 0x096E3, 0x097FF, 0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26,
+    0x051B5, 0x05168, 0x04F80, 0x05145, 0x05180, 0x052C7, 0x052FA, 0x0559D, 0x05555, 0x05599, 0x055E2, 0x0585A,
+    0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69, 0x05FAD, 0x060D8, 0x0614E, 0x06108,
+    0x0618E, 0x06160, 0x061F2, 0x06234, 0x063C4, 0x0641C, 0x06452, 0x06556, 0x06674, 0x06717, 0x0671B, 0x06756,
+    0x06B79, 0x06BBA, 0x06D41, 0x06EDB, 0x06ECB, 0x06F22, 0x0701E, 0x0716E, 0x077A7, 0x07235, 0x072AF, 0x0732A,
+    0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076CA, 0x076DB, 0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1,
+    0x07BC0, 0x07C7B, 0x07D5B, 0x07DF4, 0x07F3E, 0x08005, 0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08996,
+    0x08ABF, 0x08AF8, 0x08ACB, 0x08B01, 0x08AFE, 0x08AED, 0x08B39, 0x08B8A, 0x08D08, 0x08F38, 0x09072, 0x09199,
+    0x09276, 0x0967C, 0x096E3, 0x09756, 0x097DB, 0x097FF, 0x0980B, 0x0983B, 0x09B12, 0x09F9C, 0x2284A, 0x22844,
+    0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249, 0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x005D9, 0x005B4, 0x005F2,
+    0x005B7, 0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9, 0x005BC, 0x005C2, 0x005D0,
+    0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC, 0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4,
+    0x005BC, 0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC, 0x005DA, 0x005BC, 0x005DB,
+    0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4,
+    0x005BC, 0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC, 0x005EA, 0x005BC, 0x005D5,
+    0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF, 0x005E4, 0x005BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+    0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9,
+    0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+    0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165,
+    0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+    0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x04E3D, 0x04E38, 0x04E41, 0x20122,
+    0x04F60, 0x04FAE, 0x04FBB, 0x05002, 0x0507A, 0x05099, 0x050E7, 0x050CF, 0x0349E, 0x2063A, 0x0514D, 0x05154,
+    0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x0518D, 0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x051B5,
+    0x291DF, 0x051F5, 0x05203, 0x034DF, 0x0523B, 0x05246, 0x05272, 0x05277, 0x03515, 0x052C7, 0x052C9, 0x052E4,
+    0x052FA, 0x05305, 0x05306, 0x05317, 0x05349, 0x05351, 0x0535A, 0x05373, 0x0537D, 0x0537F, 0x0537F, 0x0537F,
+    0x20A2C, 0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468,
+    0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599, 0x055AB, 0x055B3, 0x055C2, 0x05716,
+    0x05606, 0x05717, 0x05651, 0x05674, 0x05207, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831,
+    0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962, 0x216A8, 0x216EA, 0x059EC, 0x05A1B,
+    0x05A27, 0x059D8, 0x05A66, 0x036EE, 0x036FC, 0x05B08, 0x05B3E, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BE7,
+    0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60, 0x05C6E, 0x05CC0, 0x05C8D, 0x21DE4,
+    0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1, 0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69,
+    0x03862, 0x22183, 0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x05ECA, 0x2A392, 0x05EFE, 0x22331, 0x22331, 0x08201,
+    0x05F22, 0x05F22, 0x038C7, 0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9,
+    0x06081, 0x0393A, 0x0391C, 0x06094, 0x226D4, 0x060C7, 0x06148, 0x0614C, 0x0614E, 0x0614C, 0x0617A, 0x0618E,
+    0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x061F2, 0x061F6, 0x06210, 0x0621B, 0x0625D, 0x062B1, 0x062D4, 0x06350,
+    0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469,
+    0x0647E, 0x0649D, 0x06477, 0x03A6C, 0x0654F, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649, 0x03B19, 0x06691,
+    0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD, 0x043D9, 0x06717, 0x0671B, 0x06721, 0x0675E,
+    0x06753, 0x233C3, 0x03B49, 0x067FA, 0x06785, 0x06852, 0x06885, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x03B9D,
+    0x06942, 0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E, 0x06B72,
+    0x06B9F, 0x06BBA, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16,
+    0x06D3E, 0x06D77, 0x06D41, 0x06D69, 0x06D78, 0x06D85, 0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06ECB,
+    0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701E, 0x0701B, 0x03D96, 0x0704A,
+    0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB, 0x07228, 0x07235, 0x07250, 0x24608,
+    0x07280, 0x07295, 0x24735, 0x24814, 0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x03EB8, 0x07447, 0x0745C,
+    0x07471, 0x07485, 0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x07570, 0x2219F, 0x07610, 0x24FA1,
+    0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x076F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x0771E, 0x0771F, 0x0771F,
+    0x0774A, 0x04039, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x0788C, 0x078CC, 0x040E3, 0x25626, 0x07956,
+    0x2569A, 0x256C5, 0x0798F, 0x079EB, 0x0412F, 0x07A40, 0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x07AEE,
+    0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80, 0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86,
+    0x07D63, 0x04301, 0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9, 0x07F7A, 0x2633E,
+    0x07F95, 0x07FFA, 0x08005, 0x264DA, 0x26523, 0x08060, 0x265A8, 0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103,
+    0x0440B, 0x0813E, 0x05AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08201, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+    0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C, 0x082E5, 0x0831D, 0x08363, 0x083AD,
+    0x08323, 0x083BD, 0x083E7, 0x08457, 0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B,
+    0x084F1, 0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1, 0x270D2, 0x0456B, 0x08650,
+    0x0865C, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E, 0x086E2, 0x08779, 0x08728, 0x0876B, 0x08786, 0x045D7,
+    0x087E1, 0x08801, 0x045F9, 0x08860, 0x08863, 0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE,
+    0x27966, 0x046BE, 0x046C7, 0x08AA0, 0x08AED, 0x08B8A, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77,
+    0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x08F38, 0x285D2, 0x285ED, 0x09094, 0x090F1,
+    0x09111, 0x2872E, 0x0911B, 0x09238, 0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995,
+    0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A, 0x04A6E, 0x04A76, 0x097E0, 0x2940A,
+    0x04AB2, 0x29496, 0x0980B, 0x0980B, 0x09829, 0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE,
+    0x04BCE, 0x29B30, 0x09B12, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E,
+    0x2A291, 0x09EBB, 0x04D56, 0x09EF9, 0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x09F3B, 0x2A600,
+};
+
+const size_t compositionCount = 941;
+
+//Each key is the first code point shifted up by 32, and the second in the low 32 bits
+const uint64_t compositionKeys[941] = {
+    0x0003C00000338ull, 0x0003D00000338ull, 0x0003E00000338ull, 0x0004100000300ull, 0x0004100000301ull, 0x0004100000302ull,
+    0x0004100000303ull, 0x0004100000304ull, 0x0004100000306ull, 0x0004100000307ull, 0x0004100000308ull, 0x0004100000309ull,
+    0x000410000030Aull, 0x000410000030Cull, 0x000410000030Full, 0x0004100000311ull, 0x0004100000323ull, 0x0004100000325ull,
+    0x0004100000328ull, 0x0004200000307ull, 0x0004200000323ull, 0x0004200000331ull, 0x0004300000301ull, 0x0004300000302ull,
+    0x0004300000307ull, 0x000430000030Cull, 0x0004300000327ull, 0x0004400000307ull, 0x000440000030Cull, 0x0004400000323ull,
+    0x0004400000327ull, 0x000440000032Dull, 0x0004400000331ull, 0x0004500000300ull, 0x0004500000301ull, 0x0004500000302ull,
+    0x0004500000303ull, 0x0004500000304ull, 0x0004500000306ull, 0x0004500000307ull, 0x0004500000308ull, 0x0004500000309ull,
+    0x000450000030Cull, 0x000450000030Full, 0x0004500000311ull, 0x0004500000323ull, 0x0004500000327ull, 0x0004500000328ull,
+    0x000450000032Dull, 0x0004500000330ull, 0x0004600000307ull, 0x0004700000301ull, 0x0004700000302ull, 0x0004700000304ull,
+    0x0004700000306ull, 0x0004700000307ull, 0x000470000030Cull, 0x0004700000327ull, 0x0004800000302ull, 0x0004800000307ull,
+    0x0004800000308ull, 0x000480000030Cull, 0x0004800000323ull, 0x0004800000327ull, 0x000480000032Eull, 0x0004900000300ull,
+    0x0004900000301ull, 0x0004900000302ull, 0x0004900000303ull, 0x0004900000304ull, 0x0004900000306ull, 0x0004900000307ull,
+    0x0004900000308ull, 0x0004900000309ull, 0x000490000030Cull, 0x000490000030Full, 0x0004900000311ull, 0x0004900000323ull,
+    0x0004900000328ull, 0x0004900000330ull, 0x0004A00000302ull, 0x0004B00000301ull, 0x0004B0000030Cull, 0x0004B00000323ull,
+    0x0004B00000327ull, 0x0004B00000331ull, 0x0004C00000301ull, 0x0004C0000030Cull, 0x0004C00000323ull, 0x0004C00000327ull,
+    0x0004C0000032Dull, 0x0004C00000331ull, 0x0004D00000301ull, 0x0004D00000307ull, 0x0004D00000323ull, 0x0004E00000300ull,
+    0x0004E00000301ull, 0x0004E00000303ull, 0x0004E00000307ull, 0x0004E0000030Cull, 0x0004E00000323ull, 0x0004E00000327ull,
+    0x0004E0000032Dull, 0x0004E00000331ull, 0x0004F00000300ull, 0x0004F00000301ull, 0x0004F00000302ull, 0x0004F00000303ull,
+    0x0004F00000304ull, 0x0004F00000306ull, 0x0004F00000307ull, 0x0004F00000308ull, 0x0004F00000309ull, 0x0004F0000030Bull,
+    0x0004F0000030Cull, 0x0004F0000030Full, 0x0004F00000311ull, 0x0004F0000031Bull, 0x0004F00000323ull, 0x0004F00000328ull,
+    0x0005000000301ull, 0x0005000000307ull, 0x0005200000301ull, 0x0005200000307ull, 0x000520000030Cull, 0x000520000030Full,
+    0x0005200000311ull, 0x0005200000323ull, 0x0005200000327ull, 0x0005200000331ull, 0x0005300000301ull, 0x0005300000302ull,
+    0x0005300000307ull, 0x000530000030Cull, 0x0005300000323ull, 0x0005300000326ull, 0x0005300000327ull, 0x0005400000307ull,
+    0x000540000030Cull, 0x0005400000323ull, 0x0005400000326ull, 0x0005400000327ull, 0x000540000032Dull, 0x0005400000331ull,
+    0x0005500000300ull, 0x0005500000301ull, 0x0005500000302ull, 0x0005500000303ull, 0x0005500000304ull, 0x0005500000306ull,
+    0x0005500000308ull, 0x0005500000309ull, 0x000550000030Aull, 0x000550000030Bull, 0x000550000030Cull, 0x000550000030Full,
+    0x0005500000311ull, 0x000550000031Bull, 0x0005500000323ull, 0x0005500000324ull, 0x0005500000328ull, 0x000550000032Dull,
+    0x0005500000330ull, 0x0005600000303ull, 0x0005600000323ull, 0x0005700000300ull, 0x0005700000301ull, 0x0005700000302ull,
+    0x0005700000307ull, 0x0005700000308ull, 0x0005700000323ull, 0x0005800000307ull, 0x0005800000308ull, 0x0005900000300ull,
+    0x0005900000301ull, 0x0005900000302ull, 0x0005900000303ull, 0x0005900000304ull, 0x0005900000307ull, 0x0005900000308ull,
+    0x0005900000309ull, 0x0005900000323ull, 0x0005A00000301ull, 0x0005A00000302ull, 0x0005A00000307ull, 0x0005A0000030Cull,
+    0x0005A00000323ull, 0x0005A00000331ull, 0x0006100000300ull, 0x0006100000301ull, 0x0006100000302ull, 0x0006100000303ull,
+    0x0006100000304ull, 0x0006100000306ull, 0x0006100000307ull, 0x0006100000308ull, 0x0006100000309ull, 0x000610000030Aull,
+    0x000610000030Cull, 0x000610000030Full, 0x0006100000311ull, 0x0006100000323ull, 0x0006100000325ull, 0x0006100000328ull,
+    0x0006200000307ull, 0x0006200000323ull, 0x0006200000331ull, 0x0006300000301ull, 0x0006300000302ull, 0x0006300000307ull,
+    0x000630000030Cull, 0x0006300000327ull, 0x0006400000307ull, 0x000640000030Cull, 0x0006400000323ull, 0x0006400000327ull,
+    0x000640000032Dull, 0x0006400000331ull, 0x0006500000300ull, 0x0006500000301ull, 0x0006500000302ull, 0x0006500000303ull,
+    0x0006500000304ull, 0x0006500000306ull, 0x0006500000307ull, 0x0006500000308ull, 0x0006500000309ull, 0x000650000030Cull,
+    0x000650000030Full, 0x0006500000311ull, 0x0006500000323ull, 0x0006500000327ull, 0x0006500000328ull, 0x000650000032Dull,
+    0x0006500000330ull, 0x0006600000307ull, 0x0006700000301ull, 0x0006700000302ull, 0x0006700000304ull, 0x0006700000306ull,
+    0x0006700000307ull, 0x000670000030Cull, 0x0006700000327ull, 0x0006800000302ull, 0x0006800000307ull, 0x0006800000308ull,
+    0x000680000030Cull, 0x0006800000323ull, 0x0006800000327ull, 0x000680000032Eull, 0x0006800000331ull, 0x0006900000300ull,
+    0x0006900000301ull, 0x0006900000302ull, 0x0006900000303ull, 0x0006900000304ull, 0x0006900000306ull, 0x0006900000308ull,
+    0x0006900000309ull, 0x000690000030Cull, 0x000690000030Full, 0x0006900000311ull, 0x0006900000323ull, 0x0006900000328ull,
+    0x0006900000330ull, 0x0006A00000302ull, 0x0006A0000030Cull, 0x0006B00000301ull, 0x0006B0000030Cull, 0x0006B00000323ull,
+    0x0006B00000327ull, 0x0006B00000331ull, 0x0006C00000301ull, 0x0006C0000030Cull, 0x0006C00000323ull, 0x0006C00000327ull,
+    0x0006C0000032Dull, 0x0006C00000331ull, 0x0006D00000301ull, 0x0006D00000307ull, 0x0006D00000323ull, 0x0006E00000300ull,
+    0x0006E00000301ull, 0x0006E00000303ull, 0x0006E00000307ull, 0x0006E0000030Cull, 0x0006E00000323ull, 0x0006E00000327ull,
+    0x0006E0000032Dull, 0x0006E00000331ull, 0x0006F00000300ull, 0x0006F00000301ull, 0x0006F00000302ull, 0x0006F00000303ull,
+    0x0006F00000304ull, 0x0006F00000306ull, 0x0006F00000307ull, 0x0006F00000308ull, 0x0006F00000309ull, 0x0006F0000030Bull,
+    0x0006F0000030Cull, 0x0006F0000030Full, 0x0006F00000311ull, 0x0006F0000031Bull, 0x0006F00000323ull, 0x0006F00000328ull,
+    0x0007000000301ull, 0x0007000000307ull, 0x0007200000301ull, 0x0007200000307ull, 0x000720000030Cull, 0x000720000030Full,
+    0x0007200000311ull, 0x0007200000323ull, 0x0007200000327ull, 0x0007200000331ull, 0x0007300000301ull, 0x0007300000302ull,
+    0x0007300000307ull, 0x000730000030Cull, 0x0007300000323ull, 0x0007300000326ull, 0x0007300000327ull, 0x0007400000307ull,
+    0x0007400000308ull, 0x000740000030Cull, 0x0007400000323ull, 0x0007400000326ull, 0x0007400000327ull, 0x000740000032Dull,
+    0x0007400000331ull, 0x0007500000300ull, 0x0007500000301ull, 0x0007500000302ull, 0x0007500000303ull, 0x0007500000304ull,
+    0x0007500000306ull, 0x0007500000308ull, 0x0007500000309ull, 0x000750000030Aull, 0x000750000030Bull, 0x000750000030Cull,
+    0x000750000030Full, 0x0007500000311ull, 0x000750000031Bull, 0x0007500000323ull, 0x0007500000324ull, 0x0007500000328ull,
+    0x000750000032Dull, 0x0007500000330ull, 0x0007600000303ull, 0x0007600000323ull, 0x0007700000300ull, 0x0007700000301ull,
+    0x0007700000302ull, 0x0007700000307ull, 0x0007700000308ull, 0x000770000030Aull, 0x0007700000323ull, 0x0007800000307ull,
+    0x0007800000308ull, 0x0007900000300ull, 0x0007900000301ull, 0x0007900000302ull, 0x0007900000303ull, 0x0007900000304ull,
+    0x0007900000307ull, 0x0007900000308ull, 0x0007900000309ull, 0x000790000030Aull, 0x0007900000323ull, 0x0007A00000301ull,
+    0x0007A00000302ull, 0x0007A00000307ull, 0x0007A0000030Cull, 0x0007A00000323ull, 0x0007A00000331ull, 0x000A800000300ull,
+    0x000A800000301ull, 0x000A800000342ull, 0x000C200000300ull, 0x000C200000301ull, 0x000C200000303ull, 0x000C200000309ull,
+    0x000C400000304ull, 0x000C500000301ull, 0x000C600000301ull, 0x000C600000304ull, 0x000C700000301ull, 0x000CA00000300ull,
+    0x000CA00000301ull, 0x000CA00000303ull, 0x000CA00000309ull, 0x000CF00000301ull, 0x000D400000300ull, 0x000D400000301ull,
+    0x000D400000303ull, 0x000D400000309ull, 0x000D500000301ull, 0x000D500000304ull, 0x000D500000308ull, 0x000D600000304ull,
+    0x000D800000301ull, 0x000DC00000300ull, 0x000DC00000301ull, 0x000DC00000304ull, 0x000DC0000030Cull, 0x000E200000300ull,
+    0x000E200000301ull, 0x000E200000303ull, 0x000E200000309ull, 0x000E400000304ull, 0x000E500000301ull, 0x000E600000301ull,
+    0x000E600000304ull, 0x000E700000301ull, 0x000EA00000300ull, 0x000EA00000301ull, 0x000EA00000303ull, 0x000EA00000309ull,
+    0x000EF00000301ull, 0x000F400000300ull, 0x000F400000301ull, 0x000F400000303ull, 0x000F400000309ull, 0x000F500000301ull,
+    0x000F500000304ull, 0x000F500000308ull, 0x000F600000304ull, 0x000F800000301ull, 0x000FC00000300ull, 0x000FC00000301ull,
+    0x000FC00000304ull, 0x000FC0000030Cull, 0x0010200000300ull, 0x0010200000301ull, 0x0010200000303ull, 0x0010200000309ull,
+    0x0010300000300ull, 0x0010300000301ull, 0x0010300000303ull, 0x0010300000309ull, 0x0011200000300ull, 0x0011200000301ull,
+    0x0011300000300ull, 0x0011300000301ull, 0x0014C00000300ull, 0x0014C00000301ull, 0x0014D00000300ull, 0x0014D00000301ull,
+    0x0015A00000307ull, 0x0015B00000307ull, 0x0016000000307ull, 0x0016100000307ull, 0x0016800000301ull, 0x0016900000301ull,
+    0x0016A00000308ull, 0x0016B00000308ull, 0x0017F00000307ull, 0x001A000000300ull, 0x001A000000301ull, 0x001A000000303ull,
+    0x001A000000309ull, 0x001A000000323ull, 0x001A100000300ull, 0x001A100000301ull, 0x001A100000303ull, 0x001A100000309ull,
+    0x001A100000323ull, 0x001AF00000300ull, 0x001AF00000301ull, 0x001AF00000303ull, 0x001AF00000309ull, 0x001AF00000323ull,
+    0x001B000000300ull, 0x001B000000301ull, 0x001B000000303ull, 0x001B000000309ull, 0x001B000000323ull, 0x001B70000030Cull,
+    0x001EA00000304ull, 0x001EB00000304ull, 0x0022600000304ull, 0x0022700000304ull, 0x0022800000306ull, 0x0022900000306ull,
+    0x0022E00000304ull, 0x0022F00000304ull, 0x002920000030Cull, 0x0039100000300ull, 0x0039100000301ull, 0x0039100000304ull,
+    0x0039100000306ull, 0x0039100000313ull, 0x0039100000314ull, 0x0039100000345ull, 0x0039500000300ull, 0x0039500000301ull,
+    0x0039500000313ull, 0x0039500000314ull, 0x0039700000300ull, 0x0039700000301ull, 0x0039700000313ull, 0x0039700000314ull,
+    0x0039700000345ull, 0x0039900000300ull, 0x0039900000301ull, 0x0039900000304ull, 0x0039900000306ull, 0x0039900000308ull,
+    0x0039900000313ull, 0x0039900000314ull, 0x0039F00000300ull, 0x0039F00000301ull, 0x0039F00000313ull, 0x0039F00000314ull,
+    0x003A100000314ull, 0x003A500000300ull, 0x003A500000301ull, 0x003A500000304ull, 0x003A500000306ull, 0x003A500000308ull,
+    0x003A500000314ull, 0x003A900000300ull, 0x003A900000301ull, 0x003A900000313ull, 0x003A900000314ull, 0x003A900000345ull,
+    0x003AC00000345ull, 0x003AE00000345ull, 0x003B100000300ull, 0x003B100000301ull, 0x003B100000304ull, 0x003B100000306ull,
+    0x003B100000313ull, 0x003B100000314ull, 0x003B100000342ull, 0x003B100000345ull, 0x003B500000300ull, 0x003B500000301ull,
+    0x003B500000313ull, 0x003B500000314ull, 0x003B700000300ull, 0x003B700000301ull, 0x003B700000313ull, 0x003B700000314ull,
+    0x003B700000342ull, 0x003B700000345ull, 0x003B900000300ull, 0x003B900000301ull, 0x003B900000304ull, 0x003B900000306ull,
+    0x003B900000308ull, 0x003B900000313ull, 0x003B900000314ull, 0x003B900000342ull, 0x003BF00000300ull, 0x003BF00000301ull,
+    0x003BF00000313ull, 0x003BF00000314ull, 0x003C100000313ull, 0x003C100000314ull, 0x003C500000300ull, 0x003C500000301ull,
+    0x003C500000304ull, 0x003C500000306ull, 0x003C500000308ull, 0x003C500000313ull, 0x003C500000314ull, 0x003C500000342ull,
+    0x003C900000300ull, 0x003C900000301ull, 0x003C900000313ull, 0x003C900000314ull, 0x003C900000342ull, 0x003C900000345ull,
+    0x003CA00000300ull, 0x003CA00000301ull, 0x003CA00000342ull, 0x003CB00000300ull, 0x003CB00000301ull, 0x003CB00000342ull,
+    0x003CE00000345ull, 0x003D200000301ull, 0x003D200000308ull, 0x0040600000308ull, 0x0041000000306ull, 0x0041000000308ull,
+    0x0041300000301ull, 0x0041500000300ull, 0x0041500000306ull, 0x0041500000308ull, 0x0041600000306ull, 0x0041600000308ull,
+    0x0041700000308ull, 0x0041800000300ull, 0x0041800000304ull, 0x0041800000306ull, 0x0041800000308ull, 0x0041A00000301ull,
+    0x0041E00000308ull, 0x0042300000304ull, 0x0042300000306ull, 0x0042300000308ull, 0x004230000030Bull, 0x0042700000308ull,
+    0x0042B00000308ull, 0x0042D00000308ull, 0x0043000000306ull, 0x0043000000308ull, 0x0043300000301ull, 0x0043500000300ull,
+    0x0043500000306ull, 0x0043500000308ull, 0x0043600000306ull, 0x0043600000308ull, 0x0043700000308ull, 0x0043800000300ull,
+    0x0043800000304ull, 0x0043800000306ull, 0x0043800000308ull, 0x0043A00000301ull, 0x0043E00000308ull, 0x0044300000304ull,
+    0x0044300000306ull, 0x0044300000308ull, 0x004430000030Bull, 0x0044700000308ull, 0x0044B00000308ull, 0x0044D00000308ull,
+    0x0045600000308ull, 0x004740000030Full, 0x004750000030Full, 0x004D800000308ull, 0x004D900000308ull, 0x004E800000308ull,
+    0x004E900000308ull, 0x0062700000653ull, 0x0062700000654ull, 0x0062700000655ull, 0x0064800000654ull, 0x0064A00000654ull,
+    0x006C100000654ull, 0x006D200000654ull, 0x006D500000654ull, 0x009280000093Cull, 0x009300000093Cull, 0x009330000093Cull,
+    0x009C7000009BEull, 0x009C7000009D7ull, 0x00B4700000B3Eull, 0x00B4700000B56ull, 0x00B4700000B57ull, 0x00B9200000BD7ull,
+    0x00BC600000BBEull, 0x00BC600000BD7ull, 0x00BC700000BBEull, 0x00C4600000C56ull, 0x00CBF00000CD5ull, 0x00CC600000CC2ull,
+    0x00CC600000CD5ull, 0x00CC600000CD6ull, 0x00CCA00000CD5ull, 0x00D4600000D3Eull, 0x00D4600000D57ull, 0x00D4700000D3Eull,
+    0x00DD900000DCAull, 0x00DD900000DCFull, 0x00DD900000DDFull, 0x00DDC00000DCAull, 0x010250000102Eull, 0x01B0500001B35ull,
+    0x01B0700001B35ull, 0x01B0900001B35ull, 0x01B0B00001B35ull, 0x01B0D00001B35ull, 0x01B1100001B35ull, 0x01B3A00001B35ull,
+    0x01B3C00001B35ull, 0x01B3E00001B35ull, 0x01B3F00001B35ull, 0x01B4200001B35ull, 0x01E3600000304ull, 0x01E3700000304ull,
+    0x01E5A00000304ull, 0x01E5B00000304ull, 0x01E6200000307ull, 0x01E6300000307ull, 0x01EA000000302ull, 0x01EA000000306ull,
+    0x01EA100000302ull, 0x01EA100000306ull, 0x01EB800000302ull, 0x01EB900000302ull, 0x01ECC00000302ull, 0x01ECD00000302ull,
+    0x01F0000000300ull, 0x01F0000000301ull, 0x01F0000000342ull, 0x01F0000000345ull, 0x01F0100000300ull, 0x01F0100000301ull,
+    0x01F0100000342ull, 0x01F0100000345ull, 0x01F0200000345ull, 0x01F0300000345ull, 0x01F0400000345ull, 0x01F0500000345ull,
+    0x01F0600000345ull, 0x01F0700000345ull, 0x01F0800000300ull, 0x01F0800000301ull, 0x01F0800000342ull, 0x01F0800000345ull,
+    0x01F0900000300ull, 0x01F0900000301ull, 0x01F0900000342ull, 0x01F0900000345ull, 0x01F0A00000345ull, 0x01F0B00000345ull,
+    0x01F0C00000345ull, 0x01F0D00000345ull, 0x01F0E00000345ull, 0x01F0F00000345ull, 0x01F1000000300ull, 0x01F1000000301ull,
+    0x01F1100000300ull, 0x01F1100000301ull, 0x01F1800000300ull, 0x01F1800000301ull, 0x01F1900000300ull, 0x01F1900000301ull,
+    0x01F2000000300ull, 0x01F2000000301ull, 0x01F2000000342ull, 0x01F2000000345ull, 0x01F2100000300ull, 0x01F2100000301ull,
+    0x01F2100000342ull, 0x01F2100000345ull, 0x01F2200000345ull, 0x01F2300000345ull, 0x01F2400000345ull, 0x01F2500000345ull,
+    0x01F2600000345ull, 0x01F2700000345ull, 0x01F2800000300ull, 0x01F2800000301ull, 0x01F2800000342ull, 0x01F2800000345ull,
+    0x01F2900000300ull, 0x01F2900000301ull, 0x01F2900000342ull, 0x01F2900000345ull, 0x01F2A00000345ull, 0x01F2B00000345ull,
+    0x01F2C00000345ull, 0x01F2D00000345ull, 0x01F2E00000345ull, 0x01F2F00000345ull, 0x01F3000000300ull, 0x01F3000000301ull,
+    0x01F3000000342ull, 0x01F3100000300ull, 0x01F3100000301ull, 0x01F3100000342ull, 0x01F3800000300ull, 0x01F3800000301ull,
+    0x01F3800000342ull, 0x01F3900000300ull, 0x01F3900000301ull, 0x01F3900000342ull, 0x01F4000000300ull, 0x01F4000000301ull,
+    0x01F4100000300ull, 0x01F4100000301ull, 0x01F4800000300ull, 0x01F4800000301ull, 0x01F4900000300ull, 0x01F4900000301ull,
+    0x01F5000000300ull, 0x01F5000000301ull, 0x01F5000000342ull, 0x01F5100000300ull, 0x01F5100000301ull, 0x01F5100000342ull,
+    0x01F5900000300ull, 0x01F5900000301ull, 0x01F5900000342ull, 0x01F6000000300ull, 0x01F6000000301ull, 0x01F6000000342ull,
+    0x01F6000000345ull, 0x01F6100000300ull, 0x01F6100000301ull, 0x01F6100000342ull, 0x01F6100000345ull, 0x01F6200000345ull,
+    0x01F6300000345ull, 0x01F6400000345ull, 0x01F6500000345ull, 0x01F6600000345ull, 0x01F6700000345ull, 0x01F6800000300ull,
+    0x01F6800000301ull, 0x01F6800000342ull, 0x01F6800000345ull, 0x01F6900000300ull, 0x01F6900000301ull, 0x01F6900000342ull,
+    0x01F6900000345ull, 0x01F6A00000345ull, 0x01F6B00000345ull, 0x01F6C00000345ull, 0x01F6D00000345ull, 0x01F6E00000345ull,
+    0x01F6F00000345ull, 0x01F7000000345ull, 0x01F7400000345ull, 0x01F7C00000345ull, 0x01FB600000345ull, 0x01FBF00000300ull,
+    0x01FBF00000301ull, 0x01FBF00000342ull, 0x01FC600000345ull, 0x01FF600000345ull, 0x01FFE00000300ull, 0x01FFE00000301ull,
+    0x01FFE00000342ull, 0x0219000000338ull, 0x0219200000338ull, 0x0219400000338ull, 0x021D000000338ull, 0x021D200000338ull,
+    0x021D400000338ull, 0x0220300000338ull, 0x0220800000338ull, 0x0220B00000338ull, 0x0222300000338ull, 0x0222500000338ull,
+    0x0223C00000338ull, 0x0224300000338ull, 0x0224500000338ull, 0x0224800000338ull, 0x0224D00000338ull, 0x0226100000338ull,
+    0x0226400000338ull, 0x0226500000338ull, 0x0227200000338ull, 0x0227300000338ull, 0x0227600000338ull, 0x0227700000338ull,
+    0x0227A00000338ull, 0x0227B00000338ull, 0x0227C00000338ull, 0x0227D00000338ull, 0x0228200000338ull, 0x0228300000338ull,
+    0x0228600000338ull, 0x0228700000338ull, 0x0229100000338ull, 0x0229200000338ull, 0x022A200000338ull, 0x022A800000338ull,
+    0x022A900000338ull, 0x022AB00000338ull, 0x022B200000338ull, 0x022B300000338ull, 0x022B400000338ull, 0x022B500000338ull,
+    0x0304600003099ull, 0x0304B00003099ull, 0x0304D00003099ull, 0x0304F00003099ull, 0x0305100003099ull, 0x0305300003099ull,
+    0x0305500003099ull, 0x0305700003099ull, 0x0305900003099ull, 0x0305B00003099ull, 0x0305D00003099ull, 0x0305F00003099ull,
+    0x0306100003099ull, 0x0306400003099ull, 0x0306600003099ull, 0x0306800003099ull, 0x0306F00003099ull, 0x0306F0000309Aull,
+    0x0307200003099ull, 0x030720000309Aull, 0x0307500003099ull, 0x030750000309Aull, 0x0307800003099ull, 0x030780000309Aull,
+    0x0307B00003099ull, 0x0307B0000309Aull, 0x0309D00003099ull, 0x030A600003099ull, 0x030AB00003099ull, 0x030AD00003099ull,
+    0x030AF00003099ull, 0x030B100003099ull, 0x030B300003099ull, 0x030B500003099ull, 0x030B700003099ull, 0x030B900003099ull,
+    0x030BB00003099ull, 0x030BD00003099ull, 0x030BF00003099ull, 0x030C100003099ull, 0x030C400003099ull, 0x030C600003099ull,
+    0x030C800003099ull, 0x030CF00003099ull, 0x030CF0000309Aull, 0x030D200003099ull, 0x030D20000309Aull, 0x030D500003099ull,
+    0x030D50000309Aull, 0x030D800003099ull, 0x030D80000309Aull, 0x030DB00003099ull, 0x030DB0000309Aull, 0x030EF00003099ull,
+    0x030F000003099ull, 0x030F100003099ull, 0x030F200003099ull, 0x030FD00003099ull, 0x11099000110BAull, 0x1109B000110BAull,
+    0x110A5000110BAull, 0x1113100011127ull, 0x1113200011127ull, 0x113470001133Eull, 0x1134700011357ull, 0x114B9000114B0ull,
+    0x114B9000114BAull, 0x114B9000114BDull, 0x115B8000115AFull, 0x115B9000115AFull, 0x1193500011930ull,
+};
+
+const uint32_t compositionValues[941] = {
+    0x0226E, 0x02260, 0x0226F, 0x000C0, 0x000C1, 0x000C2, 0x000C3, 0x00100, 0x00102, 0x00226, 0x000C4, 0x01EA2,
+    0x000C5, 0x001CD, 0x00200, 0x00202, 0x01EA0, 0x01E00, 0x00104, 0x01E02, 0x01E04, 0x01E06, 0x00106, 0x00108,
+    0x0010A, 0x0010C, 0x000C7, 0x01E0A, 0x0010E, 0x01E0C, 0x01E10, 0x01E12, 0x01E0E, 0x000C8, 0x000C9, 0x000CA,
+    0x01EBC, 0x00112, 0x00114, 0x00116, 0x000CB, 0x01EBA, 0x0011A, 0x00204, 0x00206, 0x01EB8, 0x00228, 0x00118,
+    0x01E18, 0x01E1A, 0x01E1E, 0x001F4, 0x0011C, 0x01E20, 0x0011E, 0x00120, 0x001E6, 0x00122, 0x00124, 0x01E22,
+    0x01E26, 0x0021E, 0x01E24, 0x01E28, 0x01E2A, 0x000CC, 0x000CD, 0x000CE, 0x00128, 0x0012A, 0x0012C, 0x00130,
+    0x000CF, 0x01EC8, 0x001CF, 0x00208, 0x0020A, 0x01ECA, 0x0012E, 0x01E2C, 0x00134, 0x01E30, 0x001E8, 0x01E32,
+    0x00136, 0x01E34, 0x00139, 0x0013D, 0x01E36, 0x0013B, 0x01E3C, 0x01E3A, 0x01E3E, 0x01E40, 0x01E42, 0x001F8,
+    0x00143, 0x000D1, 0x01E44, 0x00147, 0x01E46, 0x00145, 0x01E4A, 0x01E48, 0x000D2, 0x000D3, 0x000D4, 0x000D5,
+    0x0014C, 0x0014E, 0x0022E, 0x000D6, 0x01ECE, 0x00150, 0x001D1, 0x0020C, 0x0020E, 0x001A0, 0x01ECC, 0x001EA,
+    0x01E54, 0x01E56, 0x00154, 0x01E58, 0x00158, 0x00210, 0x00212, 0x01E5A, 0x00156, 0x01E5E, 0x0015A, 0x0015C,
+    0x01E60, 0x00160, 0x01E62, 0x00218, 0x0015E, 0x01E6A, 0x00164, 0x01E6C, 0x0021A, 0x00162, 0x01E70, 0x01E6E,
+    0x000D9, 0x000DA, 0x000DB, 0x00168, 0x0016A, 0x0016C, 0x000DC, 0x01EE6, 0x0016E, 0x00170, 0x001D3, 0x00214,
+    0x00216, 0x001AF, 0x01EE4, 0x01E72, 0x00172, 0x01E76, 0x01E74, 0x01E7C, 0x01E7E, 0x01E80, 0x01E82, 0x00174,
+    0x01E86, 0x01E84, 0x01E88, 0x01E8A, 0x01E8C, 0x01EF2, 0x000DD, 0x00176, 0x01EF8, 0x00232, 0x01E8E, 0x00178,
+    0x01EF6, 0x01EF4, 0x00179, 0x01E90, 0x0017B, 0x0017D, 0x01E92, 0x01E94, 0x000E0, 0x000E1, 0x000E2, 0x000E3,
+    0x00101, 0x00103, 0x00227, 0x000E4, 0x01EA3, 0x000E5, 0x001CE, 0x00201, 0x00203, 0x01EA1, 0x01E01, 0x00105,
+    0x01E03, 0x01E05, 0x01E07, 0x00107, 0x00109, 0x0010B, 0x0010D, 0x000E7, 0x01E0B, 0x0010F, 0x01E0D, 0x01E11,
+    0x01E13, 0x01E0F, 0x000E8, 0x000E9, 0x000EA, 0x01EBD, 0x00113, 0x00115, 0x00117, 0x000EB, 0x01EBB, 0x0011B,
+    0x00205, 0x00207, 0x01EB9, 0x00229, 0x00119, 0x01E19, 0x01E1B, 0x01E1F, 0x001F5, 0x0011D, 0x01E21, 0x0011F,
+    0x00121, 0x001E7, 0x00123, 0x00125, 0x01E23, 0x01E27, 0x0021F, 0x01E25, 0x01E29, 0x01E2B, 0x01E96, 0x000EC,
+    0x000ED, 0x000EE, 0x00129, 0x0012B, 0x0012D, 0x000EF, 0x01EC9, 0x001D0, 0x00209, 0x0020B, 0x01ECB, 0x0012F,
+    0x01E2D, 0x00135, 0x001F0, 0x01E31, 0x001E9, 0x01E33, 0x00137, 0x01E35, 0x0013A, 0x0013E, 0x01E37, 0x0013C,
+    0x01E3D, 0x01E3B, 0x01E3F, 0x01E41, 0x01E43, 0x001F9, 0x00144, 0x000F1, 0x01E45, 0x00148, 0x01E47, 0x00146,
+    0x01E4B, 0x01E49, 0x000F2, 0x000F3, 0x000F4, 0x000F5, 0x0014D, 0x0014F, 0x0022F, 0x000F6, 0x01ECF, 0x00151,
+    0x001D2, 0x0020D, 0x0020F, 0x001A1, 0x01ECD, 0x001EB, 0x01E55, 0x01E57, 0x00155, 0x01E59, 0x00159, 0x00211,
+    0x00213, 0x01E5B, 0x00157, 0x01E5F, 0x0015B, 0x0015D, 0x01E61, 0x00161, 0x01E63, 0x00219, 0x0015F, 0x01E6B,
+    0x01E97, 0x00165, 0x01E6D, 0x0021B, 0x00163, 0x01E71, 0x01E6F, 0x000F9, 0x000FA, 0x000FB, 0x00169, 0x0016B,
+    0x0016D, 0x000FC, 0x01EE7, 0x0016F, 0x00171, 0x001D4, 0x00215, 0x00217, 0x001B0, 0x01EE5, 0x01E73, 0x00173,
+    0x01E77, 0x01E75, 0x01E7D, 0x01E7F, 0x01E81, 0x01E83, 0x00175, 0x01E87, 0x01E85, 0x01E98, 0x01E89, 0x01E8B,
+    0x01E8D, 0x01EF3, 0x000FD, 0x00177, 0x01EF9, 0x00233, 0x01E8F, 0x000FF, 0x01EF7, 0x01E99, 0x01EF5, 0x0017A,
+    0x01E91, 0x0017C, 0x0017E, 0x01E93, 0x01E95, 0x01FED, 0x00385, 0x01FC1, 0x01EA6, 0x01EA4, 0x01EAA, 0x01EA8,
+    0x001DE, 0x001FA, 0x001FC, 0x001E2, 0x01E08, 0x01EC0, 0x01EBE, 0x01EC4, 0x01EC2, 0x01E2E, 0x01ED2, 0x01ED0,
+    0x01ED6, 0x01ED4, 0x01E4C, 0x0022C, 0x01E4E, 0x0022A, 0x001FE, 0x001DB, 0x001D7, 0x001D5, 0x001D9, 0x01EA7,
+    0x01EA5, 0x01EAB, 0x01EA9, 0x001DF, 0x001FB, 0x001FD, 0x001E3, 0x01E09, 0x01EC1, 0x01EBF, 0x01EC5, 0x01EC3,
+    0x01E2F, 0x01ED3, 0x01ED1, 0x01ED7, 0x01ED5, 0x01E4D, 0x0022D, 0x01E4F, 0x0022B, 0x001FF, 0x001DC, 0x001D8,
+    0x001D6, 0x001DA, 0x01EB0, 0x01EAE, 0x01EB4, 0x01EB2, 0x01EB1, 0x01EAF, 0x01EB5, 0x01EB3, 0x01E14, 0x01E16,
+    0x01E15, 0x01E17, 0x01E50, 0x01E52, 0x01E51, 0x01E53, 0x01E64, 0x01E65, 0x01E66, 0x01E67, 0x01E78, 0x01E79,
+    0x01E7A, 0x01E7B, 0x01E9B, 0x01EDC, 0x01EDA, 0x01EE0, 0x01EDE, 0x01EE2, 0x01EDD, 0x01EDB, 0x01EE1, 0x01EDF,
+    0x01EE3, 0x01EEA, 0x01EE8, 0x01EEE, 0x01EEC, 0x01EF0, 0x01EEB, 0x01EE9, 0x01EEF, 0x01EED, 0x01EF1, 0x001EE,
+    0x001EC, 0x001ED, 0x001E0, 0x001E1, 0x01E1C, 0x01E1D, 0x00230, 0x00231, 0x001EF, 0x01FBA, 0x00386, 0x01FB9,
+    0x01FB8, 0x01F08, 0x01F09, 0x01FBC, 0x01FC8, 0x00388, 0x01F18, 0x01F19, 0x01FCA, 0x00389, 0x01F28, 0x01F29,
+    0x01FCC, 0x01FDA, 0x0038A, 0x01FD9, 0x01FD8, 0x003AA, 0x01F38, 0x01F39, 0x01FF8, 0x0038C, 0x01F48, 0x01F49,
+    0x01FEC, 0x01FEA, 0x0038E, 0x01FE9, 0x01FE8, 0x003AB, 0x01F59, 0x01FFA, 0x0038F, 0x01F68, 0x01F69, 0x01FFC,
+    0x01FB4, 0x01FC4, 0x01F70, 0x003AC, 0x01FB1, 0x01FB0, 0x01F00, 0x01F01, 0x01FB6, 0x01FB3, 0x01F72, 0x003AD,
+    0x01F10, 0x01F11, 0x01F74, 0x003AE, 0x01F20, 0x01F21, 0x01FC6, 0x01FC3, 0x01F76, 0x003AF, 0x01FD1, 0x01FD0,
+    0x003CA, 0x01F30, 0x01F31, 0x01FD6, 0x01F78, 0x003CC, 0x01F40, 0x01F41, 0x01FE4, 0x01FE5, 0x01F7A, 0x003CD,
+    0x01FE1, 0x01FE0, 0x003CB, 0x01F50, 0x01F51, 0x01FE6, 0x01F7C, 0x003CE, 0x01F60, 0x01F61, 0x01FF6, 0x01FF3,
+    0x01FD2, 0x00390, 0x01FD7, 0x01FE2, 0x003B0, 0x01FE7, 0x01FF4, 0x003D3, 0x003D4, 0x00407, 0x004D0, 0x004D2,
+    0x00403, 0x00400, 0x004D6, 0x00401, 0x004C1, 0x004DC, 0x004DE, 0x0040D, 0x004E2, 0x00419, 0x004E4, 0x0040C,
+    0x004E6, 0x004EE, 0x0040E, 0x004F0, 0x004F2, 0x004F4, 0x004F8, 0x004EC, 0x004D1, 0x004D3, 0x00453, 0x00450,
+    0x004D7, 0x00451, 0x004C2, 0x004DD, 0x004DF, 0x0045D, 0x004E3, 0x00439, 0x004E5, 0x0045C, 0x004E7, 0x004EF,
+    0x0045E, 0x004F1, 0x004F3, 0x004F5, 0x004F9, 0x004ED, 0x00457, 0x00476, 0x00477, 0x004DA, 0x004DB, 0x004EA,
+    0x004EB, 0x00622, 0x00623, 0x00625, 0x00624, 0x00626, 0x006C2, 0x006D3, 0x006C0, 0x00929, 0x00931, 0x00934,
+    0x009CB, 0x009CC, 0x00B4B, 0x00B48, 0x00B4C, 0x00B94, 0x00BCA, 0x00BCC, 0x00BCB, 0x00C48, 0x00CC0, 0x00CCA,
+    0x00CC7, 0x00CC8, 0x00CCB, 0x00D4A, 0x00D4C, 0x00D4B, 0x00DDA, 0x00DDC, 0x00DDE, 0x00DDD, 0x01026, 0x01B06,
+    0x01B08, 0x01B0A, 0x01B0C, 0x01B0E, 0x01B12, 0x01B3B, 0x01B3D, 0x01B40, 0x01B41, 0x01B43, 0x01E38, 0x01E39,
+    0x01E5C, 0x01E5D, 0x01E68, 0x01E69, 0x01EAC, 0x01EB6, 0x01EAD, 0x01EB7, 0x01EC6, 0x01EC7, 0x01ED8, 0x01ED9,
+    0x01F02, 0x01F04, 0x01F06, 0x01F80, 0x01F03, 0x01F05, 0x01F07, 0x01F81, 0x01F82, 0x01F83, 0x01F84, 0x01F85,
+    0x01F86, 0x01F87, 0x01F0A, 0x01F0C, 0x01F0E, 0x01F88, 0x01F0B, 0x01F0D, 0x01F0F, 0x01F89, 0x01F8A, 0x01F8B,
+    0x01F8C, 0x01F8D, 0x01F8E, 0x01F8F, 0x01F12, 0x01F14, 0x01F13, 0x01F15, 0x01F1A, 0x01F1C, 0x01F1B, 0x01F1D,
+    0x01F22, 0x01F24, 0x01F26, 0x01F90, 0x01F23, 0x01F25, 0x01F27, 0x01F91, 0x01F92, 0x01F93, 0x01F94, 0x01F95,
+    0x01F96, 0x01F97, 0x01F2A, 0x01F2C, 0x01F2E, 0x01F98, 0x01F2B, 0x01F2D, 0x01F2F, 0x01F99, 0x01F9A, 0x01F9B,
+    0x01F9C, 0x01F9D, 0x01F9E, 0x01F9F, 0x01F32, 0x01F34, 0x01F36, 0x01F33, 0x01F35, 0x01F37, 0x01F3A, 0x01F3C,
+    0x01F3E, 0x01F3B, 0x01F3D, 0x01F3F, 0x01F42, 0x01F44, 0x01F43, 0x01F45, 0x01F4A, 0x01F4C, 0x01F4B, 0x01F4D,
+    0x01F52, 0x01F54, 0x01F56, 0x01F53, 0x01F55, 0x01F57, 0x01F5B, 0x01F5D, 0x01F5F, 0x01F62, 0x01F64, 0x01F66,
+    0x01FA0, 0x01F63, 0x01F65, 0x01F67, 0x01FA1, 0x01FA2, 0x01FA3, 0x01FA4, 0x01FA5, 0x01FA6, 0x01FA7, 0x01F6A,
+    0x01F6C, 0x01F6E, 0x01FA8, 0x01F6B, 0x01F6D, 0x01F6F, 0x01FA9, 0x01FAA, 0x01FAB, 0x01FAC, 0x01FAD, 0x01FAE,
+    0x01FAF, 0x01FB2, 0x01FC2, 0x01FF2, 0x01FB7, 0x01FCD, 0x01FCE, 0x01FCF, 0x01FC7, 0x01FF7, 0x01FDD, 0x01FDE,
+    0x01FDF, 0x0219A, 0x0219B, 0x021AE, 0x021CD, 0x021CF, 0x021CE, 0x02204, 0x02209, 0x0220C, 0x02224, 0x02226,
+    0x02241, 0x02244, 0x02247, 0x02249, 0x0226D, 0x02262, 0x02270, 0x02271, 0x02274, 0x02275, 0x02278, 0x02279,
+    0x02280, 0x02281, 0x022E0, 0x022E1, 0x02284, 0x02285, 0x02288, 0x02289, 0x022E2, 0x022E3, 0x022AC, 0x022AD,
+    0x022AE, 0x022AF, 0x022EA, 0x022EB, 0x022EC, 0x022ED, 0x03094, 0x0304C, 0x0304E, 0x03050, 0x03052, 0x03054,
+    0x03056, 0x03058, 0x0305A, 0x0305C, 0x0305E, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071,
+    0x03073, 0x03074, 0x03076, 0x03077, 0x03079, 0x0307A, 0x0307C, 0x0307D, 0x0309E, 0x030F4, 0x030AC, 0x030AE,
+    0x030B0, 0x030B2, 0x030B4, 0x030B6, 0x030B8, 0x030BA, 0x030BC, 0x030BE, 0x030C0, 0x030C2, 0x030C5, 0x030C7,
+    0x030C9, 0x030D0, 0x030D1, 0x030D3, 0x030D4, 0x030D6, 0x030D7, 0x030D9, 0x030DA, 0x030DC, 0x030DD, 0x030F7,
+    0x030F8, 0x030F9, 0x030FA, 0x030FE, 0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BC,
+    0x114BB, 0x114BE, 0x115BA, 0x115BB, 0x11938,
+};
+
+} //end namespace fl::detail
@@ -9,19 +9,329 @@ This software is licensed under the BSD 3-Clause License, which can be found in
 */
 
 #include "utf8string.hpp"   //Gets all our headers
+#include "fl_util.hpp"      //Gets the SSE2 detection
+#include "instrument.hpp"   //Counts decoding as its own stage
 #include <cstring>          //Gets memcpy
+#include <bit>              //Bit scans over comparison masks
 #include <fstream>          //Allows us to read directly from a string
 #include <algorithm>
+#include <memory>           //Allocates heap storage for long strings
 
 namespace fl {
 
+/*======================================================================================================*/
+/*                                        Search Kernels                                                */
+/*======================================================================================================*/
+
+/*
+ * Every kernel works over raw uChar runs, four at a time in an SSE2 register. A uChar is a full 32 bit
+ * lane, so a byte movemask of a lane compare sets four bits per matching uChar, and the index of the first
+ * match is the count of trailing zeros divided by four. Each kernel finishes its tail with a scalar loop
+ */
+
+#if FL_HAS_SSE2
+static inline __m128i loadUChars(const uChar* p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+static inline uint32_t laneMask(__m128i compared) noexcept {
+    return static_cast<uint32_t>(_mm_movemask_epi8(compared));
+}
+#endif
+
+/**
+ * @brief finds the first `target` in `data`, or `len` if there is none
+ */
+static size_t findUChar(const uChar* data, size_t len, uChar target) noexcept {
+    size_t i = 0;
+#if FL_HAS_SSE2
+    const __m128i needle = _mm_set1_epi32(static_cast<int>(target.n));
+    //Four registers per trip keeps the compare units busy on long comments and literals
+    for (; (i + 16) <= len; i += 16) {
+        const __m128i a = _mm_cmpeq_epi32(loadUChars(data + i), needle);
+        const __m128i b = _mm_cmpeq_epi32(loadUChars(data + i + 4), needle);
+        const __m128i c = _mm_cmpeq_epi32(loadUChars(data + i + 8), needle);
+        const __m128i d = _mm_cmpeq_epi32(loadUChars(data + i + 12), needle);
+        if (laneMask(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+            const uint64_t mask = laneMask(a) | (static_cast<uint64_t>(laneMask(b)) << 16) |
+                (static_cast<uint64_t>(laneMask(c)) << 32) | (static_cast<uint64_t>(laneMask(d)) << 48);
+            return i + (std::countr_zero(mask) / 4);
+        }
+    }
+    for (; (i + 4) <= len; i += 4) {
+        const uint32_t mask = laneMask(_mm_cmpeq_epi32(loadUChars(data + i), needle));
+        if (mask != 0) {
+            return i + (std::countr_zero(mask) / 4);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (data[i] == target) {
+            return i;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief finds the first uChar in `data` that is any of the `setLen` uChars in `set`, or `len` if there is none
+ */
+static size_t findAnyUChar(const uChar* data, size_t len, const uChar* set, size_t setLen) noexcept {
+    if (setLen == 1) {
+        return findUChar(data, len, set[0]);
+    }
+    size_t i = 0;
+#if FL_HAS_SSE2
+    for (; (i + 4) <= len; i += 4) {
+        const __m128i block = loadUChars(data + i);
+        __m128i hits = _mm_setzero_si128();
+        for (size_t s = 0; s < setLen; s++) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi32(block, _mm_set1_epi32(static_cast<int>(set[s].n))));
+        }
+        const uint32_t mask = laneMask(hits);
+        if (mask != 0) {
+            return i + (std::countr_zero(mask) / 4);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        for (size_t s = 0; s < setLen; s++) {
+            if (data[i] == set[s]) {
+                return i;
+            }
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief finds the index of the first uChar where `a` and `b` differ, or `len` if they match
+ */
+static size_t mismatchUChars(const uChar* a, const uChar* b, size_t len) noexcept {
+    size_t i = 0;
+#if FL_HAS_SSE2
+    for (; (i + 8) <= len; i += 8) {
+        const uint32_t lo = laneMask(_mm_cmpeq_epi32(loadUChars(a + i), loadUChars(b + i)));
+        const uint32_t hi = laneMask(_mm_cmpeq_epi32(loadUChars(a + i + 4), loadUChars(b + i + 4)));
+        const uint32_t mask = lo | (hi << 16);
+        if (mask != 0xFFFFFFFFu) {
+            return i + (std::countr_one(mask) / 4);
+        }
+    }
+    for (; (i + 4) <= len; i += 4) {
+        const uint32_t mask = laneMask(_mm_cmpeq_epi32(loadUChars(a + i), loadUChars(b + i)));
+        if (mask != 0xFFFFu) {
+            return i + (std::countr_one(mask) / 4);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief finds the first run of `needle` in `data`, or `len` if there is none
+ * @details candidates are found by checking the first and last uChar of the needle against four
+ * positions at once, so only positions matching at both ends are ever compared in full
+ */
+static size_t findUChars(const uChar* data, size_t len, const uChar* needle, size_t needleLen) noexcept {
+    if (needleLen == 0) {
+        return 0;
+    }
+    if (needleLen > len) {
+        return len;
+    }
+    if (needleLen == 1) {
+        return findUChar(data, len, needle[0]);
+    }
+
+    const size_t last = needleLen - 1;
+    const size_t lastStart = len - needleLen;
+    size_t i = 0;
+#if FL_HAS_SSE2
+    const __m128i first = _mm_set1_epi32(static_cast<int>(needle[0].n));
+    const __m128i final = _mm_set1_epi32(static_cast<int>(needle[last].n));
+    for (; (i + 4) <= (lastStart + 1); i += 4) {
+        const __m128i atFirst = _mm_cmpeq_epi32(loadUChars(data + i), first);
+        const __m128i atFinal = _mm_cmpeq_epi32(loadUChars(data + i + last), final);
+        for (uint32_t mask = laneMask(_mm_and_si128(atFirst, atFinal)); mask != 0; mask &= ~(0xFu << std::countr_zero(mask))) {
+            const size_t candidate = i + (std::countr_zero(mask) / 4);
+            if (mismatchUChars(data + candidate + 1, needle + 1, needleLen - 2) == (needleLen - 2)) {
+                return candidate;
+            }
+        }
+    }
+#endif
+    for (; i <= lastStart; i++) {
+        if ((data[i] == needle[0]) && (data[i + last] == needle[last]) &&
+            (mismatchUChars(data + i + 1, needle + 1, needleLen - 2) == (needleLen - 2))) {
+            return i;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief compares two uChar runs in the same order as `uChar::operator<`
+ * @returns a negative number, zero, or a positive number as `a` sorts before, equal to, or after `b`
+ */
+static int compareUChars(const uChar* a, size_t aLen, const uChar* b, size_t bLen) noexcept {
+    const size_t shared = std::min(aLen, bLen);
+    const size_t at = mismatchUChars(a, b, shared);
+    if (at != shared) {
+        return (a[at].n < b[at].n) ? -1 : 1;
+    }
+    return (aLen == bLen) ? 0 : ((aLen < bLen) ? -1 : 1);
+}
+
+/*======================================================================================================*/
+/*                                        Utf8 Encoding                                                 */
+/*======================================================================================================*/
+
+/**
+ * @brief writes one uChar back out as utf8, always storing 4 bytes but only advancing by its write size
+ */
+static inline char* encodeUChar(uChar c, char* out) noexcept {
+    out[0] = static_cast<char>(c.n & 0xFF);
+    out[1] = static_cast<char>((c.n >> 8) & 0xFF);
+    out[2] = static_cast<char>((c.n >> 16) & 0xFF);
+    out[3] = static_cast<char>(c.n >> 24);
+    return out + c.writeSize();
+}
+
+size_t encodeUtf8(const uChar* data, size_t count, char* out) noexcept {
+    char* cursor = out;
+    size_t i = 0;
+#if FL_HAS_SSE2
+    //An ascii uChar is 0x010000XX with XX below 0x80, so taking off the size byte must leave only the low 7 bits
+    const __m128i sizeByte = _mm_set1_epi32(0x01000000);
+    const __m128i notAscii = _mm_set1_epi32(~0x7F);
+    while ((i + 16) <= count) {
+        const __m128i a = _mm_sub_epi32(loadUChars(data + i), sizeByte);
+        const __m128i b = _mm_sub_epi32(loadUChars(data + i + 4), sizeByte);
+        const __m128i c = _mm_sub_epi32(loadUChars(data + i + 8), sizeByte);
+        const __m128i d = _mm_sub_epi32(loadUChars(data + i + 12), sizeByte);
+        const __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), notAscii);
+        if (laneMask(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFFu) {
+            //Every lane fits in a byte, so two saturating packs narrow 16 uChars into 16 bytes
+            const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(cursor), bytes);
+            cursor += 16;
+            i += 16;
+            continue;
+        }
+        //Mixed text is written out one uChar at a time until the next block
+        for (const size_t blockEnd = i + 16; i < blockEnd; i++) {
+            cursor = encodeUChar(data[i], cursor);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        cursor = encodeUChar(data[i], cursor);
+    }
+    return static_cast<size_t>(cursor - out);
+}
+
+uint32_t decodeUtf8(const char* bytes, size_t len, uChar* out, size_t& count) noexcept {
+    const char* const endPoint = bytes + len;
+    uChar* cursor = out;
+    while (bytes < endPoint) {
+#if FL_HAS_SSE2
+        //Ascii is widened 16 bytes at a time, by zero extending twice and adding the size byte
+        if ((endPoint - bytes) >= 16) {
+            const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+            if (_mm_movemask_epi8(raw) == 0) {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i sizeByte = _mm_set1_epi32(0x01000000);
+                const __m128i lo = _mm_unpacklo_epi8(raw, zero);
+                const __m128i hi = _mm_unpackhi_epi8(raw, zero);
+                __m128i* dst = reinterpret_cast<__m128i*>(cursor);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_unpacklo_epi16(lo, zero), sizeByte));
+                _mm_storeu_si128(dst + 1, _mm_or_si128(_mm_unpackhi_epi16(lo, zero), sizeByte));
+                _mm_storeu_si128(dst + 2, _mm_or_si128(_mm_unpacklo_epi16(hi, zero), sizeByte));
+                _mm_storeu_si128(dst + 3, _mm_or_si128(_mm_unpackhi_epi16(hi, zero), sizeByte));
+                cursor += 16;
+                bytes += 16;
+                continue;
+            }
+        }
+#endif
+        const uint8_t curByte = static_cast<uint8_t>(*bytes);
+        if (curByte < 0x80) {
+            *cursor++ = packUChar(1, 0, 0, curByte);
+            bytes++;
+            continue;
+        }
+
+        uint8_t trailBytes[3] = {0, 0, 0};
+        const int32_t leadingOnes = countLeadingOnes(curByte);
+        uint8_t headerToCheck = 0;
+        switch (leadingOnes) {
+            case 2 : { headerToCheck = 0b110; trailBytes[2] = 2; break; }
+            case 3 : { headerToCheck = 0b1110; trailBytes[2] = 3; break; }
+            case 4 : { headerToCheck = 0b11110; break; }
+            default: { count = static_cast<size_t>(cursor - out); return 1; }
+        }
+
+        if ((endPoint - bytes) < leadingOnes) { count = static_cast<size_t>(cursor - out); return 2; }
+        if ((curByte >> (7 - leadingOnes)) != headerToCheck) { count = static_cast<size_t>(cursor - out); return 3; }
+
+        for (int i = 1; i < leadingOnes; i++) {
+            const uint8_t newTrailByte = static_cast<uint8_t>(*(bytes + i));
+            if ((newTrailByte >> 6) != 0b10) {
+                count = static_cast<size_t>(cursor - out);
+                return 4;
+            }
+            trailBytes[i - 1] = newTrailByte;
+        }
+
+        //Only the lead and the first trail byte are needed to tell if the sequence is the shortest encoding of
+        //a scalar value, as every overlong form, surrogate, and code point past U+10FFFF shows up in those two
+        const uint8_t second = static_cast<uint8_t>(*(bytes + 1));
+        const bool overlong = (curByte < 0xC2) || ((curByte == 0xE0) && (second < 0xA0)) || ((curByte == 0xF0) && (second < 0x90));
+        const bool surrogate = (curByte == 0xED) && (second > 0x9F);
+        const bool tooLarge = (curByte > 0xF4) || ((curByte == 0xF4) && (second > 0x8F));
+        if (overlong || surrogate || tooLarge) {
+            count = static_cast<size_t>(cursor - out);
+            return overlong ? 5 : (surrogate ? 6 : 7);
+        }
+        *cursor++ = packUChar(trailBytes[2], trailBytes[1], trailBytes[0], curByte);
+        bytes += leadingOnes;
+    }
+    count = static_cast<size_t>(cursor - out);
+    return 0;
+}
+
+void appendUtf8(std::string& out, const uChar* data, size_t count) {
+    const size_t oldSize = out.size();
+    out.resize(oldSize + maxUtf8Bytes(count));
+    out.resize(oldSize + encodeUtf8(data, count, out.data() + oldSize));
+}
+
+/**
+ * @brief streams a run of uChars through a fixed buffer, so long strings cost one write per chunk
+ */
+static std::ostream& streamUChars(std::ostream& os, const uChar* data, size_t count) {
+    constexpr size_t chunkChars = 1024;
+    char buffer[maxUtf8Bytes(chunkChars)];
+    for (size_t i = 0; i < count; i += chunkChars) {
+        const size_t chunk = std::min(chunkChars, count - i);
+        os.write(buffer, static_cast<std::streamsize>(encodeUtf8(data + i, chunk, buffer)));
+    }
+    return os;
+}
+
 /*======================================================================================================*/
 /*                                           uChar                                                      */
 /*======================================================================================================*/
 
 std::ostream& operator<<(std::ostream& os, const uChar c) {
-    const char* cStart = reinterpret_cast<const char*>(&c);
-    os.write(cStart, c.writeSize());
+    char buffer[4];
+    os.write(buffer, static_cast<std::streamsize>(encodeUChar(c, buffer) - buffer));
     return os;
 }
 
@@ -33,16 +343,89 @@ bool uChar::operator<(const uChar& other) const {
 /*                                         Utf8String                                                   */
 /*======================================================================================================*/
 
-Utf8String::Utf8String(const char* dataPtr, size_t dataSize) {
+Utf8String::Utf8String() noexcept : heap{nullptr, 0}, lenAndFlag(0) {}
+
+Utf8String::Utf8String(const char* dataPtr, size_t dataSize) : Utf8String() {
     auto res = expandUtf8(dataPtr, dataSize);
     if (res != 0) {
         throw std::runtime_error("Failed to create UTF8 string with code: " + std::to_string(res));
     }
 }
 
-Utf8String::Utf8String(const uChar* uCharPtr, size_t charCount) {
-    data.resize(charCount);
-    std::memcpy(data.data(), uCharPtr, charCount);
+Utf8String::Utf8String(const uChar* uCharPtr, size_t charCount) : Utf8String() {
+    append(uCharPtr, charCount);
+}
+
+Utf8String::Utf8String(const Utf8String& other) : Utf8String() {
+    append(other.buffer(), other.length());
+}
+
+Utf8String::Utf8String(Utf8String&& other) noexcept : Utf8String() {
+    takeStorage(other);
+}
+
+Utf8String& Utf8String::operator=(const Utf8String& other) {
+    if (this != &other) {
+        setLength(0);
+        append(other.buffer(), other.length());
+    }
+    return *this;
+}
+
+Utf8String& Utf8String::operator=(Utf8String&& other) noexcept {
+    if (this != &other) {
+        release();
+        takeStorage(other);
+    }
+    return *this;
+}
+
+Utf8String::~Utf8String() {
+    release();
+}
+
+void Utf8String::reserve(size_t count) {
+    if (count <= capacity()) {
+        return;
+    }
+    //Grow geometrically so repeated appends stay amortized constant time
+    const size_t newCap = std::max(count, capacity() * 2);
+    uChar* newPtr = std::allocator<uChar>().allocate(newCap);
+    const size_t held = length();
+    std::memcpy(newPtr, buffer(), held * sizeof(uChar));
+    release();
+    heap.ptr = newPtr;
+    heap.cap = newCap;
+    lenAndFlag = held | heapFlag;
+}
+
+void Utf8String::append(const uChar* chars, size_t count) {
+    const size_t oldLen = length();
+    reserve(oldLen + count);
+    if (count != 0) {
+        std::memcpy(buffer() + oldLen, chars, count * sizeof(uChar));
+    }
+    setLength(oldLen + count);
+}
+
+void Utf8String::takeStorage(Utf8String& other) noexcept {
+    //Short strings are copied out of the other object, long ones just have their pointer taken
+    if (other.isInline()) {
+        std::copy(other.local, other.local + inlineCapacity, local);
+    } else {
+        heap = other.heap;
+    }
+    lenAndFlag = other.lenAndFlag;
+    other.heap = {nullptr, 0};
+    other.lenAndFlag = 0;
+}
+
+void Utf8String::release() noexcept {
+    if (!isInline()) {
+        std::allocator<uChar>().deallocate(heap.ptr, heap.cap);
+    }
+    heap = {nullptr, 0};
+    lenAndFlag = 0;
 }
 
 Utf8String Utf8String::fromFile(const char* filePath) {
@@ -59,40 +442,45 @@ Utf8String Utf8String::fromFile(const char* filePath) {
     return Utf8String(buffer.data(), buffer.size());
 }
 
-void Utf8String::setLocale() {
-    std::setlocale(LC_ALL, "");
+bool Utf8String::operator==(const Utf8StringView& other) const {
+    return view() == other;
+}
+
+Utf8String Utf8String::operator+(const Utf8StringView& other) const {
+    Utf8String joined;
+    joined.reserve(length() + other.len);
+    joined.append(buffer(), length());
+    joined.append(other.start, other.len);
+    return joined;
 }
 
 uChar& Utf8String::operator[](size_t index) {
-    if (data.size() <= index) {
+    if (length() <= index) {
         //TODO maybe make this more descriptive if i switch to throwing errors over optional/expected
         throw std::out_of_range("Accessed UTF8 string with an illegal index");
     }
-    return data[index];
+    return buffer()[index];
 }
 
 const uChar& Utf8String::operator[](size_t index) const {
-    if (data.size() <= index) {
+    if (length() <= index) {
         //TODO maybe make this more descriptive if i switch to throwing errors over optional/expected
         throw std::out_of_range("Accessed UTF8 string with an illegal index");
     }
-    return data[index];
+    return buffer()[index];
 }
 
 bool Utf8String::operator<(const Utf8String& other) const {
-    return std::lexicographical_compare(
-        data.begin(), data.end(),
-        other.data.begin(), other.data.end(),
-        [](const uChar a, const uChar b) { return a.n < b.n; }
-    );
+    return compareUChars(buffer(), length(), other.buffer(), other.length()) < 0;
 }
 
 const uChar* Utf8String::getDataPointer() const {
-    return data.data();
+    //Empty strings hand out a null pointer, so views over them still report `isEmpty`
+    return (length() == 0) ? nullptr : buffer();
 }
 
 size_t Utf8String::getCharCount() const {
-    return data.size();
+    return length();
 }
 
 Utf8StringView Utf8String::view() const {
@@ -100,41 +488,26 @@ Utf8StringView Utf8String::view() const {
 }
 
 Utf8StringView Utf8String::view(size_t startIndx, size_t endIndx) const {
-    return Utf8StringView(data.data() + startIndx, (endIndx - startIndx));
+    return Utf8StringView(buffer() + startIndx, (endIndx - startIndx));
 }
 
 uint32_t Utf8String::expandUtf8(const char* bytes, size_t len) {
-    const char* endPoint = bytes + len;
-    while (bytes < endPoint) {
-        uint8_t curByte = 0;
-        uint8_t trailBytes[3] = {0, 0, 0};
-        curByte = static_cast<uint8_t>(*bytes);
-        int32_t leadingOnes = countLeadingOnes(curByte);
-
-        uint8_t headerToCheck = 0;
-        switch (leadingOnes) {
-            case 0 : { headerToCheck = 0; trailBytes[2] = 1; break; }
-            case 2 : { headerToCheck = 0b110; trailBytes[2] = 2; break; }
-            case 3 : { headerToCheck = 0b1110; trailBytes[2] = 3; break; }
-            case 4 : { headerToCheck = 0b11110; break; }
-            default: { return 1; }
-        }
-
-        if ((bytes + (leadingOnes - 1) > endPoint)) { return 2; }
-        if ((curByte >> (7 - leadingOnes)) != headerToCheck) { return 3; }
-        
-        for (int i = 1; i < (leadingOnes); i++) {
-            uint8_t newTrailByte = *(bytes + i);
-            if ((newTrailByte >> 6) == 0b10) {
-                trailBytes[i - 1] = newTrailByte;
-            } else {
-                return 4;
-            }
-        }
-        data.push_back(packUChar(trailBytes[2], trailBytes[1], trailBytes[0], curByte));
-        bytes += (leadingOnes > 0) ? leadingOnes : 1;
+    FL_STAGE(Decode);
+    size_t count = 0;
+    //Text this short may still fit inline once decoded, since a uChar can take up to four bytes, so it is
+    //decoded on the stack first rather than reserving one uChar per byte
+    constexpr size_t maxBytesInline = inlineCapacity * 4;
+    if (len <= maxBytesInline) {
+        uChar decoded[maxBytesInline];
+        const uint32_t res = decodeUtf8(bytes, len, decoded, count);
+        append(decoded, count);
+        return res;
     }
-    return 0;
+    //There is never more than one uChar per byte, so this is the only allocation
+    reserve(len);
+    const uint32_t res = decodeUtf8(bytes, len, buffer(), count);
+    setLength(count);
+    return res;
 }
 
 Utf8String operator""_utf8(const char* bytes, size_t len) {
@@ -142,11 +515,13 @@ Utf8String operator""_utf8(const char* bytes, size_t len) {
 }
 
 std::ostream& operator<<(std::ostream& os, const Utf8String& str) {
-    for (uChar c : str.data) {
-        const char* cStart = reinterpret_cast<const char*>(&c);
-        os.write(cStart, c.writeSize());
-    }
-    return os;
+    return streamUChars(os, str.buffer(), str.length());
+}
+
+std::string Utf8String::toUtf8() const {
+    std::string out;
+    appendUtf8(out, buffer(), length());
+    return out;
 }
 
 /*======================================================================================================*/
@@ -180,34 +555,70 @@ Utf8String Utf8StringView::toOwned() const {
     return Utf8String(start, len);
 }
 
+const uChar* Utf8StringView::getDataPointer() const noexcept {
+    return start;
+}
+
 bool Utf8StringView::isEmpty() const noexcept {
     return (start == nullptr);
 }
 
 std::ostream& operator<<(std::ostream& os, const Utf8StringView& str) {
-    for (int i = 0; i < str.len; i++) {
-        const uChar* newChar = str.start + i;
-        const char* cStart = reinterpret_cast<const char*>(newChar);
-        os.write(cStart, newChar->writeSize());
-    }
-    return os;
+    return streamUChars(os, str.start, str.len);
+}
+
+std::string Utf8StringView::toUtf8() const {
+    std::string out;
+    appendUtf8(out, start, len);
+    return out;
 }
 
 bool Utf8StringView::operator==(const Utf8String& other) const {
-    return (other.data.size() == len) && (std::equal(other.data.begin(), other.data.end(), start, start + len));
+    return *this == other.view();
+}
+
+bool Utf8StringView::operator==(const Utf8StringView& other) const {
+    return (other.len == len) && (mismatchUChars(start, other.start, len) == len);
 }
 
 bool Utf8StringView::operator<(const Utf8StringView& other) const {
-    const size_t minLen = std::min(len, other.len);
-    int res = std::memcmp(start, other.start, minLen);
+    return compare(other) < 0;
+}
 
-    //Check to see if the bytes are NOT equal
-    if (res != 0) {
-        //return true when res < 0, which means that first different byte is in this, not other
-        return res < 0;
+int Utf8StringView::compare(const Utf8StringView& other) const noexcept {
+    return compareUChars(start, len, other.start, other.len);
+}
+
+size_t Utf8StringView::find(uChar c, size_t from) const noexcept {
+    if (from >= len) {
+        return npos;
     }
-    //If the bytes are equal then we should return whichever one is shorter
-    return len < other.len;
+    const size_t found = from + findUChar(start + from, len - from, c);
+    return (found == len) ? npos : found;
+}
+
+size_t Utf8StringView::find(const Utf8StringView& needle, size_t from) const noexcept {
+    if ((from > len) || (needle.len > (len - from))) {
+        return npos;
+    }
+    const size_t found = from + findUChars(start + from, len - from, needle.start, needle.len);
+    return ((found == len) && (needle.len != 0)) ? npos : found;
+}
+
+size_t Utf8StringView::findAny(const Utf8StringView& set, size_t from) const noexcept {
+    if ((from >= len) || (set.len == 0)) {
+        return npos;
+    }
+    const size_t found = from + findAnyUChar(start + from, len - from, set.start, set.len);
+    return (found == len) ? npos : found;
+}
+
+bool Utf8StringView::contains(uChar c) const noexcept {
+    return find(c) != npos;
+}
+
+bool Utf8StringView::contains(const Utf8StringView& needle) const noexcept {
+    return find(needle) != npos;
 }
 
 } //end namespace fl
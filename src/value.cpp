@@ -0,0 +1,159 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "value.hpp"
+#include <charconv>
+#include <bit>
+
+namespace fl {
+
+/*======================================================================================================*/
+/*                                          Constant                                                    */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const Constant& constant) {
+    switch (constant.type) {
+        case ConstantType::Bool: { os << (constant.intVal ? "true" : "false"); return os; }
+        case ConstantType::Int: { os << constant.intVal; return os; }
+        case ConstantType::Float: { os << constant.floatVal; return os; }
+        case ConstantType::String: { os << "\"" << constant.strVal << "\""; return os; }
+        default: { os << "nil"; return os; }
+    }
+}
+
+/**
+ * @brief reads an ascii digit out of a uChar
+ * @returns false if the uChar is not a single byte digit
+ */
+static constexpr bool asDigit(uChar c, uint32_t& digit) {
+    digit = (c.n & 0xFF) - static_cast<uint32_t>('0');
+    return ((c.n >> 24) == 1) && (digit < 10);
+}
+
+//Every power of ten a double holds exactly
+static constexpr double exactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+Result<Constant, Utf8String> constantFromNumber(const Utf8StringView& text) {
+    const size_t len = text.getLen();
+    if (len == 0) {
+        return Result<Constant, Utf8String>::Err("Malformed number literal!"_utf8);
+    }
+
+    //Collect the digits into a single mantissa, with a base ten exponent for anything past the dot
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    bool isFloat = false;
+    bool truncated = false;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t digit = 0;
+        if (!asDigit(text[i], digit)) {
+            if ((text[i] == "."_u) && !isFloat) {
+                isFloat = true;
+                continue;
+            }
+            return Result<Constant, Utf8String>::Err("Malformed number literal!"_utf8);
+        }
+
+        if (mantissa <= ((UINT64_MAX - 9) / 10)) {
+            mantissa = (mantissa * 10) + digit;
+            exponent -= isFloat;
+        } else {
+            truncated = true;
+            exponent += !isFloat;
+        }
+    }
+
+    Constant constant;
+    if (!isFloat) {
+        if (truncated || (mantissa > static_cast<uint64_t>(INT64_MAX))) {
+            return Result<Constant, Utf8String>::Err("Integer literal is too large!"_utf8);
+        }
+        constant.type = ConstantType::Int;
+        constant.intVal = static_cast<int64_t>(mantissa);
+        return Result<Constant, Utf8String>::Ok(std::move(constant));
+    }
+
+    //When both the mantissa and the power of ten are exact doubles, one IEEE divide is correctly rounded
+    constant.type = ConstantType::Float;
+    if (!truncated && (mantissa <= (1ull << 53)) && (exponent >= -22)) {
+        constant.floatVal = static_cast<double>(mantissa) / exactPowersOfTen[-exponent];
+        return Result<Constant, Utf8String>::Ok(std::move(constant));
+    }
+
+    //Long literals are narrowed back down to ascii for the general algorithm
+    std::vector<char> ascii(len);
+    for (size_t i = 0; i < len; i++) {
+        ascii[i] = static_cast<char>(text[i].n & 0xFF);
+    }
+    auto [end, error] = std::from_chars(ascii.data(), ascii.data() + len, constant.floatVal);
+    if ((error != std::errc()) || (end != (ascii.data() + len))) {
+        return Result<Constant, Utf8String>::Err("Malformed number literal!"_utf8);
+    }
+    return Result<Constant, Utf8String>::Ok(std::move(constant));
+}
+
+size_t ConstantHash::operator()(const Constant& constant) const noexcept {
+    //The type is used as the seed, so equal bits of different types still hash apart
+    const uint64_t seed = static_cast<uint64_t>(constant.type);
+    switch (constant.type) {
+        case ConstantType::Bool:
+        case ConstantType::Int: { return static_cast<size_t>(hashBytes(&constant.intVal, sizeof(constant.intVal), seed)); }
+        case ConstantType::Float: {
+            const uint64_t bits = std::bit_cast<uint64_t>(constant.floatVal);
+            return static_cast<size_t>(hashBytes(&bits, sizeof(bits), seed));
+        }
+        case ConstantType::String: {
+            const Utf8StringView str = constant.strVal.view();
+            return static_cast<size_t>(hashBytes(str.getDataPointer(), str.getLen() * sizeof(uChar), seed));
+        }
+        default: { return static_cast<size_t>(hashBytes(nullptr, 0, seed)); }
+    }
+}
+
+/*======================================================================================================*/
+/*                                        ConstantPool                                                  */
+/*======================================================================================================*/
+
+uint32_t ConstantPool::intern(const Constant& constant) {
+    auto [it, inserted] = indices.try_emplace(constant, static_cast<uint32_t>(constants.size()));
+    if (inserted) {
+        constants.push_back(constant);
+    }
+    return it->second;
+}
+
+/*======================================================================================================*/
+/*                                            Value                                                     */
+/*======================================================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const ValueType type) {
+    switch (type) {
+        case ValueType::Bool: { os << "bool"; return os; }
+        case ValueType::Int: { os << "int"; return os; }
+        case ValueType::Float: { os << "float"; return os; }
+        case ValueType::String: { os << "str"; return os; }
+        default: { os << "nil"; return os; }
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const Value& value) {
+    switch (value.type) {
+        case ValueType::Bool: { os << (value.boolVal ? "true" : "false"); return os; }
+        case ValueType::Int: { os << value.intVal; return os; }
+        case ValueType::Float: { os << value.floatVal; return os; }
+        case ValueType::String: { os << value.strVal->text; return os; }
+        default: { os << "nil"; return os; }
+    }
+}
+
+} //end namespace fl
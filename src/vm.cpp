@@ -0,0 +1,858 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "vm.hpp"
+#include "profiler.hpp"
+#include "instrument.hpp"
+#include "transcode.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace fl {
+
+//Deep enough for any sane recursion, while still catching runaway recursion before memory runs out
+static constexpr size_t maxCallDepth = 1 << 16;
+
+static constexpr const char* outOfMemory = "Script ran out of memory!";
+
+/**
+ * @brief the bytes a module holds in code, constants and functions, which grows as stubs are compiled
+ */
+static size_t compiledBytes(const Module& module) {
+    return (module.code.size() * sizeof(Instruction)) + (module.constants.size() * sizeof(Constant)) +
+           (module.functionTable.size() * sizeof(FunctionDesc)) + (module.functions.size() * sizeof(FunctionProto));
+}
+
+/*======================================================================================================*/
+/*                                       Value Helpers                                                  */
+/*======================================================================================================*/
+
+/**
+ * @brief integer arithmetic wraps on overflow instead of being undefined
+ */
+static constexpr int64_t wrapAdd(int64_t a, int64_t b) { return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b)); }
+static constexpr int64_t wrapSub(int64_t a, int64_t b) { return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b)); }
+static constexpr int64_t wrapMul(int64_t a, int64_t b) { return static_cast<int64_t>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b)); }
+static constexpr int64_t wrapNeg(int64_t a) { return static_cast<int64_t>(0 - static_cast<uint64_t>(a)); }
+
+/**
+ * @brief integer division and modulo, where dividing the smallest int by -1 wraps instead of trapping
+ * @warning `b` must not be zero
+ */
+static constexpr int64_t wrapDiv(int64_t a, int64_t b) { return (b == -1) ? wrapNeg(a) : (a / b); }
+static constexpr int64_t wrapMod(int64_t a, int64_t b) { return (b == -1) ? 0 : (a % b); }
+
+static constexpr bool isNumber(const Value& v) {
+    return (v.type == ValueType::Int) || (v.type == ValueType::Float);
+}
+
+static constexpr double asFloat(const Value& v) {
+    return (v.type == ValueType::Int) ? static_cast<double>(v.intVal) : v.floatVal;
+}
+
+/**
+ * @brief checks two values for equality, where ints and floats compare by value and every other
+ * mix of types is unequal
+ */
+static bool valuesEqual(const Value& lhs, const Value& rhs) {
+    if (isNumber(lhs) && isNumber(rhs)) {
+        if ((lhs.type == ValueType::Int) && (rhs.type == ValueType::Int)) {
+            return lhs.intVal == rhs.intVal;
+        }
+        return asFloat(lhs) == asFloat(rhs);
+    }
+    if (lhs.type != rhs.type) {
+        return false;
+    }
+    switch (lhs.type) {
+        case ValueType::Bool: { return lhs.boolVal == rhs.boolVal; }
+        case ValueType::String: { return lhs.strVal->text.view() == rhs.strVal->text.view(); }
+        default: { return true; }
+    }
+}
+
+/**
+ * @brief orders two numbers, or two strings
+ * @returns false if the values can't be ordered against each other
+ */
+static bool compareValues(OpCode op, const Value& lhs, const Value& rhs, bool& out) {
+    int order = 0;
+    if (isNumber(lhs) && isNumber(rhs)) {
+        if ((lhs.type == ValueType::Int) && (rhs.type == ValueType::Int)) {
+            order = (lhs.intVal < rhs.intVal) ? -1 : (lhs.intVal > rhs.intVal);
+        } else {
+            const double l = asFloat(lhs);
+            const double r = asFloat(rhs);
+            //NaN is unordered, and fails every comparison
+            if ((l != l) || (r != r)) {
+                out = false;
+                return true;
+            }
+            order = (l < r) ? -1 : (l > r);
+        }
+    } else if ((lhs.type == ValueType::String) && (rhs.type == ValueType::String)) {
+        const Utf8StringView l = lhs.strVal->text.view();
+        const Utf8StringView r = rhs.strVal->text.view();
+        order = (l < r) ? -1 : (r < l);
+    } else {
+        return false;
+    }
+
+    switch (op) {
+        case OpCode::LessThan: { out = order < 0; break; }
+        case OpCode::LessEqual: { out = order <= 0; break; }
+        case OpCode::GreaterThan: { out = order > 0; break; }
+        default: { out = order >= 0; break; }
+    }
+    return true;
+}
+
+/*======================================================================================================*/
+/*                                              VM                                                      */
+/*======================================================================================================*/
+
+VM::VM(Module& module) : module(module), compilable(&module) {
+    materializeConstants();
+}
+
+VM::VM(std::shared_ptr<const Module> sharedModule) : module(*sharedModule), shared(std::move(sharedModule)) {
+    materializeConstants();
+}
+
+VM::VM(const Module& module, const std::shared_ptr<const Module>& sharedModule) : module(module), shared(sharedModule) {
+    materializeConstants();
+}
+
+VM::~VM() = default;
+
+std::optional<Utf8String> VM::prepare(uint32_t function) {
+    if (!module.isStub(function)) {
+        return std::nullopt;
+    }
+    if (compilable == nullptr) {
+        return std::optional("Function `"_utf8 + module.symbols->text(module.functions[function].name) + "` was never compiled!"_utf8);
+    }
+    const size_t before = compiledBytes(module);
+    auto error = compilable->compileStub(function);
+    if (error) {
+        return error;
+    }
+    account.charge(MemoryKind::Compiled, compiledBytes(module) - before);
+    materializeConstants();
+    return std::nullopt;
+}
+
+void VM::materializeConstants() {
+    constants.reserve(module.constants.size());
+    for (size_t i = constants.size(); i < module.constants.size(); i++) {
+        const Constant& constant = module.constants[i];
+        switch (constant.type) {
+            case ConstantType::Bool: { constants.push_back(Value::fromBool(constant.intVal != 0)); break; }
+            case ConstantType::Int: { constants.push_back(Value::fromInt(constant.intVal)); break; }
+            case ConstantType::Float: { constants.push_back(Value::fromFloat(constant.floatVal)); break; }
+            case ConstantType::String: { constants.push_back(newString(constant.strVal.view().toOwned())); break; }
+            default: { constants.push_back(Value()); break; }
+        }
+    }
+}
+
+Value VM::newString(Utf8String&& text) {
+    return Value::fromString(heap.allocateString(std::move(text)));
+}
+
+/*======================================================================================================*/
+/*                                      Garbage Collection                                              */
+/*======================================================================================================*/
+
+void VM::collectGarbage() {
+    if ((hostDepth != 0) || splitting) {
+        return;
+    }
+    heap.finishSweep();
+    collect(true);
+    heap.finishSweep();
+    //The sweep is what refunds the garbage, so the soft limit can only be rearmed once it is done
+    account.rearm();
+
+    //Registers left behind by deep recursion stay charged until they are given back, but only once they are
+    //mostly dead, so a deep call still running doesn't shrink and regrow them on every call it makes
+    const size_t registerCapacity = state.registers.capacity();
+    const size_t frameCapacity = state.frames.capacity();
+    const size_t live = liveRegisters(state);
+    if (registerCapacity > (live * 2)) {
+        state.registers.resize(live);
+        state.registers.shrink_to_fit();
+    }
+    if (frameCapacity > (state.frames.size() * 2)) {
+        state.frames.shrink_to_fit();
+    }
+    recharge(state, registerCapacity, frameCapacity);
+}
+
+bool VM::collectAtSafepoint() {
+    if ((hostDepth != 0) || splitting) {
+        return true;
+    }
+    if (account.isFlagged()) {
+        //Garbage stays charged until it is collected, so only what survives a full collection counts against the limits
+        collectGarbage();
+        hostDepth++;
+        account.settle();
+        hostDepth--;
+        return !account.isOverHardLimit();
+    }
+    if (heap.needsCollection()) {
+        collect(false);
+    } else {
+        heap.sweepSlice();
+        account.rearm();
+    }
+    return true;
+}
+
+bool VM::reclaim(size_t bytes) {
+    if ((hostDepth != 0) || splitting) {
+        return account.fits(bytes);
+    }
+    collectGarbage();
+    return account.fits(bytes);
+}
+
+void VM::setMemoryBudget(const MemoryBudget& budget) {
+    account.setBudget(budget);
+    for (std::unique_ptr<VM>& worker : workers) {
+        if (worker) {
+            worker->account.setBudget(MemoryBudget{.softLimit = 0, .hardLimit = budget.hardLimit, .onSoftLimit = nullptr});
+        }
+    }
+}
+
+void VM::setProfiler(Profiler* sampler) {
+    profiler = sampler;
+    if (profiler != nullptr) {
+        profiler->retain(module.symbols);
+        sampledTick = profiler->getTick();
+    }
+    for (std::unique_ptr<VM>& worker : workers) {
+        if (worker) {
+            worker->setProfiler(sampler);
+        }
+    }
+}
+
+void VM::enterFrame(ExecutionState& execution, const CallFrame& frame, uint32_t frameSize) {
+    const size_t registerCapacity = execution.registers.capacity();
+    const size_t frameCapacity = execution.frames.capacity();
+    if (execution.registers.size() < (frame.base + frameSize)) {
+        execution.registers.resize(frame.base + frameSize);
+    }
+    execution.frames.push_back(frame);
+    recharge(execution, registerCapacity, frameCapacity);
+}
+
+void VM::recharge(const ExecutionState& execution, size_t registerCapacity, size_t frameCapacity) {
+    //Capacities only change when a vector reallocates, so almost every call gets away with two compares
+    if (execution.registers.capacity() > registerCapacity) {
+        account.charge(MemoryKind::Registers, (execution.registers.capacity() - registerCapacity) * sizeof(Value));
+    } else if (execution.registers.capacity() < registerCapacity) {
+        account.refund(MemoryKind::Registers, (registerCapacity - execution.registers.capacity()) * sizeof(Value));
+    }
+    if (execution.frames.capacity() > frameCapacity) {
+        account.charge(MemoryKind::Frames, (execution.frames.capacity() - frameCapacity) * sizeof(CallFrame));
+    } else if (execution.frames.capacity() < frameCapacity) {
+        account.refund(MemoryKind::Frames, (frameCapacity - execution.frames.capacity()) * sizeof(CallFrame));
+    }
+}
+
+void VM::collect(bool forceMajor) {
+    heap.beginCollection(forceMajor);
+    for (Value& constant : constants) {
+        heap.visit(constant);
+    }
+    visitState(state);
+    for (CoroutineSlot& slot : coroutines) {
+        if (slot.alive) {
+            visitState(slot.state);
+        }
+    }
+    heap.visit(suspendToken);
+    heap.endCollection();
+    account.rearm();
+}
+
+size_t VM::liveRegisters(const ExecutionState& execution) const {
+    //Every frame sits inside the window of the one below it, so the live registers end with the top frame
+    size_t live = 0;
+    if (!execution.frames.empty()) {
+        const CallFrame& top = execution.frames.back();
+        live = top.base + module.functionTable[top.function].frameSize;
+    }
+    return std::min(live, execution.registers.size());
+}
+
+void VM::visitState(ExecutionState& execution) {
+    const size_t live = liveRegisters(execution);
+    for (size_t i = 0; i < live; i++) {
+        heap.visit(execution.registers[i]);
+    }
+    //Dead registers are always written before they are read again, but could still point at freed objects
+    std::fill(execution.registers.begin() + live, execution.registers.end(), Value());
+}
+
+Result<Value, Utf8String> VM::call(uint32_t function, const std::vector<Value>& args) {
+    return call(function, args.data(), args.size());
+}
+
+std::optional<Utf8String> VM::checkCall(uint32_t function, size_t argCount) {
+    if (function >= module.functionTable.size()) {
+        return std::optional("Called a function that does not exist!"_utf8);
+    }
+    if (argCount != module.functionTable[function].arity) {
+        return std::optional("Function `"_utf8 + module.symbols->text(module.functions[function].name) + "` was called with the wrong number of arguments!"_utf8);
+    }
+    return prepare(function);
+}
+
+Result<Value, Utf8String> VM::call(uint32_t function, const Value* args, size_t argCount) {
+    auto callError = checkCall(function, argCount);
+    if (callError) {
+        return Result<Value, Utf8String>::Err(*callError);
+    }
+    //Only looked up once compiled, since compiling a stub appends its parallel bodies to the table
+    const FunctionDesc& desc = module.functionTable[function];
+
+    //Host calls stack on top of whatever frame is already running
+    const size_t entryDepth = state.frames.size();
+    uint32_t base = 0;
+    if (entryDepth != 0) {
+        const CallFrame& top = state.frames.back();
+        base = top.base + module.functionTable[top.function].frameSize;
+    }
+    enterFrame(state, CallFrame{.function = function, .pc = desc.entryPc, .base = base, .returnReg = 0}, desc.frameSize);
+    std::copy(args, args + argCount, state.registers.begin() + base);
+    return run(entryDepth);
+}
+
+/*======================================================================================================*/
+/*                                          Coroutines                                                  */
+/*======================================================================================================*/
+
+Result<Coroutine, Utf8String> VM::spawn(uint32_t function, const Value* args, size_t argCount) {
+    auto callError = checkCall(function, argCount);
+    if (callError) {
+        return Result<Coroutine, Utf8String>::Err(*callError);
+    }
+
+    uint32_t index = 0;
+    if (freeCoroutines.empty()) {
+        index = static_cast<uint32_t>(coroutines.size());
+        coroutines.emplace_back();
+    } else {
+        index = freeCoroutines.back();
+        freeCoroutines.pop_back();
+    }
+    CoroutineSlot& slot = coroutines[index];
+    slot.alive = true;
+    slot.started = false;
+
+    //Laid out exactly like a call from an idle VM, so resuming it for the first time just starts running it
+    const FunctionDesc& desc = module.functionTable[function];
+    enterFrame(slot.state, CallFrame{.function = function, .pc = desc.entryPc, .base = 0, .returnReg = 0}, desc.frameSize);
+    std::copy(args, args + argCount, slot.state.registers.begin());
+    return Result<Coroutine, Utf8String>::Ok(Coroutine{.index = index, .generation = slot.generation});
+}
+
+Result<CoroutineStep, Utf8String> VM::resume(Coroutine coroutine, const Value& sent) {
+    if (!isAlive(coroutine)) {
+        return Result<CoroutineStep, Utf8String>::Err("Resumed a coroutine that has already finished!"_utf8);
+    }
+    if (coroutines[coroutine.index].running) {
+        return Result<CoroutineStep, Utf8String>::Err("A coroutine can't resume itself!"_utf8);
+    }
+    CoroutineSlot& slot = coroutines[coroutine.index];
+    if (slot.started) {
+        slot.state.registers[slot.state.frames.back().base + slot.resumeReg] = sent;
+    }
+    slot.started = true;
+    slot.running = true;
+
+    //Swapping only trades buffers, so a host function resuming this from inside another script leaves
+    //every pointer that script's loop holds into its own registers and frames intact
+    std::swap(state, slot.state);
+    const bool outerSuspendable = suspendable;
+    suspendable = true;
+    auto result = run(0);
+    suspendable = outerSuspendable;
+
+    //Looked up again, since spawning from a host function can move the slots
+    CoroutineSlot& stopped = coroutines[coroutine.index];
+    std::swap(state, stopped.state);
+    stopped.running = false;
+
+    if (!result.isOk()) {
+        release(coroutine.index);
+        return Result<CoroutineStep, Utf8String>::Err(std::move(result).errValue());
+    }
+    if (stopped.state.frames.empty()) {
+        release(coroutine.index);
+        return Result<CoroutineStep, Utf8String>::Ok(CoroutineStep{.status = CoroutineStatus::Finished, .value = result.okValue()});
+    }
+
+    //Only the registers up to the top frame are live while it waits, so the rest are given back
+    stopped.resumeReg = suspendedReg;
+    const CallFrame& top = stopped.state.frames.back();
+    const size_t registerCapacity = stopped.state.registers.capacity();
+    stopped.state.registers.resize(top.base + module.functionTable[top.function].frameSize);
+    if (registerCapacity > (stopped.state.registers.size() * 2)) {
+        stopped.state.registers.shrink_to_fit();
+    }
+    recharge(stopped.state, registerCapacity, stopped.state.frames.capacity());
+    return Result<CoroutineStep, Utf8String>::Ok(CoroutineStep{.status = CoroutineStatus::Suspended, .value = result.okValue()});
+}
+
+void VM::cancel(Coroutine coroutine) {
+    if (isAlive(coroutine) && !coroutines[coroutine.index].running) {
+        release(coroutine.index);
+    }
+}
+
+void VM::release(uint32_t coroutine) {
+    CoroutineSlot& slot = coroutines[coroutine];
+    const size_t registerCapacity = slot.state.registers.capacity();
+    const size_t frameCapacity = slot.state.frames.capacity();
+    slot.state.registers = std::vector<Value>();
+    slot.state.frames = std::vector<CallFrame>();
+    recharge(slot.state, registerCapacity, frameCapacity);
+    slot.alive = false;
+    slot.generation++;
+    freeCoroutines.push_back(coroutine);
+}
+
+/*======================================================================================================*/
+/*                                        Parallel Loops                                                */
+/*======================================================================================================*/
+
+bool VM::compileEverything() {
+    if (fullyCompiled || (compilable == nullptr)) {
+        return true;
+    }
+    //Compiling can add parallel bodies to the end of the table, which are never stubs
+    for (uint32_t function = 0; function < module.functionTable.size(); function++) {
+        if (prepare(function)) {
+            return false;
+        }
+    }
+    fullyCompiled = true;
+    return true;
+}
+
+Result<Value, Utf8String> VM::runParallel(uint32_t body, const Value* args, size_t argCount) {
+    //Copied out, since running chunks on this VM can move the registers the arguments live in
+    const std::vector<Value> bodyArgs(args, args + argCount);
+    const int64_t begin = bodyArgs[0].intVal;
+    const int64_t end = bodyArgs[1].intVal;
+
+    //A stub that fails to compile keeps the loop on this thread, so the error only shows if it is actually called
+    const bool split = (scheduler != nullptr) && (scheduler->getWorkerCount() != 0) && ((end - begin) > 1) && compileEverything();
+    if (!split) {
+        return call(body, bodyArgs.data(), bodyArgs.size());
+    }
+
+    const size_t slotCount = scheduler->getSlotCount();
+    if (workers.size() != slotCount) {
+        workers.resize(slotCount);
+    }
+    for (std::unique_ptr<VM>& worker : workers) {
+        if (worker) {
+            worker->materializeConstants();
+        }
+    }
+
+    //Each slot accumulates its own chunks, and the slots are only combined once the whole range is done
+    const OpCode reduction = module.functions[body].reduction;
+    std::vector<Value> partials(slotCount, bodyArgs[2]);
+    std::atomic<bool> failed = false;
+    std::mutex errorLock;
+    Utf8String error;
+    auto chunk = [&](size_t slot, int64_t chunkBegin, int64_t chunkEnd) {
+        if (failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+        //The caller's slot runs on this VM, every other slot on a worker that is only ever used from it
+        VM* runner = this;
+        if (slot != (slotCount - 1)) {
+            if (!workers[slot]) {
+                workers[slot] = std::unique_ptr<VM>(new VM(module, shared));
+                workers[slot]->account.setBudget(MemoryBudget{.softLimit = 0, .hardLimit = account.getBudget().hardLimit, .onSoftLimit = nullptr});
+            }
+            runner = workers[slot].get();
+            runner->profiler = profiler;
+        }
+        std::vector<Value> chunkArgs = bodyArgs;
+        chunkArgs[0] = Value::fromInt(chunkBegin);
+        chunkArgs[1] = Value::fromInt(chunkEnd);
+        auto result = runner->call(body, chunkArgs.data(), chunkArgs.size());
+        if (!result.isOk()) {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (!failed.exchange(true)) {
+                error = std::move(result).errValue();
+            }
+            return;
+        }
+        if (reduction != OpCode::Move) {
+            runner->arithmetic(reduction, partials[slot], result.okValue(), partials[slot]);
+        }
+    };
+    const int64_t grain = std::max<int64_t>(1, (end - begin) / static_cast<int64_t>(slotCount * 8));
+    //Workers read the captured strings straight out of this VM's heap, so nothing moves until they are done
+    const bool outerSplitting = splitting;
+    splitting = true;
+    scheduler->parallelFor(begin, end, grain, chunk);
+    splitting = outerSplitting;
+
+    if (failed.load()) {
+        return Result<Value, Utf8String>::Err(std::move(error));
+    }
+    if (reduction == OpCode::Move) {
+        return Result<Value, Utf8String>::Ok(Value());
+    }
+    Value combined = bodyArgs[2];
+    for (const Value& partial : partials) {
+        arithmetic(reduction, combined, partial, combined);
+    }
+    return Result<Value, Utf8String>::Ok(combined);
+}
+
+Result<Value, Utf8String> VM::raise(const Utf8String& message, size_t entryDepth) {
+    Utf8String error = "Runtime error in `"_utf8 + module.symbols->text(module.functions[state.frames.back().function].name) + "`: "_utf8 + message;
+    state.frames.resize(entryDepth);
+    return Result<Value, Utf8String>::Err(std::move(error));
+}
+
+Result<Value, Utf8String> VM::raise(const char* message, size_t entryDepth) {
+    return raise(Utf8String(message, std::strlen(message)), entryDepth);
+}
+
+const char* VM::arithmetic(OpCode op, const Value& lhs, const Value& rhs, Value& out) {
+    if ((op == OpCode::Add) && (lhs.type == ValueType::String) && (rhs.type == ValueType::String)) {
+        //Checked before allocating, where the operands are still in registers that a collection patches in place
+        const size_t bytes = Heap::objectBytes(lhs.strVal->text.getCharCount() + rhs.strVal->text.getCharCount());
+        if (!account.fits(bytes) && !reclaim(bytes)) {
+            return outOfMemory;
+        }
+        out = newString(lhs.strVal->text + rhs.strVal->text.view());
+        return nullptr;
+    }
+    if (!isNumber(lhs) || !isNumber(rhs)) {
+        return "Operator can not be used with these types!";
+    }
+
+    if ((lhs.type == ValueType::Int) && (rhs.type == ValueType::Int)) {
+        const int64_t l = lhs.intVal;
+        const int64_t r = rhs.intVal;
+        switch (op) {
+            case OpCode::Add: { out = Value::fromInt(wrapAdd(l, r)); return nullptr; }
+            case OpCode::Sub: { out = Value::fromInt(wrapSub(l, r)); return nullptr; }
+            case OpCode::Mul: { out = Value::fromInt(wrapMul(l, r)); return nullptr; }
+            default: {
+                if (r == 0) {
+                    return "Integer division by zero!";
+                }
+                out = Value::fromInt((op == OpCode::Div) ? wrapDiv(l, r) : wrapMod(l, r));
+                return nullptr;
+            }
+        }
+    }
+
+    const double l = asFloat(lhs);
+    const double r = asFloat(rhs);
+    switch (op) {
+        case OpCode::Add: { out = Value::fromFloat(l + r); return nullptr; }
+        case OpCode::Sub: { out = Value::fromFloat(l - r); return nullptr; }
+        case OpCode::Mul: { out = Value::fromFloat(l * r); return nullptr; }
+        case OpCode::Div: { out = Value::fromFloat(l / r); return nullptr; }
+        default: { out = Value::fromFloat(std::fmod(l, r)); return nullptr; }
+    }
+}
+
+inline void VM::sampleIfDue(uint32_t pc) {
+    if ((profiler != nullptr) && (profiler->getTick() != sampledTick)) {
+        sampledTick = profiler->getTick();
+        profiler->record(module, state.frames.data(), state.frames.size(), pc);
+    }
+}
+
+Result<Value, Utf8String> VM::run(size_t entryDepth) {
+    FL_STAGE(Execute);
+    const Instruction* code = module.code.data();
+    const FunctionDesc* table = module.functionTable.data();
+    const Value* k = constants.data();
+    CallFrame* frame = &state.frames.back();
+    Value* regs = state.registers.data() + frame->base;
+    uint32_t pc = frame->pc;
+
+    while (true) {
+        //Copied out, since a call can compile a stub and move the code out from under it
+        const Instruction inst = code[pc++];
+        switch (inst.op) {
+            case OpCode::LoadK: {
+                regs[inst.a] = k[inst.bx()];
+                break;
+            }
+            case OpCode::Move: {
+                regs[inst.a] = regs[inst.b];
+                break;
+            }
+
+            //Generic arithmetic, which dispatches on the runtime types of its operands
+            case OpCode::Add:
+            case OpCode::Sub:
+            case OpCode::Mul:
+            case OpCode::Div:
+            case OpCode::Mod: {
+                const char* error = arithmetic(inst.op, regs[inst.b], regs[inst.c], regs[inst.a]);
+                if (error != nullptr) {
+                    return raise(error, entryDepth);
+                }
+                //Adding strings allocates, and a full collection can give back dead registers, moving the live ones
+                if (!safepoint()) {
+                    return raise(outOfMemory, entryDepth);
+                }
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                break;
+            }
+            case OpCode::Neg: {
+                const Value& v = regs[inst.b];
+                if (v.type == ValueType::Int) {
+                    regs[inst.a] = Value::fromInt(wrapNeg(v.intVal));
+                } else if (v.type == ValueType::Float) {
+                    regs[inst.a] = Value::fromFloat(-v.floatVal);
+                } else {
+                    return raise("Operator can not be used with these types!", entryDepth);
+                }
+                break;
+            }
+            case OpCode::Not: {
+                regs[inst.a] = Value::fromBool(!regs[inst.b].isTruthy());
+                break;
+            }
+
+            //Generic comparisons
+            case OpCode::LessThan:
+            case OpCode::LessEqual:
+            case OpCode::GreaterThan:
+            case OpCode::GreaterEqual: {
+                bool result = false;
+                if (!compareValues(inst.op, regs[inst.b], regs[inst.c], result)) {
+                    return raise("Operator can not be used with these types!", entryDepth);
+                }
+                regs[inst.a] = Value::fromBool(result);
+                break;
+            }
+            case OpCode::Equals: {
+                regs[inst.a] = Value::fromBool(valuesEqual(regs[inst.b], regs[inst.c]));
+                break;
+            }
+            case OpCode::NotEquals: {
+                regs[inst.a] = Value::fromBool(!valuesEqual(regs[inst.b], regs[inst.c]));
+                break;
+            }
+
+            //Int specialized ops, which trust the types proven at compile time
+            case OpCode::AddInt: { regs[inst.a] = Value::fromInt(wrapAdd(regs[inst.b].intVal, regs[inst.c].intVal)); break; }
+            case OpCode::SubInt: { regs[inst.a] = Value::fromInt(wrapSub(regs[inst.b].intVal, regs[inst.c].intVal)); break; }
+            case OpCode::MulInt: { regs[inst.a] = Value::fromInt(wrapMul(regs[inst.b].intVal, regs[inst.c].intVal)); break; }
+            case OpCode::DivInt:
+            case OpCode::ModInt: {
+                const int64_t r = regs[inst.c].intVal;
+                if (r == 0) {
+                    return raise("Integer division by zero!", entryDepth);
+                }
+                const int64_t l = regs[inst.b].intVal;
+                regs[inst.a] = Value::fromInt((inst.op == OpCode::DivInt) ? wrapDiv(l, r) : wrapMod(l, r));
+                break;
+            }
+            case OpCode::NegInt: { regs[inst.a] = Value::fromInt(wrapNeg(regs[inst.b].intVal)); break; }
+            case OpCode::LessThanInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal < regs[inst.c].intVal); break; }
+            case OpCode::LessEqualInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal <= regs[inst.c].intVal); break; }
+            case OpCode::GreaterThanInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal > regs[inst.c].intVal); break; }
+            case OpCode::GreaterEqualInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal >= regs[inst.c].intVal); break; }
+            case OpCode::EqualsInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal == regs[inst.c].intVal); break; }
+            case OpCode::NotEqualsInt: { regs[inst.a] = Value::fromBool(regs[inst.b].intVal != regs[inst.c].intVal); break; }
+
+            //Float specialized ops
+            case OpCode::AddFloat: { regs[inst.a] = Value::fromFloat(regs[inst.b].floatVal + regs[inst.c].floatVal); break; }
+            case OpCode::SubFloat: { regs[inst.a] = Value::fromFloat(regs[inst.b].floatVal - regs[inst.c].floatVal); break; }
+            case OpCode::MulFloat: { regs[inst.a] = Value::fromFloat(regs[inst.b].floatVal * regs[inst.c].floatVal); break; }
+            case OpCode::DivFloat: { regs[inst.a] = Value::fromFloat(regs[inst.b].floatVal / regs[inst.c].floatVal); break; }
+            case OpCode::NegFloat: { regs[inst.a] = Value::fromFloat(-regs[inst.b].floatVal); break; }
+            case OpCode::LessThanFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal < regs[inst.c].floatVal); break; }
+            case OpCode::LessEqualFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal <= regs[inst.c].floatVal); break; }
+            case OpCode::GreaterThanFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal > regs[inst.c].floatVal); break; }
+            case OpCode::GreaterEqualFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal >= regs[inst.c].floatVal); break; }
+            case OpCode::EqualsFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal == regs[inst.c].floatVal); break; }
+            case OpCode::NotEqualsFloat: { regs[inst.a] = Value::fromBool(regs[inst.b].floatVal != regs[inst.c].floatVal); break; }
+
+            case OpCode::Check: {
+                const Value& v = regs[inst.b];
+                const ValueType expected = static_cast<ValueType>(inst.c);
+                if (v.type == expected) {
+                    regs[inst.a] = v;
+                } else if ((v.type == ValueType::Int) && (expected == ValueType::Float)) {
+                    regs[inst.a] = Value::fromFloat(static_cast<double>(v.intVal));
+                } else {
+                    return raise("Value does not match its declared type!", entryDepth);
+                }
+                break;
+            }
+
+            //Control flow
+            //Every loop runs through a backward jump, so sampling there keeps hot loops from going unseen
+            case OpCode::Jump: {
+                if (inst.bx() < pc) {
+                    sampleIfDue(pc - 1);
+                }
+                pc = inst.bx();
+                break;
+            }
+            case OpCode::JumpIfTrue: {
+                if (regs[inst.a].isTruthy()) {
+                    if (inst.bx() < pc) {
+                        sampleIfDue(pc - 1);
+                    }
+                    pc = inst.bx();
+                }
+                break;
+            }
+            case OpCode::JumpIfFalse: {
+                if (!regs[inst.a].isTruthy()) {
+                    if (inst.bx() < pc) {
+                        sampleIfDue(pc - 1);
+                    }
+                    pc = inst.bx();
+                }
+                break;
+            }
+            case OpCode::Call: {
+                if (state.frames.size() >= maxCallDepth) {
+                    return raise("Stack overflow!", entryDepth);
+                }
+                if (table[inst.b].entryPc == lazyEntryPc) {
+                    auto compileError = prepare(inst.b);
+                    if (compileError) {
+                        return raise(*compileError, entryDepth);
+                    }
+                    //Linking grew the module, so anything pointing into it has to be refreshed
+                    code = module.code.data();
+                    table = module.functionTable.data();
+                    k = constants.data();
+                }
+                const FunctionDesc& callee = table[inst.b];
+                const uint32_t base = frame->base + inst.c;
+                frame->pc = pc;
+                enterFrame(state, CallFrame{.function = inst.b, .pc = callee.entryPc, .base = base, .returnReg = inst.a}, callee.frameSize);
+                frame = &state.frames.back();
+                regs = state.registers.data() + base;
+                pc = callee.entryPc;
+                sampleIfDue(pc);
+                //Deep recursion grows the registers and frames, which count against the budget like anything else
+                if (!safepoint()) {
+                    return raise(outOfMemory, entryDepth);
+                }
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                break;
+            }
+            case OpCode::CallHost: {
+                const HostFunction& host = module.hostFunctions[inst.b];
+                Value result;
+                hostDepth++;
+                const char* error = host.thunk(*this, host.target, regs + inst.c, result);
+                hostDepth--;
+                if (error != nullptr) {
+                    suspending = false;
+                    return raise(error, entryDepth);
+                }
+                if (suspending) {
+                    //Anything below this frame on the native stack would be lost, so only a coroutine's own frames can suspend
+                    suspending = false;
+                    if (!suspendable || (entryDepth != 0)) {
+                        return raise("Only a coroutine can be suspended, and never from inside a host call!", entryDepth);
+                    }
+                    //The frames stay exactly as they are, resuming picks up right after this call
+                    state.frames.back().pc = pc;
+                    suspendedReg = inst.a;
+                    return Result<Value, Utf8String>::Ok(suspendToken);
+                }
+                //The host may have called back into the VM, which can grow the registers and the module
+                code = module.code.data();
+                table = module.functionTable.data();
+                k = constants.data();
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                regs[inst.a] = result;
+                //Time spent inside the host lands on the line that called it
+                sampleIfDue(pc - 1);
+                if (!safepoint()) {
+                    return raise(outOfMemory, entryDepth);
+                }
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                break;
+            }
+            case OpCode::ParallelFor: {
+                //Running the body can move the frames, so the loop's function is read while `frame` still points at it
+                const uint32_t function = frame->function;
+                auto result = runParallel(inst.b, regs + inst.c, inst.argc);
+                if (!result.isOk()) {
+                    //Already names the function the loop is in, since its body is named after it, so only the line is added
+                    const uint32_t line = module.lineAt(function, pc - 1);
+                    state.frames.resize(entryDepth);
+                    return Result<Value, Utf8String>::Err(result.errValue() + " (in the parallel loop on line "_utf8 +
+                                                          fromValidatedUtf8(std::to_string(line)) + ")"_utf8);
+                }
+                //Chunks run on this VM can grow the registers and compile stubs into the module
+                code = module.code.data();
+                table = module.functionTable.data();
+                k = constants.data();
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                regs[inst.a] = result.okValue();
+                if (!safepoint()) {
+                    return raise(outOfMemory, entryDepth);
+                }
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                break;
+            }
+            case OpCode::Return:
+            case OpCode::ReturnNil: {
+                const Value result = (inst.op == OpCode::Return) ? regs[inst.a] : Value();
+                const uint16_t returnReg = frame->returnReg;
+                state.frames.pop_back();
+                if (state.frames.size() == entryDepth) {
+                    return Result<Value, Utf8String>::Ok(result);
+                }
+                frame = &state.frames.back();
+                regs = state.registers.data() + frame->base;
+                pc = frame->pc;
+                regs[returnReg] = result;
+                break;
+            }
+        }
+    }
+}
+
+} //end namespace fl
@@ -0,0 +1,90 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief just enough of a test harness for the tests in this directory, each of which builds into its own
+ * executable that ctest runs
+ * @details a test is declared with `FL_TEST(name) { ... }`, and every test in a file is run by calling
+ * `fl::test::runAll()` from its main. `FL_CHECK` records a failure and keeps going, while `FL_REQUIRE`
+ * also returns from the test, for checks that everything after them depends on. Nothing here throws,
+ * since release builds have no exceptions
+ */
+
+namespace fl::test {
+
+struct TestCase {
+    const char* name;
+    void (*body)();
+};
+
+inline std::vector<TestCase>& registry() {
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+inline size_t& failureCount() {
+    static size_t count = 0;
+    return count;
+}
+
+struct Registrar {
+    Registrar(const char* name, void (*body)()) {
+        registry().push_back(TestCase{.name = name, .body = body});
+    }
+};
+
+inline void fail(const char* file, int line, const char* expression) {
+    std::cout << "  " << file << ":" << line << ": check failed: " << expression << std::endl;
+    failureCount()++;
+}
+
+/**
+ * @brief runs every registered test in the order they were declared
+ * @returns the exit code for ctest, which is nonzero when any check failed
+ */
+inline int runAll() {
+    size_t failedTests = 0;
+    for (const TestCase& test : registry()) {
+        const size_t before = failureCount();
+        test.body();
+        const bool passed = failureCount() == before;
+        failedTests += passed ? 0 : 1;
+        std::cout << (passed ? "[ OK ] " : "[FAIL] ") << test.name << std::endl;
+    }
+    std::cout << (registry().size() - failedTests) << "/" << registry().size() << " tests passed" << std::endl;
+    return (failedTests == 0) ? 0 : 1;
+}
+
+} //end namespace fl::test
+
+#define FL_TEST(name)                                                                   \
+    static void name();                                                                 \
+    static const ::fl::test::Registrar name##Registrar(#name, name);                    \
+    static void name()
+
+#define FL_CHECK(expression)                                                            \
+    do {                                                                                \
+        if (!(expression)) {                                                            \
+            ::fl::test::fail(__FILE__, __LINE__, #expression);                          \
+        }                                                                               \
+    } while (0)
+
+#define FL_REQUIRE(expression)                                                          \
+    do {                                                                                \
+        if (!(expression)) {                                                            \
+            ::fl::test::fail(__FILE__, __LINE__, #expression);                          \
+            return;                                                                     \
+        }                                                                               \
+    } while (0)
@@ -0,0 +1,266 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "fl_util.hpp"
+#include "utf8string.hpp"
+#include <map>
+#include <string>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief hashes a key to itself, so a test can pick the group a key starts probing from, `key >> 7`, and
+ * its tag, the low 7 bits
+ */
+struct PlacedHash {
+    size_t operator()(uint64_t key) const noexcept {
+        return static_cast<size_t>(key);
+    }
+};
+
+using PlacedMap = FlatMap<uint64_t, int, PlacedHash>;
+
+/**
+ * @brief a key that starts probing from `group` with the given tag
+ */
+constexpr uint64_t placed(uint64_t group, uint64_t tag) {
+    return (group << 7) | tag;
+}
+
+/**
+ * @brief checks the map holds exactly what the reference does, through lookups and through iteration
+ */
+template <typename Map>
+bool matches(const Map& map, const std::map<uint64_t, int>& reference) {
+    if (map.size() != reference.size()) {
+        return false;
+    }
+    for (const auto& [key, value] : reference) {
+        auto found = map.find(key);
+        if ((found == map.end()) || (found->second != value)) {
+            return false;
+        }
+    }
+    size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        auto expected = reference.find(key);
+        if ((expected == reference.end()) || (expected->second != value)) {
+            return false;
+        }
+        visited++;
+    }
+    return visited == reference.size();
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                        Insert and Erase                                              */
+/*======================================================================================================*/
+
+FL_TEST(insertFindsEveryKey) {
+    FlatMap<uint64_t, int> map;
+    FL_CHECK(map.empty());
+    FL_CHECK(map.find(7) == map.end());
+    FL_CHECK(!map.contains(7));
+
+    FL_CHECK(map.insert({7, 70}).second);
+    FL_CHECK(map.try_emplace(8, 80).second);
+    map[9] = 90;
+    FL_CHECK(map.size() == 3);
+    FL_CHECK(map.find(7)->second == 70);
+    FL_CHECK(map.find(8)->second == 80);
+    FL_CHECK(map.find(9)->second == 90);
+
+    //A key already present keeps the value it had
+    auto [existing, inserted] = map.insert({7, 700});
+    FL_CHECK(!inserted);
+    FL_CHECK(existing->second == 70);
+    FL_CHECK(map.size() == 3);
+}
+
+FL_TEST(eraseRemovesOnlyItsKey) {
+    FlatMap<uint64_t, int> map = {{1, 10}, {2, 20}, {3, 30}};
+    FL_CHECK(map.erase(2) == 1);
+    FL_CHECK(map.erase(2) == 0);
+    FL_CHECK(map.erase(42) == 0);
+    FL_CHECK(map.size() == 2);
+    FL_CHECK(!map.contains(2));
+    FL_CHECK(map.find(1)->second == 10);
+    FL_CHECK(map.find(3)->second == 30);
+
+    //A key can come back after it was erased
+    FL_CHECK(map.insert({2, 200}).second);
+    FL_CHECK(map.find(2)->second == 200);
+}
+
+FL_TEST(stringKeysFindThroughViews) {
+    FlatMap<Utf8String, int> map;
+    map["alpha"_utf8] = 1;
+    map["βeta"_utf8] = 2;
+    const Utf8String text = "alpha βeta"_utf8;
+    const Utf8StringView view = text.view();
+    FL_CHECK(map.find(view.substr(0, 5))->second == 1);
+    FL_CHECK(map.find(view.substr(6, 10))->second == 2);
+    FL_CHECK(map.erase(view.substr(0, 5)) == 1);
+    FL_CHECK(!map.contains("alpha"_utf8));
+}
+
+/*======================================================================================================*/
+/*                                           Tombstones                                                 */
+/*======================================================================================================*/
+
+FL_TEST(tombstonesAreReused) {
+    PlacedMap map;
+    for (uint64_t tag = 0; tag < 4; tag++) {
+        map[placed(0, tag)] = static_cast<int>(tag);
+    }
+    const size_t capacity = map.capacity();
+    const auto* erasedSlot = &*map.find(placed(0, 1));
+    FL_CHECK(map.erase(placed(0, 1)) == 1);
+
+    //The first free slot in the group is the tombstone, so the next key in that group lands right on it
+    map[placed(0, 9)] = 9;
+    FL_CHECK(&*map.find(placed(0, 9)) == erasedSlot);
+    FL_CHECK(map.capacity() == capacity);
+    FL_CHECK(matches(map, {{placed(0, 0), 0}, {placed(0, 2), 2}, {placed(0, 3), 3}, {placed(0, 9), 9}}));
+}
+
+FL_TEST(probesContinuePastTombstones) {
+    //Every key shares a tag and a group, so each one has to be found by probing past the ones before it
+    PlacedMap map;
+    map.reserve(64);
+    std::map<uint64_t, int> reference;
+    for (uint64_t i = 0; i < 20; i++) {
+        const uint64_t key = placed(0, 5) + (i << 20);
+        map[key] = static_cast<int>(i);
+        reference[key] = static_cast<int>(i);
+    }
+    for (uint64_t i = 0; i < 20; i += 2) {
+        const uint64_t key = placed(0, 5) + (i << 20);
+        FL_CHECK(map.erase(key) == 1);
+        reference.erase(key);
+    }
+    FL_CHECK(matches(map, reference));
+}
+
+FL_TEST(churnDoesNotGrowTheTable) {
+    //Tombstones use up the table's growth, and once it runs out a same size rehash clears them instead of doubling
+    FlatMap<uint64_t, int> map;
+    map[0] = 0;
+    const size_t capacity = map.capacity();
+    for (uint64_t key = 1; key < 10000; key++) {
+        map[key] = static_cast<int>(key);
+        FL_REQUIRE(map.erase(key) == 1);
+    }
+    FL_CHECK(map.capacity() == capacity);
+    FL_CHECK(matches(map, {{0, 0}}));
+}
+
+/*======================================================================================================*/
+/*                                            Rehashing                                                 */
+/*======================================================================================================*/
+
+FL_TEST(rehashKeepsEveryEntry) {
+    FlatMap<uint64_t, std::string> map;
+    size_t lastCapacity = map.capacity();
+    size_t rehashes = 0;
+    for (uint64_t key = 0; key < 5000; key++) {
+        map[key * 7919] = std::to_string(key);
+        if (map.capacity() != lastCapacity) {
+            //Capacities are whole groups, doubling each time, and never more than 7/8 full
+            FL_CHECK((map.capacity() % 16) == 0);
+            FL_CHECK((map.capacity() & (map.capacity() - 1)) == 0);
+            lastCapacity = map.capacity();
+            rehashes++;
+        }
+        FL_CHECK(map.size() <= (map.capacity() - map.capacity() / 8));
+    }
+    FL_CHECK(rehashes > 5);
+    FL_CHECK(map.size() == 5000);
+    for (uint64_t key = 0; key < 5000; key++) {
+        auto found = map.find(key * 7919);
+        FL_REQUIRE(found != map.end());
+        FL_CHECK(found->second == std::to_string(key));
+    }
+}
+
+FL_TEST(reserveAvoidsRehashing) {
+    FlatMap<uint64_t, int> map;
+    map.reserve(1000);
+    const size_t capacity = map.capacity();
+    FL_CHECK(capacity >= 1000);
+    for (uint64_t key = 0; key < 1000; key++) {
+        map[key] = static_cast<int>(key);
+    }
+    FL_CHECK(map.capacity() == capacity);
+}
+
+FL_TEST(copiesAndMovesAreIndependent) {
+    FlatMap<uint64_t, std::string> map;
+    for (uint64_t key = 0; key < 100; key++) {
+        map[key] = std::to_string(key);
+    }
+    FlatMap<uint64_t, std::string> copy = map;
+    copy.erase(5);
+    copy[500] = "500";
+    FL_CHECK(map.contains(5));
+    FL_CHECK(!map.contains(500));
+
+    FlatMap<uint64_t, std::string> moved = std::move(copy);
+    FL_CHECK(moved.size() == 100);
+    FL_CHECK(moved.find(500)->second == "500");
+    FL_CHECK(copy.empty());
+    FL_CHECK(copy.find(500) == copy.end());
+}
+
+/*======================================================================================================*/
+/*                                         Group Wraparound                                             */
+/*======================================================================================================*/
+
+FL_TEST(probingWrapsFromTheLastGroup) {
+    //Two groups, where every key starts in the last one, so everything past its 16 slots wraps around to the first
+    PlacedMap map;
+    map.reserve(28);
+    FL_REQUIRE(map.capacity() == 32);
+    std::map<uint64_t, int> reference;
+    for (uint64_t tag = 0; tag < 24; tag++) {
+        map[placed(1, tag)] = static_cast<int>(tag);
+        reference[placed(1, tag)] = static_cast<int>(tag);
+    }
+    FL_CHECK(map.capacity() == 32);
+    FL_CHECK(matches(map, reference));
+
+    //The keys that overflowed sit at the very start of the table, ahead of the group they hash to
+    const auto* first = &*map.begin();
+    for (uint64_t tag = 0; tag < 24; tag++) {
+        const ptrdiff_t slot = &*map.find(placed(1, tag)) - first;
+        FL_CHECK((tag < 16) ? (slot >= 16) : (slot == static_cast<ptrdiff_t>(tag - 16)));
+    }
+
+    //Emptying the last group must not hide the wrapped keys, since its slots are tombstones and not empty
+    for (uint64_t tag = 0; tag < 16; tag++) {
+        FL_CHECK(map.erase(placed(1, tag)) == 1);
+        reference.erase(placed(1, tag));
+    }
+    FL_CHECK(matches(map, reference));
+    FL_CHECK(!map.contains(placed(1, 100)));
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
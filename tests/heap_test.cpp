@@ -0,0 +1,221 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "embed.hpp"
+#include <string>
+#include <vector>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief suspends the calling coroutine, so the host decides when it carries on
+ */
+Suspend waitOn(int64_t token) {
+    return Suspend{.token = token};
+}
+
+/**
+ * @brief the text of a script string, or nothing if the value isn't a string
+ */
+std::string textOf(const Value& value) {
+    return (value.type == ValueType::String) ? value.strVal->text.toUtf8() : std::string();
+}
+
+const Utf8String coroutineSource =
+    "func build(int n) returns str\n"
+    "    let str s = \"\";\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        s = s + \"ab\";\n"
+    "    end\n"
+    "    return s;\n"
+    "end\n"
+    "func churn(int n) returns int\n"
+    "    let int total = 0;\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        let str garbage = build(20);\n"
+    "        total = total + 1;\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n"
+    "func waiter() returns str\n"
+    "    let str kept = build(10);\n"
+    "    let str other = \"x\" + build(3);\n"
+    "    let val sent = pause(1);\n"
+    "    pause(2);\n"
+    "    return kept + other + sent;\n"
+    "end\n"_utf8;
+
+const Utf8String budgetSource =
+    "func grow(int rounds) returns str\n"
+    "    let str s = \"0123456789\";\n"
+    "    for let int i = 0; i < rounds; i++; do\n"
+    "        s = s + s;\n"
+    "    end\n"
+    "    return s;\n"
+    "end\n"
+    "func build(int n) returns str\n"
+    "    let str s = \"\";\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        s = s + \"ab\";\n"
+    "    end\n"
+    "    return s;\n"
+    "end\n"
+    "func churn(int n) returns int\n"
+    "    let int total = 0;\n"
+    "    for let int i = 0; i < n; i++; do\n"
+    "        let str garbage = build(20);\n"
+    "        total = total + 1;\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n"_utf8;
+
+constexpr size_t budgetHardLimit = size_t(1) << 20;
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                     Suspended Coroutines                                             */
+/*======================================================================================================*/
+
+FL_TEST(suspendedCoroutinesKeepTheirStringsThroughCollections) {
+    Engine engine;
+    engine.bind<&waitOn>("pause"_utf8);
+    FL_REQUIRE(!engine.loadSource(coroutineSource).has_value());
+    auto waiter = engine.find<Utf8StringView()>("waiter"_utf8);
+    auto churn = engine.find<int64_t(int64_t)>("churn"_utf8);
+    FL_REQUIRE(waiter.has_value() && churn.has_value());
+
+    auto spawned = engine.spawn(*waiter);
+    FL_REQUIRE(spawned.isOk());
+    const Coroutine coroutine = spawned.okValue();
+    auto first = engine.resume(coroutine);
+    FL_REQUIRE(first.isOk());
+    FL_CHECK(first.okValue().status == CoroutineStatus::Suspended);
+    FL_CHECK(first.okValue().value.intVal == 1);
+
+    //The only references to its strings are in the suspended frame, while other calls fill the nursery
+    const HeapStats before = engine.getVM().getHeapStats();
+    auto churned = engine.call(*churn, 2000);
+    FL_REQUIRE(churned.isOk());
+    FL_CHECK(churned.okValue() == 2000);
+    engine.getVM().collectGarbage();
+    const HeapStats& after = engine.getVM().getHeapStats();
+    FL_CHECK(after.minorCollections > before.minorCollections);
+    FL_CHECK(after.majorCollections > before.majorCollections);
+    FL_CHECK(after.freedObjects > before.freedObjects);
+
+    //Resuming with a string made while it waited, which only the coroutine holds once it is sent
+    auto second = engine.resume(coroutine, "!"_utf8);
+    FL_REQUIRE(second.isOk());
+    FL_CHECK(second.okValue().status == CoroutineStatus::Suspended);
+    FL_CHECK(second.okValue().value.intVal == 2);
+    engine.getVM().collectGarbage();
+    FL_REQUIRE(engine.call(*churn, 500).isOk());
+
+    auto last = engine.resume(coroutine);
+    FL_REQUIRE(last.isOk());
+    FL_CHECK(last.okValue().status == CoroutineStatus::Finished);
+    FL_CHECK(textOf(last.okValue().value) == "abababababababababab" "xababab" "!");
+}
+
+FL_TEST(cancelledCoroutinesFreeTheirStrings) {
+    Engine engine;
+    engine.bind<&waitOn>("pause"_utf8);
+    FL_REQUIRE(!engine.loadSource(coroutineSource).has_value());
+    auto waiter = engine.find<Utf8StringView()>("waiter"_utf8);
+    FL_REQUIRE(waiter.has_value());
+
+    auto spawned = engine.spawn(*waiter);
+    FL_REQUIRE(spawned.isOk());
+    FL_REQUIRE(engine.resume(spawned.okValue()).isOk());
+    engine.getVM().collectGarbage();
+    const size_t held = engine.getVM().getHeapStats().oldObjects;
+    FL_CHECK(held >= 2);
+
+    engine.cancel(spawned.okValue());
+    engine.getVM().collectGarbage();
+    FL_CHECK(engine.getVM().getHeapStats().oldObjects < held);
+    FL_CHECK(!engine.resume(spawned.okValue()).isOk());
+}
+
+/*======================================================================================================*/
+/*                                         Memory Budgets                                               */
+/*======================================================================================================*/
+
+FL_TEST(goingOverTheHardLimitIsARuntimeError) {
+    Engine engine;
+    engine.setMemoryBudget(MemoryBudget{.softLimit = 0, .hardLimit = budgetHardLimit, .onSoftLimit = nullptr});
+    FL_REQUIRE(!engine.loadSource(budgetSource).has_value());
+    auto grow = engine.find<Utf8StringView(int64_t)>("grow"_utf8);
+    FL_REQUIRE(grow.has_value());
+
+    //A few doublings stay well inside the limit, while forty would need terabytes
+    auto small = engine.call(*grow, 4);
+    FL_REQUIRE(small.isOk());
+    FL_CHECK(small.okValue().getLen() == 160);
+    auto result = engine.call(*grow, 40);
+    FL_REQUIRE(!result.isOk());
+    FL_CHECK(result.errValue().toUtf8().find("Script ran out of memory!") != std::string::npos);
+    FL_CHECK(engine.getVM().getMemoryUsage().peak <= budgetHardLimit);
+
+    //Everything the failed call held is garbage, so the isolate can carry on once it is collected
+    engine.getVM().collectGarbage();
+    FL_CHECK(engine.getVM().getMemoryUsage().total < (budgetHardLimit / 2));
+    auto again = engine.call(*grow, 4);
+    FL_REQUIRE(again.isOk());
+    FL_CHECK(again.okValue().getLen() == 160);
+}
+
+FL_TEST(garbageNeverCountsAgainstTheHardLimit) {
+    Engine engine;
+    engine.setMemoryBudget(MemoryBudget{.softLimit = 0, .hardLimit = budgetHardLimit, .onSoftLimit = nullptr});
+    FL_REQUIRE(!engine.loadSource(budgetSource).has_value());
+    auto churn = engine.find<int64_t(int64_t)>("churn"_utf8);
+    FL_REQUIRE(churn.has_value());
+
+    //Allocates several times the limit in total, but never holds more than one small string at once
+    auto result = engine.call(*churn, 5000);
+    FL_REQUIRE(result.isOk());
+    FL_CHECK(result.okValue() == 5000);
+    FL_CHECK(engine.getVM().getHeapStats().allocatedBytes > (budgetHardLimit * 2));
+}
+
+FL_TEST(theSoftLimitCallsBackOncePerCrossing) {
+    Engine engine;
+    std::vector<size_t> crossings;
+    engine.setMemoryBudget(MemoryBudget{
+        .softLimit = budgetHardLimit / 4,
+        .hardLimit = budgetHardLimit,
+        .onSoftLimit = [&](const MemoryUsage& usage) { crossings.push_back(usage.total); }});
+    FL_REQUIRE(!engine.loadSource(budgetSource).has_value());
+    auto grow = engine.find<Utf8StringView(int64_t)>("grow"_utf8);
+    FL_REQUIRE(grow.has_value());
+
+    //Thirteen doublings end on 81920 uChars, which is past the soft limit but well under the hard one
+    FL_REQUIRE(engine.call(*grow, 13).isOk());
+    FL_REQUIRE(crossings.size() == 1);
+    FL_CHECK(crossings[0] > (budgetHardLimit / 4));
+
+    //Collecting brings it back under, which rearms the limit for the next call to cross it again
+    engine.getVM().collectGarbage();
+    FL_REQUIRE(engine.call(*grow, 13).isOk());
+    FL_CHECK(crossings.size() == 2);
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
@@ -0,0 +1,352 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "compiler.hpp"
+#include "embed.hpp"
+#include "ir_passes.hpp"
+#include "tokenizer.hpp"
+#include <string>
+#include <vector>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief everything one compile of a source string left behind, kept together since the AST points into the tokens
+ */
+struct Compiled {
+    Utf8String text;
+    std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    DiagnosticBuffer tokenizerErrors;
+    std::vector<Token> tokens;
+    FlowParser parser;
+    std::optional<Module> module;
+    std::string error;
+};
+
+void compileSource(Compiled& compiled, const std::string& source) {
+    compiled.text = Utf8String(source.data(), source.size());
+    compiled.tokens = tokenize(compiled.text, *compiled.symbols, compiled.tokenizerErrors);
+    if (!compiled.tokenizerErrors.isEmpty() || !compiled.parser.parse(compiled.tokens).isOk()) {
+        compiled.error = "parse failed";
+        return;
+    }
+    Result<Module, Utf8String> module = compile(compiled.parser, compiled.symbols);
+    if (module.isOk()) {
+        compiled.module = std::move(module).okValue();
+    } else {
+        compiled.error = module.errValue().toUtf8();
+    }
+}
+
+/**
+ * @brief compiles a source string that should fail, handing back its error
+ */
+std::string compileError(const std::string& source) {
+    Compiled compiled;
+    compileSource(compiled, source);
+    return compiled.error;
+}
+
+/**
+ * @brief builds the first function in a source string into IR, and runs it through type inference and the
+ * optimization pipeline the way the compiler does
+ */
+std::optional<IRFunction> optimized(Compiled& compiled, const std::string& source) {
+    compiled.text = Utf8String(source.data(), source.size());
+    compiled.tokens = tokenize(compiled.text, *compiled.symbols, compiled.tokenizerErrors);
+    if (!compiled.tokenizerErrors.isEmpty() || !compiled.parser.parse(compiled.tokens).isOk()) {
+        return std::nullopt;
+    }
+    Result<IRFunction, Utf8String> built = buildIR(compiled.parser.getAst(), compiled.parser.getFunctionDecs()[0]);
+    if (!built.isOk()) {
+        return std::nullopt;
+    }
+    IRFunction func = std::move(built).okValue();
+    if (inferTypes(func, ReturnTypeMap()).has_value()) {
+        return std::nullopt;
+    }
+    optimizeIR(func);
+    return func;
+}
+
+/**
+ * @brief every live instruction with the given op, in reachable blocks
+ */
+std::vector<ValueId> liveOps(const IRFunction& func, IROp op) {
+    std::vector<ValueId> found;
+    for (BlockId b : func.rpo) {
+        for (ValueId v : func.blocks[b].insts) {
+            if (!func.insts[v].dead && (func.insts[v].op == op)) {
+                found.push_back(v);
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief checks if a block can reach itself again, which is what puts it inside a loop
+ */
+bool inLoop(const IRFunction& func, BlockId block) {
+    std::vector<bool> seen(func.blocks.size(), false);
+    std::vector<BlockId> work(func.blocks[block].succs.begin(), func.blocks[block].succs.end());
+    while (!work.empty()) {
+        const BlockId next = work.back();
+        work.pop_back();
+        if (next == block) {
+            return true;
+        }
+        if (!seen[next]) {
+            seen[next] = true;
+            work.insert(work.end(), func.blocks[next].succs.begin(), func.blocks[next].succs.end());
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief runs `f(n)` out of a source string through the whole compiler and the VM
+ */
+Result<int64_t, Utf8String> runF(const std::string& source, int64_t n) {
+    Engine engine;
+    auto loadError = engine.loadSource(Utf8String(source.data(), source.size()));
+    if (loadError) {
+        return Result<int64_t, Utf8String>::Err(std::move(loadError).value());
+    }
+    auto entry = engine.find<int64_t(int64_t)>("f"_utf8);
+    if (!entry.has_value()) {
+        return Result<int64_t, Utf8String>::Err("No `f` to call!"_utf8);
+    }
+    return engine.call(*entry, n);
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                          Type Errors                                                 */
+/*======================================================================================================*/
+
+FL_TEST(mismatchedDeclarationsNameTheirLineAndFunction) {
+    const std::string error = compileError(
+        "func helper() returns int\n"
+        "    return 1;\n"
+        "end\n"
+        "func main() returns int\n"
+        "    let int a = 2.5;\n"
+        "    return a;\n"
+        "end\n");
+    FL_CHECK(error == "[L: 5 C: 15] Value does not match its declared type! (in `main`)");
+}
+
+FL_TEST(invalidOperatorsNameTheirLineAndFunction) {
+    const std::string error = compileError(
+        "func first() returns int\n"
+        "    return 1;\n"
+        "end\n"
+        "func second(int n) returns int\n"
+        "    let str s = \"text\";\n"
+        "    return n - s;\n"
+        "end\n");
+    FL_CHECK(error.starts_with("[L: 6 C: "));
+    FL_CHECK(error.ends_with("] Operator can not be used with these types! (in `second`)"));
+}
+
+FL_TEST(errorsInParallelBodiesNameTheOuterFunction) {
+    const std::string error = compileError(
+        "func outer() returns int\n"
+        "    let int total = 0;\n"
+        "    @parallel for let int i = 0; i < 10; i++; do\n"
+        "        let str s = \"x\";\n"
+        "        total += i * s;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n");
+    FL_CHECK(error.starts_with("[L: 5 C: "));
+    FL_CHECK(error.ends_with("(in `outer`)"));
+}
+
+/*======================================================================================================*/
+/*                                        Lowering Errors                                               */
+/*======================================================================================================*/
+
+FL_TEST(undeclaredNamesNameTheirLineAndFunction) {
+    const std::string source =
+        "func first() returns int\n"
+        "    return 1;\n"
+        "end\n"
+        "func second() returns int\n"
+        "    let int a = 1;\n"
+        "    return a + missing;\n"
+        "end\n";
+    FL_CHECK(compileError(source) == "[L: 6 C: 16] Use of an undeclared name! (in `second`)");
+    FL_CHECK(compileError(
+        "func f() returns int\n"
+        "    gone = 2;\n"
+        "    return 0;\n"
+        "end\n") == "[L: 2 C: 5] Assignment to an undeclared name! (in `f`)");
+}
+
+FL_TEST(unknownTypesNameTheirLineAndFunction) {
+    FL_CHECK(compileError(
+        "func f() returns int\n"
+        "    let number a = 1;\n"
+        "    return a;\n"
+        "end\n") == "[L: 2 C: 9] Unknown type name! (in `f`)");
+    FL_CHECK(compileError(
+        "func f(number n) returns int\n"
+        "    return 1;\n"
+        "end\n") == "[L: 1 C: 8] Unknown type name! (in `f`)");
+    FL_CHECK(compileError(
+        "func f() returns number\n"
+        "    return 1;\n"
+        "end\n") == "[L: 1 C: 18] Unknown type name! (in `f`)");
+}
+
+FL_TEST(parallelBodiesNameTheLineTheyBreakARuleOn) {
+    const std::string error = compileError(
+        "func f() returns int\n"
+        "    let int total = 0;\n"
+        "    @parallel for let int i = 0; i < 10; i++; do\n"
+        "        if i > 5 then\n"
+        "            return i;\n"
+        "        end\n"
+        "        total += i;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n");
+    FL_CHECK(error == "[L: 5 C: 13] A parallel loop body can't return out of the function around it! (in `f`)");
+}
+
+/*======================================================================================================*/
+/*                                          Optimization                                                */
+/*======================================================================================================*/
+
+FL_TEST(unusedValuesAreRemoved) {
+    const std::string source =
+        "func f(int n) returns int\n"
+        "    let int unused = n * 7;\n"
+        "    if n > 100 then\n"
+        "        unused = unused * 3;\n"
+        "    end\n"
+        "    return n + 1;\n"
+        "end\n";
+    Compiled compiled;
+    auto func = optimized(compiled, source);
+    FL_REQUIRE(func.has_value());
+    FL_CHECK(liveOps(*func, IROp::Mul).empty());
+    FL_CHECK(liveOps(*func, IROp::Phi).empty());
+    FL_CHECK(runF(source, 4).okValue() == 5);
+    FL_CHECK(runF(source, 200).okValue() == 201);
+}
+
+FL_TEST(repeatedExpressionsShareOneValue) {
+    const std::string source =
+        "func f(int n) returns int\n"
+        "    let int a = n * n + 1;\n"
+        "    let int b = n * n + 1;\n"
+        "    if n > 0 then\n"
+        "        b = b + n * n;\n"
+        "    end\n"
+        "    return a + b;\n"
+        "end\n";
+    Compiled compiled;
+    auto func = optimized(compiled, source);
+    FL_REQUIRE(func.has_value());
+    //`n * n` is computed once in the entry, which dominates its use in the branch
+    FL_CHECK(liveOps(*func, IROp::Mul).size() == 1);
+    FL_CHECK(runF(source, 3).okValue() == 29);
+    FL_CHECK(runF(source, -2).okValue() == 10);
+}
+
+FL_TEST(copiesAndProvenGuardsAreForwarded) {
+    const std::string source =
+        "func f(int n) returns int\n"
+        "    let int a = n;\n"
+        "    let int b = a;\n"
+        "    let int total = 0;\n"
+        "    for let int i = 0; i < 3; i++; do\n"
+        "        total = total + b;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    Compiled compiled;
+    auto func = optimized(compiled, source);
+    FL_REQUIRE(func.has_value());
+    FL_CHECK(liveOps(*func, IROp::Copy).empty());
+
+    //The only guard left is the one checking the untyped parameter, since every later one is proven
+    const std::vector<ValueId> guards = liveOps(*func, IROp::Guard);
+    FL_REQUIRE(guards.size() == 1);
+    FL_CHECK(func->insts[func->insts[guards[0]].args[0]].op == IROp::Param);
+
+    //Only `i` and `total` change in the loop, so `b` never gets a phi and the add reads the checked parameter itself
+    FL_CHECK(liveOps(*func, IROp::Phi).size() == 2);
+    bool readsParam = false;
+    for (ValueId add : liveOps(*func, IROp::Add)) {
+        for (ValueId arg : func->insts[add].args) {
+            readsParam = readsParam || (arg == guards[0]);
+        }
+    }
+    FL_CHECK(readsParam);
+    FL_CHECK(runF(source, 5).okValue() == 15);
+}
+
+FL_TEST(loopInvariantsAreHoisted) {
+    const std::string source =
+        "func f(int n) returns int\n"
+        "    let int total = 0;\n"
+        "    for let int i = 0; i < 10; i++; do\n"
+        "        total = total + n * 3 + i;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    Compiled compiled;
+    auto func = optimized(compiled, source);
+    FL_REQUIRE(func.has_value());
+    const std::vector<ValueId> muls = liveOps(*func, IROp::Mul);
+    FL_REQUIRE(muls.size() == 1);
+    FL_CHECK(!inLoop(*func, func->insts[muls[0]].block));
+    FL_CHECK(runF(source, 2).okValue() == 105);
+}
+
+FL_TEST(conditionalTrapsStayInTheLoop) {
+    //Hoisting the division would raise an error the loop never reaches, when it never runs past the check
+    const std::string source =
+        "func f(int n) returns int\n"
+        "    let int total = 0;\n"
+        "    for let int i = 0; i < 3; i++; do\n"
+        "        if i > 5 then\n"
+        "            total = total + 10 / n;\n"
+        "        end\n"
+        "        total = total + i;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    Compiled compiled;
+    auto func = optimized(compiled, source);
+    FL_REQUIRE(func.has_value());
+    const std::vector<ValueId> divs = liveOps(*func, IROp::Div);
+    FL_REQUIRE(divs.size() == 1);
+    FL_CHECK(inLoop(*func, func->insts[divs[0]].block));
+    auto result = runF(source, 0);
+    FL_REQUIRE(result.isOk());
+    FL_CHECK(result.okValue() == 3);
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
@@ -0,0 +1,155 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "embed.hpp"
+#include "scheduler.hpp"
+#include <memory>
+#include <string>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief checks if some text turns up anywhere in a message
+ */
+bool mentions(const Utf8String& message, const std::string& text) {
+    return message.toUtf8().find(text) != std::string::npos;
+}
+
+/**
+ * @brief loads a script and calls its `main`, splitting parallel loops over `jobs` threads counting the caller
+ */
+Result<int64_t, Utf8String> runMain(const std::string& source, size_t jobs) {
+    Engine engine;
+    engine.setScheduler(std::make_shared<TaskScheduler>(jobs - 1));
+    auto loadError = engine.loadSource(Utf8String(source.data(), source.size()));
+    if (loadError) {
+        return Result<int64_t, Utf8String>::Err(std::move(loadError).value());
+    }
+    auto entry = engine.find<int64_t()>("main"_utf8);
+    if (!entry.has_value()) {
+        return Result<int64_t, Utf8String>::Err("No `main` to call!"_utf8);
+    }
+    return engine.call(*entry);
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                         Error Locations                                              */
+/*======================================================================================================*/
+
+FL_TEST(writingAnOuterNameReportsItsLine) {
+    const std::string source =
+        "func main() returns int\n"
+        "    let int total = 0;\n"
+        "    let int other = 0;\n"
+        "    @parallel for let int i = 0; i < 10; i++; do\n"
+        "        total += i;\n"
+        "        other = i;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    auto result = runMain(source, 1);
+    FL_REQUIRE(!result.isOk());
+    FL_CHECK(mentions(result.errValue(), "[L: 6 C: "));
+    FL_CHECK(mentions(result.errValue(), "can only write to names declared inside of it"));
+}
+
+FL_TEST(updatingThroughAnotherOperatorReportsItsLine) {
+    const std::string source =
+        "func main() returns int\n"
+        "    let int total = 1;\n"
+        "    @parallel for let int i = 1; i < 10; i++; do\n"
+        "        total *= i;\n"
+        "        total += i;\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    auto result = runMain(source, 1);
+    FL_REQUIRE(!result.isOk());
+    FL_CHECK(mentions(result.errValue(), "[L: 3 C: "));
+    FL_CHECK(mentions(result.errValue(), "A reduction must always be updated through the same operator!"));
+}
+
+FL_TEST(runtimeErrorsInABodyNameTheLoopLine) {
+    const std::string source =
+        "func main() returns int\n"
+        "    let int total = 0;\n"
+        "\n"
+        "    @parallel for let int i = 0; i < 10; i++; do\n"
+        "        total += 10 / (i - 5);\n"
+        "    end\n"
+        "    return total;\n"
+        "end\n";
+    for (size_t jobs : {1, 2, 4}) {
+        auto result = runMain(source, jobs);
+        FL_REQUIRE(!result.isOk());
+        FL_CHECK(mentions(result.errValue(), "Integer division by zero!"));
+        FL_CHECK(mentions(result.errValue(), "(in the parallel loop on line 4)"));
+    }
+}
+
+/*======================================================================================================*/
+/*                                           Reductions                                                 */
+/*======================================================================================================*/
+
+FL_TEST(reductionsFoldTheirStartingValueInOnce) {
+    //Each chunk starts from the operator's identity, so the value before the loop must be folded in exactly
+    //once, whichever way the range is split
+    const std::string source =
+        "func main() returns int\n"
+        "    let int added = -1000;\n"
+        "    @parallel for let int i = 0; i < 100; i++; do\n"
+        "        added += i * i;\n"
+        "    end\n"
+        "    let int taken = 40;\n"
+        "    @parallel for let int i = 0; i < 100; i++; do\n"
+        "        taken -= i % 7;\n"
+        "    end\n"
+        "    let int product = -3;\n"
+        "    @parallel for let int i = 0; i < 100; i++; do\n"
+        "        if i < 20 then\n"
+        "            product *= (i % 3) + 1;\n"
+        "        end\n"
+        "    end\n"
+        "    return (product * 1000 + taken) * 1000000 + added;\n"
+        "end\n";
+    int64_t added = -1000;
+    int64_t taken = 40;
+    int64_t product = -3;
+    for (int64_t i = 0; i < 100; i++) {
+        added += i * i;
+        taken -= i % 7;
+    }
+    for (int64_t i = 0; i < 20; i++) {
+        product *= (i % 3) + 1;
+    }
+    //Every result fits in the digits it is given, so a wrong one can't be hidden by another
+    const int64_t expected = (product * 1000 + taken) * 1000000 + added;
+    for (size_t jobs : {1, 2, 4}) {
+        //Repeated, since a chunk that was folded twice or dropped would only show up on some splits
+        for (int run = 0; run < 20; run++) {
+            auto result = runMain(source, jobs);
+            FL_REQUIRE(result.isOk());
+            FL_CHECK(result.okValue() == expected);
+        }
+    }
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
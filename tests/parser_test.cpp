@@ -0,0 +1,166 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "parser.hpp"
+#include "tokenizer.hpp"
+#include "utf8string.hpp"
+#include <string>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief everything one parse of a source string left behind, kept together since the AST points into the tokens
+ */
+struct Parsed {
+    Utf8String text;
+    SymbolTable symbols;
+    DiagnosticBuffer tokenizerErrors;
+    std::vector<Token> tokens;
+    FlowParser parser;
+    bool ok = false;
+};
+
+void parseSource(Parsed& parsed, const std::string& source) {
+    parsed.text = Utf8String(source.data(), source.size());
+    parsed.tokens = tokenize(parsed.text, parsed.symbols, parsed.tokenizerErrors);
+    parsed.ok = parsed.parser.parse(parsed.tokens).isOk();
+}
+
+bool reported(const Parsed& parsed, DiagCode code) {
+    for (const Diagnostic& error : parsed.parser.getDiagnostics()) {
+        if (error.code == code) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                        Function Headers                                              */
+/*======================================================================================================*/
+
+FL_TEST(returnsWithoutATypeIsReported) {
+    Parsed parsed;
+    parseSource(parsed, "func f() returns\nend\n");
+    FL_CHECK(!parsed.ok);
+    FL_REQUIRE(parsed.parser.getDiagnostics().size() == 1);
+    FL_CHECK(parsed.parser.getDiagnostics()[0].code == DiagCode::MissingReturnType);
+    FL_CHECK(parsed.parser.getDiagnostics()[0].line == 1);
+    FL_CHECK(parsed.parser.getFunctionDecs().empty());
+}
+
+FL_TEST(returnsFollowedByEndIsReported) {
+    //The type lands past the function's `end`, where it is a stray top level token of its own
+    Parsed parsed;
+    parseSource(parsed, "func main() returns end int\n");
+    FL_CHECK(!parsed.ok);
+    FL_CHECK(reported(parsed, DiagCode::MissingReturnType));
+    FL_CHECK(reported(parsed, DiagCode::IllegalTopLevelToken));
+}
+
+FL_TEST(parsingResyncsPastABrokenHeader) {
+    Parsed parsed;
+    parseSource(parsed, "func f() returns\nend\n\nfunc g() returns int\n    return 1;\nend\n");
+    FL_CHECK(!parsed.ok);
+    FL_CHECK(parsed.parser.getDiagnostics().size() == 1);
+    FL_CHECK(parsed.parser.getFunctionDecs().size() == 1);
+}
+
+FL_TEST(lazyParsingReportsAMissingReturnType) {
+    Parsed parsed;
+    parsed.text = "func f() returns\nend\n"_utf8;
+    parsed.tokens = tokenize(parsed.text, parsed.symbols, parsed.tokenizerErrors);
+    FL_CHECK(!parsed.parser.parse(parsed.tokens, ParseMode::Lazy).isOk());
+    FL_CHECK(reported(parsed, DiagCode::MissingReturnType));
+}
+
+/*======================================================================================================*/
+/*                                       Diagnostic Batches                                             */
+/*======================================================================================================*/
+
+namespace {
+
+bool inSourceOrder(const DiagnosticBuffer& errors) {
+    for (size_t i = 1; i < errors.size(); i++) {
+        if ((errors[i].line < errors[i - 1].line) || ((errors[i].line == errors[i - 1].line) && (errors[i].column < errors[i - 1].column))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} //end anonymous namespace
+
+FL_TEST(mergedBatchIsInSourceOrder) {
+    //The tokenizer only finds the error on line 4, while the parser only finds the one on line 1
+    Parsed parsed;
+    parseSource(parsed, "func f( returns int\nend\n\nfunc g() returns int\n    let int x = 1 $ 2;\n    return x;\nend\n");
+    FL_REQUIRE(!parsed.tokenizerErrors.isEmpty());
+    FL_REQUIRE(!parsed.parser.getDiagnostics().isEmpty());
+
+    DiagnosticBuffer errors = parsed.tokenizerErrors;
+    errors.append(parsed.parser.getDiagnostics());
+    FL_CHECK(!inSourceOrder(errors));
+    errors.sortByPosition();
+    FL_CHECK(inSourceOrder(errors));
+    FL_CHECK(errors[0].line == 1);
+    FL_CHECK(errors.size() == (parsed.tokenizerErrors.size() + parsed.parser.getDiagnostics().size()));
+}
+
+FL_TEST(parserBatchIsInSourceOrder) {
+    Parsed parsed;
+    parseSource(parsed,
+        "func a() returns int\n    if 1 then\n        let int = ;\n    end\n    return 1;\nend\n"
+        "func b() returns\nend\n"
+        "oops\n"
+        "func c() returns int\n    while do\n    end\n    1 +;\n    return 2;\nend\n");
+    FL_REQUIRE(parsed.parser.getDiagnostics().size() == 5);
+    FL_CHECK(inSourceOrder(parsed.parser.getDiagnostics()));
+}
+
+FL_TEST(sortKeepsReportOrderAtOnePosition) {
+    DiagnosticBuffer errors;
+    errors.report(Diagnostic{.line = 2, .column = 1, .code = DiagCode::UnexpectedTokens});
+    errors.report(Diagnostic{.line = 1, .column = 5, .code = DiagCode::MissingReturnType});
+    errors.report(Diagnostic{.line = 1, .column = 5, .code = DiagCode::MissingParamName});
+    errors.report(Diagnostic{.line = 1, .column = 2, .code = DiagCode::MissingFunctionName});
+    errors.sortByPosition();
+    FL_CHECK(errors[0].code == DiagCode::MissingFunctionName);
+    FL_CHECK(errors[1].code == DiagCode::MissingReturnType);
+    FL_CHECK(errors[2].code == DiagCode::MissingParamName);
+    FL_CHECK(errors[3].code == DiagCode::UnexpectedTokens);
+}
+
+/*======================================================================================================*/
+/*                                              Span                                                    */
+/*======================================================================================================*/
+
+FL_TEST(subspanClampsToItsSpan) {
+    int values[4] = {1, 2, 3, 4};
+    const Span<int> span(values, 4);
+    FL_CHECK(span.subspan(4).size() == 0);
+    FL_CHECK(span.subspan(7).size() == 0);
+    FL_CHECK(span.subspan(2).size() == 2);
+    FL_CHECK(span.subspan(1, 10).size() == 3);
+    FL_CHECK(span.subspan(9, 2).size() == 0);
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
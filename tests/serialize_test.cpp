@@ -0,0 +1,201 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "compiler.hpp"
+#include "serialize.hpp"
+#include "tokenizer.hpp"
+#include "vm.hpp"
+#include <sstream>
+#include <string>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+const char* roundTripSource =
+    "func scale(float x) returns float\n"
+    "    return x * 2.5;\n"
+    "end\n"
+    "func greet(int n) returns str\n"
+    "    let str s = \"héllo\";\n"
+    "    if n > 1 then\n"
+    "        s = s + \" wörld\";\n"
+    "    end\n"
+    "    return s;\n"
+    "end\n"
+    "func main() returns int\n"
+    "    let int total = 7;\n"
+    "    @parallel for let int i = 0; i < 100; i++; do\n"
+    "        total += i;\n"
+    "    end\n"
+    "    let float f = scale(4.0);\n"
+    "    if f == 10.0 then\n"
+    "        total = total + 1;\n"
+    "    end\n"
+    "    return total;\n"
+    "end\n";
+
+/**
+ * @brief compiles a whole source string, keeping the tokens around for as long as the module is in use
+ */
+struct Compiled {
+    Utf8String text;
+    std::shared_ptr<SymbolTable> symbols = std::make_shared<SymbolTable>();
+    DiagnosticBuffer tokenizerErrors;
+    std::vector<Token> tokens;
+    FlowParser parser;
+    std::optional<Module> module;
+};
+
+void compileSource(Compiled& compiled, const std::string& source) {
+    compiled.text = Utf8String(source.data(), source.size());
+    compiled.tokens = tokenize(compiled.text, *compiled.symbols, compiled.tokenizerErrors);
+    if (!compiled.tokenizerErrors.isEmpty() || !compiled.parser.parse(compiled.tokens).isOk()) {
+        return;
+    }
+    Result<Module, Utf8String> module = compile(compiled.parser, compiled.symbols);
+    if (module.isOk()) {
+        compiled.module = std::move(module).okValue();
+    }
+}
+
+std::string written(const Module& module) {
+    std::ostringstream out;
+    FL_CHECK(!writeModule(out, module).has_value());
+    return out.str();
+}
+
+Result<Module, Utf8String> loaded(const std::string& bytes) {
+    std::istringstream in(bytes);
+    return readModule(in);
+}
+
+std::string printed(const Result<Value, Utf8String>& result) {
+    std::ostringstream out;
+    if (result.isOk()) {
+        out << result.okValue();
+    } else {
+        out << "error: " << result.errValue();
+    }
+    return out.str();
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                           Round Trips                                                */
+/*======================================================================================================*/
+
+FL_TEST(loadedModuleRunsLikeTheCompiledOne) {
+    Compiled compiled;
+    compileSource(compiled, roundTripSource);
+    FL_REQUIRE(compiled.module.has_value());
+    Module& original = compiled.module.value();
+
+    Result<Module, Utf8String> reloaded = loaded(written(original));
+    FL_REQUIRE(reloaded.isOk());
+    Module& copy = reloaded.okValue();
+    FL_REQUIRE(!link(copy).has_value());
+    FL_CHECK(copy.functions.size() == original.functions.size());
+
+    //The loaded symbols are a table of their own, but every symbol keeps its number
+    for (const char* name : {"main", "greet", "scale"}) {
+        const Utf8String text(name, std::char_traits<char>::length(name));
+        FL_CHECK(copy.findFunction(text.view()) == original.findFunction(text.view()));
+    }
+
+    VM originalVm(original);
+    VM copyVm(copy);
+    const uint32_t entry = copy.findFunction("main"_utf8).value();
+    const uint32_t greet = copy.findFunction("greet"_utf8).value();
+    FL_CHECK(printed(copyVm.call(entry, {})) == printed(originalVm.call(entry, {})));
+    FL_CHECK(printed(copyVm.call(entry, {})) == "4958");
+    FL_CHECK(printed(copyVm.call(greet, {Value::fromInt(2)})) == printed(originalVm.call(greet, {Value::fromInt(2)})));
+}
+
+FL_TEST(writingIsDeterministic) {
+    Compiled first;
+    Compiled second;
+    compileSource(first, roundTripSource);
+    compileSource(second, roundTripSource);
+    FL_REQUIRE(first.module.has_value() && second.module.has_value());
+    FL_CHECK(written(first.module.value()) == written(second.module.value()));
+}
+
+FL_TEST(loadingAgainWritesTheSameBytes) {
+    Compiled compiled;
+    compileSource(compiled, roundTripSource);
+    FL_REQUIRE(compiled.module.has_value());
+    const std::string bytes = written(compiled.module.value());
+    Result<Module, Utf8String> reloaded = loaded(bytes);
+    FL_REQUIRE(reloaded.isOk());
+    FL_CHECK(written(reloaded.okValue()) == bytes);
+}
+
+/*======================================================================================================*/
+/*                                          Broken Files                                                */
+/*======================================================================================================*/
+
+FL_TEST(badMagicIsRejected) {
+    FL_CHECK(!loaded("").isOk());
+    FL_CHECK(!loaded("FLAST").isOk());
+    FL_CHECK(!loaded("not bytecode at all").isOk());
+}
+
+FL_TEST(otherVersionsAreRejected) {
+    Compiled compiled;
+    compileSource(compiled, roundTripSource);
+    FL_REQUIRE(compiled.module.has_value());
+    std::string bytes = written(compiled.module.value());
+    bytes[4] = static_cast<char>(bytecodeVersion + 1);
+    FL_CHECK(!loaded(bytes).isOk());
+}
+
+FL_TEST(everyTruncationIsRejected) {
+    Compiled compiled;
+    compileSource(compiled, roundTripSource);
+    FL_REQUIRE(compiled.module.has_value());
+    const std::string bytes = written(compiled.module.value());
+    for (size_t len = 0; len < bytes.size(); len++) {
+        FL_CHECK(!loaded(bytes.substr(0, len)).isOk());
+    }
+    FL_CHECK(!loaded(bytes + '\0').isOk());
+}
+
+FL_TEST(outOfRangeOperandsAreRejected) {
+    Compiled compiled;
+    compileSource(compiled, "func main() returns int\n    let int a = 1;\n    return a + 2;\nend\n");
+    FL_REQUIRE(compiled.module.has_value());
+    FunctionProto& proto = compiled.module->functions[0];
+
+    //Any register past the frame is out of range
+    Instruction& ret = proto.code.back();
+    FL_REQUIRE(ret.op == OpCode::Return);
+    const uint16_t returned = ret.a;
+    ret.a = proto.frameSize;
+    FL_CHECK(!loaded(written(compiled.module.value())).isOk());
+    ret.a = returned;
+    FL_CHECK(loaded(written(compiled.module.value())).isOk());
+
+    //As is a constant that doesn't exist, or a jump off the end of the code
+    proto.code.insert(proto.code.begin(), Instruction{.op = OpCode::LoadK, .argc = 0, .a = 0, .b = 0, .c = static_cast<uint16_t>(proto.constants.size())});
+    FL_CHECK(!loaded(written(compiled.module.value())).isOk());
+    proto.code.front() = Instruction{.op = OpCode::Jump, .argc = 0, .a = 0, .b = 0, .c = static_cast<uint16_t>(proto.code.size())};
+    FL_CHECK(!loaded(written(compiled.module.value())).isOk());
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
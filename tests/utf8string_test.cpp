@@ -0,0 +1,291 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "embed.hpp"
+#include "intern.hpp"
+#include "tokenizer.hpp"
+#include "transcode.hpp"
+#include "unicode.hpp"
+#include "utf8string.hpp"
+#include <string>
+#include <utility>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+/**
+ * @brief checks if a string keeps its uChars inside the object, rather than on the heap
+ * @note an empty string hands out a null data pointer, whichever storage it has
+ */
+bool storedInline(const Utf8String& str) {
+    if (str.getCharCount() == 0) {
+        return true;
+    }
+    const char* data = reinterpret_cast<const char*>(str.getDataPointer());
+    const char* object = reinterpret_cast<const char*>(&str);
+    return (data >= object) && (data < (object + sizeof(Utf8String)));
+}
+
+Utf8String fromText(const std::string& text) {
+    return Utf8String(text.data(), text.size());
+}
+
+/**
+ * @brief `count` uChars of text, where every other one takes two bytes of utf8, so byte and uChar counts differ
+ */
+std::string mixedText(size_t count) {
+    std::string text;
+    for (size_t i = 0; i < count; i++) {
+        text += ((i % 2) == 0) ? "a" : "é";
+    }
+    return text;
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                        Inline Boundary                                               */
+/*======================================================================================================*/
+
+FL_TEST(shortStringsStayInline) {
+    static_assert(Utf8String::inlineCapacity == 6);
+    for (size_t count = 0; count <= 10; count++) {
+        const std::string text = mixedText(count);
+        const Utf8String str = fromText(text);
+        FL_CHECK(str.getCharCount() == count);
+        FL_CHECK(storedInline(str) == (count <= Utf8String::inlineCapacity));
+        FL_CHECK(str.toUtf8() == text);
+    }
+}
+
+FL_TEST(theBoundaryCountsUCharsNotBytes) {
+    //Six two byte characters are twelve bytes of utf8, but still only six uChars
+    const Utf8String six = "éééééé"_utf8;
+    FL_CHECK(six.getCharCount() == 6);
+    FL_CHECK(storedInline(six));
+    const Utf8String seven = "ééééééé"_utf8;
+    FL_CHECK(seven.getCharCount() == 7);
+    FL_CHECK(!storedInline(seven));
+}
+
+FL_TEST(concatenationCrossesTheBoundary) {
+    const Utf8String abc = "abc"_utf8;
+    const Utf8String sum6 = abc + "déf"_utf8;
+    FL_CHECK(storedInline(sum6));
+    FL_CHECK(sum6.toUtf8() == "abcdéf");
+    const Utf8String sum7 = sum6 + "g"_utf8;
+    FL_CHECK(!storedInline(sum7));
+    FL_CHECK(sum7.toUtf8() == "abcdéfg");
+    FL_CHECK(sum6.toUtf8() == "abcdéf");
+}
+
+FL_TEST(builtStringsLandOnTheRightSide) {
+    const Utf8String source = "0123456789"_utf8;
+    for (size_t count = 0; count <= 10; count++) {
+        Utf8String built = Utf8String::build(count, [&](uChar* out) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = source[i];
+            }
+            return count;
+        });
+        FL_CHECK(built == source.view(0, count));
+        FL_CHECK(storedInline(built) == (count <= Utf8String::inlineCapacity));
+    }
+}
+
+/*======================================================================================================*/
+/*                                         Copy and Move                                                */
+/*======================================================================================================*/
+
+FL_TEST(copiesOwnTheirStorage) {
+    for (const char* text : {"", "short", "inline", "on the heap"}) {
+        Utf8String original = fromText(text);
+        Utf8String copy = original;
+        FL_CHECK(copy == original.view());
+        FL_CHECK(storedInline(copy) == storedInline(original));
+
+        //Writing through one never shows up in the other
+        if (original.getCharCount() != 0) {
+            FL_CHECK(copy.getDataPointer() != original.getDataPointer());
+            copy[0] = "#"_u;
+            FL_CHECK(original.toUtf8() == text);
+        }
+    }
+}
+
+FL_TEST(copyAssignmentSwitchesForms) {
+    const Utf8String shortText = "tiny"_utf8;
+    const Utf8String longText = "much longer than six"_utf8;
+
+    Utf8String target = shortText;
+    target = longText;
+    FL_CHECK(!storedInline(target));
+    FL_CHECK(target == longText.view());
+
+    //Copying a short string over a long one reuses the heap storage it already has
+    const uChar* data = target.getDataPointer();
+    target = shortText;
+    FL_CHECK(target.getDataPointer() == data);
+    FL_CHECK(target == shortText.view());
+
+    //Assigning a string to itself leaves it as it was, in either form
+    Utf8String large = longText;
+    const Utf8String& alias = large;
+    large = alias;
+    FL_CHECK(large == longText.view());
+    Utf8String small = shortText;
+    const Utf8String& smallAlias = small;
+    small = smallAlias;
+    FL_CHECK(small == shortText.view());
+}
+
+FL_TEST(movingAHeapStringKeepsItsUChars) {
+    Utf8String original = "more than six uChars"_utf8;
+    const uChar* data = original.getDataPointer();
+    Utf8String moved = std::move(original);
+    FL_CHECK(moved.getDataPointer() == data);
+    FL_CHECK(moved.toUtf8() == "more than six uChars");
+    FL_CHECK(original.getCharCount() == 0);
+    FL_CHECK(storedInline(original));
+}
+
+FL_TEST(movingAnInlineStringCopiesItsUChars) {
+    Utf8String original = "sé"_utf8;
+    Utf8String moved = std::move(original);
+    FL_CHECK(storedInline(moved));
+    FL_CHECK(moved.toUtf8() == "sé");
+    FL_CHECK(original.getCharCount() == 0);
+}
+
+FL_TEST(moveAssignmentSwitchesForms) {
+    Utf8String target = "starts out long enough for the heap"_utf8;
+    target = "short"_utf8;
+    FL_CHECK(storedInline(target));
+    FL_CHECK(target.toUtf8() == "short");
+
+    Utf8String longText = "ends up long enough for the heap"_utf8;
+    const uChar* data = longText.getDataPointer();
+    target = std::move(longText);
+    FL_CHECK(!storedInline(target));
+    FL_CHECK(target.getDataPointer() == data);
+    FL_CHECK(target.toUtf8() == "ends up long enough for the heap");
+    FL_CHECK(longText.getCharCount() == 0);
+
+    //A moved from string is still usable in either form
+    longText = "again"_utf8;
+    FL_CHECK(longText.toUtf8() == "again");
+    longText = target;
+    FL_CHECK(longText == target.view());
+}
+
+/*======================================================================================================*/
+/*                                           Decoding                                                   */
+/*======================================================================================================*/
+
+FL_TEST(shortestFormsAtEveryBoundaryDecode) {
+    //The smallest and largest scalar value of every length, and either side of the surrogates
+    const std::pair<const char*, char32_t> cases[] = {
+        {"\x7F", 0x7F}, {"\xC2\x80", 0x80}, {"\xDF\xBF", 0x7FF}, {"\xE0\xA0\x80", 0x800},
+        {"\xED\x9F\xBF", 0xD7FF}, {"\xEE\x80\x80", 0xE000}, {"\xEF\xBF\xBF", 0xFFFF},
+        {"\xF0\x90\x80\x80", 0x10000}, {"\xF4\x8F\xBF\xBF", 0x10FFFF},
+    };
+    for (const auto& [bytes, codePoint] : cases) {
+        auto decoded = fromUtf8(bytes);
+        FL_REQUIRE(decoded.isOk());
+        FL_CHECK(toUtf32(decoded.okValue().view()) == std::u32string(1, codePoint));
+        FL_CHECK(decoded.okValue().toUtf8() == bytes);
+    }
+}
+
+FL_TEST(illFormedSequencesAreRejected) {
+    const char* cases[] = {
+        //Overlong forms, of a nul, an `A`, and the last code points one byte shorter would hold
+        "\xC0\x80", "\xC1\x81", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF",
+        //Encoded surrogates, which only utf16 may use, and only in pairs
+        "\xED\xA0\x80", "\xED\xAF\xBF", "\xED\xB0\x80", "\xED\xBF\xBF",
+        //Past U+10FFFF, including every lead byte that could only start such a sequence
+        "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF6\x80\x80\x80", "\xF7\xBF\xBF\xBF",
+        //Broken structure, which was already rejected
+        "\x80", "\xC3", "\xE2\x82", "\xC3\x28", "\xF8\x88\x80\x80\x80",
+    };
+    for (const char* bytes : cases) {
+        FL_CHECK(!fromUtf8(bytes).isOk());
+        //Wherever it turns up in the text, and however long the ascii run before it is
+        FL_CHECK(!fromUtf8(std::string("abc") + bytes + "def").isOk());
+        FL_CHECK(!fromUtf8(std::string(40, 'a') + bytes).isOk());
+    }
+}
+
+/*======================================================================================================*/
+/*                                        NFC Interning                                                 */
+/*======================================================================================================*/
+
+FL_TEST(canonicallyEquivalentSpellingsShareASymbol) {
+    SymbolTable symbols;
+    //Precomposed and decomposed `é`, and a Hangul syllable against its jamo
+    const Utf8String composed = fromText("caf\xC3\xA9");
+    const Utf8String decomposed = fromText("cafe\xCC\x81");
+    const Utf8String syllable = fromText("\xEA\xB0\x80");
+    const Utf8String jamo = fromText("\xE1\x84\x80\xE1\x85\xA1");
+    FL_CHECK(!(composed == decomposed.view()));
+    FL_CHECK(quickCheckNfc(composed.view()) == NfcCheck::Yes);
+    FL_CHECK(quickCheckNfc(decomposed.view()) != NfcCheck::Yes);
+
+    //Whichever spelling comes first, the table holds the NFC form
+    const Symbol first = symbols.intern(decomposed.view());
+    FL_CHECK(symbols.intern(composed.view()) == first);
+    FL_CHECK(symbols.text(first) == composed.view());
+    FL_CHECK(symbols.intern(syllable.view()) == symbols.intern(jamo.view()));
+    FL_CHECK(symbols.size() == 2);
+    FL_CHECK(symbols.find(decomposed.view()) == std::optional<Symbol>(first));
+}
+
+FL_TEST(tokenizedIdentifiersInternToOneSymbol) {
+    SymbolTable symbols;
+    DiagnosticBuffer errors;
+    const Utf8String source = fromText("caf\xC3\xA9 cafe\xCC\x81 cafe");
+    std::vector<Token> tokens = tokenize(source, symbols, errors);
+    FL_REQUIRE(errors.isEmpty());
+    FL_REQUIRE(tokens.size() >= 3);
+    FL_CHECK(tokens[0].type == TokenType::Identifier);
+    FL_CHECK(tokens[1].type == TokenType::Identifier);
+    FL_CHECK(tokens[0].symbol == tokens[1].symbol);
+    FL_CHECK(tokens[0].symbol != tokens[2].symbol);
+}
+
+FL_TEST(callsResolveAcrossSpellings) {
+    //Declared with a precomposed name and called through the decomposed one
+    const std::string source =
+        "func caf\xC3\xA9(int n) returns int\n"
+        "    return n * 2;\n"
+        "end\n"
+        "func main() returns int\n"
+        "    let int r\xC3\xA9sum\xC3\xA9 = cafe\xCC\x81(21);\n"
+        "    return re\xCC\x81sume\xCC\x81;\n"
+        "end\n";
+    Engine engine;
+    auto loadError = engine.loadSource(fromText(source));
+    FL_REQUIRE(!loadError.has_value());
+    auto entry = engine.find<int64_t()>("main"_utf8);
+    FL_REQUIRE(entry.has_value());
+    auto result = engine.call(*entry);
+    FL_REQUIRE(result.isOk());
+    FL_CHECK(result.okValue() == 42);
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
@@ -0,0 +1,114 @@
+/*
+ __                __                                           
+|_| _    .   /\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\)/.  /--\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+#include "check.hpp"
+#include "embed.hpp"
+#include "value.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+using namespace fl;
+
+/*======================================================================================================*/
+/*                                            Helpers                                                   */
+/*======================================================================================================*/
+
+namespace {
+
+Result<Constant, Utf8String> number(const std::string& text) {
+    const Utf8String str(text.data(), text.size());
+    return constantFromNumber(str.view());
+}
+
+/**
+ * @brief checks that a float literal converts to exactly the double the C library rounds it to
+ */
+bool convertsLikeStrtod(const std::string& text) {
+    auto converted = number(text);
+    if (!converted.isOk() || (converted.okValue().type != ConstantType::Float)) {
+        return false;
+    }
+    const double expected = std::strtod(text.c_str(), nullptr);
+    return std::bit_cast<uint64_t>(converted.okValue().floatVal) == std::bit_cast<uint64_t>(expected);
+}
+
+} //end anonymous namespace
+
+/*======================================================================================================*/
+/*                                         Int Literals                                                 */
+/*======================================================================================================*/
+
+FL_TEST(intLiteralsUpToInt64MaxConvert) {
+    for (const auto& [text, value] : {std::pair<std::string, int64_t>{"0", 0}, {"007", 7}, {"4294967296", 4294967296},
+                                      {"9223372036854775807", INT64_MAX}}) {
+        auto converted = number(text);
+        FL_REQUIRE(converted.isOk());
+        FL_CHECK(converted.okValue().type == ConstantType::Int);
+        FL_CHECK(converted.okValue().intVal == value);
+    }
+}
+
+FL_TEST(intLiteralsPastInt64MaxAreRejected) {
+    //Just past the limit, at the most a uint64 holds and one past it, and far enough out that digits are dropped
+    for (const char* text : {"9223372036854775808", "18446744073709551615", "18446744073709551616",
+                             "99999999999999999999999999999"}) {
+        auto converted = number(text);
+        FL_REQUIRE(!converted.isOk());
+        FL_CHECK(converted.errValue().toUtf8() == "Integer literal is too large!");
+    }
+}
+
+FL_TEST(tooLargeLiteralsNameTheirLine) {
+    Engine engine;
+    auto loadError = engine.loadSource(
+        "func f() returns int\n"
+        "    let int a = 1;\n"
+        "    return a + 9223372036854775808;\n"
+        "end\n"_utf8);
+    FL_REQUIRE(loadError.has_value());
+    FL_CHECK(loadError->toUtf8().find("[L: 3 C: 16] Integer literal is too large! (in `f`)") != std::string::npos);
+}
+
+/*======================================================================================================*/
+/*                                        Float Literals                                                */
+/*======================================================================================================*/
+
+FL_TEST(shortFloatsTakeTheExactPath) {
+    //Mantissas up to 2^53 over powers of ten up to 1e22, where one divide is correctly rounded
+    for (const char* text : {"0.5", "0.1", "2.5", "123.456", "9007199254740.992", "0.0000000000000000000001",
+                             "1234567890123456.0"}) {
+        FL_CHECK(convertsLikeStrtod(text));
+    }
+    FL_CHECK(number("0.1").okValue().floatVal == 0.1);
+}
+
+FL_TEST(longFloatsFallBackAndStillRoundCorrectly) {
+    //A mantissa one past 2^53, an exponent one past 1e-22, and mantissas too long for a uint64
+    for (const char* text : {"9007199254740.993", "0.00000000000000000000001", "3.14159265358979323846264338327950288",
+                             "123456789012345678901234567890.5", "0.30000000000000000000000000000000000001"}) {
+        FL_CHECK(convertsLikeStrtod(text));
+    }
+    FL_CHECK(convertsLikeStrtod("1" + std::string(308, '0') + ".0"));
+    FL_CHECK(convertsLikeStrtod("0." + std::string(320, '0') + "5"));
+}
+
+FL_TEST(malformedNumbersAreRejected) {
+    for (const char* text : {"", "1.2.3", "1..2", "12a"}) {
+        auto converted = number(text);
+        FL_REQUIRE(!converted.isOk());
+        FL_CHECK(converted.errValue().toUtf8() == "Malformed number literal!");
+    }
+}
+
+int main() {
+    return ::fl::test::runAll();
+}
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+#
+# FlowLang unicode table generator
+#
+# Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+# This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+#
+# Regenerates src/unicode_tables.cpp, the XID_Start and XID_Continue tables used by the tokenizer, and
+# the canonical combining classes, NFC quick check values, decompositions and compositions used to
+# normalize interned text.
+# The properties come from the unicode database bundled with python, which python's own identifier
+# rules are built on, so running this under a newer python picks up a newer unicode version.
+#
+# The tables split every code point into a 64 code point block and a bit inside it. Blocks are looked
+# up through `blockIndex`, and identical blocks are only stored once in `blockBits`, which keeps the
+# whole thing to a few tens of kilobytes. A block is exactly the span of one trailing utf8 byte, so the
+# block number and bit come straight out of a packed uChar with masks and shifts. The normalization
+# properties use the same blocks, with one 16 bit entry per code point instead of one bit.
+#
+# usage: python3 tools/gen_unicode_tables.py [output path]
+
+import os
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+BLOCK_BITS = 6
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+
+def xid_start(cp):
+    return (not is_surrogate(cp)) and chr(cp).isidentifier() and cp != ord('_')
+
+
+def xid_continue(cp):
+    return (not is_surrogate(cp)) and ('a' + chr(cp)).isidentifier()
+
+
+def canonical_mapping(cp):
+    if is_surrogate(cp):
+        return None
+    mapping = unicodedata.decomposition(chr(cp))
+    if (not mapping) or mapping.startswith('<'):
+        return None
+    return [int(part, 16) for part in mapping.split()]
+
+
+def full_decomposition(cp):
+    mapping = canonical_mapping(cp)
+    if mapping is None:
+        return [cp]
+    out = []
+    for part in mapping:
+        out.extend(full_decomposition(part))
+    return out
+
+
+def build_normalization():
+    #Primary composites are the pairs that NFC puts back together, which leaves out every exclusion
+    compositions = {}
+    for cp in range(MAX_CODE_POINT):
+        mapping = canonical_mapping(cp)
+        if mapping and len(mapping) == 2 and unicodedata.normalize('NFC', ''.join(map(chr, mapping))) == chr(cp):
+            compositions[(mapping[0], mapping[1])] = cp
+    seconds = {pair[1] for pair in compositions}
+
+    #Low 8 bits are the combining class, then NFC_QC=No, then NFC_QC=Maybe
+    props = []
+    for cp in range(MAX_CODE_POINT):
+        if is_surrogate(cp):
+            props.append(0)
+            continue
+        ch = chr(cp)
+        value = unicodedata.combining(ch)
+        if unicodedata.normalize('NFC', ch) != ch:
+            value |= 1 << 8
+        elif (cp in seconds) or (0x1161 <= cp <= 0x1175) or (0x11A8 <= cp <= 0x11C2):
+            value |= 1 << 9
+        props.append(value)
+
+    decompositions = []
+    for cp in range(MAX_CODE_POINT):
+        #Hangul syllables are decomposed by formula instead
+        if 0xAC00 <= cp <= 0xD7A3:
+            continue
+        if canonical_mapping(cp) is not None:
+            decompositions.append((cp, full_decomposition(cp)))
+    return props, decompositions, sorted(compositions.items())
+
+
+def dedupe_blocks(values):
+    unique = {}
+    blocks = []
+    index = []
+    for base in range(0, len(values), BLOCK_SIZE):
+        block = tuple(values[base:base + BLOCK_SIZE])
+        if block not in unique:
+            unique[block] = len(blocks)
+            blocks.append(block)
+        index.append(unique[block])
+    empty = unique.get(tuple([0] * BLOCK_SIZE), -1)
+    used = max(i for i, entry in enumerate(index) if entry != empty) + 1
+    return index[:used], blocks
+
+
+def build_bits(predicate):
+    blocks = []
+    for base in range(0, MAX_CODE_POINT, BLOCK_SIZE):
+        bits = 0
+        for offset in range(BLOCK_SIZE):
+            if predicate(base + offset):
+                bits |= 1 << offset
+        blocks.append(bits)
+    return blocks
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'src', 'unicode_tables.cpp')
+
+    start = build_bits(xid_start)
+    cont = build_bits(xid_continue)
+
+    #Both properties share one index, each entry naming a pair of unique bitmaps
+    unique = {}
+    pairs = []
+    index = []
+    for pair in zip(start, cont):
+        if pair not in unique:
+            unique[pair] = len(pairs)
+            pairs.append(pair)
+        index.append(unique[pair])
+
+    #Everything past the last block with any identifier code points is left out of the index
+    used_blocks = max(i for i, entry in enumerate(index) if entry != unique.get((0, 0), -1)) + 1
+    index = index[:used_blocks]
+    #The index types are fixed by the declarations in include/unicode.hpp
+    index_type = 'uint16_t'
+    assert len(pairs) <= 0x10000
+
+    props, decompositions, compositions = build_normalization()
+    norm_index, norm_blocks = dedupe_blocks(props)
+    norm_index_type = 'uint8_t'
+    assert len(norm_blocks) <= 0x100, 'widen normalizationBlockIndex in include/unicode.hpp'
+    decomp_data = []
+    decomp_keys = []
+    decomp_ranges = []
+    for cp, parts in decompositions:
+        decomp_keys.append(cp)
+        decomp_ranges.append((len(decomp_data) << 8) | len(parts))
+        decomp_data.extend(parts)
+
+    def rows(values, per_row, fmt):
+        lines = []
+        for i in range(0, len(values), per_row):
+            lines.append('    ' + ', '.join(fmt(v) for v in values[i:i + per_row]) + ',')
+        return '\n'.join(lines)
+
+    ascii_flags = []
+    for cp in range(128):
+        flags = 0
+        if xid_start(cp) or cp == ord('_'):
+            flags |= 1
+        if xid_continue(cp):
+            flags |= 2
+        ascii_flags.append(flags)
+
+    text = f'''/*
+ __                __                                           
+|_| _    .   /\\   (_  _ _. _ |_. _  _   |   _  _  _     _  _  _ 
+| |(_)\\)/.  /--\\  __)(_| ||_)|_|| )(_)  |__(_|| )(_)|_|(_|(_)(- 
+                          |        _/            _/       _/    
+
+Copyright (c) 2025 Moose Abou-Harb All rights reserved.
+This software is licensed under the BSD 3-Clause License, which can be found in the accompanying LICENSE file.
+*/
+
+//GENERATED by tools/gen_unicode_tables.py from unicode {unicodedata.unidata_version}, do not edit by hand
+
+#include "unicode.hpp"
+
+namespace fl::detail {{
+
+const uint8_t asciiIdentifierFlags[128] = {{
+{rows(ascii_flags, 16, str)}
+}};
+
+const size_t identifierBlockCount = {used_blocks};
+
+const {index_type} identifierBlockIndex[{used_blocks}] = {{
+{rows(index, 24, str)}
+}};
+
+const uint64_t xidStartBits[{len(pairs)}] = {{
+{rows([p[0] for p in pairs], 4, lambda v: f'0x{v:016X}ull')}
+}};
+
+const uint64_t xidContinueBits[{len(pairs)}] = {{
+{rows([p[1] for p in pairs], 4, lambda v: f'0x{v:016X}ull')}
+}};
+
+const size_t normalizationBlockCount = {len(norm_index)};
+
+const {norm_index_type} normalizationBlockIndex[{len(norm_index)}] = {{
+{rows(norm_index, 24, str)}
+}};
+
+const uint16_t normalizationProps[{len(norm_blocks) * BLOCK_SIZE}] = {{
+{rows([v for block in norm_blocks for v in block], 16, lambda v: f'0x{v:03X}')}
+}};
+
+const size_t decompositionCount = {len(decomp_keys)};
+
+const uint32_t decompositionKeys[{len(decomp_keys)}] = {{
+{rows(decomp_keys, 12, lambda v: f'0x{v:05X}')}
+}};
+
+//Each entry is the offset into `decompositionData` shifted up by 8, and the length in the low byte
+const uint32_t decompositionRanges[{len(decomp_ranges)}] = {{
+{rows(decomp_ranges, 12, lambda v: f'0x{v:06X}')}
+}};
+
+const uint32_t decompositionData[{len(decomp_data)}] = {{
+{rows(decomp_data, 12, lambda v: f'0x{v:05X}')}
+}};
+
+const size_t compositionCount = {len(compositions)};
+
+//Each key is the first code point shifted up by 32, and the second in the low 32 bits
+const uint64_t compositionKeys[{len(compositions)}] = {{
+{rows([(a << 32) | b for (a, b), _ in compositions], 6, lambda v: f'0x{v:013X}ull')}
+}};
+
+const uint32_t compositionValues[{len(compositions)}] = {{
+{rows([v for _, v in compositions], 12, lambda v: f'0x{v:05X}')}
+}};
+
+}} //end namespace fl::detail
+'''
+    with open(out_path, 'w', newline='\n') as out:
+        out.write(text)
+    print(f'wrote {out_path}: {used_blocks} identifier blocks, {len(pairs)} unique ({index_type} index), '
+          f'{len(norm_index)} normalization blocks, {len(norm_blocks)} unique ({norm_index_type} index), '
+          f'{len(decomp_keys)} decompositions, {len(compositions)} compositions')
+
+
+if __name__ == '__main__':
+    main()